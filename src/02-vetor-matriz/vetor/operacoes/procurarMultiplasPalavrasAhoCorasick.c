@@ -0,0 +1,601 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * Programa de exemplo para busca de MÚLTIPLAS palavras em uma única passada
+ * usando o autômato de Aho-Corasick
+ *
+ * As funções de procurarPalavraStringH.c e procurarPalavraSemStringH.c
+ * buscam uma palavra por vez: procurar 10.000 termos de uma lista de
+ * bloqueio significa percorrer o texto 10.000 vezes. O Aho-Corasick
+ * constrói um autômato a partir de todos os padrões e encontra TODAS as
+ * ocorrências de TODOS eles percorrendo o texto uma única vez:
+ *
+ *   Força bruta (k palavras):  O(k * n * m)
+ *   Aho-Corasick:              O(n + total_dos_padroes + ocorrencias)
+ *
+ * Organização da tabela de transições (compacta e amigável à cache):
+ * - Raiz: tabela DENSA de 256 posições (é o estado mais visitado,
+ *   então cada byte do texto resolve sua transição com um único acesso)
+ * - Demais estados: tabela ESPARSA, com as arestas de cada estado
+ *   guardadas de forma contígua e ordenada por caractere em dois vetores
+ *   globais (caracteres e destinos). Os estados são renumerados em ordem
+ *   de largura (BFS), de modo que estados próximos ficam próximos na memória.
+ *
+ * Operações implementadas:
+ * 1. Construção do autômato (trie + links de falha + links de saída)
+ * 2. Busca de todas as ocorrências em uma única passada
+ * 3. Busca em fluxo (streaming): o texto pode chegar em blocos e
+ *    ocorrências que atravessam a fronteira entre blocos são encontradas
+ * 4. Comparação de desempenho com a busca palavra por palavra (strstr)
+ *
+ * Compilação:
+ *   gcc -Wall -Wextra -std=c99 -O2 -o ahocorasick procurarMultiplasPalavrasAhoCorasick.c
+ */
+
+// Número máximo de arestas para busca linear; acima disso usa busca binária
+#define LIMITE_BUSCA_LINEAR 8
+
+// Estado do autômato compilado
+typedef struct {
+    int inicioArestas;   // Índice da primeira aresta em arestaCaractere/arestaDestino
+    int numArestas;      // Quantidade de arestas (ordenadas por caractere)
+    int falha;           // Link de falha (maior sufixo próprio que é prefixo de algum padrão)
+    int saidaLink;       // Próximo estado na cadeia de falha que possui saída (-1 se nenhum)
+    int primeiroPadrao;  // Primeiro padrão que termina neste estado (-1 se nenhum)
+} EstadoAC;
+
+// Autômato de Aho-Corasick
+typedef struct {
+    int raiz[256];                  // Transições densas da raiz (sempre definidas)
+    EstadoAC* estados;              // Estados em ordem BFS (estado 0 = raiz)
+    int numEstados;
+    unsigned char* arestaCaractere; // Caracteres das arestas (contíguos por estado)
+    int* arestaDestino;             // Destinos das arestas
+    int numArestas;
+    char** padroes;                 // Cópia dos padrões
+    int* tamanhoPadrao;
+    int* proximoPadrao;             // Padrões duplicados que terminam no mesmo estado
+    int numPadroes;
+} AhoCorasick;
+
+// Estado de uma busca em fluxo (permite processar o texto em blocos)
+typedef struct {
+    int estado;              // Estado atual do autômato
+    long long deslocamento;  // Quantos bytes já foram processados
+} FluxoAC;
+
+// Função chamada para cada ocorrência encontrada
+// Parâmetros:
+// - padrao: índice do padrão encontrado
+// - inicio: posição (absoluta no fluxo) do primeiro caractere da ocorrência
+// - contexto: ponteiro repassado pelo usuário
+typedef void (*CallbackOcorrencia)(int padrao, long long inicio, void* contexto);
+
+// ==================== TRIE TEMPORÁRIA DE CONSTRUÇÃO ====================
+
+// Nó da trie usada apenas durante a construção (filho/irmão, ordenado)
+typedef struct {
+    int primeiroFilho;
+    int proximoIrmao;
+    unsigned char caractere;
+    int primeiroPadrao;
+} NoTrie;
+
+typedef struct {
+    NoTrie* nos;
+    int quantidade;
+    int capacidade;
+} TrieConstrucao;
+
+static int novoNoTrie(TrieConstrucao* trie, unsigned char caractere) {
+    if (trie->quantidade == trie->capacidade) {
+        int novaCapacidade = trie->capacidade * 2;
+        NoTrie* novos = realloc(trie->nos, novaCapacidade * sizeof(NoTrie));
+        if (novos == NULL) {
+            return -1;
+        }
+        trie->nos = novos;
+        trie->capacidade = novaCapacidade;
+    }
+
+    int id = trie->quantidade++;
+    trie->nos[id].primeiroFilho = -1;
+    trie->nos[id].proximoIrmao = -1;
+    trie->nos[id].caractere = caractere;
+    trie->nos[id].primeiroPadrao = -1;
+    return id;
+}
+
+// Retorna o filho de 'no' com o caractere dado, criando-o (em ordem) se necessário
+static int filhoOuCria(TrieConstrucao* trie, int no, unsigned char caractere) {
+    int anterior = -1;
+    int atual = trie->nos[no].primeiroFilho;
+
+    while (atual != -1 && trie->nos[atual].caractere < caractere) {
+        anterior = atual;
+        atual = trie->nos[atual].proximoIrmao;
+    }
+
+    if (atual != -1 && trie->nos[atual].caractere == caractere) {
+        return atual;
+    }
+
+    int novo = novoNoTrie(trie, caractere);
+    if (novo == -1) {
+        return -1;
+    }
+
+    trie->nos[novo].proximoIrmao = atual;
+    if (anterior == -1) {
+        trie->nos[no].primeiroFilho = novo;
+    } else {
+        trie->nos[anterior].proximoIrmao = novo;
+    }
+    return novo;
+}
+
+// ==================== AUTÔMATO COMPILADO ====================
+
+// Procura a aresta de 'estado' com o caractere dado
+// Retorna:
+// - Estado de destino, ou -1 se não houver aresta
+static inline int procurarAresta(const AhoCorasick* ac, int estado, unsigned char caractere) {
+    const EstadoAC* e = &ac->estados[estado];
+    const unsigned char* chars = ac->arestaCaractere + e->inicioArestas;
+    int n = e->numArestas;
+
+    if (n <= LIMITE_BUSCA_LINEAR) {
+        for (int i = 0; i < n; i++) {
+            if (chars[i] == caractere) {
+                return ac->arestaDestino[e->inicioArestas + i];
+            }
+        }
+        return -1;
+    }
+
+    int esquerda = 0;
+    int direita = n - 1;
+    while (esquerda <= direita) {
+        int meio = (esquerda + direita) / 2;
+        if (chars[meio] == caractere) {
+            return ac->arestaDestino[e->inicioArestas + meio];
+        }
+        if (chars[meio] < caractere) {
+            esquerda = meio + 1;
+        } else {
+            direita = meio - 1;
+        }
+    }
+    return -1;
+}
+
+// Calcula a próxima transição seguindo os links de falha quando necessário
+static inline int transicao(const AhoCorasick* ac, int estado, unsigned char caractere) {
+    while (estado != 0) {
+        int destino = procurarAresta(ac, estado, caractere);
+        if (destino != -1) {
+            return destino;
+        }
+        estado = ac->estados[estado].falha;
+    }
+    return ac->raiz[caractere];
+}
+
+// Libera toda a memória do autômato
+void liberarAhoCorasick(AhoCorasick* ac) {
+    if (ac == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < ac->numPadroes; i++) {
+        free(ac->padroes[i]);
+    }
+    free(ac->padroes);
+    free(ac->tamanhoPadrao);
+    free(ac->proximoPadrao);
+    free(ac->estados);
+    free(ac->arestaCaractere);
+    free(ac->arestaDestino);
+    free(ac);
+}
+
+// Função para construir o autômato a partir de uma lista de padrões
+// Parâmetros:
+// - padroes: vetor de strings a serem procuradas (padrões vazios são ignorados)
+// - numPadroes: quantidade de padrões
+// Retorna:
+// - Ponteiro para o autômato construído
+// - NULL em caso de erro de alocação
+AhoCorasick* construirAhoCorasick(const char* padroes[], int numPadroes) {
+    if (padroes == NULL || numPadroes < 0) {
+        return NULL;
+    }
+
+    AhoCorasick* ac = calloc(1, sizeof(AhoCorasick));
+    TrieConstrucao trie = { malloc(64 * sizeof(NoTrie)), 0, 64 };
+    int* ordem = NULL;
+    int* novoId = NULL;
+
+    if (ac == NULL || trie.nos == NULL) {
+        goto erro;
+    }
+
+    ac->numPadroes = numPadroes;
+    ac->padroes = calloc(numPadroes > 0 ? numPadroes : 1, sizeof(char*));
+    ac->tamanhoPadrao = calloc(numPadroes > 0 ? numPadroes : 1, sizeof(int));
+    ac->proximoPadrao = malloc((numPadroes > 0 ? numPadroes : 1) * sizeof(int));
+    if (ac->padroes == NULL || ac->tamanhoPadrao == NULL || ac->proximoPadrao == NULL) {
+        goto erro;
+    }
+
+    // 1. Inserir todos os padrões na trie de construção
+    novoNoTrie(&trie, 0); // raiz
+    for (int p = 0; p < numPadroes; p++) {
+        size_t tamanho = strlen(padroes[p]);
+        ac->padroes[p] = malloc(tamanho + 1);
+        if (ac->padroes[p] == NULL) {
+            goto erro;
+        }
+        memcpy(ac->padroes[p], padroes[p], tamanho + 1);
+        ac->tamanhoPadrao[p] = (int)tamanho;
+        ac->proximoPadrao[p] = -1;
+
+        if (tamanho == 0) {
+            continue;
+        }
+
+        int no = 0;
+        for (size_t i = 0; i < tamanho; i++) {
+            no = filhoOuCria(&trie, no, (unsigned char)padroes[p][i]);
+            if (no == -1) {
+                goto erro;
+            }
+        }
+        ac->proximoPadrao[p] = trie.nos[no].primeiroPadrao;
+        trie.nos[no].primeiroPadrao = p;
+    }
+
+    // 2. Renumerar os nós em ordem de largura (BFS)
+    int n = trie.quantidade;
+    ordem = malloc(n * sizeof(int));
+    novoId = malloc(n * sizeof(int));
+    ac->estados = malloc(n * sizeof(EstadoAC));
+    ac->arestaCaractere = malloc(n > 1 ? (size_t)(n - 1) : 1);
+    ac->arestaDestino = malloc((n > 1 ? (size_t)(n - 1) : 1) * sizeof(int));
+    if (ordem == NULL || novoId == NULL || ac->estados == NULL ||
+        ac->arestaCaractere == NULL || ac->arestaDestino == NULL) {
+        goto erro;
+    }
+
+    int cabeca = 0;
+    int cauda = 0;
+    ordem[cauda++] = 0;
+    while (cabeca < cauda) {
+        int no = ordem[cabeca++];
+        novoId[no] = cabeca - 1;
+        for (int f = trie.nos[no].primeiroFilho; f != -1; f = trie.nos[f].proximoIrmao) {
+            ordem[cauda++] = f;
+        }
+    }
+
+    // 3. Copiar arestas de forma contígua (já ordenadas por caractere)
+    ac->numEstados = n;
+    ac->numArestas = 0;
+    for (int s = 0; s < n; s++) {
+        int no = ordem[s];
+        EstadoAC* e = &ac->estados[s];
+        e->inicioArestas = ac->numArestas;
+        e->numArestas = 0;
+        e->falha = 0;
+        e->saidaLink = -1;
+        e->primeiroPadrao = trie.nos[no].primeiroPadrao;
+
+        for (int f = trie.nos[no].primeiroFilho; f != -1; f = trie.nos[f].proximoIrmao) {
+            ac->arestaCaractere[ac->numArestas] = trie.nos[f].caractere;
+            ac->arestaDestino[ac->numArestas] = novoId[f];
+            ac->numArestas++;
+            e->numArestas++;
+        }
+    }
+
+    // 4. Tabela densa da raiz
+    for (int c = 0; c < 256; c++) {
+        ac->raiz[c] = 0;
+    }
+    for (int i = 0; i < ac->estados[0].numArestas; i++) {
+        ac->raiz[ac->arestaCaractere[i]] = ac->arestaDestino[i];
+    }
+
+    // 5. Links de falha e de saída: como os estados estão em ordem BFS,
+    //    o link de falha de um estado sempre aponta para um estado anterior
+    for (int s = 0; s < n; s++) {
+        EstadoAC* e = &ac->estados[s];
+        for (int i = 0; i < e->numArestas; i++) {
+            unsigned char c = ac->arestaCaractere[e->inicioArestas + i];
+            int destino = ac->arestaDestino[e->inicioArestas + i];
+
+            int falha = (s == 0) ? 0 : transicao(ac, e->falha, c);
+            ac->estados[destino].falha = falha;
+            ac->estados[destino].saidaLink = (ac->estados[falha].primeiroPadrao != -1)
+                                             ? falha
+                                             : ac->estados[falha].saidaLink;
+        }
+    }
+
+    free(ordem);
+    free(novoId);
+    free(trie.nos);
+    return ac;
+
+erro:
+    free(ordem);
+    free(novoId);
+    free(trie.nos);
+    if (ac != NULL) {
+        liberarAhoCorasick(ac);
+    }
+    return NULL;
+}
+
+// Reporta todas as ocorrências que terminam no estado dado
+static inline int reportarSaidas(const AhoCorasick* ac, int estado, long long fim,
+                                 CallbackOcorrencia callback, void* contexto) {
+    int total = 0;
+
+    if (ac->estados[estado].primeiroPadrao == -1) {
+        estado = ac->estados[estado].saidaLink;
+    }
+
+    while (estado != -1) {
+        for (int p = ac->estados[estado].primeiroPadrao; p != -1; p = ac->proximoPadrao[p]) {
+            if (callback != NULL) {
+                callback(p, fim - ac->tamanhoPadrao[p] + 1, contexto);
+            }
+            total++;
+        }
+        estado = ac->estados[estado].saidaLink;
+    }
+
+    return total;
+}
+
+// Inicializa (ou reinicia) uma busca em fluxo
+void iniciarFluxoAC(FluxoAC* fluxo) {
+    fluxo->estado = 0;
+    fluxo->deslocamento = 0;
+}
+
+// Função para processar um bloco de texto em uma busca em fluxo
+// Parâmetros:
+// - ac: autômato construído
+// - fluxo: estado da busca (mantido entre blocos)
+// - bloco: bytes do bloco atual (não precisa terminar em '\0')
+// - tamanho: quantidade de bytes do bloco
+// - callback: função chamada para cada ocorrência (pode ser NULL)
+// - contexto: ponteiro repassado ao callback
+// Retorna:
+// - Número de ocorrências encontradas neste bloco
+long long processarBlocoAC(const AhoCorasick* ac, FluxoAC* fluxo,
+                           const char* bloco, size_t tamanho,
+                           CallbackOcorrencia callback, void* contexto) {
+    if (ac == NULL || fluxo == NULL || bloco == NULL) {
+        return 0;
+    }
+
+    long long total = 0;
+    int estado = fluxo->estado;
+    long long base = fluxo->deslocamento;
+
+    for (size_t i = 0; i < tamanho; i++) {
+        unsigned char c = (unsigned char)bloco[i];
+
+        // Caminho rápido: na raiz a transição é um único acesso à tabela densa
+        estado = (estado == 0) ? ac->raiz[c] : transicao(ac, estado, c);
+
+        if (ac->estados[estado].primeiroPadrao != -1 || ac->estados[estado].saidaLink != -1) {
+            total += reportarSaidas(ac, estado, base + (long long)i, callback, contexto);
+        }
+    }
+
+    fluxo->estado = estado;
+    fluxo->deslocamento = base + (long long)tamanho;
+    return total;
+}
+
+// Função para buscar todas as ocorrências de todos os padrões em um texto
+// Parâmetros:
+// - ac: autômato construído
+// - texto: string terminada em '\0'
+// - callback: função chamada para cada ocorrência (pode ser NULL)
+// - contexto: ponteiro repassado ao callback
+// Retorna:
+// - Número total de ocorrências (ocorrências sobrepostas são contadas)
+long long procurarTodasAC(const AhoCorasick* ac, const char* texto,
+                          CallbackOcorrencia callback, void* contexto) {
+    if (ac == NULL || texto == NULL) {
+        return 0;
+    }
+
+    FluxoAC fluxo;
+    iniciarFluxoAC(&fluxo);
+    return processarBlocoAC(ac, &fluxo, texto, strlen(texto), callback, contexto);
+}
+
+// ==================== DEMONSTRAÇÕES ====================
+
+typedef struct {
+    const AhoCorasick* ac;
+    const char* texto;
+} ContextoImpressao;
+
+static void imprimirOcorrencia(int padrao, long long inicio, void* contexto) {
+    ContextoImpressao* ctx = (ContextoImpressao*)contexto;
+    printf("   - \"%s\" na posição %lld\n", ctx->ac->padroes[padrao], inicio);
+}
+
+typedef struct {
+    long long soma;   // Soma de (padrão + posição), usada para comparar resultados
+    long long total;
+} ContextoChecksum;
+
+static void acumularOcorrencia(int padrao, long long inicio, void* contexto) {
+    ContextoChecksum* ctx = (ContextoChecksum*)contexto;
+    ctx->soma += (long long)padrao * 1000003LL + inicio;
+    ctx->total++;
+}
+
+void demonstrarBuscaMultipla() {
+    printf("=== DEMONSTRAÇÃO DE BUSCA MÚLTIPLA (AHO-CORASICK) ===\n\n");
+
+    const char* texto = "Programacao em C e uma linguagem de programacao poderosa. "
+                       "A programacao estruturada facilita o desenvolvimento.";
+    const char* padroes[] = { "programacao", "gram", "em", "linguagem", "ao", "a p" };
+    int numPadroes = sizeof(padroes) / sizeof(padroes[0]);
+
+    printf("Texto de exemplo:\n\"%s\"\n\n", texto);
+    printf("Padrões: ");
+    for (int i = 0; i < numPadroes; i++) {
+        printf("\"%s\"%s", padroes[i], i + 1 < numPadroes ? ", " : "\n\n");
+    }
+
+    AhoCorasick* ac = construirAhoCorasick(padroes, numPadroes);
+    if (ac == NULL) {
+        printf("Erro ao construir o autômato\n");
+        return;
+    }
+
+    printf("Autômato: %d estados, %d arestas (raiz densa com 256 entradas)\n\n",
+           ac->numEstados, ac->numArestas);
+
+    printf("1. TODAS AS OCORRÊNCIAS EM UMA ÚNICA PASSADA:\n");
+    ContextoImpressao ctx = { ac, texto };
+    long long total = procurarTodasAC(ac, texto, imprimirOcorrencia, &ctx);
+    printf("   Total: %lld ocorrência(s)\n", total);
+
+    // Busca em fluxo: o mesmo texto entregue em blocos de 7 bytes
+    printf("\n2. BUSCA EM FLUXO (blocos de 7 bytes):\n");
+    ContextoChecksum inteiro = { 0, 0 };
+    ContextoChecksum emBlocos = { 0, 0 };
+    procurarTodasAC(ac, texto, acumularOcorrencia, &inteiro);
+
+    FluxoAC fluxo;
+    iniciarFluxoAC(&fluxo);
+    size_t tamanho = strlen(texto);
+    for (size_t i = 0; i < tamanho; i += 7) {
+        size_t pedaco = (tamanho - i < 7) ? tamanho - i : 7;
+        processarBlocoAC(ac, &fluxo, texto + i, pedaco, acumularOcorrencia, &emBlocos);
+    }
+
+    printf("   Texto inteiro: %lld ocorrências | Em blocos: %lld ocorrências\n",
+           inteiro.total, emBlocos.total);
+    printf("   Resultados idênticos: %s\n",
+           (inteiro.total == emBlocos.total && inteiro.soma == emBlocos.soma) ? "OK" : "FALHA");
+
+    liberarAhoCorasick(ac);
+}
+
+// Contagem ingênua: uma passada completa do texto para cada padrão (com sobreposição)
+static long long contarPalavraPorPalavra(const char* texto, char** padroes, int numPadroes) {
+    long long total = 0;
+    for (int p = 0; p < numPadroes; p++) {
+        const char* ptr = texto;
+        while ((ptr = strstr(ptr, padroes[p])) != NULL) {
+            total++;
+            ptr++;
+        }
+    }
+    return total;
+}
+
+void compararDesempenho(int numPadroes, size_t tamanhoTexto) {
+    printf("\n=== COMPARAÇÃO DE DESEMPENHO ===\n\n");
+
+    srand(42);
+
+    // Texto com alfabeto pequeno, para que existam muitas ocorrências
+    char* texto = malloc(tamanhoTexto + 1);
+    char** padroes = malloc(numPadroes * sizeof(char*));
+    if (texto == NULL || padroes == NULL) {
+        free(texto);
+        free(padroes);
+        return;
+    }
+
+    for (size_t i = 0; i < tamanhoTexto; i++) {
+        texto[i] = (char)('a' + rand() % 8);
+    }
+    texto[tamanhoTexto] = '\0';
+
+    for (int p = 0; p < numPadroes; p++) {
+        int tamanho = 4 + rand() % 9;
+        padroes[p] = malloc(tamanho + 1);
+        for (int i = 0; i < tamanho; i++) {
+            padroes[p][i] = (char)('a' + rand() % 8);
+        }
+        padroes[p][tamanho] = '\0';
+    }
+
+    printf("Texto: %zu bytes | Padrões: %d\n\n", tamanhoTexto, numPadroes);
+
+    clock_t inicio = clock();
+    long long totalIngenuo = contarPalavraPorPalavra(texto, padroes, numPadroes);
+    double tempoIngenuo = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    AhoCorasick* ac = construirAhoCorasick((const char**)padroes, numPadroes);
+    double tempoConstrucao = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    if (ac == NULL) {
+        printf("Erro ao construir o autômato\n");
+        for (int p = 0; p < numPadroes; p++) {
+            free(padroes[p]);
+        }
+        free(padroes);
+        free(texto);
+        return;
+    }
+
+    inicio = clock();
+    long long totalAC = procurarTodasAC(ac, texto, NULL, NULL);
+    double tempoAC = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+
+    printf("Palavra por palavra (strstr): %8.3f s  -> %lld ocorrências\n", tempoIngenuo, totalIngenuo);
+    printf("Aho-Corasick (construção):    %8.3f s  (%d estados)\n", tempoConstrucao, ac->numEstados);
+    printf("Aho-Corasick (busca):         %8.3f s  -> %lld ocorrências\n", tempoAC, totalAC);
+    printf("Resultados idênticos: %s\n", totalIngenuo == totalAC ? "OK" : "FALHA");
+    if (tempoAC > 0) {
+        printf("Aceleração da busca: %.1fx\n", tempoIngenuo / tempoAC);
+    }
+
+    liberarAhoCorasick(ac);
+    for (int p = 0; p < numPadroes; p++) {
+        free(padroes[p]);
+    }
+    free(padroes);
+    free(texto);
+}
+
+int main(int argc, char* argv[]) {
+    printf("=== BUSCA DE MÚLTIPLAS PALAVRAS COM AHO-CORASICK ===\n\n");
+
+    demonstrarBuscaMultipla();
+
+    // Parâmetros opcionais: número de padrões e tamanho do texto
+    int numPadroes = (argc > 1) ? atoi(argv[1]) : 1000;
+    size_t tamanhoTexto = (argc > 2) ? (size_t)atol(argv[2]) : 1000000;
+    if (numPadroes <= 0) numPadroes = 1000;
+    if (tamanhoTexto == 0) tamanhoTexto = 1000000;
+
+    compararDesempenho(numPadroes, tamanhoTexto);
+
+    printf("\n=== CONCEITOS IMPORTANTES ===\n");
+    printf("1. Uma única passada pelo texto, independente do número de padrões\n");
+    printf("2. Links de falha evitam retroceder no texto (como no KMP)\n");
+    printf("3. Links de saída listam padrões que são sufixos de outros\n");
+    printf("4. Raiz densa + estados esparsos: tabela compacta e rápida\n");
+    printf("5. O estado do autômato é suficiente para continuar entre blocos\n");
+
+    return 0;
+}
@@ -0,0 +1,798 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <regex.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * Programa de exemplo para busca de palavras em ARQUIVOS (inclusive maiores
+ * que a memória RAM) usando mmap ou leituras em blocos, com várias threads
+ *
+ * As funções de busca desta pasta recebem um `const char*` já carregado na
+ * memória. Para um log de dezenas de GB isso é inviável: o arquivo não cabe
+ * na RAM e ler tudo antes de começar a buscar desperdiça tempo.
+ *
+ * Estratégia:
+ * 1. O arquivo é dividido em BLOCOS de tamanho fixo (múltiplo da página)
+ * 2. Cada bloco é lido com mmap (páginas carregadas sob demanda e descartadas
+ *    com madvise depois do uso) ou com pread em um buffer da thread
+ * 3. Threads processam blocos em paralelo
+ * 4. Os resultados são entregues ao chamador NA ORDEM DO ARQUIVO: um bloco
+ *    só é emitido quando todos os anteriores já foram (fusão ordenada)
+ *
+ * Correspondências que atravessam a fronteira entre blocos:
+ * - Substring: cada bloco é lido com m - 1 bytes a mais; uma ocorrência
+ *   pertence ao bloco onde ela COMEÇA
+ * - Palavra completa: além disso, o byte anterior e o byte seguinte são
+ *   lidos para verificar os limites da palavra (isalnum)
+ * - Regex: a busca é por linha; uma linha pertence ao bloco onde começa e
+ *   a leitura se estende até o fim dessa linha
+ *
+ * Cada resultado informa a posição (byte) e o número da linha. As quebras de
+ * linha de cada bloco são contadas localmente e somadas na fusão ordenada.
+ *
+ * Compilação:
+ *   gcc -Wall -Wextra -std=c99 -O2 -pthread -o buscaArquivo procurarPalavraArquivoMmap.c
+ *
+ * Uso:
+ *   ./buscaArquivo                      # verificação + benchmark com arquivo de 256 MB
+ *   ./buscaArquivo 1024                 # benchmark com arquivo gerado de 1 GB
+ *   ./buscaArquivo /var/log/syslog erro # busca em um arquivo existente
+ */
+
+typedef enum {
+    BUSCA_SUBSTRING,  // Ocorrências não sobrepostas (como contarOcorrencias)
+    BUSCA_PALAVRA,    // Palavra completa (como procurarPalavraCompleta)
+    BUSCA_REGEX       // Primeira correspondência de cada linha (como grep)
+} TipoBusca;
+
+typedef enum {
+    LEITURA_MMAP,
+    LEITURA_PREAD
+} ModoLeitura;
+
+// Uma ocorrência encontrada no arquivo
+typedef struct {
+    long long posicao;  // Byte inicial no arquivo
+    long long linha;    // Número da linha (começando em 1)
+    int tamanho;        // Tamanho da correspondência em bytes
+} OcorrenciaArquivo;
+
+typedef void (*CallbackArquivo)(const OcorrenciaArquivo* ocorrencia, void* contexto);
+
+typedef struct {
+    TipoBusca tipo;
+    const char* padrao;
+    int case_sensitive;   // Usado apenas em BUSCA_REGEX
+    ModoLeitura modo;
+    int numThreads;
+    size_t tamBloco;      // 0 = TAM_BLOCO_PADRAO
+} OpcoesBusca;
+
+#define TAM_BLOCO_PADRAO (16u * 1024 * 1024)
+#define EXTENSAO_LINHA (64 * 1024)     // Leitura extra para completar uma linha (pread)
+#define BLOCOS_POR_THREAD_ADIANTE 2    // Limite de blocos prontos aguardando emissão
+
+// ==================== JANELAS DO ARQUIVO ====================
+
+// Trecho do arquivo disponível na memória: bytes [base, base + tamanho)
+typedef struct {
+    const char* dados;
+    long long base;
+    long long tamanho;
+} Janela;
+
+// Conta as quebras de linha em um trecho (laço simples, vetorizado pelo compilador)
+static long long contarQuebras(const char* p, long long n) {
+    long long total = 0;
+    for (long long i = 0; i < n; i++) {
+        total += (p[i] == '\n');
+    }
+    return total;
+}
+
+// ==================== RESULTADOS POR BLOCO ====================
+
+typedef struct {
+    OcorrenciaArquivo* itens;  // 'linha' guarda as quebras desde o início do bloco
+    int quantidade;
+    int capacidade;
+    long long quebras;         // Quebras de linha dentro do bloco
+    int pronto;
+    int erro;
+} ResultadoBloco;
+
+static int adicionarResultado(ResultadoBloco* r, long long posicao, long long quebrasLocais, int tamanho) {
+    if (r->quantidade == r->capacidade) {
+        int novaCap = r->capacidade ? r->capacidade * 2 : 64;
+        OcorrenciaArquivo* novos = realloc(r->itens, novaCap * sizeof(OcorrenciaArquivo));
+        if (novos == NULL) {
+            r->erro = 1;
+            return 0;
+        }
+        r->itens = novos;
+        r->capacidade = novaCap;
+    }
+    r->itens[r->quantidade].posicao = posicao;
+    r->itens[r->quantidade].linha = quebrasLocais;
+    r->itens[r->quantidade].tamanho = tamanho;
+    r->quantidade++;
+    return 1;
+}
+
+// ==================== BUSCA EM UM BLOCO ====================
+
+// Parâmetros comuns: a janela contém o bloco [inicio, fim) e o contexto
+// necessário; 'tamArquivo' indica onde o arquivo termina.
+
+static void buscarSubstringNoBloco(const Janela* j, long long inicio, long long fim, long long tamArquivo,
+                                   const char* padrao, size_t m, int palavraCompleta, ResultadoBloco* r) {
+    long long limite = fim + (long long)m - 1;
+    if (limite > j->base + j->tamanho) {
+        limite = j->base + j->tamanho;
+    }
+
+    const char* p = j->dados + (inicio - j->base);
+    const char* final = j->dados + (limite - j->base);
+    const char* cursor = p;
+    long long quebras = 0;
+
+    while (p < final) {
+        const char* q = memmem(p, (size_t)(final - p), padrao, m);
+        if (q == NULL) {
+            break;
+        }
+        long long pos = j->base + (q - j->dados);
+        if (pos >= fim) {
+            break; // Começa no próximo bloco
+        }
+
+        int valida = 1;
+        if (palavraCompleta) {
+            int inicioValido = (pos == 0) || !isalnum((unsigned char)q[-1]);
+            int fimValido = (pos + (long long)m >= tamArquivo) || !isalnum((unsigned char)q[m]);
+            valida = inicioValido && fimValido;
+        }
+        if (valida) {
+            quebras += contarQuebras(cursor, q - cursor);
+            cursor = q;
+            if (!adicionarResultado(r, pos, quebras, (int)m)) {
+                return;
+            }
+        }
+        p = q + 1;
+    }
+
+    quebras += contarQuebras(cursor, (j->dados + (fim - j->base)) - cursor);
+    r->quebras = quebras;
+}
+
+static void buscarRegexNoBloco(const Janela* j, long long inicio, long long fim,
+                               const regex_t* regex, ResultadoBloco* r) {
+    // Posições relativas ao início da janela
+    const char* dados = j->dados;
+    long long ini = inicio - j->base;
+    long long lim = fim - j->base;
+    long long tam = j->tamanho;
+
+    // A primeira linha do bloco é a primeira que COMEÇA em [inicio, fim)
+    long long linha = ini;
+    if (inicio > 0 && dados[ini - 1] != '\n') {
+        const char* nl = memchr(dados + ini, '\n', (size_t)(tam - ini));
+        linha = (nl == NULL) ? tam : (nl - dados) + 1;
+    }
+
+    long long cursor = ini;
+    long long quebras = 0;
+
+    while (linha < lim && linha < tam) {
+        const char* nl = memchr(dados + linha, '\n', (size_t)(tam - linha));
+        long long fimLinha = (nl == NULL) ? tam : (nl - dados);
+
+        // REG_STARTEND: a linha não precisa terminar com '\0'
+        regmatch_t match[1];
+        match[0].rm_so = 0;
+        match[0].rm_eo = (regoff_t)(fimLinha - linha);
+        if (regexec(regex, dados + linha, 1, match, REG_STARTEND) == 0) {
+            quebras += contarQuebras(dados + cursor, linha - cursor);
+            cursor = linha;
+            if (!adicionarResultado(r, j->base + linha + match[0].rm_so, quebras,
+                                    (int)(match[0].rm_eo - match[0].rm_so))) {
+                return;
+            }
+        }
+        linha = fimLinha + 1;
+    }
+
+    quebras += contarQuebras(dados + cursor, lim - cursor);
+    r->quebras = quebras;
+}
+
+// ==================== EXECUÇÃO PARALELA E FUSÃO ORDENADA ====================
+
+typedef struct {
+    const OpcoesBusca* opcoes;
+    size_t tamPadrao;
+    regex_t regex;
+
+    int fd;
+    long long tamArquivo;
+    const char* mapa;          // Arquivo inteiro mapeado (LEITURA_MMAP)
+    size_t tamBloco;
+
+    ResultadoBloco* blocos;
+    int numBlocos;
+    int proximoBloco;          // Próximo bloco a ser processado
+    int proximoEmitir;         // Próximo bloco a ser entregue ao chamador
+    int limiteAdiante;
+    long long quebrasEmitidas; // Quebras de linha antes de 'proximoEmitir'
+    long long fimUltimo;       // Fim da última substring emitida (não sobreposição)
+    long long totalEmitido;
+    int erro;
+
+    CallbackArquivo callback;
+    void* contexto;
+    pthread_mutex_t trava;
+    pthread_cond_t avancou;
+} BuscaArquivo;
+
+// Lê com pread um trecho a partir de 'inicio'; o trecho cobre o bloco até
+// 'fimBloco' mais 'depois' bytes. Com 'completarLinha', a leitura continua
+// até encontrar a quebra de linha que termina a última linha do bloco.
+static int lerJanela(BuscaArquivo* b, long long inicio, long long fimBloco, long long depois,
+                     int completarLinha, char** buffer, size_t* capacidade, Janela* j) {
+    long long fim = fimBloco + depois;
+    long long lidos = 0;
+    long long procurarDesde = (fimBloco - 1 > inicio) ? fimBloco - 1 - inicio : 0;
+
+    for (;;) {
+        if (fim > b->tamArquivo) {
+            fim = b->tamArquivo;
+        }
+        long long tamanho = fim - inicio;
+        if ((size_t)tamanho > *capacidade) {
+            char* novo = realloc(*buffer, (size_t)tamanho);
+            if (novo == NULL) {
+                return 0;
+            }
+            *buffer = novo;
+            *capacidade = (size_t)tamanho;
+        }
+
+        while (lidos < tamanho) {
+            ssize_t n = pread(b->fd, *buffer + lidos, (size_t)(tamanho - lidos), inicio + lidos);
+            if (n <= 0) {
+                return 0;
+            }
+            lidos += n;
+        }
+
+        if (!completarLinha || fim >= b->tamArquivo ||
+            memchr(*buffer + procurarDesde, '\n', (size_t)(tamanho - procurarDesde)) != NULL) {
+            break;
+        }
+        procurarDesde = tamanho;
+        fim += EXTENSAO_LINHA; // Linha muito longa: lê mais um trecho
+    }
+
+    j->dados = *buffer;
+    j->base = inicio;
+    j->tamanho = lidos;
+    return 1;
+}
+
+static void processarBloco(BuscaArquivo* b, int indice, char** buffer, size_t* capacidade) {
+    const OpcoesBusca* op = b->opcoes;
+    ResultadoBloco* r = &b->blocos[indice];
+    long long inicio = (long long)indice * (long long)b->tamBloco;
+    long long fim = inicio + (long long)b->tamBloco;
+    if (fim > b->tamArquivo) {
+        fim = b->tamArquivo;
+    }
+
+    // Contexto necessário além do bloco
+    long long antes = (inicio > 0) ? 1 : 0;
+    long long depois = (op->tipo == BUSCA_REGEX) ? EXTENSAO_LINHA : (long long)b->tamPadrao;
+
+    Janela j;
+    if (op->modo == LEITURA_MMAP) {
+        j.dados = b->mapa;
+        j.base = 0;
+        j.tamanho = b->tamArquivo;
+        madvise((void*)(b->mapa + inicio), (size_t)(fim - inicio), MADV_WILLNEED);
+    } else if (!lerJanela(b, inicio - antes, fim, depois, op->tipo == BUSCA_REGEX, buffer, capacidade, &j)) {
+        r->erro = 1;
+        return;
+    }
+
+    if (op->tipo == BUSCA_REGEX) {
+        buscarRegexNoBloco(&j, inicio, fim, &b->regex, r);
+    } else {
+        buscarSubstringNoBloco(&j, inicio, fim, b->tamArquivo, op->padrao, b->tamPadrao,
+                               op->tipo == BUSCA_PALAVRA, r);
+    }
+
+    if (op->modo == LEITURA_MMAP) {
+        // Devolve as páginas ao kernel: arquivos maiores que a RAM não se acumulam
+        madvise((void*)(b->mapa + inicio), (size_t)(fim - inicio), MADV_DONTNEED);
+    }
+}
+
+// Entrega ao chamador os blocos prontos, em ordem (chamada com a trava obtida)
+static void emitirBlocosProntos(BuscaArquivo* b) {
+    while (b->proximoEmitir < b->numBlocos && b->blocos[b->proximoEmitir].pronto) {
+        ResultadoBloco* r = &b->blocos[b->proximoEmitir];
+        if (r->erro) {
+            b->erro = 1;
+        }
+
+        for (int i = 0; i < r->quantidade && !b->erro; i++) {
+            OcorrenciaArquivo oc = r->itens[i];
+            if (b->opcoes->tipo == BUSCA_SUBSTRING) {
+                // Os blocos reportam todas as ocorrências; aqui ficam só as
+                // não sobrepostas, como no laço com strstr de contarOcorrencias
+                if (oc.posicao < b->fimUltimo) {
+                    continue;
+                }
+                b->fimUltimo = oc.posicao + oc.tamanho;
+            }
+            oc.linha = b->quebrasEmitidas + oc.linha + 1;
+            if (b->callback != NULL) {
+                b->callback(&oc, b->contexto);
+            }
+            b->totalEmitido++;
+        }
+
+        b->quebrasEmitidas += r->quebras;
+        free(r->itens);
+        r->itens = NULL;
+        b->proximoEmitir++;
+    }
+    pthread_cond_broadcast(&b->avancou);
+}
+
+static void* trabalhador(void* arg) {
+    BuscaArquivo* b = (BuscaArquivo*)arg;
+    char* buffer = NULL;
+    size_t capacidade = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&b->trava);
+        // Não se adianta demais: limita os resultados guardados na memória
+        while (b->proximoBloco < b->numBlocos &&
+               b->proximoBloco >= b->proximoEmitir + b->limiteAdiante) {
+            pthread_cond_wait(&b->avancou, &b->trava);
+        }
+        if (b->proximoBloco >= b->numBlocos) {
+            pthread_mutex_unlock(&b->trava);
+            break;
+        }
+        int indice = b->proximoBloco++;
+        pthread_mutex_unlock(&b->trava);
+
+        processarBloco(b, indice, &buffer, &capacidade);
+
+        pthread_mutex_lock(&b->trava);
+        b->blocos[indice].pronto = 1;
+        emitirBlocosProntos(b);
+        pthread_mutex_unlock(&b->trava);
+    }
+
+    free(buffer);
+    return NULL;
+}
+
+// Função para procurar um padrão em um arquivo
+// Parâmetros:
+// - caminho: caminho do arquivo
+// - opcoes: tipo de busca, padrão, modo de leitura, threads e tamanho do bloco
+// - callback: chamada para cada ocorrência, em ordem crescente de posição
+//   (nunca em paralelo); pode ser NULL para apenas contar
+// - contexto: ponteiro repassado ao callback
+// Retorna:
+// - Número de ocorrências encontradas
+// - -1 em caso de erro
+long long procurarEmArquivo(const char* caminho, const OpcoesBusca* opcoes,
+                            CallbackArquivo callback, void* contexto) {
+    if (caminho == NULL || opcoes == NULL || opcoes->padrao == NULL || opcoes->padrao[0] == '\0') {
+        return -1;
+    }
+
+    BuscaArquivo b;
+    memset(&b, 0, sizeof(b));
+    b.opcoes = opcoes;
+    b.tamPadrao = strlen(opcoes->padrao);
+    b.callback = callback;
+    b.contexto = contexto;
+
+    // O tamanho do bloco é múltiplo da página (exigência do madvise)
+    long pagina = sysconf(_SC_PAGESIZE);
+    size_t tamBloco = opcoes->tamBloco ? opcoes->tamBloco : TAM_BLOCO_PADRAO;
+    b.tamBloco = ((tamBloco + (size_t)pagina - 1) / (size_t)pagina) * (size_t)pagina;
+
+    if (opcoes->tipo == BUSCA_REGEX) {
+        int flags = REG_EXTENDED | REG_NEWLINE | (opcoes->case_sensitive ? 0 : REG_ICASE);
+        int resultado = regcomp(&b.regex, opcoes->padrao, flags);
+        if (resultado != 0) {
+            char mensagem_erro[256];
+            regerror(resultado, &b.regex, mensagem_erro, sizeof(mensagem_erro));
+            printf("Erro ao compilar regex: %s\n", mensagem_erro);
+            return -1;
+        }
+    }
+
+    b.fd = open(caminho, O_RDONLY);
+    struct stat info;
+    if (b.fd < 0 || fstat(b.fd, &info) != 0) {
+        if (b.fd >= 0) close(b.fd);
+        if (opcoes->tipo == BUSCA_REGEX) regfree(&b.regex);
+        return -1;
+    }
+    b.tamArquivo = (long long)info.st_size;
+
+    OpcoesBusca efetivas = *opcoes;
+    b.opcoes = &efetivas;
+    if (efetivas.modo == LEITURA_MMAP && b.tamArquivo > 0) {
+        void* mapa = mmap(NULL, (size_t)b.tamArquivo, PROT_READ, MAP_PRIVATE, b.fd, 0);
+        if (mapa == MAP_FAILED) {
+            efetivas.modo = LEITURA_PREAD; // Ex.: sistemas de arquivos sem suporte a mmap
+        } else {
+            b.mapa = (const char*)mapa;
+            madvise(mapa, (size_t)b.tamArquivo, MADV_SEQUENTIAL);
+        }
+    }
+
+    b.numBlocos = (int)((b.tamArquivo + (long long)b.tamBloco - 1) / (long long)b.tamBloco);
+    b.blocos = calloc(b.numBlocos > 0 ? b.numBlocos : 1, sizeof(ResultadoBloco));
+    int numThreads = opcoes->numThreads > 0 ? opcoes->numThreads : 1;
+    b.limiteAdiante = numThreads * BLOCOS_POR_THREAD_ADIANTE;
+    pthread_mutex_init(&b.trava, NULL);
+    pthread_cond_init(&b.avancou, NULL);
+
+    if (b.blocos == NULL) {
+        b.erro = 1;
+    } else if (numThreads == 1) {
+        trabalhador(&b);
+    } else {
+        pthread_t* threads = malloc(numThreads * sizeof(pthread_t));
+        int criadas = 0;
+        for (int i = 0; threads != NULL && i < numThreads; i++) {
+            if (pthread_create(&threads[i], NULL, trabalhador, &b) != 0) {
+                break;
+            }
+            criadas++;
+        }
+        if (criadas == 0) {
+            trabalhador(&b); // Sem threads extras: processa na thread atual
+        }
+        for (int i = 0; i < criadas; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        free(threads);
+    }
+
+    pthread_cond_destroy(&b.avancou);
+    pthread_mutex_destroy(&b.trava);
+    for (int i = 0; b.blocos != NULL && i < b.numBlocos; i++) {
+        free(b.blocos[i].itens);
+    }
+    free(b.blocos);
+    if (b.mapa != NULL) {
+        munmap((void*)b.mapa, (size_t)b.tamArquivo);
+    }
+    close(b.fd);
+    if (opcoes->tipo == BUSCA_REGEX) {
+        regfree(&b.regex);
+    }
+
+    return b.erro ? -1 : b.totalEmitido;
+}
+
+// ==================== VERIFICAÇÃO ====================
+
+typedef struct {
+    OcorrenciaArquivo* itens;
+    long long quantidade;
+    long long capacidade;
+} ListaOcorrencias;
+
+static void guardarOcorrencia(const OcorrenciaArquivo* oc, void* contexto) {
+    ListaOcorrencias* lista = (ListaOcorrencias*)contexto;
+    if (lista->quantidade == lista->capacidade) {
+        lista->capacidade = lista->capacidade ? lista->capacidade * 2 : 256;
+        lista->itens = realloc(lista->itens, (size_t)lista->capacidade * sizeof(OcorrenciaArquivo));
+    }
+    lista->itens[lista->quantidade++] = *oc;
+}
+
+// Referência: o arquivo inteiro na memória, buscado com os laços das versões originais
+static void buscarReferencia(const char* texto, long long n, const OpcoesBusca* op, ListaOcorrencias* saida) {
+    size_t m = strlen(op->padrao);
+    long long linha = 1;
+    long long ultimo = 0;
+    OcorrenciaArquivo oc;
+
+    if (op->tipo == BUSCA_REGEX) {
+        regex_t regex;
+        regcomp(&regex, op->padrao, REG_EXTENDED | REG_NEWLINE | (op->case_sensitive ? 0 : REG_ICASE));
+        long long inicio = 0;
+        while (inicio < n) {
+            const char* nl = memchr(texto + inicio, '\n', (size_t)(n - inicio));
+            long long fim = nl ? nl - texto : n;
+            regmatch_t match[1];
+            match[0].rm_so = 0;
+            match[0].rm_eo = (regoff_t)(fim - inicio);
+            if (regexec(&regex, texto + inicio, 1, match, REG_STARTEND) == 0) {
+                oc.posicao = inicio + match[0].rm_so;
+                oc.tamanho = (int)(match[0].rm_eo - match[0].rm_so);
+                oc.linha = linha;
+                guardarOcorrencia(&oc, saida);
+            }
+            inicio = fim + 1;
+            linha++;
+        }
+        regfree(&regex);
+        return;
+    }
+
+    const char* p = texto;
+    while (p < texto + n) {
+        const char* q = memmem(p, (size_t)(texto + n - p), op->padrao, m);
+        if (q == NULL) {
+            break;
+        }
+        long long pos = q - texto;
+        int valida = 1;
+        if (op->tipo == BUSCA_PALAVRA) {
+            valida = (pos == 0 || !isalnum((unsigned char)q[-1])) &&
+                     (pos + (long long)m >= n || !isalnum((unsigned char)q[m]));
+        }
+        if (valida) {
+            linha += contarQuebras(texto + ultimo, pos - ultimo);
+            ultimo = pos;
+            oc.posicao = pos;
+            oc.tamanho = (int)m;
+            oc.linha = linha;
+            guardarOcorrencia(&oc, saida);
+        }
+        p = (op->tipo == BUSCA_SUBSTRING && valida) ? q + m : q + 1;
+    }
+}
+
+// Gera um arquivo de log sintético com palavras que atravessam fronteiras de bloco
+static char* gerarArquivo(const char* caminho, long long tamanho) {
+    const char* palavras[] = { "INFO", "WARN", "ERROR", "usuario", "conexao", "timeout", "erro",
+                               "erros", "aaaa", "requisicao", "servidor", "id=", "404", "500" };
+    int numPalavras = sizeof(palavras) / sizeof(palavras[0]);
+
+    char* texto = malloc((size_t)tamanho);
+    if (texto == NULL) {
+        return NULL;
+    }
+    unsigned int semente = 12345;
+    long long pos = 0;
+    while (pos < tamanho) {
+        semente = semente * 1103515245u + 12345u;
+        const char* w = palavras[(semente >> 16) % numPalavras];
+        for (const char* c = w; *c && pos < tamanho; c++) {
+            texto[pos++] = *c;
+        }
+        if (pos < tamanho) {
+            semente = semente * 1103515245u + 12345u;
+            unsigned int r = (semente >> 16) % 100;
+            texto[pos++] = (r < 8) ? '\n' : (r < 12) ? '-' : (r < 16) ? (char)('0' + r % 10) : ' ';
+        }
+    }
+
+    FILE* f = fopen(caminho, "wb");
+    if (f == NULL || fwrite(texto, 1, (size_t)tamanho, f) != (size_t)tamanho) {
+        if (f) fclose(f);
+        free(texto);
+        return NULL;
+    }
+    fclose(f);
+    return texto;
+}
+
+static int listasIguais(const ListaOcorrencias* a, const ListaOcorrencias* b) {
+    if (a->quantidade != b->quantidade) {
+        return 0;
+    }
+    for (long long i = 0; i < a->quantidade; i++) {
+        if (a->itens[i].posicao != b->itens[i].posicao || a->itens[i].linha != b->itens[i].linha ||
+            a->itens[i].tamanho != b->itens[i].tamanho) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void verificarFronteiras() {
+    printf("=== VERIFICAÇÃO: FRONTEIRAS ENTRE BLOCOS ===\n\n");
+
+    char caminho[] = "/tmp/buscaArquivoTesteXXXXXX";
+    int fd = mkstemp(caminho);
+    if (fd < 0) {
+        printf("Não foi possível criar arquivo temporário\n\n");
+        return;
+    }
+    close(fd);
+
+    long long tamanho = 3 * 1024 * 1024 + 777; // Último bloco incompleto
+    char* texto = gerarArquivo(caminho, tamanho);
+    if (texto == NULL) {
+        unlink(caminho);
+        return;
+    }
+
+    OpcoesBusca casos[] = {
+        { BUSCA_SUBSTRING, "aaaa", 1, LEITURA_MMAP, 1, 0 },
+        { BUSCA_SUBSTRING, "requisicao servidor", 1, LEITURA_MMAP, 1, 0 },
+        { BUSCA_PALAVRA, "erro", 1, LEITURA_MMAP, 1, 0 },
+        { BUSCA_PALAVRA, "404", 1, LEITURA_MMAP, 1, 0 },
+        { BUSCA_REGEX, "ERROR.*timeout", 1, LEITURA_MMAP, 1, 0 },
+        { BUSCA_REGEX, "^usuario [a-z]+$", 1, LEITURA_MMAP, 1, 0 },
+        { BUSCA_REGEX, "id=[0-9]", 0, LEITURA_MMAP, 1, 0 },
+    };
+    int numCasos = sizeof(casos) / sizeof(casos[0]);
+    size_t tamanhosBloco[] = { 4096, 65536, 1024 * 1024 };
+    int threads[] = { 1, 3 };
+    ModoLeitura modos[] = { LEITURA_MMAP, LEITURA_PREAD };
+
+    int falhas = 0;
+    int execucoes = 0;
+    for (int c = 0; c < numCasos; c++) {
+        ListaOcorrencias esperado = { NULL, 0, 0 };
+        buscarReferencia(texto, tamanho, &casos[c], &esperado);
+
+        for (int tb = 0; tb < 3; tb++) {
+            for (int t = 0; t < 2; t++) {
+                for (int md = 0; md < 2; md++) {
+                    OpcoesBusca op = casos[c];
+                    op.tamBloco = tamanhosBloco[tb];
+                    op.numThreads = threads[t];
+                    op.modo = modos[md];
+
+                    ListaOcorrencias obtido = { NULL, 0, 0 };
+                    long long total = procurarEmArquivo(caminho, &op, guardarOcorrencia, &obtido);
+                    if (total != obtido.quantidade || !listasIguais(&esperado, &obtido)) {
+                        falhas++;
+                    }
+                    execucoes++;
+                    free(obtido.itens);
+                }
+            }
+        }
+        printf("   %-9s \"%s\": %lld ocorrências\n",
+               casos[c].tipo == BUSCA_SUBSTRING ? "substring" : casos[c].tipo == BUSCA_PALAVRA ? "palavra" : "regex",
+               casos[c].padrao, esperado.quantidade);
+        free(esperado.itens);
+    }
+
+    printf("\n   %d execuções (blocos de 4 KB a 1 MB, 1 e 3 threads, mmap e pread): %s\n\n",
+           execucoes, falhas == 0 ? "OK" : "FALHA");
+
+    free(texto);
+    unlink(caminho);
+}
+
+// ==================== BENCHMARK ====================
+
+static double agora() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void imprimirOcorrencia(const OcorrenciaArquivo* oc, void* contexto) {
+    int* restantes = (int*)contexto;
+    if (*restantes > 0) {
+        printf("   linha %lld, byte %lld\n", oc->linha, oc->posicao);
+        (*restantes)--;
+    }
+}
+
+void benchmark(const char* caminho, const char* padrao) {
+    long numCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+    if (numCPUs < 1) numCPUs = 1;
+
+    printf("=== BENCHMARK: \"%s\" em %s ===\n\n", padrao, caminho);
+    printf("%-34s %10s %12s\n", "Configuração", "Tempo (s)", "Ocorrências");
+
+    // Referência: carregar o arquivo inteiro e buscar com o laço de contarOcorrencias
+    double inicio = agora();
+    FILE* f = fopen(caminho, "rb");
+    long long total = -1;
+    if (f != NULL) {
+        fseek(f, 0, SEEK_END);
+        long tamanho = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        char* texto = malloc((size_t)tamanho + 1);
+        if (texto != NULL && fread(texto, 1, (size_t)tamanho, f) == (size_t)tamanho) {
+            texto[tamanho] = '\0';
+            total = 0;
+            size_t m = strlen(padrao);
+            const char* ptr = texto;
+            while ((ptr = strstr(ptr, padrao)) != NULL) {
+                total++;
+                ptr += m;
+            }
+        }
+        free(texto);
+        fclose(f);
+    }
+    printf("%-34s %10.3f %12lld\n", "fread do arquivo inteiro + strstr", agora() - inicio, total);
+
+    int threads[] = { 1, 2, 4, 8 };
+    for (int md = 0; md < 2; md++) {
+        for (int t = 0; t < 4; t++) {
+            if (threads[t] > 1 && threads[t] > 2 * numCPUs) {
+                break;
+            }
+            OpcoesBusca op = { BUSCA_SUBSTRING, padrao, 1, md == 0 ? LEITURA_MMAP : LEITURA_PREAD, threads[t], 0 };
+            inicio = agora();
+            total = procurarEmArquivo(caminho, &op, NULL, NULL);
+            char rotulo[64];
+            snprintf(rotulo, sizeof(rotulo), "substring, %s, %d thread(s)", md == 0 ? "mmap" : "pread", threads[t]);
+            printf("%-34s %10.3f %12lld\n", rotulo, agora() - inicio, total);
+        }
+    }
+
+    OpcoesBusca palavra = { BUSCA_PALAVRA, padrao, 1, LEITURA_MMAP, (int)numCPUs, 0 };
+    inicio = agora();
+    total = procurarEmArquivo(caminho, &palavra, NULL, NULL);
+    printf("%-34s %10.3f %12lld\n", "palavra completa, mmap", agora() - inicio, total);
+
+    OpcoesBusca regex = { BUSCA_REGEX, padrao, 0, LEITURA_MMAP, (int)numCPUs, 0 };
+    inicio = agora();
+    total = procurarEmArquivo(caminho, &regex, NULL, NULL);
+    printf("%-34s %10.3f %12lld\n", "regex por linha (ignora caixa)", agora() - inicio, total);
+
+    printf("\nPrimeiras ocorrências (entregues em ordem pela fusão):\n");
+    int restantes = 3;
+    OpcoesBusca op = { BUSCA_SUBSTRING, padrao, 1, LEITURA_MMAP, (int)numCPUs, 0 };
+    procurarEmArquivo(caminho, &op, imprimirOcorrencia, &restantes);
+    printf("\n(%ld CPU(s) disponíveis)\n\n", numCPUs);
+}
+
+int main(int argc, char* argv[]) {
+    printf("=== BUSCA EM ARQUIVOS GRANDES (MMAP + BLOCOS + THREADS) ===\n\n");
+
+    verificarFronteiras();
+
+    if (argc > 1 && atoll(argv[1]) <= 0) {
+        // Arquivo informado pelo usuário
+        benchmark(argv[1], argc > 2 ? argv[2] : "erro");
+    } else {
+        long long megabytes = (argc > 1) ? atoll(argv[1]) : 256;
+        char caminho[] = "/tmp/buscaArquivoBenchXXXXXX";
+        int fd = mkstemp(caminho);
+        if (fd >= 0) {
+            close(fd);
+            char* texto = gerarArquivo(caminho, megabytes * 1024 * 1024);
+            if (texto != NULL) {
+                free(texto);
+                benchmark(caminho, "timeout");
+            } else {
+                printf("Não foi possível gerar o arquivo de %lld MB\n\n", megabytes);
+            }
+            unlink(caminho);
+        }
+    }
+
+    printf("=== CONCEITOS IMPORTANTES ===\n");
+    printf("1. mmap carrega páginas sob demanda; madvise(DONTNEED) as devolve depois do uso\n");
+    printf("2. Blocos sobrepostos em m - 1 bytes não perdem ocorrências na fronteira\n");
+    printf("3. Cada ocorrência pertence ao bloco onde começa (sem duplicatas)\n");
+    printf("4. Regex é aplicada por linha; a linha pertence ao bloco onde começa\n");
+    printf("5. Fusão ordenada: resultados entregues na ordem do arquivo, memória limitada\n");
+
+    return 0;
+}
@@ -0,0 +1,1576 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <regex.h>
+
+/**
+ * Programa de exemplo para busca com expressões regulares usando um
+ * autômato finito DETERMINÍSTICO construído sob demanda (lazy DFA)
+ *
+ * Em procurarPalavraRegex.c, buscarComRegex e encontrarTodasCorrespondencias
+ * chamam regcomp() a cada invocação: validar 1 milhão de emails compila o
+ * mesmo padrão 1 milhão de vezes. Além disso, o regexec do POSIX pode
+ * retroceder (backtracking) e ter tempo superlinear em alguns padrões.
+ *
+ * Este arquivo resolve os dois problemas:
+ *
+ * 1. CACHE DE REGEX COMPILADAS: uma tabela hash indexada por
+ *    (padrão, case_sensitive) guarda o padrão já compilado. A primeira
+ *    chamada compila; as seguintes reutilizam.
+ *
+ * 2. MOTOR NFA DE THOMPSON + DFA PREGUIÇOSO (estilo RE2):
+ *    - O padrão é convertido em uma árvore sintática e depois em um
+ *      autômato não determinístico (construção de Thompson)
+ *    - Cada estado do DFA é um CONJUNTO de estados do NFA; as transições
+ *      são calculadas apenas quando usadas pela primeira vez e ficam
+ *      guardadas em uma tabela de 256 entradas por estado
+ *    - Cada byte do texto custa uma consulta à tabela: tempo LINEAR no
+ *      tamanho do texto, sem backtracking
+ *    - Se o número de estados passar do limite, o cache do DFA é
+ *      esvaziado e reconstruído (memória limitada)
+ *
+ * Subconjunto suportado (sintaxe POSIX estendida):
+ *   literais, '.', classes [a-z0-9._%+-], [^...], [[:alpha:]] etc.,
+ *   \w \W \s \S, escapes de metacaracteres (\. \( ...), agrupamento ( ),
+ *   alternativa |, quantificadores * + ? {m} {m,} {m,n},
+ *   âncoras ^ (no início do padrão) e $ (no fim do padrão)
+ * Padrões fora do subconjunto (ex.: \b, retro-referências) continuam
+ * funcionando: são compilados UMA vez com regcomp e guardados no cache.
+ *
+ * Semântica de correspondência: a mais à esquerda e, entre essas, a mais
+ * longa (igual ao POSIX). Para encontrar todas as correspondências são
+ * usados dois DFAs: um REVERSO marca em uma passada onde começam
+ * correspondências, e um direto ancorado encontra o fim mais longo (com
+ * memória dos trechos sem aceite, para não reler o texto: ver fimMaisLongo).
+ *
+ * Compilação:
+ *   gcc -Wall -Wextra -std=c99 -O2 -o regexDFA procurarPalavraRegexDFA.c
+ *
+ * Uso:
+ *   ./regexDFA            # benchmark com 300.000 linhas
+ *   ./regexDFA 5000000    # benchmark com 5 milhões de linhas
+ */
+
+// Estrutura para armazenar informações sobre uma correspondência encontrada
+// (mesma estrutura de procurarPalavraRegex.c)
+typedef struct {
+    int inicio;      // Posição inicial da correspondência
+    int fim;         // Posição final da correspondência
+    char texto[256]; // Texto da correspondência
+} Correspondencia;
+
+#define MAX_ESTADOS_NFA 20000   // Acima disso o padrão é tratado pelo regcomp
+#define MAX_ESTADOS_DFA 1024    // Limite do cache de estados de cada DFA
+#define MAX_REPETICAO 255       // Maior valor aceito em {m,n} (RE_DUP_MAX)
+#define TRANSICAO_DESCONHECIDA (-2)
+#define ESTADO_MORTO (-1)
+
+// ==================== CONJUNTOS DE BYTES ====================
+
+typedef struct {
+    uint64_t bits[4];
+} ConjuntoBytes;
+
+static void conjuntoAdicionar(ConjuntoBytes* c, unsigned char b) {
+    c->bits[b >> 6] |= (uint64_t)1 << (b & 63);
+}
+
+static int conjuntoContem(const ConjuntoBytes* c, unsigned char b) {
+    return (int)((c->bits[b >> 6] >> (b & 63)) & 1);
+}
+
+static void conjuntoAdicionarFaixa(ConjuntoBytes* c, int de, int ate) {
+    for (int b = de; b <= ate; b++) {
+        conjuntoAdicionar(c, (unsigned char)b);
+    }
+}
+
+// ==================== ÁRVORE SINTÁTICA ====================
+
+typedef enum {
+    NO_CLASSE,       // Um byte pertencente a um conjunto
+    NO_VAZIO,        // Cadeia vazia
+    NO_CONCATENACAO,
+    NO_ALTERNATIVA,
+    NO_ESTRELA,      // a*
+    NO_MAIS,         // a+
+    NO_OPCIONAL,     // a?
+    NO_REPETICAO     // a{min,max} (max = -1 significa ilimitado)
+} TipoNo;
+
+typedef struct {
+    TipoNo tipo;
+    int esquerda;
+    int direita;
+    int classe;
+    int minimo;
+    int maximo;
+} NoRegex;
+
+typedef struct {
+    const char* padrao;
+    int pos;
+    int suportado;
+    int ignorarCaixa;
+    NoRegex* nos;
+    int numNos;
+    int capNos;
+    ConjuntoBytes* classes;
+    int numClasses;
+    int capClasses;
+} Analisador;
+
+static int novoNo(Analisador* a, TipoNo tipo, int esquerda, int direita) {
+    if (a->numNos == a->capNos) {
+        int novaCap = a->capNos ? a->capNos * 2 : 32;
+        NoRegex* novos = realloc(a->nos, novaCap * sizeof(NoRegex));
+        if (novos == NULL) {
+            a->suportado = 0;
+            return -1;
+        }
+        a->nos = novos;
+        a->capNos = novaCap;
+    }
+
+    NoRegex* no = &a->nos[a->numNos];
+    no->tipo = tipo;
+    no->esquerda = esquerda;
+    no->direita = direita;
+    no->classe = -1;
+    no->minimo = 0;
+    no->maximo = 0;
+    return a->numNos++;
+}
+
+// Cria um nó de classe, aplicando a conversão de caixa se necessário
+static int novoNoClasse(Analisador* a, ConjuntoBytes conjunto) {
+    if (a->ignorarCaixa) {
+        for (int b = 'a'; b <= 'z'; b++) {
+            if (conjuntoContem(&conjunto, (unsigned char)b) ||
+                conjuntoContem(&conjunto, (unsigned char)(b - 'a' + 'A'))) {
+                conjuntoAdicionar(&conjunto, (unsigned char)b);
+                conjuntoAdicionar(&conjunto, (unsigned char)(b - 'a' + 'A'));
+            }
+        }
+    }
+
+    if (a->numClasses == a->capClasses) {
+        int novaCap = a->capClasses ? a->capClasses * 2 : 16;
+        ConjuntoBytes* novas = realloc(a->classes, novaCap * sizeof(ConjuntoBytes));
+        if (novas == NULL) {
+            a->suportado = 0;
+            return -1;
+        }
+        a->classes = novas;
+        a->capClasses = novaCap;
+    }
+    a->classes[a->numClasses] = conjunto;
+
+    int no = novoNo(a, NO_CLASSE, -1, -1);
+    if (no >= 0) {
+        a->nos[no].classe = a->numClasses;
+    }
+    a->numClasses++;
+    return no;
+}
+
+static char atual(Analisador* a) {
+    return a->padrao[a->pos];
+}
+
+static int analisarAlternativa(Analisador* a);
+
+// Classes nomeadas [:alpha:], [:digit:] etc.
+static int adicionarClasseNomeada(ConjuntoBytes* c, const char* nome, int tamanho) {
+    for (int b = 1; b < 256; b++) {
+        int pertence;
+        if (tamanho == 5 && strncmp(nome, "alpha", 5) == 0) {
+            pertence = (b >= 'a' && b <= 'z') || (b >= 'A' && b <= 'Z');
+        } else if (tamanho == 5 && strncmp(nome, "digit", 5) == 0) {
+            pertence = (b >= '0' && b <= '9');
+        } else if (tamanho == 5 && strncmp(nome, "alnum", 5) == 0) {
+            pertence = (b >= 'a' && b <= 'z') || (b >= 'A' && b <= 'Z') || (b >= '0' && b <= '9');
+        } else if (tamanho == 5 && strncmp(nome, "upper", 5) == 0) {
+            pertence = (b >= 'A' && b <= 'Z');
+        } else if (tamanho == 5 && strncmp(nome, "lower", 5) == 0) {
+            pertence = (b >= 'a' && b <= 'z');
+        } else if (tamanho == 5 && strncmp(nome, "space", 5) == 0) {
+            pertence = (b == ' ' || (b >= '\t' && b <= '\r'));
+        } else if (tamanho == 6 && strncmp(nome, "xdigit", 6) == 0) {
+            pertence = (b >= '0' && b <= '9') || (b >= 'a' && b <= 'f') || (b >= 'A' && b <= 'F');
+        } else if (tamanho == 5 && strncmp(nome, "punct", 5) == 0) {
+            pertence = (b >= 33 && b <= 47) || (b >= 58 && b <= 64) ||
+                       (b >= 91 && b <= 96) || (b >= 123 && b <= 126);
+        } else {
+            return 0;
+        }
+        if (pertence) {
+            conjuntoAdicionar(c, (unsigned char)b);
+        }
+    }
+    return 1;
+}
+
+// Analisa uma classe entre colchetes (a posição atual está logo após '[')
+static int analisarColchetes(Analisador* a) {
+    ConjuntoBytes c = { { 0, 0, 0, 0 } };
+    int negada = 0;
+
+    if (atual(a) == '^') {
+        negada = 1;
+        a->pos++;
+    }
+
+    int primeiro = 1;
+    while (atual(a) != '\0' && (atual(a) != ']' || primeiro)) {
+        primeiro = 0;
+
+        if (atual(a) == '[' && a->padrao[a->pos + 1] == ':') {
+            const char* fim = strstr(a->padrao + a->pos + 2, ":]");
+            if (fim == NULL ||
+                !adicionarClasseNomeada(&c, a->padrao + a->pos + 2, (int)(fim - (a->padrao + a->pos + 2)))) {
+                a->suportado = 0;
+                return -1;
+            }
+            a->pos = (int)(fim - a->padrao) + 2;
+            continue;
+        }
+        if (atual(a) == '[' && (a->padrao[a->pos + 1] == '.' || a->padrao[a->pos + 1] == '=')) {
+            a->suportado = 0; // elementos de ordenação não são suportados
+            return -1;
+        }
+
+        unsigned char inicio = (unsigned char)atual(a);
+        a->pos++;
+        if (atual(a) == '-' && a->padrao[a->pos + 1] != ']' && a->padrao[a->pos + 1] != '\0') {
+            unsigned char fim = (unsigned char)a->padrao[a->pos + 1];
+            if (fim < inicio) {
+                a->suportado = 0;
+                return -1;
+            }
+            conjuntoAdicionarFaixa(&c, inicio, fim);
+            a->pos += 2;
+        } else {
+            conjuntoAdicionar(&c, inicio);
+        }
+    }
+
+    if (atual(a) != ']') {
+        a->suportado = 0;
+        return -1;
+    }
+    a->pos++;
+
+    if (negada) {
+        // A negação é aplicada depois da conversão de caixa
+        if (a->ignorarCaixa) {
+            for (int b = 'a'; b <= 'z'; b++) {
+                if (conjuntoContem(&c, (unsigned char)b) || conjuntoContem(&c, (unsigned char)(b - 32))) {
+                    conjuntoAdicionar(&c, (unsigned char)b);
+                    conjuntoAdicionar(&c, (unsigned char)(b - 32));
+                }
+            }
+        }
+        for (int i = 0; i < 4; i++) {
+            c.bits[i] = ~c.bits[i];
+        }
+        c.bits[0] &= ~(uint64_t)1; // '\0' nunca faz parte do texto
+        int salvo = a->ignorarCaixa;
+        a->ignorarCaixa = 0;
+        int no = novoNoClasse(a, c);
+        a->ignorarCaixa = salvo;
+        return no;
+    }
+    return novoNoClasse(a, c);
+}
+
+// Analisa um átomo: literal, '.', classe, escape ou grupo
+static int analisarAtomo(Analisador* a) {
+    ConjuntoBytes c = { { 0, 0, 0, 0 } };
+    char ch = atual(a);
+
+    switch (ch) {
+        case '(': {
+            a->pos++;
+            int no = (atual(a) == ')') ? novoNo(a, NO_VAZIO, -1, -1) : analisarAlternativa(a);
+            if (atual(a) != ')') {
+                a->suportado = 0;
+                return -1;
+            }
+            a->pos++;
+            return no;
+        }
+        case '[':
+            a->pos++;
+            return analisarColchetes(a);
+        case '.':
+            a->pos++;
+            conjuntoAdicionarFaixa(&c, 1, 255);
+            return novoNoClasse(a, c);
+        case '\\': {
+            char e = a->padrao[a->pos + 1];
+            if (e == '\0') {
+                a->suportado = 0;
+                return -1;
+            }
+            a->pos += 2;
+            if (e == 'w' || e == 'W') {
+                adicionarClasseNomeada(&c, "alnum", 5);
+                conjuntoAdicionar(&c, '_');
+            } else if (e == 's' || e == 'S') {
+                adicionarClasseNomeada(&c, "space", 5);
+            } else if ((e >= 'a' && e <= 'z') || (e >= 'A' && e <= 'Z') || (e >= '0' && e <= '9')) {
+                // \b, \B, \<, \d, retro-referências...: fora do subconjunto
+                a->suportado = 0;
+                return -1;
+            } else {
+                conjuntoAdicionar(&c, (unsigned char)e);
+                return novoNoClasse(a, c);
+            }
+            if (e == 'W' || e == 'S') {
+                for (int i = 0; i < 4; i++) c.bits[i] = ~c.bits[i];
+                c.bits[0] &= ~(uint64_t)1;
+            }
+            return novoNoClasse(a, c);
+        }
+        case '*': case '+': case '?': case '{': case '|': case ')': case '^': case '$': case '\0':
+            // Quantificador sem operando ou âncora no meio do padrão
+            a->suportado = 0;
+            return -1;
+        default:
+            a->pos++;
+            conjuntoAdicionar(&c, (unsigned char)ch);
+            return novoNoClasse(a, c);
+    }
+}
+
+static int lerNumero(Analisador* a) {
+    if (atual(a) < '0' || atual(a) > '9') {
+        return -1;
+    }
+    int valor = 0;
+    while (atual(a) >= '0' && atual(a) <= '9') {
+        valor = valor * 10 + (atual(a) - '0');
+        if (valor > MAX_REPETICAO) {
+            return -1;
+        }
+        a->pos++;
+    }
+    return valor;
+}
+
+// Analisa um átomo seguido de quantificadores
+static int analisarRepeticao(Analisador* a) {
+    int no = analisarAtomo(a);
+
+    while (a->suportado) {
+        char ch = atual(a);
+        if (ch == '*') {
+            no = novoNo(a, NO_ESTRELA, no, -1);
+            a->pos++;
+        } else if (ch == '+') {
+            no = novoNo(a, NO_MAIS, no, -1);
+            a->pos++;
+        } else if (ch == '?') {
+            no = novoNo(a, NO_OPCIONAL, no, -1);
+            a->pos++;
+        } else if (ch == '{') {
+            a->pos++;
+            int minimo = lerNumero(a);
+            int maximo = minimo;
+            if (atual(a) == ',') {
+                a->pos++;
+                maximo = (atual(a) == '}') ? -1 : lerNumero(a);
+            }
+            if (minimo < 0 || atual(a) != '}' || (maximo != -1 && maximo < minimo)) {
+                a->suportado = 0;
+                return -1;
+            }
+            a->pos++;
+            no = novoNo(a, NO_REPETICAO, no, -1);
+            if (no >= 0) {
+                a->nos[no].minimo = minimo;
+                a->nos[no].maximo = maximo;
+            }
+        } else {
+            break;
+        }
+    }
+    return no;
+}
+
+static int fimDeConcatenacao(Analisador* a) {
+    char ch = atual(a);
+    if (ch == '\0' || ch == '|' || ch == ')') {
+        return 1;
+    }
+    // '$' final é tratado como âncora pelo chamador
+    return ch == '$' && a->padrao[a->pos + 1] == '\0';
+}
+
+static int analisarConcatenacao(Analisador* a) {
+    if (fimDeConcatenacao(a)) {
+        return novoNo(a, NO_VAZIO, -1, -1);
+    }
+
+    int no = analisarRepeticao(a);
+    while (a->suportado && !fimDeConcatenacao(a)) {
+        int direita = analisarRepeticao(a);
+        no = novoNo(a, NO_CONCATENACAO, no, direita);
+    }
+    return no;
+}
+
+static int analisarAlternativa(Analisador* a) {
+    int no = analisarConcatenacao(a);
+    while (a->suportado && atual(a) == '|') {
+        a->pos++;
+        int direita = analisarConcatenacao(a);
+        no = novoNo(a, NO_ALTERNATIVA, no, direita);
+    }
+    return no;
+}
+
+// ==================== NFA DE THOMPSON ====================
+
+typedef enum {
+    EST_CLASSE,   // Consome um byte da classe e vai para 'saida'
+    EST_DIVISAO,  // Transição vazia para 'saida' e 'saida1'
+    EST_ACEITA
+} TipoEstado;
+
+typedef struct {
+    TipoEstado tipo;
+    int classe;
+    int saida;
+    int saida1;
+} EstadoNFA;
+
+typedef struct {
+    EstadoNFA* estados;
+    int num;
+    int cap;
+    int inicio;
+    int excedeu;
+} NFA;
+
+// Fragmento de NFA: estado inicial + lista de saídas pendentes.
+// A lista é codificada nos próprios campos de saída (técnica de Thompson/Cox):
+// cada elemento é (estado * 2 + campo) e o campo guarda o próximo elemento.
+typedef struct {
+    int inicio;
+    int pendentes;
+} Fragmento;
+
+static int novoEstado(NFA* nfa, TipoEstado tipo, int classe, int saida, int saida1) {
+    if (nfa->num >= MAX_ESTADOS_NFA) {
+        nfa->excedeu = 1;
+        return -1;
+    }
+    if (nfa->num == nfa->cap) {
+        int novaCap = nfa->cap ? nfa->cap * 2 : 64;
+        EstadoNFA* novos = realloc(nfa->estados, novaCap * sizeof(EstadoNFA));
+        if (novos == NULL) {
+            nfa->excedeu = 1;
+            return -1;
+        }
+        nfa->estados = novos;
+        nfa->cap = novaCap;
+    }
+
+    EstadoNFA* e = &nfa->estados[nfa->num];
+    e->tipo = tipo;
+    e->classe = classe;
+    e->saida = saida;
+    e->saida1 = saida1;
+    return nfa->num++;
+}
+
+static int* campoPendente(NFA* nfa, int elemento) {
+    EstadoNFA* e = &nfa->estados[elemento >> 1];
+    return (elemento & 1) ? &e->saida1 : &e->saida;
+}
+
+static void conectar(NFA* nfa, int lista, int destino) {
+    while (lista != -1) {
+        int* campo = campoPendente(nfa, lista);
+        lista = *campo;
+        *campo = destino;
+    }
+}
+
+static int juntarListas(NFA* nfa, int lista1, int lista2) {
+    if (lista1 == -1) {
+        return lista2;
+    }
+    int ultimo = lista1;
+    while (*campoPendente(nfa, ultimo) != -1) {
+        ultimo = *campoPendente(nfa, ultimo);
+    }
+    *campoPendente(nfa, ultimo) = lista2;
+    return lista1;
+}
+
+static Fragmento fragmentoVazio(NFA* nfa) {
+    int s = novoEstado(nfa, EST_DIVISAO, -1, -1, -3); // saida1 = -3: sem segunda saída
+    Fragmento f = { s, s < 0 ? -1 : s * 2 };
+    return f;
+}
+
+static Fragmento concatenarFragmentos(NFA* nfa, Fragmento a, Fragmento b) {
+    conectar(nfa, a.pendentes, b.inicio);
+    Fragmento f = { a.inicio, b.pendentes };
+    return f;
+}
+
+// Converte a árvore em NFA; com 'reverso' = 1 gera o autômato da linguagem invertida
+static Fragmento compilarNo(NFA* nfa, const NoRegex* nos, int id, int reverso) {
+    Fragmento erro = { -1, -1 };
+    if (nfa->excedeu || id < 0) {
+        nfa->excedeu = 1;
+        return erro;
+    }
+
+    const NoRegex* no = &nos[id];
+    switch (no->tipo) {
+        case NO_CLASSE: {
+            int s = novoEstado(nfa, EST_CLASSE, no->classe, -1, -3);
+            Fragmento f = { s, s * 2 };
+            return (s < 0) ? erro : f;
+        }
+        case NO_VAZIO:
+            return fragmentoVazio(nfa);
+        case NO_CONCATENACAO: {
+            Fragmento a = compilarNo(nfa, nos, reverso ? no->direita : no->esquerda, reverso);
+            Fragmento b = compilarNo(nfa, nos, reverso ? no->esquerda : no->direita, reverso);
+            if (nfa->excedeu) return erro;
+            return concatenarFragmentos(nfa, a, b);
+        }
+        case NO_ALTERNATIVA: {
+            Fragmento a = compilarNo(nfa, nos, no->esquerda, reverso);
+            Fragmento b = compilarNo(nfa, nos, no->direita, reverso);
+            if (nfa->excedeu) return erro;
+            int s = novoEstado(nfa, EST_DIVISAO, -1, a.inicio, b.inicio);
+            if (s < 0) return erro;
+            Fragmento f = { s, juntarListas(nfa, a.pendentes, b.pendentes) };
+            return f;
+        }
+        case NO_ESTRELA: {
+            Fragmento a = compilarNo(nfa, nos, no->esquerda, reverso);
+            if (nfa->excedeu) return erro;
+            int s = novoEstado(nfa, EST_DIVISAO, -1, a.inicio, -1);
+            if (s < 0) return erro;
+            conectar(nfa, a.pendentes, s);
+            Fragmento f = { s, s * 2 + 1 };
+            return f;
+        }
+        case NO_MAIS: {
+            Fragmento a = compilarNo(nfa, nos, no->esquerda, reverso);
+            if (nfa->excedeu) return erro;
+            int s = novoEstado(nfa, EST_DIVISAO, -1, a.inicio, -1);
+            if (s < 0) return erro;
+            conectar(nfa, a.pendentes, s);
+            Fragmento f = { a.inicio, s * 2 + 1 };
+            return f;
+        }
+        case NO_OPCIONAL: {
+            Fragmento a = compilarNo(nfa, nos, no->esquerda, reverso);
+            if (nfa->excedeu) return erro;
+            int s = novoEstado(nfa, EST_DIVISAO, -1, a.inicio, -1);
+            if (s < 0) return erro;
+            Fragmento f = { s, juntarListas(nfa, a.pendentes, s * 2 + 1) };
+            return f;
+        }
+        case NO_REPETICAO: {
+            // a{m,n} = a...a (m vezes) seguido de (n - m) cópias de a? (ou a* se ilimitado)
+            Fragmento resultado = fragmentoVazio(nfa);
+            for (int i = 0; i < no->minimo && !nfa->excedeu; i++) {
+                Fragmento a = compilarNo(nfa, nos, no->esquerda, reverso);
+                if (nfa->excedeu) return erro;
+                resultado = concatenarFragmentos(nfa, resultado, a);
+            }
+            if (no->maximo == -1) {
+                Fragmento a = compilarNo(nfa, nos, no->esquerda, reverso);
+                if (nfa->excedeu) return erro;
+                int s = novoEstado(nfa, EST_DIVISAO, -1, a.inicio, -1);
+                if (s < 0) return erro;
+                conectar(nfa, a.pendentes, s);
+                Fragmento f = { s, s * 2 + 1 };
+                resultado = concatenarFragmentos(nfa, resultado, f);
+            } else {
+                for (int i = no->minimo; i < no->maximo && !nfa->excedeu; i++) {
+                    Fragmento a = compilarNo(nfa, nos, no->esquerda, reverso);
+                    if (nfa->excedeu) return erro;
+                    int s = novoEstado(nfa, EST_DIVISAO, -1, a.inicio, -1);
+                    if (s < 0) return erro;
+                    Fragmento f = { s, juntarListas(nfa, a.pendentes, s * 2 + 1) };
+                    resultado = concatenarFragmentos(nfa, resultado, f);
+                }
+            }
+            return nfa->excedeu ? erro : resultado;
+        }
+    }
+    return erro;
+}
+
+static int construirNFA(NFA* nfa, const NoRegex* nos, int raiz, int reverso) {
+    memset(nfa, 0, sizeof(NFA));
+    Fragmento f = compilarNo(nfa, nos, raiz, reverso);
+    if (nfa->excedeu) {
+        return 0;
+    }
+    int aceita = novoEstado(nfa, EST_ACEITA, -1, -1, -3);
+    if (aceita < 0) {
+        return 0;
+    }
+    conectar(nfa, f.pendentes, aceita);
+    nfa->inicio = f.inicio;
+    return 1;
+}
+
+// ==================== DFA PREGUIÇOSO ====================
+
+typedef struct {
+    int* conjunto;     // Estados do NFA (apenas CLASSE e ACEITA), ordenados
+    int tamanho;
+    uint32_t hash;
+    int aceita;        // O conjunto contém o estado de aceitação?
+    int proximo[256];  // Transições já calculadas (TRANSICAO_DESCONHECIDA se não)
+} EstadoDFA;
+
+typedef struct {
+    const NFA* nfa;
+    const ConjuntoBytes* classes;
+    int naoAncorado;   // Reinsere o estado inicial a cada passo (busca em qualquer posição)
+
+    EstadoDFA* estados;
+    int num;
+    int inicio;        // Índice do estado inicial (-1 se precisa recalcular)
+    int* tabelaHash;   // Endereçamento aberto: índice do estado ou -1
+    int capHash;
+    long esvaziamentos;
+
+    // Áreas de trabalho para o cálculo de conjuntos
+    int* marca;
+    int geracao;
+    int* pilha;
+    int* temporario;
+    int numTemporario;
+} DFA;
+
+static int inicializarDFA(DFA* dfa, const NFA* nfa, const ConjuntoBytes* classes, int naoAncorado) {
+    memset(dfa, 0, sizeof(DFA));
+    dfa->nfa = nfa;
+    dfa->classes = classes;
+    dfa->naoAncorado = naoAncorado;
+    dfa->inicio = -1;
+    dfa->capHash = MAX_ESTADOS_DFA * 2;
+    dfa->estados = malloc(MAX_ESTADOS_DFA * sizeof(EstadoDFA));
+    dfa->tabelaHash = malloc(dfa->capHash * sizeof(int));
+    dfa->marca = calloc(nfa->num, sizeof(int));
+    dfa->pilha = malloc(nfa->num * sizeof(int));
+    dfa->temporario = malloc(nfa->num * sizeof(int));
+    if (dfa->estados == NULL || dfa->tabelaHash == NULL || dfa->marca == NULL ||
+        dfa->pilha == NULL || dfa->temporario == NULL) {
+        return 0;
+    }
+    for (int i = 0; i < dfa->capHash; i++) {
+        dfa->tabelaHash[i] = -1;
+    }
+    return 1;
+}
+
+static void esvaziarDFA(DFA* dfa) {
+    for (int i = 0; i < dfa->num; i++) {
+        free(dfa->estados[i].conjunto);
+    }
+    dfa->num = 0;
+    dfa->inicio = -1;
+    for (int i = 0; i < dfa->capHash; i++) {
+        dfa->tabelaHash[i] = -1;
+    }
+}
+
+static void liberarDFA(DFA* dfa) {
+    if (dfa->estados != NULL) {
+        esvaziarDFA(dfa);
+    }
+    free(dfa->estados);
+    free(dfa->tabelaHash);
+    free(dfa->marca);
+    free(dfa->pilha);
+    free(dfa->temporario);
+}
+
+// Adiciona ao conjunto temporário o fecho-ε de um estado do NFA
+static void adicionarFecho(DFA* dfa, int estado) {
+    int topo = 0;
+    if (estado < 0 || dfa->marca[estado] == dfa->geracao) {
+        return;
+    }
+    dfa->marca[estado] = dfa->geracao;
+    dfa->pilha[topo++] = estado;
+
+    while (topo > 0) {
+        int s = dfa->pilha[--topo];
+        const EstadoNFA* e = &dfa->nfa->estados[s];
+        if (e->tipo == EST_DIVISAO) {
+            int saidas[2] = { e->saida, e->saida1 };
+            for (int k = 0; k < 2; k++) {
+                int t = saidas[k];
+                if (t >= 0 && dfa->marca[t] != dfa->geracao) {
+                    dfa->marca[t] = dfa->geracao;
+                    dfa->pilha[topo++] = t;
+                }
+            }
+        } else {
+            dfa->temporario[dfa->numTemporario++] = s;
+        }
+    }
+}
+
+static int compararInteiros(const void* a, const void* b) {
+    return (*(const int*)a > *(const int*)b) - (*(const int*)a < *(const int*)b);
+}
+
+// Procura (ou cria) o estado do DFA correspondente ao conjunto temporário.
+// Se o cache estiver cheio, ele é esvaziado antes de criar o novo estado.
+static int obterEstadoDFA(DFA* dfa) {
+    int n = dfa->numTemporario;
+    qsort(dfa->temporario, n, sizeof(int), compararInteiros);
+
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < n; i++) {
+        hash = (hash ^ (uint32_t)dfa->temporario[i]) * 16777619u;
+    }
+
+    int pos = (int)(hash & (uint32_t)(dfa->capHash - 1));
+    while (dfa->tabelaHash[pos] != -1) {
+        EstadoDFA* e = &dfa->estados[dfa->tabelaHash[pos]];
+        if (e->hash == hash && e->tamanho == n &&
+            memcmp(e->conjunto, dfa->temporario, n * sizeof(int)) == 0) {
+            return dfa->tabelaHash[pos];
+        }
+        pos = (pos + 1) & (dfa->capHash - 1);
+    }
+
+    if (dfa->num == MAX_ESTADOS_DFA) {
+        esvaziarDFA(dfa);
+        dfa->esvaziamentos++;
+        pos = (int)(hash & (uint32_t)(dfa->capHash - 1));
+    }
+
+    int id = dfa->num++;
+    EstadoDFA* e = &dfa->estados[id];
+    e->conjunto = malloc((n > 0 ? n : 1) * sizeof(int));
+    memcpy(e->conjunto, dfa->temporario, n * sizeof(int));
+    e->tamanho = n;
+    e->hash = hash;
+    e->aceita = 0;
+    for (int i = 0; i < n; i++) {
+        if (dfa->nfa->estados[e->conjunto[i]].tipo == EST_ACEITA) {
+            e->aceita = 1;
+        }
+    }
+    for (int c = 0; c < 256; c++) {
+        e->proximo[c] = TRANSICAO_DESCONHECIDA;
+    }
+    dfa->tabelaHash[pos] = id;
+    return id;
+}
+
+static int estadoInicialDFA(DFA* dfa) {
+    if (dfa->inicio == -1) {
+        dfa->geracao++;
+        dfa->numTemporario = 0;
+        adicionarFecho(dfa, dfa->nfa->inicio);
+        dfa->inicio = obterEstadoDFA(dfa);
+    }
+    return dfa->inicio;
+}
+
+// Calcula a transição de um estado do DFA com o byte c (caminho lento)
+static int calcularTransicao(DFA* dfa, int estado, unsigned char c) {
+    dfa->geracao++;
+    dfa->numTemporario = 0;
+
+    const EstadoDFA* e = &dfa->estados[estado];
+    for (int i = 0; i < e->tamanho; i++) {
+        const EstadoNFA* s = &dfa->nfa->estados[e->conjunto[i]];
+        if (s->tipo == EST_CLASSE && conjuntoContem(&dfa->classes[s->classe], c)) {
+            adicionarFecho(dfa, s->saida);
+        }
+    }
+    if (dfa->naoAncorado) {
+        adicionarFecho(dfa, dfa->nfa->inicio);
+    }
+
+    if (dfa->numTemporario == 0) {
+        dfa->estados[estado].proximo[c] = ESTADO_MORTO;
+        return ESTADO_MORTO;
+    }
+
+    long antes = dfa->esvaziamentos;
+    int destino = obterEstadoDFA(dfa);
+    if (dfa->esvaziamentos == antes) {
+        // Só guarda a transição se 'estado' continua válido (sem esvaziamento)
+        dfa->estados[estado].proximo[c] = destino;
+    }
+    return destino;
+}
+
+// Um passo do DFA: na maioria das vezes é uma única consulta à tabela
+static inline int passoDFA(DFA* dfa, int estado, unsigned char c) {
+    int destino = dfa->estados[estado].proximo[c];
+    return (destino != TRANSICAO_DESCONHECIDA) ? destino : calcularTransicao(dfa, estado, c);
+}
+
+// ==================== REGEX COMPILADA E CACHE ====================
+
+// Par (estado do DFA ancorado, posição) a partir do qual não há mais aceite
+typedef struct {
+    int estado;
+    int posicao;
+    int proximo;             // Próximo par da mesma posição
+    long epoca;              // dfaAncorado.esvaziamentos quando foi anotado
+} ParMemo;
+
+typedef struct RegexCompilada {
+    char* padrao;
+    int case_sensitive;
+    int usaDFA;              // 1 se o padrão pertence ao subconjunto suportado
+    int ancoradoInicio;      // Padrão começa com '^'
+    int ancoradoFim;         // Padrão termina com '$'
+    ConjuntoBytes* classes;
+    NFA nfaDireto;
+    NFA nfaReverso;
+    DFA dfaBusca;            // Direto, não ancorado (existe correspondência?)
+    DFA dfaAncorado;         // Direto, ancorado (fim mais longo a partir de um início)
+    DFA dfaReverso;          // Reverso (onde começam correspondências)
+    unsigned char* inicios;  // Área de trabalho reutilizada entre chamadas
+    size_t capInicios;
+    int* memoCabeca;         // Por posição: primeiro par anotado por fimMaisLongo (-1 se nenhum)
+    size_t capMemoCabeca;
+    ParMemo* memo;           // Pares (estado, posição) sem aceite à frente
+    int numMemo;
+    int capMemo;
+    long bytesLidosFim;      // Bytes lidos por fimMaisLongo (usado no teste de linearidade)
+    regex_t posix;           // Usado quando o padrão está fora do subconjunto
+    int posixValido;
+    struct RegexCompilada* proximo;
+} RegexCompilada;
+
+#define NUM_BALDES_CACHE 64
+
+static RegexCompilada* cacheRegex[NUM_BALDES_CACHE];
+static long compilacoesRealizadas = 0;
+
+static uint32_t hashPadrao(const char* padrao, int case_sensitive) {
+    uint32_t hash = 2166136261u ^ (uint32_t)case_sensitive;
+    for (const unsigned char* p = (const unsigned char*)padrao; *p; p++) {
+        hash = (hash ^ *p) * 16777619u;
+    }
+    return hash;
+}
+
+static void liberarRegexCompilada(RegexCompilada* r) {
+    if (r->usaDFA) {
+        liberarDFA(&r->dfaBusca);
+        liberarDFA(&r->dfaAncorado);
+        liberarDFA(&r->dfaReverso);
+    }
+    free(r->nfaDireto.estados);
+    free(r->nfaReverso.estados);
+    free(r->classes);
+    free(r->inicios);
+    free(r->memoCabeca);
+    free(r->memo);
+    if (r->posixValido) {
+        regfree(&r->posix);
+    }
+    free(r->padrao);
+    free(r);
+}
+
+// Tenta compilar o padrão para o motor DFA; retorna 0 se estiver fora do subconjunto
+static int compilarParaDFA(RegexCompilada* r) {
+    const char* padrao = r->padrao;
+    Analisador a;
+    memset(&a, 0, sizeof(a));
+    a.suportado = 1;
+    a.ignorarCaixa = !r->case_sensitive;
+
+    if (padrao[0] == '^') {
+        r->ancoradoInicio = 1;
+        padrao++;
+    }
+    a.padrao = padrao;
+    int raiz = analisarAlternativa(&a);
+    // '$' que sobrou no fim é âncora: os escapes ("\$", "\\") já foram
+    // consumidos pelo analisador, então não é preciso olhar o texto cru
+    if (a.suportado && atual(&a) == '$' && padrao[a.pos + 1] == '\0') {
+        if (raiz >= 0 && a.nos[raiz].tipo == NO_ALTERNATIVA) {
+            // Em "a|b$" a âncora vale só para o último ramo: fica com o regcomp
+            a.suportado = 0;
+        } else {
+            r->ancoradoFim = 1;
+            a.pos++;
+        }
+    }
+    if (r->ancoradoInicio && raiz >= 0 && a.nos[raiz].tipo == NO_ALTERNATIVA) {
+        a.suportado = 0;                      // "^a|b": mesmo caso, no primeiro ramo
+    }
+    if (!a.suportado || atual(&a) != '\0' || raiz < 0) {
+        free(a.nos);
+        free(a.classes);
+        return 0;
+    }
+
+    int ok = construirNFA(&r->nfaDireto, a.nos, raiz, 0) &&
+             construirNFA(&r->nfaReverso, a.nos, raiz, 1);
+    free(a.nos);
+    r->classes = a.classes;
+    if (!ok) {
+        return 0;
+    }
+
+    return inicializarDFA(&r->dfaBusca, &r->nfaDireto, r->classes, !r->ancoradoInicio) &&
+           inicializarDFA(&r->dfaAncorado, &r->nfaDireto, r->classes, 0) &&
+           inicializarDFA(&r->dfaReverso, &r->nfaReverso, r->classes, !r->ancoradoFim);
+}
+
+// Função para obter uma regex compilada do cache (compila na primeira vez)
+// Parâmetros:
+// - padrao: padrão regex (sintaxe POSIX estendida)
+// - case_sensitive: 1 para busca sensível a maiúsculas, 0 para insensível
+// Retorna:
+// - Ponteiro para a regex compilada (pertence ao cache, não liberar)
+// - NULL se o padrão for inválido
+RegexCompilada* obterRegexCompilada(const char* padrao, int case_sensitive) {
+    case_sensitive = case_sensitive ? 1 : 0;
+    uint32_t balde = hashPadrao(padrao, case_sensitive) % NUM_BALDES_CACHE;
+
+    for (RegexCompilada* r = cacheRegex[balde]; r != NULL; r = r->proximo) {
+        if (r->case_sensitive == case_sensitive && strcmp(r->padrao, padrao) == 0) {
+            return r;
+        }
+    }
+
+    RegexCompilada* r = calloc(1, sizeof(RegexCompilada));
+    if (r == NULL) {
+        return NULL;
+    }
+    r->padrao = malloc(strlen(padrao) + 1);
+    if (r->padrao == NULL) {
+        free(r);
+        return NULL;
+    }
+    strcpy(r->padrao, padrao);
+    r->case_sensitive = case_sensitive;
+    compilacoesRealizadas++;
+
+    r->usaDFA = compilarParaDFA(r);
+    if (!r->usaDFA) {
+        // Fora do subconjunto: usa o regcomp, mas compila só uma vez
+        liberarDFA(&r->dfaBusca);
+        liberarDFA(&r->dfaAncorado);
+        liberarDFA(&r->dfaReverso);
+        int flags = REG_EXTENDED | (case_sensitive ? 0 : REG_ICASE);
+        int resultado = regcomp(&r->posix, padrao, flags);
+        if (resultado != 0) {
+            char mensagem_erro[256];
+            regerror(resultado, &r->posix, mensagem_erro, sizeof(mensagem_erro));
+            printf("Erro ao compilar regex \"%s\": %s\n", padrao, mensagem_erro);
+            r->posixValido = 0;
+            liberarRegexCompilada(r);
+            return NULL;
+        }
+        r->posixValido = 1;
+    }
+
+    r->proximo = cacheRegex[balde];
+    cacheRegex[balde] = r;
+    return r;
+}
+
+// Libera todas as regex guardadas no cache
+void liberarCacheRegex(void) {
+    for (int i = 0; i < NUM_BALDES_CACHE; i++) {
+        RegexCompilada* r = cacheRegex[i];
+        while (r != NULL) {
+            RegexCompilada* proximo = r->proximo;
+            liberarRegexCompilada(r);
+            r = proximo;
+        }
+        cacheRegex[i] = NULL;
+    }
+}
+
+// ==================== BUSCAS ====================
+
+// Existe alguma correspondência? Uma única passada, sem retrocesso
+static int existeCorrespondenciaDFA(RegexCompilada* r, const char* texto) {
+    DFA* dfa = r->ancoradoInicio ? &r->dfaAncorado : &r->dfaBusca;
+    int estado = estadoInicialDFA(dfa);
+
+    if (dfa->estados[estado].aceita && !r->ancoradoFim) {
+        return 1;
+    }
+
+    for (const unsigned char* p = (const unsigned char*)texto; *p; p++) {
+        estado = passoDFA(dfa, estado, *p);
+        if (estado == ESTADO_MORTO) {
+            return 0;
+        }
+        if (dfa->estados[estado].aceita && !r->ancoradoFim) {
+            return 1;
+        }
+    }
+    return dfa->estados[estado].aceita;
+}
+
+// Prepara a memória de fimMaisLongo para um texto de n bytes
+static int prepararMemo(RegexCompilada* r, size_t n) {
+    if (r->capMemoCabeca < n + 1) {
+        int* novo = realloc(r->memoCabeca, (n + 1) * sizeof(int));
+        if (novo == NULL) {
+            return 0;
+        }
+        r->memoCabeca = novo;
+        r->capMemoCabeca = n + 1;
+    }
+    memset(r->memoCabeca, 0xFF, (n + 1) * sizeof(int));
+    r->numMemo = 0;
+    return 1;
+}
+
+static int memoContem(const RegexCompilada* r, int estado, size_t posicao) {
+    for (int i = r->memoCabeca[posicao]; i != -1; i = r->memo[i].proximo) {
+        if (r->memo[i].estado == estado && r->memo[i].epoca == r->dfaAncorado.esvaziamentos) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Sem memória disponível o par simplesmente não é anotado (só custa tempo)
+static void anotarMemo(RegexCompilada* r, int estado, size_t posicao) {
+    if (r->numMemo == r->capMemo) {
+        int novaCap = r->capMemo ? r->capMemo * 2 : 256;
+        ParMemo* novo = realloc(r->memo, novaCap * sizeof(ParMemo));
+        if (novo == NULL) {
+            return;
+        }
+        r->memo = novo;
+        r->capMemo = novaCap;
+    }
+    ParMemo* m = &r->memo[r->numMemo];
+    m->estado = estado;
+    m->posicao = (int)posicao;
+    m->proximo = r->memoCabeca[posicao];
+    m->epoca = r->dfaAncorado.esvaziamentos;
+    r->memoCabeca[posicao] = r->numMemo++;
+}
+
+// Remove os pares anotados depois de 'marca' (em ordem inversa)
+static void desfazerMemo(RegexCompilada* r, int marca) {
+    while (r->numMemo > marca) {
+        const ParMemo* m = &r->memo[--r->numMemo];
+        r->memoCabeca[m->posicao] = m->proximo;
+    }
+}
+
+// Fim da correspondência mais longa que começa em 'inicio' (-1 se não houver)
+//
+// O DFA segue até morrer ou o texto acabar, mesmo depois do último aceite:
+// com "a|a.*b" em "aaa...a", cada início casa só "a", mas a varredura vai
+// até o fim procurando um 'b', e todas as correspondências custariam O(n²).
+// Por isso os pares (estado, posição) percorridos depois do último aceite
+// ficam anotados (prepararMemo): como o DFA é determinístico, uma varredura
+// posterior que chegue ao mesmo par também não aceitaria mais nada e pode
+// parar ali. Cada par é anotado uma vez, e o trecho até o aceite é a própria
+// correspondência, que não se sobrepõe às seguintes: cada byte é lido no
+// máximo (estados do DFA + 1) vezes, independente do tamanho do texto
+static long fimMaisLongo(RegexCompilada* r, const char* texto, size_t n, size_t inicio) {
+    DFA* dfa = &r->dfaAncorado;
+    int estado = estadoInicialDFA(dfa);
+    int marca = r->numMemo;
+    long ultimo = -1;
+
+    for (size_t j = inicio;; j++) {
+        if (dfa->estados[estado].aceita && (!r->ancoradoFim || j == n)) {
+            // Os pares anotados nesta varredura têm este aceite à frente
+            ultimo = (long)j;
+            desfazerMemo(r, marca);
+        } else if (memoContem(r, estado, j)) {
+            break;
+        } else {
+            anotarMemo(r, estado, j);
+        }
+        if (j == n) {
+            break;
+        }
+        estado = passoDFA(dfa, estado, (unsigned char)texto[j]);
+        r->bytesLidosFim++;
+        if (estado == ESTADO_MORTO) {
+            break;
+        }
+    }
+    return ultimo;
+}
+
+// Marca, em uma passada da direita para a esquerda, as posições onde começa
+// alguma correspondência (inicios[i] = 1 se texto[i..j) casa para algum j)
+static int marcarInicios(RegexCompilada* r, const char* texto, size_t n) {
+    if (r->capInicios < n + 1) {
+        unsigned char* novo = realloc(r->inicios, n + 1);
+        if (novo == NULL) {
+            return 0;
+        }
+        r->inicios = novo;
+        r->capInicios = n + 1;
+    }
+
+    DFA* dfa = &r->dfaReverso;
+    int estado = estadoInicialDFA(dfa);
+    r->inicios[n] = (unsigned char)dfa->estados[estado].aceita;
+
+    size_t i = n;
+    while (i > 0) {
+        i--;
+        estado = passoDFA(dfa, estado, (unsigned char)texto[i]);
+        if (estado == ESTADO_MORTO) {
+            memset(r->inicios, 0, i + 1);
+            break;
+        }
+        r->inicios[i] = (unsigned char)dfa->estados[estado].aceita;
+    }
+    return 1;
+}
+
+static void preencherCorrespondencia(Correspondencia* c, const char* texto, long inicio, long fim) {
+    c->inicio = (int)inicio;
+    c->fim = (int)fim;
+    long tamanho = fim - inicio;
+    if (tamanho < (long)(sizeof(c->texto) - 1)) {
+        memcpy(c->texto, texto + inicio, (size_t)tamanho);
+        c->texto[tamanho] = '\0';
+    } else {
+        c->texto[0] = '\0';
+    }
+}
+
+// Função para buscar um padrão em uma string (mesma interface de buscarComRegex)
+// Parâmetros:
+// - texto: string onde será feita a busca
+// - padrao: padrão regex a ser buscado
+// - case_sensitive: 1 para busca sensível a maiúsculas, 0 para insensível
+// Retorna:
+// - 1 se o padrão foi encontrado
+// - 0 se não foi encontrado
+// - -1 em caso de erro
+int buscarComRegexCache(const char* texto, const char* padrao, int case_sensitive) {
+    if (texto == NULL || padrao == NULL) {
+        return -1;
+    }
+
+    RegexCompilada* r = obterRegexCompilada(padrao, case_sensitive);
+    if (r == NULL) {
+        return -1;
+    }
+
+    if (r->usaDFA) {
+        return existeCorrespondenciaDFA(r, texto);
+    }
+    return regexec(&r->posix, texto, 0, NULL, 0) == 0 ? 1 : 0;
+}
+
+// Função para encontrar todas as correspondências de um padrão
+// (mesma interface de encontrarTodasCorrespondencias)
+// Parâmetros:
+// - texto: string onde será feita a busca
+// - padrao: padrão regex a ser buscado
+// - correspondencias: array para armazenar os resultados
+// - max_correspondencias: tamanho máximo do array
+// - case_sensitive: 1 para busca sensível a maiúsculas, 0 para insensível
+// Retorna:
+// - Número de correspondências encontradas
+// - -1 em caso de erro
+//
+// Diferença em relação à versão original: '^' casa apenas no início do
+// texto (a original reaplicava o padrão a cada sufixo, e '^' casava de novo)
+int encontrarTodasCorrespondenciasCache(const char* texto, const char* padrao,
+                                        Correspondencia correspondencias[], int max_correspondencias,
+                                        int case_sensitive) {
+    if (texto == NULL || padrao == NULL || correspondencias == NULL) {
+        return -1;
+    }
+
+    RegexCompilada* r = obterRegexCompilada(padrao, case_sensitive);
+    if (r == NULL) {
+        return -1;
+    }
+
+    int contador = 0;
+    size_t n = strlen(texto);
+
+    if (!r->usaDFA) {
+        regmatch_t match[1];
+        size_t pos = 0;
+        while (contador < max_correspondencias &&
+               regexec(&r->posix, texto + pos, 1, match, pos > 0 ? REG_NOTBOL : 0) == 0) {
+            long inicio = (long)pos + match[0].rm_so;
+            long fim = (long)pos + match[0].rm_eo;
+            preencherCorrespondencia(&correspondencias[contador++], texto, inicio, fim);
+            pos = (size_t)fim;
+            if (inicio == fim) {
+                if (pos >= n) break;
+                pos++;
+            }
+        }
+        return contador;
+    }
+
+    if (!prepararMemo(r, n)) {
+        return -1;
+    }
+
+    if (r->ancoradoInicio) {
+        long fim = fimMaisLongo(r, texto, n, 0);
+        if (fim >= 0 && max_correspondencias > 0) {
+            preencherCorrespondencia(&correspondencias[contador++], texto, 0, fim);
+        }
+        return contador;
+    }
+
+    if (!marcarInicios(r, texto, n)) {
+        return -1;
+    }
+
+    size_t pos = 0;
+    while (contador < max_correspondencias && pos <= n) {
+        while (pos <= n && !r->inicios[pos]) {
+            pos++;
+        }
+        if (pos > n) {
+            break;
+        }
+
+        long fim = fimMaisLongo(r, texto, n, pos);
+        preencherCorrespondencia(&correspondencias[contador++], texto, (long)pos, fim);
+
+        if ((size_t)fim == pos) {
+            if (pos >= n) break;
+            pos++;
+        } else {
+            pos = (size_t)fim;
+        }
+    }
+    return contador;
+}
+
+// Função para validar formato de email (mesmo padrão de validarEmail)
+int validarEmailDFA(const char* email) {
+    const char* padrao = "^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\\.[a-zA-Z]{2,}$";
+    return buscarComRegexCache(email, padrao, 1);
+}
+
+// Função para extrair números de uma string (mesmo padrão de extrairNumeros)
+int extrairNumerosDFA(const char* texto, Correspondencia numeros[], int max_numeros) {
+    return encontrarTodasCorrespondenciasCache(texto, "[0-9]+", numeros, max_numeros, 1);
+}
+
+// ==================== VERSÕES ORIGINAIS (REGCOMP A CADA CHAMADA) ====================
+
+static int buscarComRegexOriginal(const char* texto, const char* padrao, int case_sensitive) {
+    regex_t regex;
+    if (regcomp(&regex, padrao, REG_EXTENDED | (case_sensitive ? 0 : REG_ICASE)) != 0) {
+        return -1;
+    }
+    int resultado = regexec(&regex, texto, 0, NULL, 0);
+    regfree(&regex);
+    return (resultado == 0) ? 1 : 0;
+}
+
+static int encontrarTodasOriginal(const char* texto, const char* padrao,
+                                  Correspondencia correspondencias[], int max_correspondencias) {
+    regex_t regex;
+    regmatch_t match[1];
+    int contador = 0;
+    if (regcomp(&regex, padrao, REG_EXTENDED) != 0) {
+        return -1;
+    }
+
+    const char* ptr = texto;
+    while (contador < max_correspondencias && regexec(&regex, ptr, 1, match, 0) == 0) {
+        preencherCorrespondencia(&correspondencias[contador], texto,
+                                 (long)(ptr - texto + match[0].rm_so),
+                                 (long)(ptr - texto + match[0].rm_eo));
+        contador++;
+        ptr += match[0].rm_eo;
+        if (match[0].rm_so == match[0].rm_eo) {
+            if (*ptr == '\0') break;
+            ptr++;
+        }
+    }
+    regfree(&regex);
+    return contador;
+}
+
+// ==================== DEMONSTRAÇÃO, TESTES E BENCHMARK ====================
+
+void demonstrarMotorDFA() {
+    printf("=== DEMONSTRAÇÃO DO MOTOR DFA ===\n\n");
+
+    const char* texto = "Joao Silva tem 25 anos e trabalha na empresa TechCorp. "
+                       "Seu email e joao.silva@techcorp.com.br e seu telefone e (11) 98765-4321.";
+    printf("Texto de exemplo:\n\"%s\"\n\n", texto);
+
+    Correspondencia numeros[10];
+    int qtd = extrairNumerosDFA(texto, numeros, 10);
+    printf("1. Números encontrados: %d\n", qtd);
+    for (int i = 0; i < qtd; i++) {
+        printf("   - \"%s\" (posição %d-%d)\n", numeros[i].texto, numeros[i].inicio, numeros[i].fim);
+    }
+
+    Correspondencia tel;
+    if (encontrarTodasCorrespondenciasCache(texto, "\\([0-9]{2}\\) [0-9]{4,5}-[0-9]{4}", &tel, 1, 1) == 1) {
+        printf("\n2. Telefone: \"%s\"\n", tel.texto);
+    }
+
+    printf("\n3. Validação de email:\n");
+    const char* emails[] = { "joao.silva@techcorp.com.br", "maria@empresa.com", "email_invalido", "test@" };
+    for (int i = 0; i < 4; i++) {
+        printf("   \"%s\" - %s\n", emails[i], validarEmailDFA(emails[i]) ? "✅ VÁLIDO" : "❌ INVÁLIDO");
+    }
+
+    printf("\n4. Padrão fora do subconjunto (\\b): \"\\bTech[a-zA-Z]*\\b\" -> %s (via regcomp em cache)\n",
+           buscarComRegexCache(texto, "\\bTech[a-zA-Z]*\\b", 1) == 1 ? "encontrado" : "não encontrado");
+    printf("\n");
+}
+
+// Compara o motor DFA com o regexec do POSIX em textos e padrões variados
+void verificarContraPOSIX() {
+    printf("=== VERIFICAÇÃO CONTRA O REGEXEC (POSIX) ===\n\n");
+
+    const char* padroes[] = {
+        "[0-9]+", "a|ab|abc", "(a|b)*c", "x(ab)+y?", "[a-c]{2,3}", "a{2}", "(ab|a)(bc|c)?",
+        "[^a ]+", "b*", "^[a-z]+", "[0-9]+$", "^(ab)*$", "c.a", "(a|)+b", "[[:digit:]]{1,2}-",
+        "A[b-c]*", "(x|y|z){3,}", "a?b?c?", ".*c", "[ab]*a[abc]{10}",
+        "a\\\\$", "a\\$", "\\\\\\\\$", "a|b$", "^a|b", "a|a.*b"
+    };
+    int numPadroes = sizeof(padroes) / sizeof(padroes[0]);
+
+    srand(99);
+    int divergencias = 0;
+    int comparacoes = 0;
+    char texto[80];
+    Correspondencia esperado[64];
+    Correspondencia obtido[64];
+
+    for (int t = 0; t < 3000; t++) {
+        int n = rand() % 60;
+        for (int i = 0; i < n; i++) {
+            const char alfabeto[] = "abcxyzABC0123- \\$";
+            texto[i] = alfabeto[rand() % (sizeof(alfabeto) - 1)];
+        }
+        texto[n] = '\0';
+
+        for (int p = 0; p < numPadroes; p++) {
+            int cs = rand() % 2;
+
+            // Referência: regexec com REG_NOTBOL nos sufixos (semântica correta de '^')
+            regex_t regex;
+            regcomp(&regex, padroes[p], REG_EXTENDED | (cs ? 0 : REG_ICASE));
+            int qtdEsperada = 0;
+            size_t pos = 0;
+            regmatch_t m[1];
+            while (qtdEsperada < 64 && regexec(&regex, texto + pos, 1, m, pos > 0 ? REG_NOTBOL : 0) == 0) {
+                esperado[qtdEsperada].inicio = (int)pos + m[0].rm_so;
+                esperado[qtdEsperada].fim = (int)pos + m[0].rm_eo;
+                qtdEsperada++;
+                pos += m[0].rm_eo;
+                if (m[0].rm_so == m[0].rm_eo) {
+                    if (texto[pos] == '\0') break;
+                    pos++;
+                }
+            }
+            int existe = regexec(&regex, texto, 0, NULL, 0) == 0;
+            regfree(&regex);
+
+            int qtdObtida = encontrarTodasCorrespondenciasCache(texto, padroes[p], obtido, 64, cs);
+            int igual = (qtdObtida == qtdEsperada) &&
+                        (buscarComRegexCache(texto, padroes[p], cs) == existe);
+            for (int i = 0; igual && i < qtdObtida; i++) {
+                igual = obtido[i].inicio == esperado[i].inicio && obtido[i].fim == esperado[i].fim;
+            }
+            if (!igual) {
+                if (divergencias < 3) {
+                    printf("   Divergência: padrão \"%s\" texto \"%s\"\n", padroes[p], texto);
+                }
+                divergencias++;
+            }
+            comparacoes++;
+        }
+    }
+
+    printf("   %d comparações (todas as correspondências + existência): %s\n",
+           comparacoes, divergencias == 0 ? "OK" : "FALHA");
+    printf("   Padrões compilados (cache): %ld para %d chamadas\n\n",
+           compilacoesRealizadas, comparacoes * 2);
+}
+
+// '$' depois de uma barra escapada continua sendo âncora; a busca de todas as
+// correspondências lê cada byte um número limitado de vezes
+void verificarAncorasELinearidade() {
+    printf("=== VERIFICAÇÃO: ÂNCORAS E TEMPO LINEAR ===\n\n");
+
+    // "a\\\\$" em C é a regex a\\$: 'a', uma barra literal e a âncora
+    RegexCompilada* r = obterRegexCompilada("a\\\\$", 1);
+    int ok = r != NULL && r->usaDFA && r->ancoradoFim &&
+             buscarComRegexCache("xa\\", "a\\\\$", 1) == 1 &&
+             buscarComRegexCache("xa\\y", "a\\\\$", 1) == 0;
+    r = obterRegexCompilada("a\\$", 1);
+    ok = ok && r != NULL && r->usaDFA && !r->ancoradoFim &&
+         buscarComRegexCache("a$b", "a\\$", 1) == 1;
+    printf("   \"a\\\\$\" ancorado e \"a\\$\" literal: %s\n", ok ? "OK" : "FALHA");
+
+    // Com "a|a.*b" em "aaa...a", cada início casa só "a", mas o DFA ancorado
+    // continua procurando um 'b' até o fim do texto: sem memória, O(n²)
+    const char* padroes[] = { "a|a.*b", "a|a[ab]*c" };
+    const char* unidades[] = { "a", "ab" };
+    int linear = 1;
+    for (int p = 0; p < 2; p++) {
+        double bytesPorByte[2];
+        for (int k = 0; k < 2; k++) {
+            size_t n = k == 0 ? 10000 : 40000;
+            size_t u = strlen(unidades[p]);
+            char* texto = malloc(n + 1);
+            for (size_t i = 0; i < n; i++) {
+                texto[i] = unidades[p][i % u];
+            }
+            texto[n] = '\0';
+            Correspondencia* todas = malloc(n * sizeof(Correspondencia));
+
+            r = obterRegexCompilada(padroes[p], 1);
+            r->bytesLidosFim = 0;
+            int qtd = encontrarTodasCorrespondenciasCache(texto, padroes[p], todas, (int)n, 1);
+            bytesPorByte[k] = (double)r->bytesLidosFim / n;
+            linear = linear && qtd == (int)((n + u - 1) / u) && bytesPorByte[k] <= 4.0;
+
+            free(todas);
+            free(texto);
+        }
+        printf("   \"%s\": %.2f bytes lidos por byte (10 KB), %.2f (40 KB)\n",
+               padroes[p], bytesPorByte[0], bytesPorByte[1]);
+    }
+    printf("   Todas as correspondências em tempo linear: %s\n\n", linear ? "OK" : "FALHA");
+}
+
+static double cronometrar(clock_t inicio) {
+    return (double)(clock() - inicio) / CLOCKS_PER_SEC;
+}
+
+void benchmark(int numLinhas) {
+    printf("=== BENCHMARK: %d LINHAS ===\n\n", numLinhas);
+
+    // Gera linhas no estilo de um cadastro: metade com email válido
+    char** linhas = malloc(numLinhas * sizeof(char*));
+    srand(1);
+    for (int i = 0; i < numLinhas; i++) {
+        char buffer[128];
+        if (rand() % 2) {
+            snprintf(buffer, sizeof(buffer), "usuario.%d@empresa%d.com.br", rand() % 100000, rand() % 50);
+        } else {
+            snprintf(buffer, sizeof(buffer), "pedido %d itens %d valor %d.%02d", rand() % 100000,
+                     rand() % 20, rand() % 1000, rand() % 100);
+        }
+        linhas[i] = malloc(strlen(buffer) + 1);
+        strcpy(linhas[i], buffer);
+    }
+
+    const char* padraoEmail = "^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\\.[a-zA-Z]{2,}$";
+    Correspondencia numeros[16];
+
+    clock_t inicio = clock();
+    long validosOriginal = 0;
+    for (int i = 0; i < numLinhas; i++) {
+        validosOriginal += buscarComRegexOriginal(linhas[i], padraoEmail, 1) == 1;
+    }
+    double tEmailOriginal = cronometrar(inicio);
+
+    regex_t uma;
+    regcomp(&uma, padraoEmail, REG_EXTENDED);
+    inicio = clock();
+    long validosCachePosix = 0;
+    for (int i = 0; i < numLinhas; i++) {
+        validosCachePosix += regexec(&uma, linhas[i], 0, NULL, 0) == 0;
+    }
+    double tEmailCachePosix = cronometrar(inicio);
+    regfree(&uma);
+
+    inicio = clock();
+    long validosDFA = 0;
+    for (int i = 0; i < numLinhas; i++) {
+        validosDFA += validarEmailDFA(linhas[i]) == 1;
+    }
+    double tEmailDFA = cronometrar(inicio);
+
+    inicio = clock();
+    long numerosOriginal = 0;
+    for (int i = 0; i < numLinhas; i++) {
+        numerosOriginal += encontrarTodasOriginal(linhas[i], "[0-9]+", numeros, 16);
+    }
+    double tNumOriginal = cronometrar(inicio);
+
+    inicio = clock();
+    long numerosDFA = 0;
+    for (int i = 0; i < numLinhas; i++) {
+        numerosDFA += extrairNumerosDFA(linhas[i], numeros, 16);
+    }
+    double tNumDFA = cronometrar(inicio);
+
+    printf("%-34s %10s %12s\n", "Operação", "Tempo (s)", "Resultado");
+    printf("%-34s %10.3f %12ld\n", "validarEmail (regcomp por chamada)", tEmailOriginal, validosOriginal);
+    printf("%-34s %10.3f %12ld\n", "validarEmail (regcomp uma vez)", tEmailCachePosix, validosCachePosix);
+    printf("%-34s %10.3f %12ld\n", "validarEmailDFA (cache + DFA)", tEmailDFA, validosDFA);
+    printf("%-34s %10.3f %12ld\n", "extrairNumeros (original)", tNumOriginal, numerosOriginal);
+    printf("%-34s %10.3f %12ld\n", "extrairNumerosDFA", tNumDFA, numerosDFA);
+    printf("\nResultados idênticos: %s\n",
+           (validosOriginal == validosDFA && validosCachePosix == validosDFA &&
+            numerosOriginal == numerosDFA) ? "OK" : "FALHA");
+    if (tEmailDFA > 0 && tNumDFA > 0) {
+        printf("Aceleração: validarEmail %.0fx | extrairNumeros %.0fx\n\n",
+               tEmailOriginal / tEmailDFA, tNumOriginal / tNumDFA);
+    }
+
+    for (int i = 0; i < numLinhas; i++) {
+        free(linhas[i]);
+    }
+    free(linhas);
+}
+
+int main(int argc, char* argv[]) {
+    printf("=== REGEX COM CACHE E DFA PREGUIÇOSO ===\n\n");
+
+    demonstrarMotorDFA();
+    verificarContraPOSIX();
+    verificarAncorasELinearidade();
+
+    int numLinhas = (argc > 1) ? atoi(argv[1]) : 300000;
+    if (numLinhas <= 0) numLinhas = 300000;
+    benchmark(numLinhas);
+
+    liberarCacheRegex();
+
+    printf("=== CONCEITOS IMPORTANTES ===\n");
+    printf("1. Compilar uma vez e reutilizar: o custo do regcomp domina textos curtos\n");
+    printf("2. NFA de Thompson: um estado por símbolo/operador, sem retrocesso\n");
+    printf("3. DFA preguiçoso: só os estados realmente visitados são construídos\n");
+    printf("4. Tempo linear: cada byte do texto é uma consulta à tabela de transições\n");
+    printf("5. DFA reverso encontra inícios; DFA direto encontra o fim mais longo\n");
+
+    return 0;
+}
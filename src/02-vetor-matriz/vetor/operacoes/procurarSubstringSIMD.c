@@ -0,0 +1,645 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define TEM_SIMD_X86 1
+#else
+#define TEM_SIMD_X86 0
+#endif
+
+/**
+ * Programa de exemplo para busca de substring VETORIZADA (SIMD)
+ *
+ * procurarSubstringManual (procurarPalavraSemStringH.c) compara o padrão
+ * em cada posição do texto: O(n * m) no pior caso e um byte por vez.
+ * Este arquivo implementa uma busca que processa 16 (SSE2) ou 32 (AVX2)
+ * posições do texto por instrução, com garantia de tempo linear.
+ *
+ * Técnica 1 - Filtro SIMD "primeiro + último byte" (generic SIMD):
+ *   Para cada bloco de posições i..i+31 compara, em paralelo, texto[i]
+ *   com o primeiro byte do padrão e texto[i+m-1] com o último byte.
+ *   Só as posições em que AMBOS coincidem (bits da máscara) são
+ *   verificadas por completo. Em texto real quase nenhuma posição passa
+ *   pelo filtro, então o custo fica próximo de n/32 comparações.
+ *
+ * Técnica 2 - Two-Way (Crochemore-Perrin) como reserva:
+ *   Em textos patológicos (ex.: "aaaa...a" procurando "aa...b...aa") o
+ *   filtro deixa passar quase todas as posições. O trabalho de verificação
+ *   é medido e, se ultrapassar um orçamento proporcional ao texto já
+ *   percorrido, a busca continua com o Two-Way: O(n + m) no pior caso e
+ *   memória O(1) (é o algoritmo usado por glibc/musl em strstr/memmem).
+ *
+ * Variante case-insensitive:
+ *   procurarCaseInsensitiveSIMD tem a mesma assinatura e o mesmo retorno
+ *   de procurarCaseInsensitiveManual e pode substituí-la diretamente.
+ *   O filtro compara (bloco | 0x20) para letras ASCII e o Two-Way usa
+ *   uma tabela de conversão para minúsculas.
+ *
+ * O SSE4.2 (pcmpistri) também permite buscar substrings, mas tem latência
+ * alta e processa só 16 bytes; o filtro de primeiro/último byte com SSE2
+ * ou AVX2 é mais rápido na prática. A escolha entre SSE2 e AVX2 é feita
+ * em tempo de execução, então o mesmo binário roda em qualquer x86-64.
+ *
+ * Compilação:
+ *   gcc -Wall -Wextra -std=c99 -O2 -o substringSIMD procurarSubstringSIMD.c
+ *
+ * Uso:
+ *   ./substringSIMD                 # gera um log sintético de 64 MB
+ *   ./substringSIMD arquivo.log     # usa um arquivo de log real
+ */
+
+// Tabelas de conversão de bytes usadas pelo Two-Way e pela verificação.
+// Inicializadas em tempo de compilação: as funções públicas não dependem
+// de nenhuma preparação feita pelo main
+#define BYTE_IDENTIDADE(c) (c)
+#define BYTE_MINUSCULA(c) ((c) >= 'A' && (c) <= 'Z' ? (c) + ('a' - 'A') : (c))
+#define MAPA_4(f, c) f(c), f((c) + 1), f((c) + 2), f((c) + 3)
+#define MAPA_16(f, c) MAPA_4(f, c), MAPA_4(f, (c) + 4), MAPA_4(f, (c) + 8), MAPA_4(f, (c) + 12)
+#define MAPA_64(f, c) MAPA_16(f, c), MAPA_16(f, (c) + 16), MAPA_16(f, (c) + 32), MAPA_16(f, (c) + 48)
+#define MAPA_256(f) MAPA_64(f, 0), MAPA_64(f, 64), MAPA_64(f, 128), MAPA_64(f, 192)
+
+static const unsigned char MAPA_IDENTIDADE[256] = { MAPA_256(BYTE_IDENTIDADE) };
+static const unsigned char MAPA_MINUSCULA[256] = { MAPA_256(BYTE_MINUSCULA) };
+
+// Compara m bytes usando a tabela de conversão (0 se iguais)
+static int compararMapeado(const unsigned char* a, const unsigned char* b, size_t m,
+                           const unsigned char* mapa) {
+    if (mapa == MAPA_IDENTIDADE) {
+        return memcmp(a, b, m);
+    }
+    for (size_t i = 0; i < m; i++) {
+        if (mapa[a[i]] != mapa[b[i]]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ==================== TWO-WAY (CROCHEMORE-PERRIN) ====================
+
+// Função para busca Two-Way com tempo O(n + m) garantido
+// Parâmetros:
+// - texto, n: texto e seu tamanho
+// - padrao, m: padrão e seu tamanho (m >= 1)
+// - mapa: tabela de conversão aplicada aos bytes antes de comparar
+// Retorna:
+// - Índice da primeira ocorrência, ou -1 se não encontrada
+static long buscaTwoWay(const unsigned char* texto, size_t n,
+                        const unsigned char* padrao, size_t m,
+                        const unsigned char* mapa) {
+    if (m > n) {
+        return -1;
+    }
+
+    long l = (long)m;
+    long ip, jp, k, p, ms, p0, mem, mem0;
+    size_t deslocamento[256];
+
+    // Tabela do "mau caractere" para pular rapidamente pelo último byte
+    for (int c = 0; c < 256; c++) {
+        deslocamento[c] = 0;
+    }
+    for (long i = 0; i < l; i++) {
+        deslocamento[mapa[padrao[i]]] = (size_t)i + 1;
+    }
+
+    // Fatoração crítica: maior sufixo segundo a ordem '<' ...
+    ip = -1; jp = 0; k = p = 1;
+    while (jp + k < l) {
+        unsigned char a = mapa[padrao[ip + k]];
+        unsigned char b = mapa[padrao[jp + k]];
+        if (a == b) {
+            if (k == p) { jp += p; k = 1; } else { k++; }
+        } else if (a > b) {
+            jp += k; k = 1; p = jp - ip;
+        } else {
+            ip = jp++; k = p = 1;
+        }
+    }
+    ms = ip;
+    p0 = p;
+
+    // ... e segundo a ordem inversa; fica a maior das duas
+    ip = -1; jp = 0; k = p = 1;
+    while (jp + k < l) {
+        unsigned char a = mapa[padrao[ip + k]];
+        unsigned char b = mapa[padrao[jp + k]];
+        if (a == b) {
+            if (k == p) { jp += p; k = 1; } else { k++; }
+        } else if (a < b) {
+            jp += k; k = 1; p = jp - ip;
+        } else {
+            ip = jp++; k = p = 1;
+        }
+    }
+    if (ip + 1 > ms + 1) {
+        ms = ip;
+    } else {
+        p = p0;
+    }
+
+    // Padrão periódico? (a metade esquerda se repete com período p)
+    if (compararMapeado(padrao, padrao + p, (size_t)(ms + 1), mapa) != 0) {
+        mem0 = 0;
+        p = ((ms > l - ms - 1) ? ms : l - ms - 1) + 1;
+    } else {
+        mem0 = l - p;
+    }
+    mem = 0;
+
+    size_t pos = 0;
+    while (pos + m <= n) {
+        const unsigned char* h = texto + pos;
+
+        // Verifica o último byte primeiro; avança pelo deslocamento em caso de falha
+        size_t d = deslocamento[mapa[h[l - 1]]];
+        if (d == 0) {
+            pos += m;
+            mem = 0;
+            continue;
+        }
+        if (d < m) {
+            pos += m - d;
+            mem = 0;
+            continue;
+        }
+
+        // Compara a metade direita
+        for (k = (ms + 1 > mem) ? ms + 1 : mem; k < l && mapa[padrao[k]] == mapa[h[k]]; k++);
+        if (k < l) {
+            pos += (size_t)(k - ms);
+            mem = 0;
+            continue;
+        }
+
+        // Compara a metade esquerda
+        for (k = ms + 1; k > mem && mapa[padrao[k - 1]] == mapa[h[k - 1]]; k--);
+        if (k <= mem) {
+            return (long)pos;
+        }
+        pos += (size_t)p;
+        mem = mem0;
+    }
+
+    return -1;
+}
+
+// ==================== FILTRO SIMD (PRIMEIRO + ÚLTIMO BYTE) ====================
+
+// Resultado interno do filtro SIMD quando precisa continuar com outro algoritmo
+#define CONTINUAR_ESCALAR -2
+
+// Orçamento de verificação: bytes verificados por byte percorrido
+#define FATOR_ORCAMENTO 4
+#define ORCAMENTO_INICIAL 4096
+
+#if TEM_SIMD_X86
+
+// Prepara o byte do padrão para comparação com o bloco:
+// para letras compara (bloco | 0x20) com a minúscula; demais bytes comparam direto
+static void prepararByte(unsigned char c, const unsigned char* mapa,
+                         unsigned char* valor, unsigned char* mascaraOr) {
+    int ehLetra = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+    if (mapa == MAPA_MINUSCULA && ehLetra) {
+        *valor = MAPA_MINUSCULA[c];
+        *mascaraOr = 0x20;
+    } else {
+        *valor = c;
+        *mascaraOr = 0;
+    }
+}
+
+// Filtro com registradores de 128 bits (SSE2, presente em todo x86-64)
+// Retorna o índice encontrado, -1 se não há ocorrência, ou CONTINUAR_ESCALAR
+// com *retomar indicando a partir de onde continuar
+static long filtroSSE2(const unsigned char* texto, size_t n,
+                       const unsigned char* padrao, size_t m,
+                       const unsigned char* mapa, size_t* retomar) {
+    unsigned char v0, o0, v1, o1;
+    prepararByte(padrao[0], mapa, &v0, &o0);
+    prepararByte(padrao[m - 1], mapa, &v1, &o1);
+
+    const __m128i primeiro = _mm_set1_epi8((char)v0);
+    const __m128i ultimo = _mm_set1_epi8((char)v1);
+    const __m128i orPrimeiro = _mm_set1_epi8((char)o0);
+    const __m128i orUltimo = _mm_set1_epi8((char)o1);
+
+    size_t i = 0;
+    size_t gasto = 0;
+
+    for (; i + m - 1 + 16 <= n; i += 16) {
+        __m128i blocoA = _mm_or_si128(_mm_loadu_si128((const __m128i*)(texto + i)), orPrimeiro);
+        __m128i blocoB = _mm_or_si128(_mm_loadu_si128((const __m128i*)(texto + i + m - 1)), orUltimo);
+        unsigned mascara = (unsigned)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(blocoA, primeiro), _mm_cmpeq_epi8(blocoB, ultimo)));
+
+        while (mascara != 0) {
+            size_t candidato = i + (size_t)__builtin_ctz(mascara);
+            if (compararMapeado(texto + candidato, padrao, m, mapa) == 0) {
+                return (long)candidato;
+            }
+            gasto += m;
+            mascara &= mascara - 1;
+        }
+
+        if (gasto > FATOR_ORCAMENTO * (i + 16) + ORCAMENTO_INICIAL) {
+            *retomar = i + 16;
+            return CONTINUAR_ESCALAR;
+        }
+    }
+
+    *retomar = i;
+    return CONTINUAR_ESCALAR;
+}
+
+// Filtro com registradores de 256 bits (AVX2), selecionado em tempo de execução
+__attribute__((target("avx2")))
+static long filtroAVX2(const unsigned char* texto, size_t n,
+                       const unsigned char* padrao, size_t m,
+                       const unsigned char* mapa, size_t* retomar) {
+    unsigned char v0, o0, v1, o1;
+    prepararByte(padrao[0], mapa, &v0, &o0);
+    prepararByte(padrao[m - 1], mapa, &v1, &o1);
+
+    const __m256i primeiro = _mm256_set1_epi8((char)v0);
+    const __m256i ultimo = _mm256_set1_epi8((char)v1);
+    const __m256i orPrimeiro = _mm256_set1_epi8((char)o0);
+    const __m256i orUltimo = _mm256_set1_epi8((char)o1);
+
+    size_t i = 0;
+    size_t gasto = 0;
+
+    for (; i + m - 1 + 32 <= n; i += 32) {
+        __m256i blocoA = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(texto + i)), orPrimeiro);
+        __m256i blocoB = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(texto + i + m - 1)), orUltimo);
+        unsigned mascara = (unsigned)_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(blocoA, primeiro), _mm256_cmpeq_epi8(blocoB, ultimo)));
+
+        while (mascara != 0) {
+            size_t candidato = i + (size_t)__builtin_ctz(mascara);
+            if (compararMapeado(texto + candidato, padrao, m, mapa) == 0) {
+                return (long)candidato;
+            }
+            gasto += m;
+            mascara &= mascara - 1;
+        }
+
+        if (gasto > FATOR_ORCAMENTO * (i + 32) + ORCAMENTO_INICIAL) {
+            *retomar = i + 32;
+            return CONTINUAR_ESCALAR;
+        }
+    }
+
+    *retomar = i;
+    return CONTINUAR_ESCALAR;
+}
+
+static int suportaAVX2(void) {
+    static int suporte = -1;
+    if (suporte == -1) {
+        __builtin_cpu_init();
+        suporte = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return suporte;
+}
+
+#endif
+
+// Contador de quantas buscas precisaram do Two-Way (apenas para demonstração)
+static long buscasComReserva = 0;
+
+// Função principal de busca com tamanhos conhecidos (equivalente a memmem)
+// Parâmetros:
+// - texto, n: texto e seu tamanho
+// - padrao, m: padrão e seu tamanho
+// - mapa: MAPA_IDENTIDADE (busca exata) ou MAPA_MINUSCULA (case-insensitive)
+// Retorna:
+// - Índice da primeira ocorrência, ou -1 se não encontrada
+static long buscarSIMD(const unsigned char* texto, size_t n,
+                       const unsigned char* padrao, size_t m,
+                       const unsigned char* mapa) {
+    if (m == 0) {
+        return 0;
+    }
+    if (m > n) {
+        return -1;
+    }
+
+    size_t retomar = 0;
+#if TEM_SIMD_X86
+    long resultado = suportaAVX2()
+                     ? filtroAVX2(texto, n, padrao, m, mapa, &retomar)
+                     : filtroSSE2(texto, n, padrao, m, mapa, &retomar);
+    if (resultado != CONTINUAR_ESCALAR) {
+        return resultado;
+    }
+    // O filtro parou no final do texto (cauda menor que um bloco) ou
+    // estourou o orçamento de verificação: o Two-Way termina o trabalho
+    if (retomar + m + 64 < n) {
+        buscasComReserva++;
+    }
+#endif
+
+    long restante = buscaTwoWay(texto + retomar, n - retomar, padrao, m, mapa);
+    return (restante < 0) ? -1 : (long)retomar + restante;
+}
+
+// Função para buscar uma substring (mesma interface de procurarSubstringManual)
+// Parâmetros:
+// - texto: string onde será feita a busca
+// - palavra: substring a ser procurada
+// Retorna:
+// - Ponteiro para a primeira ocorrência da palavra no texto
+// - NULL se a palavra não for encontrada
+char* procurarSubstringSIMD(const char* texto, const char* palavra) {
+    if (texto == NULL || palavra == NULL) {
+        return NULL;
+    }
+
+    long pos = buscarSIMD((const unsigned char*)texto, strlen(texto),
+                          (const unsigned char*)palavra, strlen(palavra), MAPA_IDENTIDADE);
+    return (pos < 0) ? NULL : (char*)(texto + pos);
+}
+
+// Função para busca case-insensitive (mesma interface de procurarCaseInsensitiveManual)
+// Parâmetros:
+// - texto: string onde será feita a busca
+// - palavra: palavra a ser procurada
+// Retorna:
+// - Posição da primeira ocorrência (índice baseado em 0)
+// - -1 se a palavra não for encontrada
+int procurarCaseInsensitiveSIMD(const char* texto, const char* palavra) {
+    if (texto == NULL || palavra == NULL) {
+        return -1;
+    }
+
+    long pos = buscarSIMD((const unsigned char*)texto, strlen(texto),
+                          (const unsigned char*)palavra, strlen(palavra), MAPA_MINUSCULA);
+    return (int)pos;
+}
+
+// ==================== VERSÕES ORIGINAIS (PARA COMPARAÇÃO) ====================
+
+// Cópia de procurarSubstringManual (procurarPalavraSemStringH.c)
+static char* procurarSubstringIngenuo(const char* texto, const char* palavra) {
+    int len_texto = (int)strlen(texto);
+    int len_palavra = (int)strlen(palavra);
+
+    if (len_palavra == 0) return (char*)texto;
+    if (len_palavra > len_texto) return NULL;
+
+    for (int i = 0; i <= len_texto - len_palavra; i++) {
+        int j = 0;
+        while (j < len_palavra && texto[i + j] == palavra[j]) j++;
+        if (j == len_palavra) return (char*)(texto + i);
+    }
+    return NULL;
+}
+
+// Cópia de procurarCaseInsensitiveManual (procurarPalavraSemStringH.c)
+static int procurarCaseInsensitiveIngenuo(const char* texto, const char* palavra) {
+    int len_texto = (int)strlen(texto);
+    int len_palavra = (int)strlen(palavra);
+
+    if (len_palavra == 0) return 0;
+    if (len_palavra > len_texto) return -1;
+
+    for (int i = 0; i <= len_texto - len_palavra; i++) {
+        int j = 0;
+        while (j < len_palavra &&
+               MAPA_MINUSCULA[(unsigned char)texto[i + j]] == MAPA_MINUSCULA[(unsigned char)palavra[j]]) {
+            j++;
+        }
+        if (j == len_palavra) return i;
+    }
+    return -1;
+}
+
+// ==================== TESTES E BENCHMARK ====================
+
+void verificarCorretude() {
+    printf("=== VERIFICAÇÃO CONTRA strstr E A BUSCA MANUAL ===\n\n");
+
+    srand(7);
+    char texto[600];
+    char padrao[40];
+    int erros = 0;
+    int testes = 20000;
+
+    for (int t = 0; t < testes; t++) {
+        // Alfabetos pequenos geram muitas ocorrências parciais (casos difíceis)
+        int alfabeto = 1 + rand() % 4;
+        int n = rand() % 590;
+        int m = 1 + rand() % 30;
+        for (int i = 0; i < n; i++) texto[i] = (char)((rand() % 2 ? 'a' : 'A') + rand() % alfabeto);
+        texto[n] = '\0';
+        for (int i = 0; i < m; i++) padrao[i] = (char)((rand() % 2 ? 'a' : 'A') + rand() % alfabeto);
+        padrao[m] = '\0';
+
+        const char* esperado = strstr(texto, padrao);
+        long twoWay = buscaTwoWay((const unsigned char*)texto, (size_t)n,
+                                  (const unsigned char*)padrao, (size_t)m, MAPA_IDENTIDADE);
+        if (twoWay != (esperado ? (long)(esperado - texto) : -1)) erros++;
+        if (procurarSubstringSIMD(texto, padrao) != esperado) erros++;
+        if (procurarCaseInsensitiveSIMD(texto, padrao) != procurarCaseInsensitiveIngenuo(texto, padrao)) erros++;
+    }
+
+    printf("   %d buscas aleatórias comparadas: %s\n", testes * 3, erros == 0 ? "OK" : "FALHA");
+
+    const char* frase = "Programacao em C e uma LINGUAGEM de programacao poderosa.";
+    printf("   procurarSubstringSIMD(\"programacao\") -> posição %ld\n",
+           procurarSubstringSIMD(frase, "programacao") - frase);
+    printf("   procurarCaseInsensitiveSIMD(\"linguagem\") -> posição %d\n\n",
+           procurarCaseInsensitiveSIMD(frase, "linguagem"));
+}
+
+// Gera um log sintético com linhas no formato "data hora NIVEL [modulo] mensagem"
+static char* gerarLog(size_t tamanho) {
+    const char* niveis[] = { "INFO", "DEBUG", "WARN", "INFO", "INFO" };
+    const char* modulos[] = { "http", "db", "cache", "auth", "fila", "pagamento" };
+    const char* mensagens[] = {
+        "requisicao concluida em %d ms",
+        "conexao reutilizada do pool (%d ativas)",
+        "chave expirada, recarregando (%d itens)",
+        "token validado para usuario %d",
+        "mensagem publicada na particao %d"
+    };
+
+    char* log = malloc(tamanho + 1);
+    if (log == NULL) {
+        return NULL;
+    }
+
+    size_t pos = 0;
+    char linha[200];
+    srand(2024);
+    while (pos < tamanho) {
+        int len = snprintf(linha, sizeof(linha), "2024-03-%02d %02d:%02d:%02d %s [%s] ",
+                           1 + rand() % 28, rand() % 24, rand() % 60, rand() % 60,
+                           niveis[rand() % 5], modulos[rand() % 6]);
+        len += snprintf(linha + len, sizeof(linha) - len, mensagens[rand() % 5], rand() % 1000);
+        linha[len++] = '\n';
+
+        size_t copiar = (pos + (size_t)len > tamanho) ? tamanho - pos : (size_t)len;
+        memcpy(log + pos, linha, copiar);
+        pos += copiar;
+    }
+
+    // A linha procurada aparece apenas perto do final
+    const char* alvo = "ERROR [pagamento] timeout ao contatar gateway";
+    size_t tamAlvo = strlen(alvo);
+    if (tamanho > tamAlvo + 100) {
+        memcpy(log + tamanho - tamAlvo - 50, alvo, tamAlvo);
+    }
+    log[tamanho] = '\0';
+    return log;
+}
+
+static char* lerArquivo(const char* caminho, size_t* tamanho) {
+    FILE* f = fopen(caminho, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long tam = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    char* dados = malloc((size_t)tam + 1);
+    if (dados != NULL && fread(dados, 1, (size_t)tam, f) == (size_t)tam) {
+        dados[tam] = '\0';
+        // Bytes nulos no meio do arquivo encerrariam a string antes do fim
+        for (long i = 0; i < tam; i++) {
+            if (dados[i] == '\0') dados[i] = ' ';
+        }
+        *tamanho = (size_t)tam;
+    } else {
+        free(dados);
+        dados = NULL;
+    }
+
+    fclose(f);
+    return dados;
+}
+
+static double cronometrar(clock_t inicio) {
+    return (double)(clock() - inicio) / CLOCKS_PER_SEC;
+}
+
+void benchmarkLog(const char* texto, size_t tamanho) {
+    printf("=== BENCHMARK EM LOG (%.1f MB) ===\n\n", tamanho / (1024.0 * 1024.0));
+
+    const char* padroes[] = { "ERROR [pagamento] timeout", "nao-existe-no-log", "gateway" };
+    int numPadroes = sizeof(padroes) / sizeof(padroes[0]);
+
+    printf("%-28s %12s %12s %12s\n", "Padrão", "Manual (s)", "strstr (s)", "SIMD (s)");
+    for (int p = 0; p < numPadroes; p++) {
+        clock_t inicio = clock();
+        const char* r1 = procurarSubstringIngenuo(texto, padroes[p]);
+        double t1 = cronometrar(inicio);
+
+        inicio = clock();
+        const char* r2 = strstr(texto, padroes[p]);
+        double t2 = cronometrar(inicio);
+
+        inicio = clock();
+        const char* r3 = procurarSubstringSIMD(texto, padroes[p]);
+        double t3 = cronometrar(inicio);
+
+        printf("%-28s %12.4f %12.4f %12.4f %s\n", padroes[p], t1, t2, t3,
+               (r1 == r2 && r2 == r3) ? "" : "(RESULTADOS DIFERENTES!)");
+    }
+
+    printf("\nCase-insensitive (\"error [PAGAMENTO]\"):\n");
+    clock_t inicio = clock();
+    int c1 = procurarCaseInsensitiveIngenuo(texto, "error [PAGAMENTO]");
+    double t1 = cronometrar(inicio);
+    inicio = clock();
+    int c2 = procurarCaseInsensitiveSIMD(texto, "error [PAGAMENTO]");
+    double t2 = cronometrar(inicio);
+    printf("   Manual: %.4f s | SIMD: %.4f s | posições iguais: %s\n\n",
+           t1, t2, c1 == c2 ? "OK" : "FALHA");
+}
+
+void benchmarkPiorCaso() {
+    printf("=== PIOR CASO: TEXTO \"aaa...a\" E PADRÃO \"aa...b...aa\" ===\n\n");
+
+    size_t n = 2000000;
+    size_t m = 1000;
+    char* texto = malloc(n + 1);
+    char* padrao = malloc(m + 1);
+    memset(texto, 'a', n);
+    texto[n] = '\0';
+    // O 'b' fica no meio: primeiro e último bytes passam pelo filtro em toda posição
+    memset(padrao, 'a', m);
+    padrao[m / 2] = 'b';
+    padrao[m] = '\0';
+
+    // A busca manual é O(n * m): usamos só os primeiros 200 KB para ela
+    char guardado = texto[200000];
+    texto[200000] = '\0';
+    clock_t inicio = clock();
+    char* rManual = procurarSubstringIngenuo(texto, padrao);
+    double tManual = cronometrar(inicio);
+    texto[200000] = guardado;
+
+    long antes = buscasComReserva;
+    inicio = clock();
+    char* r = procurarSubstringSIMD(texto, padrao);
+    double tSIMD = cronometrar(inicio);
+
+    printf("   Manual (apenas 200 KB): %.4f s (resultado: %s)\n", tManual,
+           rManual == NULL ? "não encontrado" : "encontrado");
+    printf("   SIMD + Two-Way (2 MB):  %.4f s (resultado: %s, reserva Two-Way acionada: %s)\n\n",
+           tSIMD, r == NULL ? "não encontrado" : "encontrado",
+           buscasComReserva > antes ? "sim" : "não");
+
+    free(texto);
+    free(padrao);
+}
+
+int main(int argc, char* argv[]) {
+    printf("=== BUSCA DE SUBSTRING COM SIMD ===\n\n");
+
+#if TEM_SIMD_X86
+    printf("Conjunto de instruções em uso: %s\n\n", suportaAVX2() ? "AVX2 (32 bytes)" : "SSE2 (16 bytes)");
+#else
+    printf("Arquitetura sem SIMD x86: usando apenas o Two-Way\n\n");
+#endif
+
+    verificarCorretude();
+
+    size_t tamanho = 0;
+    char* texto = NULL;
+    if (argc > 1) {
+        texto = lerArquivo(argv[1], &tamanho);
+        if (texto == NULL) {
+            printf("Não foi possível ler \"%s\"\n", argv[1]);
+            return 1;
+        }
+    } else {
+        tamanho = 64u * 1024 * 1024;
+        texto = gerarLog(tamanho);
+        if (texto == NULL) {
+            printf("Memória insuficiente para gerar o log\n");
+            return 1;
+        }
+    }
+
+    benchmarkLog(texto, tamanho);
+    free(texto);
+
+    benchmarkPiorCaso();
+
+    printf("=== CONCEITOS IMPORTANTES ===\n");
+    printf("1. SIMD compara 16/32 posições do texto por instrução\n");
+    printf("2. O filtro primeiro+último byte descarta quase todas as posições\n");
+    printf("3. Orçamento de verificação detecta entradas patológicas\n");
+    printf("4. Two-Way garante O(n + m) com memória O(1)\n");
+    printf("5. Detecção da CPU em tempo de execução (AVX2 ou SSE2)\n");
+
+    return 0;
+}
@@ -0,0 +1,932 @@
+/*
+ * ====================================================================
+ * FILAS DE PRIORIDADE: HEAP BINÁRIO, PAIRING HEAP E RADIX HEAP
+ * ====================================================================
+ *
+ * Descrição:
+ * Três implementações de fila de prioridade mínima atrás de uma mesma
+ * interface (PriorityQueue), com pares (chave, id) e decrease_key:
+ *
+ * - Heap binário indexado: o algoritmo de heap_binario.c com o índice de
+ *   posições de heap_d_ario.c (pos[id])
+ * - Pairing heap (Fredman, Sedgewick, Sleator e Tarjan, 1986): árvore
+ *   multi-ramificada; inserção, meld e decrease_key só ligam duas
+ *   árvores (O(1)); a extração junta os filhos da raiz em dois passes
+ *   (O(log n) amortizado)
+ * - Radix heap (Ahuja, Mehlhorn, Orlin e Tarjan, 1990): só para chaves
+ *   inteiras MONÓTONAS (nenhuma chave menor que o último mínimo extraído,
+ *   como no Dijkstra e em filas de timers). O balde de uma chave é o bit
+ *   mais alto em que ela difere do último mínimo; cada elemento só desce
+ *   de balde, no máximo 64 vezes: O(1) amortizado por operação, sem
+ *   comparações entre chaves
+ *
+ * Interface comum:
+ * - pq_push(pq, key, id), pq_pop(pq, &key, &id), pq_decrease_key(pq, id, key)
+ * - id é um inteiro >= 0 escolhido pelo usuário (ex.: o vértice)
+ *
+ * Complexidade das operações:
+ *                    binário      pairing          radix (monótono)
+ * - Inserção:        O(log n)     O(1)             O(1)
+ * - decrease_key:    O(log n)     O(log n) amort.  O(1)
+ * - Extração:        O(log n)     O(log n) amort.  O(log C) amort.
+ * - Meld:            O(n)         O(1)             -
+ *   (C = maior diferença entre chaves)
+ *
+ * Compilação: gcc -Wall -Wextra -std=c99 -O2 -o fila_prioridade fila_prioridade.c
+ *
+ * Autor: Estrutura de Dados em C
+ * Data: 2026
+ * ====================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+
+// ============ INTERFACE COMUM ============
+
+/**
+ * Operações de uma fila de prioridade mínima de pares (chave, id)
+ * @param push: false se o id já estiver na fila (ou chave inválida)
+ * @param pop: false se a fila estiver vazia
+ * @param decrease_key: false se o id não estiver na fila ou a chave aumentar
+ */
+typedef struct {
+    const char* name;
+    void* (*create)(int capacity);
+    void (*destroy)(void* impl);
+    bool (*push)(void* impl, long long key, int id);
+    bool (*pop)(void* impl, long long* key, int* id);
+    bool (*decrease_key)(void* impl, int id, long long key);
+    int (*size)(const void* impl);
+} PriorityQueueOps;
+
+typedef struct {
+    const PriorityQueueOps* ops;
+    void* impl;
+} PriorityQueue;
+
+PriorityQueue pq_create(const PriorityQueueOps* ops, int capacity) {
+    PriorityQueue pq = { ops, ops->create(capacity) };
+    return pq;
+}
+
+void pq_destroy(PriorityQueue* pq) {
+    pq->ops->destroy(pq->impl);
+    pq->impl = NULL;
+}
+
+static inline bool pq_push(PriorityQueue* pq, long long key, int id) {
+    return pq->ops->push(pq->impl, key, id);
+}
+
+static inline bool pq_pop(PriorityQueue* pq, long long* key, int* id) {
+    return pq->ops->pop(pq->impl, key, id);
+}
+
+static inline bool pq_decrease_key(PriorityQueue* pq, int id, long long key) {
+    return pq->ops->decrease_key(pq->impl, id, key);
+}
+
+static inline int pq_size(const PriorityQueue* pq) {
+    return pq->ops->size(pq->impl);
+}
+
+/**
+ * Aloca memória ou encerra o programa (mesma política de heap_binario.c)
+ */
+static void* checked_realloc(void* ptr, size_t bytes) {
+    void* p = realloc(ptr, bytes);
+    if (p == NULL) {
+        printf("Erro: Falha na alocação de memória\n");
+        exit(1);
+    }
+    return p;
+}
+
+/**
+ * Garante que array[id] exista num vetor de ints indexado por id,
+ * preenchendo posições novas com fill
+ */
+static int* grow_index(int* array, int* capacity, int id, int fill) {
+    if (id < *capacity) return array;
+    int new_capacity = *capacity * 2;
+    if (new_capacity <= id) new_capacity = id + 1;
+    array = (int*)checked_realloc(array, new_capacity * sizeof(int));
+    for (int i = *capacity; i < new_capacity; i++) array[i] = fill;
+    *capacity = new_capacity;
+    return array;
+}
+
+// ============ HEAP BINÁRIO INDEXADO ============
+
+typedef struct {
+    long long key;
+    int id;
+} HeapEntry;
+
+typedef struct {
+    HeapEntry* data;
+    int size;
+    int capacity;
+    int* pos;              // pos[id] = índice em data, ou -1
+    int pos_capacity;
+} BinaryHeap;
+
+static void* binary_create(int capacity) {
+    BinaryHeap* heap = (BinaryHeap*)checked_realloc(NULL, sizeof(BinaryHeap));
+    heap->capacity = capacity > 0 ? capacity : 16;
+    heap->data = (HeapEntry*)checked_realloc(NULL, heap->capacity * sizeof(HeapEntry));
+    heap->size = 0;
+    heap->pos = NULL;
+    heap->pos_capacity = 0;
+    heap->pos = grow_index(heap->pos, &heap->pos_capacity, heap->capacity - 1, -1);
+    return heap;
+}
+
+static void binary_destroy(void* impl) {
+    BinaryHeap* heap = (BinaryHeap*)impl;
+    free(heap->data);
+    free(heap->pos);
+    free(heap);
+}
+
+/**
+ * Sobe e a partir do buraco i (heapify_up sem trocas)
+ */
+static void binary_sift_up(BinaryHeap* heap, int i, HeapEntry e) {
+    HeapEntry* data = heap->data;
+    int* pos = heap->pos;
+    while (i > 0 && data[(i - 1) / 2].key > e.key) {
+        data[i] = data[(i - 1) / 2];
+        pos[data[i].id] = i;
+        i = (i - 1) / 2;
+    }
+    data[i] = e;
+    pos[e.id] = i;
+}
+
+/**
+ * Desce e a partir do buraco i (heapify_down iterativo, sem trocas)
+ */
+static void binary_sift_down(BinaryHeap* heap, int i, HeapEntry e) {
+    HeapEntry* data = heap->data;
+    int* pos = heap->pos;
+    int size = heap->size;
+    for (;;) {
+        int smallest = 2 * i + 1;
+        if (smallest >= size) break;
+        if (smallest + 1 < size && data[smallest + 1].key < data[smallest].key) smallest++;
+        if (data[smallest].key >= e.key) break;
+        data[i] = data[smallest];
+        pos[data[i].id] = i;
+        i = smallest;
+    }
+    data[i] = e;
+    pos[e.id] = i;
+}
+
+static bool binary_push(void* impl, long long key, int id) {
+    BinaryHeap* heap = (BinaryHeap*)impl;
+    if (id < 0) return false;
+    heap->pos = grow_index(heap->pos, &heap->pos_capacity, id, -1);
+    if (heap->pos[id] >= 0) return false;
+    if (heap->size == heap->capacity) {
+        heap->capacity *= 2;
+        heap->data = (HeapEntry*)checked_realloc(heap->data, heap->capacity * sizeof(HeapEntry));
+    }
+    HeapEntry e = { key, id };
+    binary_sift_up(heap, heap->size++, e);
+    return true;
+}
+
+static bool binary_pop(void* impl, long long* key, int* id) {
+    BinaryHeap* heap = (BinaryHeap*)impl;
+    if (heap->size == 0) return false;
+    *key = heap->data[0].key;
+    *id = heap->data[0].id;
+    heap->pos[*id] = -1;
+    if (--heap->size > 0) binary_sift_down(heap, 0, heap->data[heap->size]);
+    return true;
+}
+
+static bool binary_decrease_key(void* impl, int id, long long key) {
+    BinaryHeap* heap = (BinaryHeap*)impl;
+    if (id < 0 || id >= heap->pos_capacity || heap->pos[id] < 0) return false;
+    int i = heap->pos[id];
+    if (key > heap->data[i].key) return false;
+    HeapEntry e = { key, id };
+    binary_sift_up(heap, i, e);
+    return true;
+}
+
+static int binary_size(const void* impl) {
+    return ((const BinaryHeap*)impl)->size;
+}
+
+static const PriorityQueueOps BINARY_HEAP_OPS = {
+    "heap binário indexado", binary_create, binary_destroy,
+    binary_push, binary_pop, binary_decrease_key, binary_size
+};
+
+// ============ PAIRING HEAP ============
+
+/**
+ * Nó do pairing heap (representação filho-esquerdo / irmão-direito)
+ * @param prev: pai, se o nó for o primeiro filho; senão, o irmão anterior
+ */
+typedef struct PairingNode {
+    long long key;
+    int id;
+    struct PairingNode* child;
+    struct PairingNode* sibling;
+    struct PairingNode* prev;
+} PairingNode;
+
+#define PAIRING_BLOCK 4096
+
+/**
+ * Bloco de nós: os nós nunca mudam de endereço, então podem ser usados
+ * como handles; no meld, os blocos passam para o heap de destino
+ */
+typedef struct PairingBlock {
+    struct PairingBlock* next;
+    PairingNode nodes[PAIRING_BLOCK];
+} PairingBlock;
+
+typedef struct {
+    PairingNode* root;
+    int size;
+    PairingBlock* blocks;          // Bloco atual primeiro
+    PairingBlock* last_block;
+    int block_used;
+    PairingNode* free_list;        // Nós liberados (encadeados por sibling)
+} PairingHeap;
+
+/**
+ * Cria um pairing heap vazio
+ */
+PairingHeap* pairing_create(void) {
+    PairingHeap* heap = (PairingHeap*)checked_realloc(NULL, sizeof(PairingHeap));
+    heap->root = NULL;
+    heap->size = 0;
+    heap->blocks = NULL;
+    heap->last_block = NULL;
+    heap->block_used = PAIRING_BLOCK;
+    heap->free_list = NULL;
+    return heap;
+}
+
+/**
+ * Libera o heap e todos os nós (inclusive os recebidos por meld)
+ */
+void pairing_destroy(PairingHeap* heap) {
+    PairingBlock* block = heap->blocks;
+    while (block != NULL) {
+        PairingBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    free(heap);
+}
+
+static PairingNode* pairing_alloc(PairingHeap* heap) {
+    if (heap->free_list != NULL) {
+        PairingNode* node = heap->free_list;
+        heap->free_list = node->sibling;
+        return node;
+    }
+    if (heap->block_used == PAIRING_BLOCK) {
+        PairingBlock* block = (PairingBlock*)checked_realloc(NULL, sizeof(PairingBlock));
+        block->next = heap->blocks;
+        if (heap->blocks == NULL) heap->last_block = block;
+        heap->blocks = block;
+        heap->block_used = 0;
+    }
+    return &heap->blocks->nodes[heap->block_used++];
+}
+
+/**
+ * Liga duas árvores: a raiz de chave maior vira o primeiro filho da outra
+ */
+static PairingNode* pairing_link(PairingNode* a, PairingNode* b) {
+    if (a == NULL) return b;
+    if (b == NULL) return a;
+    if (b->key < a->key) {
+        PairingNode* t = a;
+        a = b;
+        b = t;
+    }
+    b->prev = a;
+    b->sibling = a->child;
+    if (a->child != NULL) a->child->prev = b;
+    a->child = b;
+    a->sibling = NULL;
+    a->prev = NULL;
+    return a;
+}
+
+/**
+ * Insere (key, id) em O(1) e retorna o nó, que serve de handle para
+ * pairing_decrease_key
+ */
+PairingNode* pairing_push(PairingHeap* heap, long long key, int id) {
+    PairingNode* node = pairing_alloc(heap);
+    node->key = key;
+    node->id = id;
+    node->child = node->sibling = node->prev = NULL;
+    heap->root = pairing_link(heap->root, node);
+    heap->size++;
+    return node;
+}
+
+/**
+ * Junta os filhos de uma raiz removida em dois passes: liga pares da
+ * esquerda para a direita e depois acumula da direita para a esquerda
+ */
+static PairingNode* pairing_merge_children(PairingNode* first) {
+    if (first == NULL) return NULL;
+
+    // 1º passo: pares ligados, encadeados em ordem inversa via prev
+    PairingNode* pairs = NULL;
+    while (first != NULL) {
+        PairingNode* a = first;
+        PairingNode* b = a->sibling;
+        first = b != NULL ? b->sibling : NULL;
+        a->sibling = a->prev = NULL;
+        if (b != NULL) b->sibling = b->prev = NULL;
+        PairingNode* linked = pairing_link(a, b);
+        linked->prev = pairs;
+        pairs = linked;
+    }
+
+    // 2º passo: da direita para a esquerda
+    PairingNode* root = pairs;
+    pairs = pairs->prev;
+    root->prev = NULL;
+    while (pairs != NULL) {
+        PairingNode* next = pairs->prev;
+        pairs->prev = NULL;
+        root = pairing_link(pairs, root);
+        pairs = next;
+    }
+    return root;
+}
+
+/**
+ * Remove o mínimo; false se vazio. O nó volta para a lista livre
+ */
+bool pairing_pop(PairingHeap* heap, long long* key, int* id) {
+    PairingNode* root = heap->root;
+    if (root == NULL) return false;
+    *key = root->key;
+    *id = root->id;
+    heap->root = pairing_merge_children(root->child);
+    heap->size--;
+    root->sibling = heap->free_list;
+    heap->free_list = root;
+    return true;
+}
+
+/**
+ * Diminui a chave de um nó: corta sua subárvore e a liga à raiz
+ * @return: false se key for maior que a chave atual
+ */
+bool pairing_decrease_key(PairingHeap* heap, PairingNode* node, long long key) {
+    if (key > node->key) return false;
+    node->key = key;
+    if (node == heap->root) return true;
+
+    // Desliga node da lista de irmãos (prev é o pai se node é o 1º filho)
+    if (node->prev->child == node) node->prev->child = node->sibling;
+    else node->prev->sibling = node->sibling;
+    if (node->sibling != NULL) node->sibling->prev = node->prev;
+    node->sibling = node->prev = NULL;
+
+    heap->root = pairing_link(heap->root, node);
+    return true;
+}
+
+/**
+ * Move todos os elementos de src para dst em O(1); src fica vazio.
+ * Os handles de src continuam válidos, agora em dst
+ */
+void pairing_meld(PairingHeap* dst, PairingHeap* src) {
+    dst->root = pairing_link(dst->root, src->root);
+    dst->size += src->size;
+
+    // Os blocos de src passam a ser de dst (liberados no destroy de dst)
+    if (src->blocks != NULL) {
+        if (dst->blocks == NULL) {
+            dst->blocks = src->blocks;
+            dst->last_block = src->last_block;
+            dst->block_used = src->block_used;
+        } else {
+            dst->last_block->next = src->blocks;
+            dst->last_block = src->last_block;
+        }
+    }
+    src->root = NULL;
+    src->size = 0;
+    src->blocks = src->last_block = NULL;
+    src->block_used = PAIRING_BLOCK;
+    src->free_list = NULL;
+}
+
+// Adaptador para a interface comum: handle[id] guarda o nó de cada id
+typedef struct {
+    PairingHeap* heap;
+    PairingNode** handle;
+    int handle_capacity;
+} PairingQueue;
+
+static void* pairing_queue_create(int capacity) {
+    PairingQueue* q = (PairingQueue*)checked_realloc(NULL, sizeof(PairingQueue));
+    q->heap = pairing_create();
+    q->handle_capacity = capacity > 0 ? capacity : 16;
+    q->handle = (PairingNode**)calloc(q->handle_capacity, sizeof(PairingNode*));
+    return q;
+}
+
+static void pairing_queue_destroy(void* impl) {
+    PairingQueue* q = (PairingQueue*)impl;
+    pairing_destroy(q->heap);
+    free(q->handle);
+    free(q);
+}
+
+static bool pairing_queue_push(void* impl, long long key, int id) {
+    PairingQueue* q = (PairingQueue*)impl;
+    if (id < 0) return false;
+    if (id >= q->handle_capacity) {
+        int capacity = q->handle_capacity * 2 > id ? q->handle_capacity * 2 : id + 1;
+        q->handle = (PairingNode**)checked_realloc(q->handle, capacity * sizeof(PairingNode*));
+        memset(q->handle + q->handle_capacity, 0, (capacity - q->handle_capacity) * sizeof(PairingNode*));
+        q->handle_capacity = capacity;
+    }
+    if (q->handle[id] != NULL) return false;
+    q->handle[id] = pairing_push(q->heap, key, id);
+    return true;
+}
+
+static bool pairing_queue_pop(void* impl, long long* key, int* id) {
+    PairingQueue* q = (PairingQueue*)impl;
+    if (!pairing_pop(q->heap, key, id)) return false;
+    q->handle[*id] = NULL;
+    return true;
+}
+
+static bool pairing_queue_decrease_key(void* impl, int id, long long key) {
+    PairingQueue* q = (PairingQueue*)impl;
+    if (id < 0 || id >= q->handle_capacity || q->handle[id] == NULL) return false;
+    return pairing_decrease_key(q->heap, q->handle[id], key);
+}
+
+static int pairing_queue_size(const void* impl) {
+    return ((const PairingQueue*)impl)->heap->size;
+}
+
+static const PriorityQueueOps PAIRING_HEAP_OPS = {
+    "pairing heap", pairing_queue_create, pairing_queue_destroy,
+    pairing_queue_push, pairing_queue_pop, pairing_queue_decrease_key, pairing_queue_size
+};
+
+// ============ RADIX HEAP ============
+
+#define RADIX_BUCKETS 65
+
+/**
+ * Entrada de um balde. version identifica a inserção: decrease_key insere
+ * uma entrada nova e as antigas ficam obsoletas (descartadas ao aparecer)
+ */
+typedef struct {
+    long long key;
+    int id;
+    int version;
+} RadixEntry;
+
+typedef struct {
+    RadixEntry* items;
+    int count;
+    int capacity;
+} RadixBucket;
+
+/**
+ * Balde 0: chaves iguais a last. Balde b > 0: chaves cujo bit mais alto
+ * diferente de last é o bit b-1
+ */
+typedef struct {
+    RadixBucket buckets[RADIX_BUCKETS];
+    unsigned long long last;       // Último mínimo extraído
+    int size;
+    int* version;                  // version[id] da entrada válida
+    long long* current;            // current[id] = chave atual, ou -1 se fora
+    int id_capacity;
+} RadixHeap;
+
+static inline int radix_bucket(unsigned long long last, unsigned long long key) {
+    return key == last ? 0 : 64 - __builtin_clzll(key ^ last);
+}
+
+static void radix_append(RadixBucket* bucket, RadixEntry e) {
+    if (bucket->count == bucket->capacity) {
+        bucket->capacity = bucket->capacity ? bucket->capacity * 2 : 16;
+        bucket->items = (RadixEntry*)checked_realloc(bucket->items, bucket->capacity * sizeof(RadixEntry));
+    }
+    bucket->items[bucket->count++] = e;
+}
+
+static void* radix_create(int capacity) {
+    RadixHeap* heap = (RadixHeap*)checked_realloc(NULL, sizeof(RadixHeap));
+    memset(heap->buckets, 0, sizeof(heap->buckets));
+    heap->last = 0;
+    heap->size = 0;
+    heap->id_capacity = capacity > 0 ? capacity : 16;
+    heap->version = (int*)calloc(heap->id_capacity, sizeof(int));
+    heap->current = (long long*)checked_realloc(NULL, heap->id_capacity * sizeof(long long));
+    for (int i = 0; i < heap->id_capacity; i++) heap->current[i] = -1;
+    return heap;
+}
+
+static void radix_destroy(void* impl) {
+    RadixHeap* heap = (RadixHeap*)impl;
+    for (int b = 0; b < RADIX_BUCKETS; b++) free(heap->buckets[b].items);
+    free(heap->version);
+    free(heap->current);
+    free(heap);
+}
+
+static void radix_reserve_id(RadixHeap* heap, int id) {
+    if (id < heap->id_capacity) return;
+    int capacity = heap->id_capacity * 2 > id ? heap->id_capacity * 2 : id + 1;
+    heap->version = (int*)checked_realloc(heap->version, capacity * sizeof(int));
+    heap->current = (long long*)checked_realloc(heap->current, capacity * sizeof(long long));
+    for (int i = heap->id_capacity; i < capacity; i++) {
+        heap->version[i] = 0;
+        heap->current[i] = -1;
+    }
+    heap->id_capacity = capacity;
+}
+
+/**
+ * Insere (key, id); false se key < último mínimo extraído (não monótona)
+ */
+static bool radix_push(void* impl, long long key, int id) {
+    RadixHeap* heap = (RadixHeap*)impl;
+    if (id < 0 || key < 0 || (unsigned long long)key < heap->last) return false;
+    radix_reserve_id(heap, id);
+    if (heap->current[id] >= 0) return false;
+    heap->current[id] = key;
+    RadixEntry e = { key, id, ++heap->version[id] };
+    radix_append(&heap->buckets[radix_bucket(heap->last, key)], e);
+    heap->size++;
+    return true;
+}
+
+static inline bool radix_valid(const RadixHeap* heap, RadixEntry e) {
+    return heap->version[e.id] == e.version && heap->current[e.id] >= 0;
+}
+
+static bool radix_pop(void* impl, long long* key, int* id) {
+    RadixHeap* heap = (RadixHeap*)impl;
+    if (heap->size == 0) return false;
+
+    for (;;) {
+        // Balde 0: todas as chaves iguais a last, qualquer uma serve
+        RadixBucket* zero = &heap->buckets[0];
+        while (zero->count > 0) {
+            RadixEntry e = zero->items[--zero->count];
+            if (!radix_valid(heap, e)) continue;
+            *key = e.key;
+            *id = e.id;
+            heap->current[e.id] = -1;
+            heap->size--;
+            return true;
+        }
+
+        // Primeiro balde não vazio: seu mínimo vira o novo last, e todas
+        // as suas entradas descem para baldes menores
+        int b = 1;
+        while (heap->buckets[b].count == 0) b++;
+        RadixBucket* bucket = &heap->buckets[b];
+        unsigned long long min = ULLONG_MAX;
+        for (int i = 0; i < bucket->count; i++) {
+            RadixEntry e = bucket->items[i];
+            if (radix_valid(heap, e) && (unsigned long long)e.key < min) min = (unsigned long long)e.key;
+        }
+        int count = bucket->count;
+        bucket->count = 0;
+        if (min == ULLONG_MAX) continue;       // Só havia entradas obsoletas
+        heap->last = min;
+        for (int i = 0; i < count; i++) {
+            RadixEntry e = bucket->items[i];
+            if (radix_valid(heap, e)) {
+                radix_append(&heap->buckets[radix_bucket(min, (unsigned long long)e.key)], e);
+            }
+        }
+    }
+}
+
+/**
+ * decrease_key em O(1): entrada nova com a chave menor; a antiga fica
+ * obsoleta. false se key < último mínimo (não monótona)
+ */
+static bool radix_decrease_key(void* impl, int id, long long key) {
+    RadixHeap* heap = (RadixHeap*)impl;
+    if (id < 0 || id >= heap->id_capacity || heap->current[id] < 0) return false;
+    if (key > heap->current[id] || key < 0 || (unsigned long long)key < heap->last) return false;
+    heap->current[id] = key;
+    RadixEntry e = { key, id, ++heap->version[id] };
+    radix_append(&heap->buckets[radix_bucket(heap->last, key)], e);
+    return true;
+}
+
+static int radix_size(const void* impl) {
+    return ((const RadixHeap*)impl)->size;
+}
+
+static const PriorityQueueOps RADIX_HEAP_OPS = {
+    "radix heap", radix_create, radix_destroy,
+    radix_push, radix_pop, radix_decrease_key, radix_size
+};
+
+static const PriorityQueueOps* const ALL_QUEUES[3] = {
+    &BINARY_HEAP_OPS, &PAIRING_HEAP_OPS, &RADIX_HEAP_OPS
+};
+
+// ============ TESTES ============
+
+static unsigned long long rng_state = 88172645463325252ULL;
+
+static unsigned int next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned int)(rng_state >> 32);
+}
+
+/**
+ * Operações aleatórias monótonas (válidas para as três filas) comparadas
+ * com força bruta
+ */
+static void testar_interface(void) {
+    printf("=== TESTE: INTERFACE COMUM CONTRA FORÇA BRUTA ===\n\n");
+
+    const int ids = 1000;
+    long long* key = (long long*)malloc(ids * sizeof(long long));
+    bool ok = true;
+
+    for (int q = 0; q < 3; q++) {
+        PriorityQueue pq = pq_create(ALL_QUEUES[q], 1);
+        for (int i = 0; i < ids; i++) key[i] = -1;
+        long long last = 0;
+        int count = 0;
+        bool okQueue = true;
+        for (int step = 0; step < 200000 && okQueue; step++) {
+            int op = (int)(next_random() % 3);
+            int id = (int)(next_random() % (unsigned int)ids);
+            if (op == 0) {
+                long long k = last + (long long)(next_random() % 5000);
+                okQueue = pq_push(&pq, k, id) == (key[id] < 0);
+                if (key[id] < 0) { key[id] = k; count++; }
+            } else if (op == 1) {
+                long long k = last + (long long)(next_random() % 5000);
+                bool expected = key[id] >= 0 && k <= key[id];
+                okQueue = pq_decrease_key(&pq, id, k) == expected;
+                if (expected) key[id] = k;
+            } else {
+                long long min = LLONG_MAX;
+                for (int i = 0; i < ids; i++) if (key[i] >= 0 && key[i] < min) min = key[i];
+                long long k;
+                int got_id;
+                bool got = pq_pop(&pq, &k, &got_id);
+                okQueue = got == (count > 0) && (!got || (k == min && key[got_id] == min));
+                if (got) { key[got_id] = -1; count--; last = k; }
+            }
+            okQueue = okQueue && pq_size(&pq) == count;
+        }
+        printf("%-24s 200000 operações: %s\n", ALL_QUEUES[q]->name, okQueue ? "ok" : "ERRO");
+        ok = ok && okQueue;
+        pq_destroy(&pq);
+    }
+
+    // Radix heap rejeita chave menor que o último mínimo
+    PriorityQueue radix = pq_create(&RADIX_HEAP_OPS, 4);
+    long long k;
+    int id;
+    pq_push(&radix, 10, 0);
+    pq_push(&radix, 20, 1);
+    pq_pop(&radix, &k, &id);
+    bool rejects = !pq_push(&radix, 5, 2) && !pq_decrease_key(&radix, 1, 9) && pq_decrease_key(&radix, 1, 10);
+    printf("Radix heap rejeita chaves abaixo do último mínimo: %s\n", rejects ? "sim" : "NÃO");
+    ok = ok && rejects;
+    pq_destroy(&radix);
+
+    free(key);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+/**
+ * Meld O(1) do pairing heap e handles válidos depois do meld
+ */
+static void testar_meld(void) {
+    printf("=== TESTE: MELD DO PAIRING HEAP ===\n\n");
+
+    PairingHeap* a = pairing_create();
+    PairingHeap* b = pairing_create();
+    for (int i = 0; i < 10000; i++) pairing_push(a, (long long)(next_random() % 100000), i);
+    PairingNode* handle = NULL;
+    for (int i = 0; i < 10000; i++) {
+        PairingNode* node = pairing_push(b, (long long)(next_random() % 100000) + 10, 10000 + i);
+        if (i == 5000) handle = node;
+    }
+    pairing_meld(a, b);
+    pairing_destroy(b);
+    bool ok = a->size == 20000 && pairing_decrease_key(a, handle, -1);
+
+    long long previous = LLONG_MIN, key;
+    int id, popped = 0;
+    while (ok && pairing_pop(a, &key, &id)) {
+        ok = key >= previous && (popped > 0 || id == 15000);
+        previous = key;
+        popped++;
+    }
+    ok = ok && popped == 20000;
+    printf("10000 + 10000 elementos, decrease_key após o meld, extração em ordem: %s\n", ok ? "ok" : "ERRO");
+    pairing_destroy(a);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// ============ BENCHMARK ============
+
+/**
+ * Grafo em formato CSR para o traço de Dijkstra
+ */
+typedef struct {
+    int n;
+    int* start;
+    int* target;
+    int* weight;
+} Graph;
+
+static Graph* random_graph(int n, int degree, int max_weight) {
+    Graph* g = (Graph*)malloc(sizeof(Graph));
+    g->n = n;
+    g->start = (int*)malloc((n + 1) * sizeof(int));
+    g->target = (int*)malloc((size_t)n * degree * sizeof(int));
+    g->weight = (int*)malloc((size_t)n * degree * sizeof(int));
+    for (int u = 0; u <= n; u++) g->start[u] = u * degree;
+    for (int e = 0; e < n * degree; e++) {
+        g->target[e] = (int)(next_random() % (unsigned int)n);
+        g->weight[e] = 1 + (int)(next_random() % (unsigned int)max_weight);
+    }
+    return g;
+}
+
+static void free_graph(Graph* g) {
+    free(g->start);
+    free(g->target);
+    free(g->weight);
+    free(g);
+}
+
+typedef struct {
+    double seconds;
+    long long operations;
+    unsigned long long checksum;   // Das chaves extraídas, em ordem
+} TraceResult;
+
+static inline unsigned long long mix(unsigned long long h, long long key) {
+    return (h ^ (unsigned long long)key) * 0x100000001B3ULL;
+}
+
+/**
+ * Traço aleatório: n inserções com chaves aleatórias e n extrações
+ */
+static TraceResult trace_random(const PriorityQueueOps* ops, int n, const long long* keys) {
+    TraceResult r = { 0, 0, 14695981039346656037ULL };
+    clock_t start = clock();
+    PriorityQueue pq = pq_create(ops, n);
+    for (int i = 0; i < n; i++) pq_push(&pq, keys[i], i);
+    long long key;
+    int id;
+    while (pq_pop(&pq, &key, &id)) r.checksum = mix(r.checksum, key);
+    pq_destroy(&pq);
+    r.seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    r.operations = 2LL * n;
+    return r;
+}
+
+/**
+ * Traço monótono ("hold", como uma fila de timers): fila com size
+ * elementos; cada passo extrai o mínimo k e insere k + atraso aleatório
+ */
+static TraceResult trace_monotone(const PriorityQueueOps* ops, int size, int steps, const long long* delays) {
+    TraceResult r = { 0, 0, 14695981039346656037ULL };
+    clock_t start = clock();
+    PriorityQueue pq = pq_create(ops, size);
+    for (int i = 0; i < size; i++) pq_push(&pq, delays[i], i);
+    for (int s = 0; s < steps; s++) {
+        long long key;
+        int id;
+        pq_pop(&pq, &key, &id);
+        r.checksum = mix(r.checksum, key);
+        pq_push(&pq, key + delays[(size + s) % (2 * size)], id);
+    }
+    pq_destroy(&pq);
+    r.seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    r.operations = size + 2LL * steps;
+    return r;
+}
+
+/**
+ * Traço com muitos decrease_key: Dijkstra num grafo aleatório denso
+ */
+static TraceResult trace_dijkstra(const PriorityQueueOps* ops, const Graph* g, long long* dist) {
+    TraceResult r = { 0, 0, 14695981039346656037ULL };
+    clock_t start = clock();
+    PriorityQueue pq = pq_create(ops, g->n);
+    for (int v = 0; v < g->n; v++) dist[v] = LLONG_MAX;
+    dist[0] = 0;
+    pq_push(&pq, 0, 0);
+    long long d;
+    int u;
+    while (pq_pop(&pq, &d, &u)) {
+        r.operations += 2;
+        r.checksum = mix(r.checksum, d);
+        for (int e = g->start[u]; e < g->start[u + 1]; e++) {
+            int v = g->target[e];
+            long long nd = d + g->weight[e];
+            if (nd < dist[v]) {
+                if (dist[v] == LLONG_MAX) {
+                    pq_push(&pq, nd, v);
+                } else {
+                    pq_decrease_key(&pq, v, nd);
+                    r.operations++;
+                }
+                dist[v] = nd;
+            }
+        }
+    }
+    pq_destroy(&pq);
+    r.seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    return r;
+}
+
+static void print_row(const char* trace, const TraceResult* results) {
+    printf("%-34s", trace);
+    for (int q = 0; q < 3; q++) printf(" %12.1f", 1e9 * results[q].seconds / results[q].operations);
+    bool same = results[0].checksum == results[1].checksum && results[0].checksum == results[2].checksum;
+    printf("   %s\n", same ? "iguais" : "DIFERENTES");
+}
+
+static void benchmark(int n) {
+    printf("=== BENCHMARK: ns por operação ===\n\n");
+    printf("%-34s %12s %12s %12s   %s\n", "Traço", "binário", "pairing", "radix", "resultados");
+
+    long long* values = (long long*)malloc(2 * (size_t)n * sizeof(long long));
+    TraceResult results[3];
+
+    for (int i = 0; i < n; i++) values[i] = (long long)(next_random() % 1000000000u);
+    for (int q = 0; q < 3; q++) results[q] = trace_random(ALL_QUEUES[q], n, values);
+    char label[64];
+    snprintf(label, sizeof(label), "aleatório (%d push + pop)", n);
+    print_row(label, results);
+
+    for (int i = 0; i < 2 * n; i++) values[i] = 1 + (long long)(next_random() % 100000u);
+    int size = n / 10;
+    for (int q = 0; q < 3; q++) results[q] = trace_monotone(ALL_QUEUES[q], size, 10 * size, values);
+    snprintf(label, sizeof(label), "monótono (timers, %d na fila)", size);
+    print_row(label, results);
+
+    Graph* g = random_graph(n / 10, 32, 100000);
+    long long* dist = (long long*)malloc((size_t)g->n * sizeof(long long));
+    for (int q = 0; q < 3; q++) results[q] = trace_dijkstra(ALL_QUEUES[q], g, dist);
+    snprintf(label, sizeof(label), "decrease-key (Dijkstra, grau 32)");
+    print_row(label, results);
+    printf("(Dijkstra: %lld operações, das quais decrease_key = %lld)\n\n",
+           results[0].operations, results[0].operations - 2LL * g->n);
+    free(dist);
+    free_graph(g);
+    free(values);
+}
+
+/**
+ * Função principal: testes e benchmark das três filas
+ * Uso: ./fila_prioridade [elementos]
+ */
+int main(int argc, char* argv[]) {
+    printf("=== FILAS DE PRIORIDADE: BINÁRIO, PAIRING E RADIX HEAP ===\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    if (n < 1000) n = 1000;
+
+    testar_interface();
+    testar_meld();
+    benchmark(n);
+
+    return 0;
+}
@@ -0,0 +1,712 @@
+/*
+ * ====================================================================
+ * IMPLEMENTAÇÃO DE HEAP D-ÁRIO INDEXADO (Min Heap com decrease-key)
+ * ====================================================================
+ *
+ * Descrição:
+ * Generalização do heap binário (heap_binario.c) em que cada nó tem d
+ * filhos (d = 2, 4, 8 ou 16). Cada elemento é um par (chave, id): o id é
+ * um inteiro >= 0 escolhido pelo usuário (ex.: o vértice no Dijkstra), e
+ * um índice de posições pos[id] permite alterar ou remover um elemento
+ * qualquer em O(log n), sem procurá-lo no array.
+ *
+ * Propriedades:
+ * - Árvore d-ária completa em array: parent(i) = (i-1)/d,
+ *   filhos = d*i+1 ... d*i+d
+ * - Altura log_d(n): subir (inserção, decrease_key) faz menos passos;
+ *   descer compara d filhos por nível, mas eles são contíguos na memória
+ * - Alinhamento: cada elemento ocupa 16 bytes e o array é deslocado para
+ *   que data[1] comece numa linha de cache (64 bytes). Com d >= 4, os
+ *   filhos de todo nó começam numa linha (d = 4: exatamente uma linha);
+ *   com d = 2, cada par de irmãos ocupa meia linha, sem atravessá-la
+ * - Capacidade cresce automaticamente (dobrando)
+ *
+ * Complexidade das operações:
+ * - Inserção / decrease_key: O(log_d n)
+ * - Extração do mínimo / remoção: O(d log_d n)
+ * - Busca do mínimo: O(1)
+ * - Construção a partir de um array (heapify): O(n)
+ *
+ * Compilação: gcc -Wall -Wextra -std=c99 -O2 -o heap_d_ario heap_d_ario.c
+ *
+ * Autor: Estrutura de Dados em C
+ * Data: 2026
+ * ====================================================================
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+
+#define CACHE_LINE 64
+
+/**
+ * Elemento do heap: chave de prioridade e id do item (16 bytes)
+ */
+typedef struct {
+    long long key;
+    int id;
+} HeapEntry;
+
+/**
+ * Estrutura do heap d-ário indexado
+ * @param data: elementos (data[0] é o mínimo), dentro de block
+ * @param block: memória alinhada a CACHE_LINE (usada no free)
+ * @param pos: pos[id] = índice do id em data, ou -1 se ausente
+ * @param arity, shift: d e log2(d)
+ */
+typedef struct {
+    HeapEntry* data;
+    HeapEntry* block;
+    int size;
+    int capacity;
+    int* pos;
+    int pos_capacity;
+    int arity;
+    int shift;
+} DHeap;
+
+// ============ MEMÓRIA ============
+
+/**
+ * Aloca o array de elementos alinhado: data[1] (primeiro filho da raiz)
+ * cai no início de uma linha de cache, e com d >= 4 também d*i+1 para todo i
+ * @param heap: ponteiro para o heap
+ * @param capacity: nova capacidade (elementos existentes são copiados)
+ */
+static void dheap_reserve(DHeap* heap, int capacity) {
+    HeapEntry* block;
+    size_t offset = CACHE_LINE / sizeof(HeapEntry) - 1;
+    size_t count = (size_t)capacity + offset;
+    if (posix_memalign((void**)&block, CACHE_LINE, count * sizeof(HeapEntry)) != 0) {
+        printf("Erro: Falha na alocação de memória para os dados\n");
+        exit(1);
+    }
+    HeapEntry* data = block + offset;
+    if (heap->size > 0) {
+        memcpy(data, heap->data, heap->size * sizeof(HeapEntry));
+    }
+    free(heap->block);
+    heap->block = block;
+    heap->data = data;
+    heap->capacity = capacity;
+}
+
+/**
+ * Garante que pos[id] exista, preenchendo posições novas com -1
+ * @param heap: ponteiro para o heap
+ * @param id: maior id que precisa caber
+ */
+static void dheap_reserve_id(DHeap* heap, int id) {
+    if (id < heap->pos_capacity) return;
+    int capacity = heap->pos_capacity * 2;
+    if (capacity <= id) capacity = id + 1;
+    int* pos = (int*)realloc(heap->pos, capacity * sizeof(int));
+    if (pos == NULL) {
+        printf("Erro: Falha na alocação de memória para o índice\n");
+        exit(1);
+    }
+    for (int i = heap->pos_capacity; i < capacity; i++) pos[i] = -1;
+    heap->pos = pos;
+    heap->pos_capacity = capacity;
+}
+
+/**
+ * Cria um heap d-ário vazio
+ * @param arity: filhos por nó (2, 4, 8 ou 16; outros valores viram 4)
+ * @param capacity: capacidade inicial (cresce quando necessário)
+ * @return: ponteiro para o heap criado
+ */
+DHeap* dheap_create(int arity, int capacity) {
+    DHeap* heap = (DHeap*)malloc(sizeof(DHeap));
+    if (heap == NULL) {
+        printf("Erro: Falha na alocação de memória para o heap\n");
+        exit(1);
+    }
+    if (arity != 2 && arity != 4 && arity != 8 && arity != 16) arity = 4;
+    heap->arity = arity;
+    heap->shift = 0;
+    while ((1 << heap->shift) < arity) heap->shift++;
+
+    heap->data = NULL;
+    heap->block = NULL;
+    heap->size = 0;
+    heap->pos = NULL;
+    heap->pos_capacity = 0;
+    dheap_reserve(heap, capacity > 0 ? capacity : 16);
+    dheap_reserve_id(heap, capacity > 0 ? capacity - 1 : 15);
+    return heap;
+}
+
+/**
+ * Libera toda a memória alocada para o heap
+ * @param heap: ponteiro para o heap a ser destruído
+ */
+void dheap_destroy(DHeap* heap) {
+    if (heap != NULL) {
+        free(heap->block);
+        free(heap->pos);
+        free(heap);
+    }
+}
+
+// ============ SUBIR E DESCER ============
+
+/**
+ * Sobe o elemento e a partir da posição i. Usa um "buraco" em vez de
+ * trocas: cada pai maior desce uma vez e e é escrito só no final
+ * @param heap: ponteiro para o heap
+ * @param i: posição inicial (livre)
+ * @param e: elemento a posicionar
+ */
+static void sift_up(DHeap* heap, int i, HeapEntry e) {
+    // Cópias locais: escrever em pos[] (int*) obrigaria o compilador a
+    // reler os campos int do heap a cada passo
+    HeapEntry* data = heap->data;
+    int* pos = heap->pos;
+    int shift = heap->shift;
+    while (i > 0) {
+        int p = (i - 1) >> shift;
+        if (data[p].key <= e.key) break;
+        data[i] = data[p];
+        pos[data[i].id] = i;
+        i = p;
+    }
+    data[i] = e;
+    pos[e.id] = i;
+}
+
+/**
+ * Desce o elemento e a partir da posição i, trocando com o menor dos d
+ * filhos enquanto ele for menor que e
+ * @param heap: ponteiro para o heap
+ * @param i: posição inicial (livre)
+ * @param e: elemento a posicionar
+ */
+static void sift_down(DHeap* heap, int i, HeapEntry e) {
+    HeapEntry* data = heap->data;
+    int* pos = heap->pos;
+    int size = heap->size, shift = heap->shift, arity = heap->arity;
+    for (;;) {
+        int first = (i << shift) + 1;
+        if (first >= size) break;
+        int last = first + arity;
+        if (last > size) last = size;
+
+        // Menor filho: os d filhos estão na mesma linha de cache, e manter a
+        // menor chave numa variável permite ao compilador usar cmov
+        int best = first;
+        long long best_key = data[first].key;
+        for (int c = first + 1; c < last; c++) {
+            long long k = data[c].key;
+            best = k < best_key ? c : best;
+            best_key = k < best_key ? k : best_key;
+        }
+        if (best_key >= e.key) break;
+        data[i] = data[best];
+        pos[data[i].id] = i;
+        i = best;
+    }
+    data[i] = e;
+    pos[e.id] = i;
+}
+
+// ============ OPERAÇÕES ============
+
+/**
+ * Verifica se um id está no heap
+ */
+bool dheap_contains(const DHeap* heap, int id) {
+    return id >= 0 && id < heap->pos_capacity && heap->pos[id] >= 0;
+}
+
+/**
+ * Insere o par (key, id)
+ * @return: false se id for negativo ou já estiver no heap
+ */
+bool dheap_push(DHeap* heap, long long key, int id) {
+    if (id < 0 || dheap_contains(heap, id)) return false;
+    dheap_reserve_id(heap, id);
+    if (heap->size == heap->capacity) {
+        dheap_reserve(heap, heap->capacity * 2);
+    }
+    HeapEntry e = { key, id };
+    heap->size++;
+    sift_up(heap, heap->size - 1, e);
+    return true;
+}
+
+/**
+ * Consulta o mínimo sem removê-lo
+ * @return: false se o heap estiver vazio
+ */
+bool dheap_peek(const DHeap* heap, long long* key, int* id) {
+    if (heap->size == 0) return false;
+    if (key) *key = heap->data[0].key;
+    if (id) *id = heap->data[0].id;
+    return true;
+}
+
+/**
+ * Remove o elemento da posição i, preenchendo o buraco com o último
+ */
+static void remove_at(DHeap* heap, int i) {
+    heap->pos[heap->data[i].id] = -1;
+    heap->size--;
+    if (i == heap->size) return;
+    HeapEntry last = heap->data[heap->size];
+    // O último pode ser menor que o pai de i (remoção no meio): sobe ou desce
+    if (i > 0 && last.key < heap->data[(i - 1) >> heap->shift].key) {
+        sift_up(heap, i, last);
+    } else {
+        sift_down(heap, i, last);
+    }
+}
+
+/**
+ * Remove e retorna o mínimo
+ * @return: false se o heap estiver vazio
+ */
+bool dheap_pop(DHeap* heap, long long* key, int* id) {
+    if (!dheap_peek(heap, key, id)) return false;
+    remove_at(heap, 0);
+    return true;
+}
+
+/**
+ * Diminui a chave de um id presente no heap
+ * @return: false se o id não estiver no heap ou se key for maior que a atual
+ */
+bool dheap_decrease_key(DHeap* heap, int id, long long key) {
+    if (!dheap_contains(heap, id)) return false;
+    int i = heap->pos[id];
+    if (key > heap->data[i].key) return false;
+    HeapEntry e = { key, id };
+    sift_up(heap, i, e);
+    return true;
+}
+
+/**
+ * Remove um id qualquer do heap
+ * @param key: recebe a chave removida (pode ser NULL)
+ * @return: false se o id não estiver no heap
+ */
+bool dheap_remove(DHeap* heap, int id, long long* key) {
+    if (!dheap_contains(heap, id)) return false;
+    int i = heap->pos[id];
+    if (key) *key = heap->data[i].key;
+    remove_at(heap, i);
+    return true;
+}
+
+/**
+ * Substitui o conteúdo do heap pelos n pares (keys[i], ids[i]) em O(n):
+ * copia tudo e desce os nós internos do último ao primeiro (Floyd)
+ * @return: false (heap vazio) se houver id negativo ou repetido
+ */
+bool dheap_heapify(DHeap* heap, const long long* keys, const int* ids, int n) {
+    for (int i = 0; i < heap->size; i++) heap->pos[heap->data[i].id] = -1;
+    heap->size = 0;
+    if (n > heap->capacity) dheap_reserve(heap, n);
+
+    for (int i = 0; i < n; i++) {
+        if (ids[i] < 0 || dheap_contains(heap, ids[i])) {
+            for (int j = 0; j < i; j++) heap->pos[ids[j]] = -1;
+            return false;
+        }
+        dheap_reserve_id(heap, ids[i]);
+        heap->data[i].key = keys[i];
+        heap->data[i].id = ids[i];
+        heap->pos[ids[i]] = i;
+    }
+    heap->size = n;
+    for (int i = (n - 2) >> heap->shift; n > 1 && i >= 0; i--) {
+        sift_down(heap, i, heap->data[i]);
+    }
+    return true;
+}
+
+// ============ HEAP BINÁRIO DE REFERÊNCIA ============
+
+// Mesmo algoritmo de heap_binario.c (trocas, heapify_down recursivo,
+// capacidade fixa), com par (chave, id). Sem decrease-key: o Dijkstra
+// insere de novo e descarta as entradas velhas na extração
+typedef struct {
+    HeapEntry* data;
+    int size;
+    int capacity;
+} MinHeap;
+
+static MinHeap* create_heap(int capacity) {
+    MinHeap* heap = (MinHeap*)malloc(sizeof(MinHeap));
+    heap->data = (HeapEntry*)malloc(capacity * sizeof(HeapEntry));
+    heap->size = 0;
+    heap->capacity = capacity;
+    return heap;
+}
+
+static void swap(HeapEntry* a, HeapEntry* b) {
+    HeapEntry temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static void heapify_up(MinHeap* heap, int i) {
+    while (i != 0 && heap->data[(i - 1) / 2].key > heap->data[i].key) {
+        swap(&heap->data[i], &heap->data[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+}
+
+static void heapify_down(MinHeap* heap, int i) {
+    int smallest = i;
+    int left = 2 * i + 1;
+    int right = 2 * i + 2;
+    if (left < heap->size && heap->data[left].key < heap->data[smallest].key) smallest = left;
+    if (right < heap->size && heap->data[right].key < heap->data[smallest].key) smallest = right;
+    if (smallest != i) {
+        swap(&heap->data[i], &heap->data[smallest]);
+        heapify_down(heap, smallest);
+    }
+}
+
+static void insert(MinHeap* heap, HeapEntry e) {
+    if (heap->size == heap->capacity) return;
+    heap->data[heap->size] = e;
+    heapify_up(heap, heap->size);
+    heap->size++;
+}
+
+static HeapEntry extract_min(MinHeap* heap) {
+    HeapEntry root = heap->data[0];
+    heap->data[0] = heap->data[heap->size - 1];
+    heap->size--;
+    heapify_down(heap, 0);
+    return root;
+}
+
+static void destroy_heap(MinHeap* heap) {
+    free(heap->data);
+    free(heap);
+}
+
+// ============ GRAFO E DIJKSTRA ============
+
+/**
+ * Grafo em formato CSR: arestas de u em edges[start[u] .. start[u+1])
+ */
+typedef struct {
+    int n;
+    int m;
+    int* start;
+    int* target;
+    int* weight;
+} Graph;
+
+typedef struct {
+    long long pushes;
+    long long decreases;
+    long long pops;
+} DijkstraStats;
+
+/**
+ * Dijkstra com o heap d-ário: cada vértice entra uma vez e tem a chave
+ * diminuída quando um caminho melhor aparece
+ */
+static void dijkstra_dheap(const Graph* g, int source, int arity, long long* dist, DijkstraStats* stats) {
+    DHeap* heap = dheap_create(arity, 1024);
+    for (int v = 0; v < g->n; v++) dist[v] = LLONG_MAX;
+    dist[source] = 0;
+    dheap_push(heap, 0, source);
+    stats->pushes++;
+
+    long long d;
+    int u;
+    while (dheap_pop(heap, &d, &u)) {
+        stats->pops++;
+        for (int e = g->start[u]; e < g->start[u + 1]; e++) {
+            int v = g->target[e];
+            long long nd = d + g->weight[e];
+            if (nd < dist[v]) {
+                if (dist[v] == LLONG_MAX) {
+                    dheap_push(heap, nd, v);
+                    stats->pushes++;
+                } else {
+                    dheap_decrease_key(heap, v, nd);
+                    stats->decreases++;
+                }
+                dist[v] = nd;
+            }
+        }
+    }
+    dheap_destroy(heap);
+}
+
+/**
+ * Dijkstra com o heap binário de referência: insere de novo a cada
+ * melhora (capacidade m + 1) e ignora entradas com distância velha
+ */
+static void dijkstra_binary(const Graph* g, int source, long long* dist, DijkstraStats* stats) {
+    MinHeap* heap = create_heap(g->m + 1);
+    for (int v = 0; v < g->n; v++) dist[v] = LLONG_MAX;
+    dist[source] = 0;
+    insert(heap, (HeapEntry){ 0, source });
+    stats->pushes++;
+
+    while (heap->size > 0) {
+        HeapEntry top = extract_min(heap);
+        stats->pops++;
+        if (top.key > dist[top.id]) continue;        // Entrada velha
+        for (int e = g->start[top.id]; e < g->start[top.id + 1]; e++) {
+            int v = g->target[e];
+            long long nd = top.key + g->weight[e];
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                insert(heap, (HeapEntry){ nd, v });
+                stats->pushes++;
+            }
+        }
+    }
+    destroy_heap(heap);
+}
+
+static unsigned long long rng_state = 88172645463325252ULL;
+
+static unsigned int next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned int)(rng_state >> 32);
+}
+
+/**
+ * Grafo aleatório com n vértices e grau de saída fixo, pesos em [1, max_weight]
+ */
+static Graph* random_graph(int n, int degree, int max_weight) {
+    Graph* g = (Graph*)malloc(sizeof(Graph));
+    g->n = n;
+    g->m = n * degree;
+    g->start = (int*)malloc((n + 1) * sizeof(int));
+    g->target = (int*)malloc(g->m * sizeof(int));
+    g->weight = (int*)malloc(g->m * sizeof(int));
+    for (int u = 0; u <= n; u++) g->start[u] = u * degree;
+    for (int e = 0; e < g->m; e++) {
+        g->target[e] = (int)(next_random() % (unsigned int)n);
+        g->weight[e] = 1 + (int)(next_random() % (unsigned int)max_weight);
+    }
+    return g;
+}
+
+/**
+ * Grade side x side com 4 vizinhos (parecida com uma malha viária)
+ */
+static Graph* grid_graph(int side, int max_weight) {
+    Graph* g = (Graph*)malloc(sizeof(Graph));
+    g->n = side * side;
+    g->start = (int*)malloc((g->n + 1) * sizeof(int));
+    g->target = (int*)malloc(4 * g->n * sizeof(int));
+    g->weight = (int*)malloc(4 * g->n * sizeof(int));
+    int m = 0;
+    static const int dr[4] = { -1, 1, 0, 0 };
+    static const int dc[4] = { 0, 0, -1, 1 };
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            g->start[r * side + c] = m;
+            for (int k = 0; k < 4; k++) {
+                int nr = r + dr[k], nc = c + dc[k];
+                if (nr < 0 || nr >= side || nc < 0 || nc >= side) continue;
+                g->target[m] = nr * side + nc;
+                g->weight[m] = 1 + (int)(next_random() % (unsigned int)max_weight);
+                m++;
+            }
+        }
+    }
+    g->start[g->n] = m;
+    g->m = m;
+    return g;
+}
+
+static void free_graph(Graph* g) {
+    free(g->start);
+    free(g->target);
+    free(g->weight);
+    free(g);
+}
+
+// ============ TESTES ============
+
+/**
+ * Operações aleatórias comparadas com um vetor de chaves (força bruta)
+ */
+static void testar_operacoes(void) {
+    printf("=== TESTE: OPERAÇÕES CONTRA FORÇA BRUTA ===\n\n");
+
+    const int ids = 2000;
+    long long* key = (long long*)malloc(ids * sizeof(long long));
+    bool* present = (bool*)calloc(ids, sizeof(bool));
+    static const int arities[4] = { 2, 4, 8, 16 };
+    bool ok = true;
+
+    for (int a = 0; a < 4 && ok; a++) {
+        DHeap* heap = dheap_create(arities[a], 1);    // Cresce a partir de 1
+        memset(present, 0, ids * sizeof(bool));
+        int count = 0;
+        for (int step = 0; step < 200000 && ok; step++) {
+            int op = (int)(next_random() % 4);
+            int id = (int)(next_random() % (unsigned int)ids);
+            long long k = (long long)(next_random() % 100000);
+            if (op == 0) {
+                ok = dheap_push(heap, k, id) == !present[id];
+                if (!present[id]) { present[id] = true; key[id] = k; count++; }
+            } else if (op == 1) {
+                bool expected = present[id] && k <= key[id];
+                ok = dheap_decrease_key(heap, id, k) == expected;
+                if (expected) key[id] = k;
+            } else if (op == 2) {
+                long long removed;
+                ok = dheap_remove(heap, id, &removed) == present[id] &&
+                     (!present[id] || removed == key[id]);
+                if (present[id]) { present[id] = false; count--; }
+            } else {
+                long long min = LLONG_MAX;
+                for (int i = 0; i < ids; i++) if (present[i] && key[i] < min) min = key[i];
+                long long k2;
+                int id2;
+                bool got = dheap_pop(heap, &k2, &id2);
+                ok = got == (count > 0) && (!got || (k2 == min && present[id2] && key[id2] == min));
+                if (got) { present[id2] = false; count--; }
+            }
+            ok = ok && heap->size == count;
+        }
+        printf("d = %2d: 200000 operações (push, decrease_key, remove, pop): %s\n",
+               arities[a], ok ? "ok" : "ERRO");
+        dheap_destroy(heap);
+    }
+    free(key);
+    free(present);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+/**
+ * Heapify O(n) seguido de extração: sai em ordem
+ */
+static void testar_heapify(void) {
+    printf("=== TESTE: HEAPIFY ===\n\n");
+
+    const int n = 100000;
+    long long* keys = (long long*)malloc(n * sizeof(long long));
+    int* ids = (int*)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        keys[i] = (long long)(next_random() % 1000);
+        ids[i] = n - 1 - i;
+    }
+
+    DHeap* heap = dheap_create(4, 8);
+    dheap_push(heap, 5, 3);
+    bool ok = dheap_heapify(heap, keys, ids, n) && heap->size == n;
+
+    long long previous = LLONG_MIN, k;
+    int id, popped = 0;
+    while (ok && dheap_pop(heap, &k, &id)) {
+        ok = k >= previous && keys[n - 1 - id] == k;
+        previous = k;
+        popped++;
+    }
+    ok = ok && popped == n;
+
+    // Id repetido: rejeitado e heap vazio
+    ids[n / 2] = ids[0];
+    ok = ok && !dheap_heapify(heap, keys, ids, n) && heap->size == 0 && !dheap_contains(heap, ids[1]);
+
+    printf("%d elementos (d = 4): extração em ordem crescente: %s\n", n, ok ? "ok" : "ERRO");
+    dheap_destroy(heap);
+
+    // Alinhamento, depois de crescer: data[1] no início de uma linha, grupos
+    // de irmãos numa linha (d >= 4) ou em meia linha sem atravessá-la (d = 2)
+    bool aligned = true;
+    for (int d = 2; d <= 16; d *= 2) {
+        heap = dheap_create(d, 8);
+        for (int i = 0; i < 1000; i++) dheap_push(heap, i, i);
+        aligned = aligned && (size_t)(heap->data + 1) % CACHE_LINE == 0;
+        for (int i = 0; d * i + 1 < heap->capacity; i++) {
+            size_t first = (size_t)(heap->data + d * i + 1);
+            size_t group = (size_t)d * sizeof(HeapEntry);
+            aligned = aligned && (d >= 4 ? first % CACHE_LINE == 0 : first % CACHE_LINE + group <= CACHE_LINE);
+        }
+        dheap_destroy(heap);
+    }
+    printf("Alinhamento (d = 2, 4, 8, 16): filhos de cada nó sem atravessar linha de %d bytes: %s\n",
+           CACHE_LINE, aligned ? "sim" : "não");
+    ok = ok && aligned;
+    free(keys);
+    free(ids);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// ============ BENCHMARK ============
+
+static void benchmark(const char* name, Graph* g) {
+    printf("=== BENCHMARK: Dijkstra, %s (%d vértices, %d arestas) ===\n\n", name, g->n, g->m);
+    printf("%-28s %10s %12s %12s %12s\n", "Heap", "tempo (s)", "inserções", "decrease", "extrações");
+
+    long long* expected = (long long*)malloc(g->n * sizeof(long long));
+    long long* dist = (long long*)malloc(g->n * sizeof(long long));
+    bool same = true;
+
+    DijkstraStats stats = { 0, 0, 0 };
+    clock_t start = clock();
+    dijkstra_binary(g, 0, expected, &stats);
+    double t = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("%-28s %10.3f %12lld %12s %12lld\n", "binário (heap_binario.c)", t, stats.pushes, "-", stats.pops);
+
+    static const int arities[4] = { 2, 4, 8, 16 };
+    for (int a = 0; a < 4; a++) {
+        DijkstraStats s = { 0, 0, 0 };
+        start = clock();
+        dijkstra_dheap(g, 0, arities[a], dist, &s);
+        t = (double)(clock() - start) / CLOCKS_PER_SEC;
+        char label[32];
+        snprintf(label, sizeof(label), "d-ário indexado, d = %d", arities[a]);
+        printf("%-28s %10.3f %12lld %12lld %12lld\n", label, t, s.pushes, s.decreases, s.pops);
+        same = same && memcmp(dist, expected, g->n * sizeof(long long)) == 0;
+    }
+    printf("Distâncias iguais em todas as versões: %s\n\n", same ? "sim" : "NÃO");
+
+    free(expected);
+    free(dist);
+}
+
+/**
+ * Função principal: testes e benchmark de Dijkstra
+ * Uso: ./heap_d_ario [vértices]
+ */
+int main(int argc, char* argv[]) {
+    printf("=== DEMONSTRAÇÃO DE HEAP D-ÁRIO INDEXADO ===\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    if (n < 100) n = 100;
+
+    testar_operacoes();
+    testar_heapify();
+
+    Graph* g = random_graph(n, 8, 1000);
+    benchmark("aleatório, grau 8", g);
+    free_graph(g);
+
+    g = random_graph(n / 10, 64, 100000);
+    benchmark("aleatório, grau 64", g);
+    free_graph(g);
+
+    int side = 1;
+    while ((side + 1) * (side + 1) <= n) side++;
+    g = grid_graph(side, 1000);
+    benchmark("grade 4-vizinhos", g);
+    free_graph(g);
+
+    return 0;
+}
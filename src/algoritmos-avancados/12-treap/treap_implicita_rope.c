@@ -0,0 +1,634 @@
+/**
+ * ============================================================================
+ * TREAP IMPLÍCITO (ROPE) - EDIÇÃO DE TEXTOS GRANDES
+ * ============================================================================
+ *
+ * Num buffer plano, inserir ou remover no meio custa um memmove de tudo o
+ * que vem depois: O(n) por edição. Num treap implícito a "chave" de um nó
+ * é a sua posição, derivada dos tamanhos das subárvores (o mesmo size de
+ * treap.c), e split/merge por posição fazem cada edição em O(log n).
+ *
+ * NÓS COM BLOCOS DE BYTES:
+ * - Um caractere por nó custaria ~40 bytes de estrutura por byte de texto.
+ *   Aqui cada nó guarda até CHUNK bytes, e size conta BYTES, não nós
+ *
+ *        [size=900, len=256 "...."]
+ *         /                     \
+ *   [size=300, len=44]     [size=344, len=256]
+ *
+ * - Split numa posição no meio de um bloco divide o bloco em dois nós; o
+ *   pedaço novo herda a prioridade, então a propriedade de heap se mantém
+ * - Edições pequenas são feitas dentro do bloco (memmove de até CHUNK
+ *   bytes) quando cabem, e na emenda de um split os dois blocos vizinhos
+ *   são juntados se couberem num só: sem isso, digitar criaria um nó por
+ *   tecla e os blocos ficariam cada vez mais vazios
+ *
+ * REVERSO PREGUIÇOSO (lazy propagation):
+ * - rope_reverse marca a subárvore com rev = true em O(log n); a marca só é
+ *   aplicada (trocar filhos, inverter os bytes do bloco, passar a marca aos
+ *   filhos) quando um nó é visitado
+ *
+ * Operações (n = bytes no texto):
+ * - rope_insert(pos, texto), rope_delete(pos, len), rope_reverse(pos, len):
+ *   O(log n + len/CHUNK)
+ * - rope_substr(pos, len): O(log n + len)
+ *
+ * Pré-requisito: treap.c
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#define CHUNK 256
+
+// ==================== ESTRUTURA DO ROPE ====================
+
+typedef struct RopeNode {
+    int priority;               // Prioridade aleatória (heap-max)
+    int size;                   // Bytes na subárvore
+    int len;                    // Bytes neste nó
+    bool rev;                   // Subárvore pendente de inversão
+    struct RopeNode *left;
+    struct RopeNode *right;
+    char data[CHUNK];
+} RopeNode;
+
+typedef struct {
+    RopeNode *root;
+    long nodes;                 // Nós alocados (estatística)
+} Rope;
+
+// ==================== FUNÇÕES AUXILIARES ====================
+
+static RopeNode* create_node(Rope *rope, const char *data, int len, int priority) {
+    RopeNode *node = (RopeNode *)malloc(sizeof(RopeNode));
+    if (node == NULL) {
+        fprintf(stderr, "Erro ao alocar nó\n");
+        exit(1);
+    }
+    node->priority = priority;
+    node->len = len;
+    node->size = len;
+    node->rev = false;
+    node->left = node->right = NULL;
+    memcpy(node->data, data, len);
+    rope->nodes++;
+    return node;
+}
+
+static inline int get_size(RopeNode *node) {
+    return node ? node->size : 0;
+}
+
+static inline void update_size(RopeNode *node) {
+    node->size = node->len + get_size(node->left) + get_size(node->right);
+}
+
+/**
+ * Aplicar a inversão pendente: trocar filhos, inverter o bloco e
+ * repassar a marca
+ */
+static void push_down(RopeNode *node) {
+    if (node == NULL || !node->rev) return;
+    RopeNode *tmp = node->left;
+    node->left = node->right;
+    node->right = tmp;
+    for (int i = 0, j = node->len - 1; i < j; i++, j--) {
+        char c = node->data[i];
+        node->data[i] = node->data[j];
+        node->data[j] = c;
+    }
+    if (node->left) node->left->rev = !node->left->rev;
+    if (node->right) node->right->rev = !node->right->rev;
+    node->rev = false;
+}
+
+static void free_nodes(Rope *rope, RopeNode *node) {
+    while (node != NULL) {
+        free_nodes(rope, node->left);
+        RopeNode *right = node->right;
+        free(node);
+        rope->nodes--;
+        node = right;
+    }
+}
+
+// ==================== SPLIT E MERGE POR POSIÇÃO ====================
+
+/**
+ * Split: left = primeiros pos bytes, right = o resto
+ */
+static void rope_split(Rope *rope, RopeNode *node, int pos, RopeNode **left, RopeNode **right) {
+    if (node == NULL) {
+        *left = *right = NULL;
+        return;
+    }
+    push_down(node);
+
+    int left_size = get_size(node->left);
+    if (pos <= left_size) {
+        rope_split(rope, node->left, pos, left, &node->left);
+        update_size(node);
+        *right = node;
+    } else if (pos >= left_size + node->len) {
+        rope_split(rope, node->right, pos - left_size - node->len, &node->right, right);
+        update_size(node);
+        *left = node;
+    } else {
+        // Posição no meio do bloco: a segunda metade vira um nó com a mesma
+        // prioridade, que adota a subárvore direita
+        int offset = pos - left_size;
+        RopeNode *tail = create_node(rope, node->data + offset, node->len - offset, node->priority);
+        tail->right = node->right;
+        update_size(tail);
+        node->len = offset;
+        node->right = NULL;
+        update_size(node);
+        *left = node;
+        *right = tail;
+    }
+}
+
+/**
+ * Merge: concatenar (left antes de right)
+ */
+static RopeNode* rope_merge(RopeNode *left, RopeNode *right) {
+    if (left == NULL) return right;
+    if (right == NULL) return left;
+
+    if (left->priority > right->priority) {
+        push_down(left);
+        left->right = rope_merge(left->right, right);
+        update_size(left);
+        return left;
+    } else {
+        push_down(right);
+        right->left = rope_merge(left, right->left);
+        update_size(right);
+        return right;
+    }
+}
+
+/**
+ * Construir um treap com os blocos de 'text' em O(len/CHUNK)
+ * (árvore cartesiana com pilha da espinha direita)
+ */
+static RopeNode* build_chunks(Rope *rope, const char *text, int len) {
+    int count = (len + CHUNK - 1) / CHUNK;
+    if (count == 0) return NULL;
+    RopeNode **stack = (RopeNode **)malloc(count * sizeof(RopeNode *));
+    int top = 0;
+    for (int off = 0; off < len; off += CHUNK) {
+        int n = len - off < CHUNK ? len - off : CHUNK;
+        RopeNode *node = create_node(rope, text + off, n, rand());
+        RopeNode *last = NULL;
+        while (top > 0 && stack[top - 1]->priority < node->priority) {
+            last = stack[--top];
+            update_size(last);
+        }
+        node->left = last;
+        if (top > 0) stack[top - 1]->right = node;
+        stack[top++] = node;
+    }
+    while (top > 1) update_size(stack[--top]);
+    RopeNode *root = stack[0];
+    update_size(root);
+    free(stack);
+    return root;
+}
+
+/**
+ * Anexar ao último bloco da árvore se houver espaço (atualiza os tamanhos
+ * da espinha direita na volta)
+ */
+static bool append_to_last(RopeNode *node, const char *text, int len) {
+    if (node == NULL) return false;
+    push_down(node);
+    bool done;
+    if (node->right != NULL) {
+        done = append_to_last(node->right, text, len);
+    } else if (node->len + len <= CHUNK) {
+        memcpy(node->data + node->len, text, len);
+        node->len += len;
+        done = true;
+    } else {
+        done = false;
+    }
+    if (done) update_size(node);
+    return done;
+}
+
+/**
+ * Tamanho do primeiro/último bloco (aplicando inversões pendentes no caminho)
+ */
+static int first_len(RopeNode *node) {
+    push_down(node);
+    while (node->left != NULL) {
+        node = node->left;
+        push_down(node);
+    }
+    return node->len;
+}
+
+static int last_len(RopeNode *node) {
+    push_down(node);
+    while (node->right != NULL) {
+        node = node->right;
+        push_down(node);
+    }
+    return node->len;
+}
+
+/**
+ * Concatenar juntando os blocos da emenda quando cabem num só: cada split
+ * no meio de um bloco deixa dois pedaços, e sem isso as edições
+ * fragmentariam o texto em nós quase vazios
+ */
+static RopeNode* rope_join(Rope *rope, RopeNode *left, RopeNode *right) {
+    if (left != NULL && right != NULL) {
+        int head_len = first_len(right);
+        if (last_len(left) + head_len <= CHUNK) {
+            RopeNode *head;
+            rope_split(rope, right, head_len, &head, &right);
+            append_to_last(left, head->data, head->len);
+            free_nodes(rope, head);
+        }
+    }
+    return rope_merge(left, right);
+}
+
+/**
+ * Edição dentro de um único bloco, sem split: inserir se o bloco que
+ * contém pos tem espaço, ou remover um trecho que não esvazia o bloco.
+ * Atualiza os tamanhos do caminho na volta.
+ */
+static bool insert_in_place(RopeNode *node, int pos, const char *text, int len) {
+    if (node == NULL) return false;
+    push_down(node);
+    int left_size = get_size(node->left);
+    bool done;
+    if (pos < left_size) {
+        done = insert_in_place(node->left, pos, text, len);
+    } else if (pos > left_size + node->len) {
+        done = insert_in_place(node->right, pos - left_size - node->len, text, len);
+    } else if (node->len + len <= CHUNK) {
+        int offset = pos - left_size;
+        memmove(node->data + offset + len, node->data + offset, node->len - offset);
+        memcpy(node->data + offset, text, len);
+        node->len += len;
+        done = true;
+    } else {
+        done = false;
+    }
+    if (done) update_size(node);
+    return done;
+}
+
+static bool delete_in_place(RopeNode *node, int pos, int len) {
+    if (node == NULL) return false;
+    push_down(node);
+    int left_size = get_size(node->left);
+    bool done;
+    if (pos < left_size) {
+        done = delete_in_place(node->left, pos, len);
+    } else if (pos >= left_size + node->len) {
+        done = delete_in_place(node->right, pos - left_size - node->len, len);
+    } else if (pos - left_size + len < node->len) {
+        int offset = pos - left_size;
+        memmove(node->data + offset, node->data + offset + len, node->len - offset - len);
+        node->len -= len;
+        done = true;
+    } else {
+        done = false;
+    }
+    if (done) update_size(node);
+    return done;
+}
+
+// ==================== OPERAÇÕES DO ROPE ====================
+
+Rope* rope_create(const char *text, int len) {
+    Rope *rope = (Rope *)calloc(1, sizeof(Rope));
+    rope->root = build_chunks(rope, text, len);
+    return rope;
+}
+
+void rope_free(Rope *rope) {
+    free_nodes(rope, rope->root);
+    free(rope);
+}
+
+int rope_length(Rope *rope) {
+    return get_size(rope->root);
+}
+
+/**
+ * Inserir 'len' bytes na posição pos (0 <= pos <= comprimento)
+ */
+void rope_insert(Rope *rope, int pos, const char *text, int len) {
+    if (len <= 0) return;
+    if (insert_in_place(rope->root, pos, text, len)) return;
+    RopeNode *left, *right;
+    rope_split(rope, rope->root, pos, &left, &right);
+    if (!append_to_last(left, text, len)) {
+        left = rope_join(rope, left, build_chunks(rope, text, len));
+    }
+    rope->root = rope_join(rope, left, right);
+}
+
+/**
+ * Remover 'len' bytes a partir de pos
+ */
+void rope_delete(Rope *rope, int pos, int len) {
+    if (len <= 0) return;
+    if (delete_in_place(rope->root, pos, len)) return;
+    RopeNode *left, *middle, *right;
+    rope_split(rope, rope->root, pos, &left, &right);
+    rope_split(rope, right, len, &middle, &right);
+    free_nodes(rope, middle);
+    rope->root = rope_join(rope, left, right);
+}
+
+/**
+ * Inverter o trecho [pos, pos + len) em O(log n): só marca a subárvore
+ */
+void rope_reverse(Rope *rope, int pos, int len) {
+    if (len <= 1) return;
+    RopeNode *left, *middle, *right;
+    rope_split(rope, rope->root, pos, &left, &right);
+    rope_split(rope, right, len, &middle, &right);
+    middle->rev = !middle->rev;
+    rope->root = rope_join(rope, rope_join(rope, left, middle), right);
+}
+
+/**
+ * Copiar bytes de [pos, pos + len) da subárvore para out (sem split)
+ */
+static void copy_range(RopeNode *node, int pos, int len, char *out) {
+    while (node != NULL && len > 0) {
+        push_down(node);
+        int left_size = get_size(node->left);
+        if (pos < left_size) {
+            int n = left_size - pos < len ? left_size - pos : len;
+            copy_range(node->left, pos, n, out);
+            out += n;
+            len -= n;
+            pos = left_size;
+        }
+        if (len == 0) break;
+        int offset = pos - left_size;
+        if (offset < node->len) {
+            int n = node->len - offset < len ? node->len - offset : len;
+            memcpy(out, node->data + offset, n);
+            out += n;
+            len -= n;
+            pos += n;
+        }
+        pos -= left_size + node->len;
+        node = node->right;
+    }
+}
+
+/**
+ * Extrair [pos, pos + len) para out (não adiciona '\0')
+ */
+void rope_substr(Rope *rope, int pos, int len, char *out) {
+    copy_range(rope->root, pos, len, out);
+}
+
+char rope_char_at(Rope *rope, int pos) {
+    char c;
+    copy_range(rope->root, pos, 1, &c);
+    return c;
+}
+
+// ==================== VERIFICAÇÃO ====================
+
+/**
+ * Verificar tamanhos, propriedade heap e blocos não vazios
+ */
+static bool verify_nodes(RopeNode *node, long *count) {
+    if (node == NULL) return true;
+    (*count)++;
+    if (node->len <= 0 || node->len > CHUNK) return false;
+    if (node->size != node->len + get_size(node->left) + get_size(node->right)) return false;
+    if (node->left && node->left->priority > node->priority) return false;
+    if (node->right && node->right->priority > node->priority) return false;
+    return verify_nodes(node->left, count) && verify_nodes(node->right, count);
+}
+
+bool rope_verify(Rope *rope) {
+    long count = 0;
+    return verify_nodes(rope->root, &count) && count == rope->nodes;
+}
+
+// ==================== TESTES ====================
+
+void testar_basico() {
+    printf("=== TESTE BÁSICO ===\n\n");
+
+    const char *texto = "O rato roeu a roupa do rei de Roma";
+    Rope *rope = rope_create(texto, (int)strlen(texto));
+    char buffer[128];
+
+    rope_insert(rope, 13, " velha", 6);
+    rope_substr(rope, 0, rope_length(rope), buffer);
+    buffer[rope_length(rope)] = '\0';
+    printf("Após inserir \" velha\" em 13: \"%s\"\n", buffer);
+    bool ok = strcmp(buffer, "O rato roeu a velha roupa do rei de Roma") == 0;
+
+    rope_delete(rope, 26, 7);
+    rope_substr(rope, 0, rope_length(rope), buffer);
+    buffer[rope_length(rope)] = '\0';
+    printf("Após remover 7 bytes em 26:   \"%s\"\n", buffer);
+    ok = ok && strcmp(buffer, "O rato roeu a velha roupa de Roma") == 0;
+
+    rope_reverse(rope, 2, 4);
+    rope_substr(rope, 0, rope_length(rope), buffer);
+    buffer[rope_length(rope)] = '\0';
+    printf("Após inverter [2, 6):         \"%s\"\n", buffer);
+    ok = ok && strcmp(buffer, "O otar roeu a velha roupa de Roma") == 0;
+
+    rope_substr(rope, 14, 5, buffer);
+    buffer[5] = '\0';
+    printf("Substring [14, 19):           \"%s\"\n", buffer);
+    ok = ok && strcmp(buffer, "velha") == 0 && rope_verify(rope);
+
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    rope_free(rope);
+}
+
+void testar_aleatorio() {
+    printf("=== TESTE ALEATÓRIO (contra buffer plano) ===\n\n");
+
+    enum { INITIAL = 100000, OPS = 20000 };
+    int capacity = INITIAL + OPS * 600;
+    char *flat = (char *)malloc(capacity);
+    char *check = (char *)malloc(capacity);
+    char text[1200];
+    int n = INITIAL;
+    for (int i = 0; i < n; i++) flat[i] = 'a' + rand() % 26;
+    Rope *rope = rope_create(flat, n);
+    bool ok = true;
+
+    for (int op = 0; op < OPS && ok; op++) {
+        int kind = rand() % 4;
+        int pos = n ? rand() % (n + 1) : 0;
+        if (kind == 0 || n < 1000) {
+            // Inserções pequenas (digitação) e grandes (colar)
+            int len = rand() % 4 == 0 ? 1 + rand() % 1100 : 1 + rand() % 8;
+            for (int i = 0; i < len; i++) text[i] = 'A' + rand() % 26;
+            rope_insert(rope, pos, text, len);
+            memmove(flat + pos + len, flat + pos, n - pos);
+            memcpy(flat + pos, text, len);
+            n += len;
+        } else if (kind == 1) {
+            int len = rand() % 250;
+            if (len > n - pos) len = n - pos;
+            rope_delete(rope, pos, len);
+            memmove(flat + pos, flat + pos + len, n - pos - len);
+            n -= len;
+        } else if (kind == 2) {
+            int len = rand() % 5000;
+            if (len > n - pos) len = n - pos;
+            rope_reverse(rope, pos, len);
+            for (int i = pos, j = pos + len - 1; i < j; i++, j--) {
+                char c = flat[i]; flat[i] = flat[j]; flat[j] = c;
+            }
+        } else {
+            int len = rand() % 3000;
+            if (len > n - pos) len = n - pos;
+            rope_substr(rope, pos, len, check);
+            ok = memcmp(check, flat + pos, len) == 0;
+        }
+        if (op % 2000 == 0 && ok) {
+            rope_substr(rope, 0, n, check);
+            ok = rope_length(rope) == n && memcmp(check, flat, n) == 0 && rope_verify(rope);
+        }
+    }
+    rope_substr(rope, 0, n, check);
+    ok = ok && rope_length(rope) == n && memcmp(check, flat, n) == 0 && rope_verify(rope);
+
+    printf("%d edições (inserção, remoção, reverso, substring) conferidas\n", OPS);
+    printf("Texto final: %d bytes em %ld nós (%.0f bytes/nó)\n", n, rope->nodes, (double)n / rope->nodes);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+
+    free(flat);
+    free(check);
+    rope_free(rope);
+}
+
+// ==================== BENCHMARK ====================
+
+void benchmark(int n, int ops) {
+    printf("=== BENCHMARK: texto de %d MB, %d edições ===\n\n", n >> 20, ops);
+
+    int max_len = n + ops * 16 + 1;
+    char *flat = (char *)malloc(max_len);
+    char *out = (char *)malloc(4096);
+    for (int i = 0; i < n; i++) flat[i] = 'a' + rand() % 26;
+
+    // Mesma sequência para os dois: posições aleatórias, 8 bytes por edição
+    int *positions = (int *)malloc(ops * sizeof(int));
+    for (int i = 0; i < ops; i++) positions[i] = (int)(((long)rand() * RAND_MAX + rand()) % (n - 1024));
+    const char *typed = "abcdefgh";
+
+    clock_t start = clock();
+    Rope *rope = rope_create(flat, n);
+    double t_build = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    // Buffer plano: memmove a cada edição (limitado para não demorar demais)
+    int flat_ops = ops < 2000 ? ops : 2000;
+    int len = n;
+    start = clock();
+    for (int i = 0; i < flat_ops; i++) {
+        int pos = positions[i];
+        memmove(flat + pos + 8, flat + pos, len - pos);
+        memcpy(flat + pos, typed, 8);
+        len += 8;
+        memmove(flat + pos / 2, flat + pos / 2 + 8, len - pos / 2 - 8);
+        len -= 8;
+    }
+    double t_flat = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int i = 0; i < ops; i++) {
+        int pos = positions[i];
+        rope_insert(rope, pos, typed, 8);
+        rope_delete(rope, pos / 2, 8);
+    }
+    double t_rope = (double)(clock() - start) / CLOCKS_PER_SEC;
+    double mem_edits = (double)rope->nodes * sizeof(RopeNode) / rope_length(rope);
+
+    start = clock();
+    for (int i = 0; i < ops; i++) rope_substr(rope, positions[i], 4096, out);
+    double t_substr = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int i = 0; i < ops; i++) rope_reverse(rope, positions[i] / 2, n / 2);
+    double t_rev = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int i = 0; i < flat_ops / 10; i++) {
+        int pos = positions[i] / 2;
+        for (int a = pos, b = pos + n / 2 - 1; a < b; a++, b--) {
+            char c = flat[a]; flat[a] = flat[b]; flat[b] = c;
+        }
+    }
+    double t_flat_rev = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    double mem_reverses = (double)rope->nodes * sizeof(RopeNode) / rope_length(rope);
+    printf("Construção do rope: %.3f s | memória = %.2fx o texto\n", t_build,
+           (double)((n + CHUNK - 1) / CHUNK) * sizeof(RopeNode) / n);
+    printf("Memória após as edições: %.2fx | após os reversos: %.2fx (%ld nós)\n\n",
+           mem_edits, mem_reverses, rope->nodes);
+    printf("%-36s %14s\n", "Operação", "µs/operação");
+    printf("%-36s %14.2f\n", "buffer plano: inserir+remover 8 B", t_flat * 1e6 / flat_ops);
+    printf("%-36s %14.2f\n", "rope: inserir+remover 8 B", t_rope * 1e6 / ops);
+    printf("%-36s %14.2f\n", "rope: substring de 4 KB", t_substr * 1e6 / ops);
+    printf("%-36s %14.2f\n", "buffer plano: inverter n/2 bytes", t_flat_rev * 1e6 / (flat_ops / 10));
+    printf("%-36s %14.2f\n", "rope: inverter n/2 bytes", t_rev * 1e6 / ops);
+    printf("Edição: rope %.0fx mais rápido | rope válido: %s\n\n",
+           t_rope > 0 ? (t_flat / flat_ops) / (t_rope / ops) : 0.0, rope_verify(rope) ? "OK" : "FALHA");
+
+    free(positions);
+    free(flat);
+    free(out);
+    rope_free(rope);
+}
+
+// ==================== FUNÇÃO PRINCIPAL ====================
+
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║              TREAP IMPLÍCITO (ROPE)                      ║\n");
+    printf("║   Edição por posição com blocos e reverso preguiçoso     ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int mb = (argc > 1) ? atoi(argv[1]) : 64;
+    int ops = (argc > 2) ? atoi(argv[2]) : 200000;
+    if (mb < 1) mb = 1;
+    if (mb > 1024) mb = 1024;
+    if (ops < 10) ops = 10;
+
+    srand(12345);
+    testar_basico();
+    testar_aleatorio();
+    benchmark(mb << 20, ops);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades do Rope (Treap Implícito):\n");
+    printf("- Posição implícita pelo tamanho (em bytes) das subárvores\n");
+    printf("- Inserir/remover/inverter trecho: O(log n) + tamanho/CHUNK\n");
+    printf("- Blocos de até %d bytes: pouca memória extra por byte\n", CHUNK);
+    printf("- Reverso preguiçoso aplicado só nos nós visitados\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
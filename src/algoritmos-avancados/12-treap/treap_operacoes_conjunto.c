@@ -0,0 +1,710 @@
+/**
+ * ============================================================================
+ * TREAP - UNIÃO, INTERSEÇÃO E DIFERENÇA EM LOTE (JOIN-BASED)
+ * ============================================================================
+ *
+ * Com treap.c, unir dois treaps exige inserir as m chaves do menor uma a
+ * uma no maior: O(m log n). Os algoritmos baseados em split/join
+ * (Blelloch & Reid-Miller, 1998) fazem o mesmo em
+ *
+ *                O(m log(n/m + 1))   esperado,  m <= n
+ *
+ * que é ótimo: para m = n vira O(n) (uma "intercalação" de árvores), e
+ * para m = 1 vira O(log n) (uma inserção).
+ *
+ * IDEIA (união):
+ *
+ *   union(T1, T2):
+ *     se T1 tem a raiz de maior prioridade, ela continua sendo a raiz
+ *     split(T2, raiz(T1).key) -> L2, (duplicata), R2
+ *     raiz.left  = union(T1.left,  L2)     <- independentes:
+ *     raiz.right = union(T1.right, R2)     <- podem rodar em paralelo
+ *
+ * Interseção e diferença seguem o mesmo padrão; quando a raiz sai do
+ * resultado, as duas metades são coladas com treap_merge.
+ *
+ * PRIORIDADES POR HASH:
+ * - Aqui a prioridade é hash(key), e não rand(): a mesma chave tem a mesma
+ *   prioridade nos dois treaps, e o formato do treap passa a depender só
+ *   do conjunto de chaves (único e reprodutível)
+ *
+ * PARALELISMO FORK-JOIN:
+ * - As duas chamadas recursivas não compartilham nós; nos primeiros
+ *   níveis a chamada da esquerda vai para uma thread nova (pthread_create)
+ *   e a da direita roda na thread atual
+ *
+ * Todas as operações CONSOMEM os dois treaps de entrada (como treap_merge):
+ * os nós são reaproveitados no resultado ou descartados. Interseção e
+ * diferença descartam subárvores inteiras; liberá-las na recursão visitaria
+ * cada nó e o custo viraria O(n + m). Por isso as raízes descartadas vão
+ * para uma DiscardList, liberada por quem chamou fora da operação.
+ *
+ * Compilação: gcc -O2 -std=c11 -pthread treap_operacoes_conjunto.c
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+// ==================== ESTRUTURA DO TREAP ====================
+
+typedef struct TreapNode {
+    int key;                    // Chave (propriedade BST)
+    int priority;               // hash(key) (propriedade Heap-max)
+    int size;                   // Tamanho da subárvore
+    struct TreapNode *left;
+    struct TreapNode *right;
+} TreapNode;
+
+// ==================== FUNÇÕES AUXILIARES ====================
+
+/**
+ * Prioridade determinística: mistura de bits da chave (finalizador murmur3)
+ */
+static int hash_priority(int key) {
+    uint32_t h = (uint32_t)key;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return (int)(h & 0x7FFFFFFF);
+}
+
+/**
+ * Ordem total das prioridades (empate desfeito pela chave)
+ */
+static inline bool higher(TreapNode *a, TreapNode *b) {
+    return a->priority > b->priority || (a->priority == b->priority && a->key > b->key);
+}
+
+TreapNode* create_node(int key) {
+    TreapNode *node = (TreapNode *)malloc(sizeof(TreapNode));
+    if (node == NULL) {
+        fprintf(stderr, "Erro ao alocar nó\n");
+        exit(1);
+    }
+    node->key = key;
+    node->priority = hash_priority(key);
+    node->size = 1;
+    node->left = node->right = NULL;
+    return node;
+}
+
+int get_size(TreapNode *node) {
+    return node ? node->size : 0;
+}
+
+void update_size(TreapNode *node) {
+    if (node) {
+        node->size = 1 + get_size(node->left) + get_size(node->right);
+    }
+}
+
+void treap_free(TreapNode *node) {
+    if (node) {
+        treap_free(node->left);
+        treap_free(node->right);
+        free(node);
+    }
+}
+
+// ==================== SPLIT E MERGE ====================
+
+/**
+ * Merge: combinar dois treaps (todos elementos de left < right)
+ */
+TreapNode* treap_merge(TreapNode *left, TreapNode *right) {
+    if (left == NULL) return right;
+    if (right == NULL) return left;
+
+    if (higher(left, right)) {
+        left->right = treap_merge(left->right, right);
+        update_size(left);
+        return left;
+    } else {
+        right->left = treap_merge(left, right->left);
+        update_size(right);
+        return right;
+    }
+}
+
+/**
+ * Split em três partes: left (< key), found (nó com a chave, ou NULL)
+ * e right (> key)
+ */
+void treap_split_exact(TreapNode *node, int key, TreapNode **left, TreapNode **found, TreapNode **right) {
+    if (node == NULL) {
+        *left = *found = *right = NULL;
+        return;
+    }
+
+    if (node->key < key) {
+        *left = node;
+        treap_split_exact(node->right, key, &node->right, found, right);
+        update_size(node);
+    } else if (node->key > key) {
+        *right = node;
+        treap_split_exact(node->left, key, left, found, &node->left);
+        update_size(node);
+    } else {
+        *left = node->left;
+        *right = node->right;
+        node->left = node->right = NULL;
+        node->size = 1;
+        *found = node;
+    }
+}
+
+/**
+ * Construir treap a partir de chaves ordenadas e distintas em O(n)
+ * (árvore cartesiana com uma pilha da espinha direita)
+ */
+TreapNode* treap_build_sorted(const int *keys, int n) {
+    TreapNode **stack = (TreapNode **)malloc((n + 1) * sizeof(TreapNode *));
+    int top = 0;
+    for (int i = 0; i < n; i++) {
+        TreapNode *node = create_node(keys[i]);
+        TreapNode *last = NULL;
+        while (top > 0 && higher(node, stack[top - 1])) {
+            last = stack[--top];
+            update_size(last);
+        }
+        node->left = last;
+        if (top > 0) stack[top - 1]->right = node;
+        stack[top++] = node;
+    }
+    while (top > 1) update_size(stack[--top]);
+    TreapNode *root = top ? stack[0] : NULL;
+    update_size(root);
+    free(stack);
+    return root;
+}
+
+// ==================== DESCARTE ====================
+
+/**
+ * Subárvores que saem do resultado de interseção/diferença. Guardar a raiz
+ * é O(1); liberar os nós (discard_list_free) fica fora da operação
+ */
+typedef struct {
+    TreapNode **roots;
+    int count;
+    int capacity;
+    long nodes;                 // Total de nós descartados
+    pthread_mutex_t lock;       // As chamadas em paralelo descartam juntas
+} DiscardList;
+
+void discard_list_init(DiscardList *d) {
+    d->roots = NULL;
+    d->count = d->capacity = 0;
+    d->nodes = 0;
+    pthread_mutex_init(&d->lock, NULL);
+}
+
+/**
+ * Libera todos os nós descartados e esvazia a lista: O(nós descartados)
+ */
+void discard_list_free(DiscardList *d) {
+    for (int i = 0; i < d->count; i++) treap_free(d->roots[i]);
+    free(d->roots);
+    pthread_mutex_destroy(&d->lock);
+    discard_list_init(d);
+}
+
+// Sem lista (d == NULL), a subárvore é liberada na hora: O(tamanho dela)
+static void discard(DiscardList *d, TreapNode *root) {
+    if (root == NULL) return;
+    if (d == NULL) {
+        treap_free(root);
+        return;
+    }
+    pthread_mutex_lock(&d->lock);
+    if (d->count == d->capacity) {
+        d->capacity = d->capacity ? 2 * d->capacity : 64;
+        d->roots = (TreapNode **)realloc(d->roots, d->capacity * sizeof(TreapNode *));
+    }
+    d->roots[d->count++] = root;
+    d->nodes += get_size(root);
+    pthread_mutex_unlock(&d->lock);
+}
+
+// Um nó que sai do resultado depois que os filhos já foram repassados
+static void discard_node(DiscardList *d, TreapNode *node) {
+    node->left = node->right = NULL;
+    node->size = 1;
+    discard(d, node);
+}
+
+// ==================== OPERAÇÕES DE CONJUNTO ====================
+
+typedef enum { OP_UNION, OP_INTERSECTION, OP_DIFFERENCE } SetOp;
+
+// Abaixo deste tamanho (soma das duas entradas) não vale criar uma thread
+#define PARALLEL_GRAIN 20000
+
+static TreapNode* set_op(SetOp op, TreapNode *a, TreapNode *b, int depth, DiscardList *d);
+
+typedef struct {
+    SetOp op;
+    TreapNode *a, *b;
+    int depth;
+    DiscardList *discarded;
+    TreapNode *result;
+} ForkTask;
+
+static void* fork_task_run(void *arg) {
+    ForkTask *task = (ForkTask *)arg;
+    task->result = set_op(task->op, task->a, task->b, task->depth, task->discarded);
+    return NULL;
+}
+
+/**
+ * Executa as duas chamadas recursivas; a da esquerda em outra thread
+ * enquanto depth > 0 e o trabalho for grande o bastante
+ */
+static void fork_join(SetOp op, TreapNode *a1, TreapNode *b1, TreapNode *a2, TreapNode *b2,
+                      int depth, DiscardList *d, TreapNode **r1, TreapNode **r2) {
+    if (depth > 0 && get_size(a1) + get_size(b1) >= PARALLEL_GRAIN &&
+        get_size(a2) + get_size(b2) >= PARALLEL_GRAIN) {
+        ForkTask task = { op, a1, b1, depth - 1, d, NULL };
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, fork_task_run, &task) == 0) {
+            *r2 = set_op(op, a2, b2, depth - 1, d);
+            pthread_join(thread, NULL);
+            *r1 = task.result;
+            return;
+        }
+        // Sem recursos para outra thread: segue sequencial
+    }
+    *r1 = set_op(op, a1, b1, depth, d);
+    *r2 = set_op(op, a2, b2, depth, d);
+}
+
+/**
+ * União: a raiz de maior prioridade divide o outro treap
+ */
+static TreapNode* union_rec(TreapNode *a, TreapNode *b, int depth) {
+    if (a == NULL) return b;
+    if (b == NULL) return a;
+    if (higher(b, a)) {
+        TreapNode *tmp = a; a = b; b = tmp;
+    }
+
+    TreapNode *l, *dup, *r;
+    treap_split_exact(b, a->key, &l, &dup, &r);
+    free(dup);      // Chave presente nos dois: fica o nó de a
+
+    fork_join(OP_UNION, a->left, l, a->right, r, depth, NULL, &a->left, &a->right);
+    update_size(a);
+    return a;
+}
+
+/**
+ * Interseção: a raiz fica só se a chave existir no outro treap
+ */
+static TreapNode* intersection_rec(TreapNode *a, TreapNode *b, int depth, DiscardList *d) {
+    if (a == NULL || b == NULL) {
+        discard(d, a);
+        discard(d, b);
+        return NULL;
+    }
+    if (higher(b, a)) {
+        TreapNode *tmp = a; a = b; b = tmp;
+    }
+
+    TreapNode *l, *dup, *r, *left, *right;
+    treap_split_exact(b, a->key, &l, &dup, &r);
+    fork_join(OP_INTERSECTION, a->left, l, a->right, r, depth, d, &left, &right);
+
+    if (dup != NULL) {
+        discard(d, dup);
+        a->left = left;
+        a->right = right;
+        update_size(a);
+        return a;
+    }
+    discard_node(d, a);
+    return treap_merge(left, right);
+}
+
+/**
+ * Diferença a \ b: a raiz de a divide b (não é simétrica, sem troca)
+ */
+static TreapNode* difference_rec(TreapNode *a, TreapNode *b, int depth, DiscardList *d) {
+    if (a == NULL || b == NULL) {
+        discard(d, b);
+        return a;
+    }
+
+    TreapNode *l, *dup, *r, *left, *right;
+    treap_split_exact(b, a->key, &l, &dup, &r);
+    fork_join(OP_DIFFERENCE, a->left, l, a->right, r, depth, d, &left, &right);
+
+    if (dup == NULL) {
+        a->left = left;
+        a->right = right;
+        update_size(a);
+        return a;
+    }
+    discard(d, dup);
+    discard_node(d, a);
+    return treap_merge(left, right);
+}
+
+static TreapNode* set_op(SetOp op, TreapNode *a, TreapNode *b, int depth, DiscardList *d) {
+    switch (op) {
+        case OP_UNION:        return union_rec(a, b, depth);
+        case OP_INTERSECTION: return intersection_rec(a, b, depth, d);
+        default:              return difference_rec(a, b, depth, d);
+    }
+}
+
+/**
+ * Níveis de fork para usar até 'threads' threads
+ */
+static int fork_depth(int threads) {
+    int depth = 0;
+    while ((1 << depth) < threads) depth++;
+    return depth;
+}
+
+TreapNode* treap_union(TreapNode *a, TreapNode *b) {
+    return union_rec(a, b, 0);
+}
+
+/**
+ * Interseção e diferença: os nós que saem do resultado vão para
+ * 'discarded' (NULL libera na hora, somando O(nós descartados) ao custo)
+ */
+TreapNode* treap_intersection(TreapNode *a, TreapNode *b, DiscardList *discarded) {
+    return intersection_rec(a, b, 0, discarded);
+}
+
+TreapNode* treap_difference(TreapNode *a, TreapNode *b, DiscardList *discarded) {
+    return difference_rec(a, b, 0, discarded);
+}
+
+TreapNode* treap_union_parallel(TreapNode *a, TreapNode *b, int threads) {
+    return union_rec(a, b, fork_depth(threads));
+}
+
+TreapNode* treap_intersection_parallel(TreapNode *a, TreapNode *b, int threads, DiscardList *discarded) {
+    return intersection_rec(a, b, fork_depth(threads), discarded);
+}
+
+TreapNode* treap_difference_parallel(TreapNode *a, TreapNode *b, int threads, DiscardList *discarded) {
+    return difference_rec(a, b, fork_depth(threads), discarded);
+}
+
+// ==================== INSERÇÃO UMA A UMA (treap.c) ====================
+
+TreapNode* rotate_right(TreapNode *y) {
+    TreapNode *x = y->left;
+    y->left = x->right;
+    x->right = y;
+    update_size(y);
+    update_size(x);
+    return x;
+}
+
+TreapNode* rotate_left(TreapNode *x) {
+    TreapNode *y = x->right;
+    x->right = y->left;
+    y->left = x;
+    update_size(x);
+    update_size(y);
+    return y;
+}
+
+TreapNode* treap_insert(TreapNode *node, int key) {
+    if (node == NULL) {
+        return create_node(key);
+    }
+    if (key < node->key) {
+        node->left = treap_insert(node->left, key);
+        if (higher(node->left, node)) node = rotate_right(node);
+    } else if (key > node->key) {
+        node->right = treap_insert(node->right, key);
+        if (higher(node->right, node)) node = rotate_left(node);
+    }
+    update_size(node);
+    return node;
+}
+
+// ==================== VERIFICAÇÃO ====================
+
+/**
+ * Verificar BST, heap e tamanhos
+ */
+bool verify_treap(TreapNode *node, long min, long max) {
+    if (node == NULL) return true;
+    if (node->key <= min || node->key >= max) return false;
+    if (node->size != 1 + get_size(node->left) + get_size(node->right)) return false;
+    if (node->left && higher(node->left, node)) return false;
+    if (node->right && higher(node->right, node)) return false;
+    return verify_treap(node->left, min, node->key) && verify_treap(node->right, node->key, max);
+}
+
+static void collect(TreapNode *node, int *out, int *pos) {
+    if (node == NULL) return;
+    collect(node->left, out, pos);
+    out[(*pos)++] = node->key;
+    collect(node->right, out, pos);
+}
+
+/**
+ * Conferir o conteúdo do treap com um vetor ordenado esperado
+ */
+static bool same_keys(TreapNode *root, const int *expected, int n) {
+    if (get_size(root) != n || !verify_treap(root, -2147483649L, 2147483648L)) return false;
+    int *keys = (int *)malloc((n + 1) * sizeof(int));
+    int pos = 0;
+    collect(root, keys, &pos);
+    bool ok = pos == n && memcmp(keys, expected, n * sizeof(int)) == 0;
+    free(keys);
+    return ok;
+}
+
+// ==================== TESTES ====================
+
+static uint64_t xorshift64(uint64_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return *s;
+}
+
+static int cmp_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Gerar n chaves distintas e ordenadas em [0, range)
+ */
+static int random_sorted_keys(int *out, int n, int range, uint64_t *s) {
+    for (int i = 0; i < n; i++) out[i] = (int)(xorshift64(s) % (uint64_t)range);
+    qsort(out, n, sizeof(int), cmp_int);
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        if (m == 0 || out[i] != out[m - 1]) out[m++] = out[i];
+    }
+    return m;
+}
+
+/**
+ * Resultado esperado por intercalação de vetores ordenados
+ */
+static int merge_expected(SetOp op, const int *a, int na, const int *b, int nb, int *out) {
+    int i = 0, j = 0, k = 0;
+    while (i < na || j < nb) {
+        if (j == nb || (i < na && a[i] < b[j])) {
+            if (op != OP_INTERSECTION) out[k++] = a[i];
+            i++;
+        } else if (i == na || b[j] < a[i]) {
+            if (op == OP_UNION) out[k++] = b[j];
+            j++;
+        } else {
+            if (op != OP_DIFFERENCE) out[k++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    return k;
+}
+
+void testar_basico() {
+    printf("=== TESTE BÁSICO ===\n\n");
+
+    int a[] = {1, 3, 5, 7, 9, 11};
+    int b[] = {3, 4, 5, 6, 11, 12};
+    const char *names[] = {"União", "Interseção", "Diferença A\\B"};
+    bool ok = true;
+
+    for (int op = OP_UNION; op <= OP_DIFFERENCE; op++) {
+        TreapNode *ta = treap_build_sorted(a, 6);
+        TreapNode *tb = treap_build_sorted(b, 6);
+        TreapNode *r = set_op((SetOp)op, ta, tb, 0, NULL);
+        int keys[12], pos = 0;
+        collect(r, keys, &pos);
+        printf("%-14s:", names[op]);
+        for (int i = 0; i < pos; i++) printf(" %d", keys[i]);
+        printf("\n");
+
+        int expected[12];
+        int n = merge_expected((SetOp)op, a, 6, b, 6, expected);
+        ok = ok && same_keys(r, expected, n);
+        treap_free(r);
+    }
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+void testar_aleatorio() {
+    printf("=== TESTE ALEATÓRIO (sequencial e paralelo) ===\n\n");
+
+    uint64_t s = 12345;
+    int sizes[][2] = { {0, 1000}, {1, 100000}, {1000, 100000}, {50000, 50000}, {100000, 300} };
+    int *a = (int *)malloc(200000 * sizeof(int));
+    int *b = (int *)malloc(200000 * sizeof(int));
+    int *expected = (int *)malloc(400000 * sizeof(int));
+    int casos = 0;
+    bool ok = true;
+
+    for (int c = 0; c < 5; c++) {
+        // Intervalo pequeno o bastante para haver muitas chaves em comum
+        int range = 2 * (sizes[c][0] + sizes[c][1]) + 10;
+        int na = random_sorted_keys(a, sizes[c][0], range, &s);
+        int nb = random_sorted_keys(b, sizes[c][1], range, &s);
+        for (int op = OP_UNION; op <= OP_DIFFERENCE; op++) {
+            int n = merge_expected((SetOp)op, a, na, b, nb, expected);
+            for (int threads = 1; threads <= 4; threads *= 4) {
+                DiscardList discarded;
+                discard_list_init(&discarded);
+                TreapNode *r = set_op((SetOp)op, treap_build_sorted(a, na),
+                                      treap_build_sorted(b, nb), fork_depth(threads), &discarded);
+                // Todo nó de entrada está no resultado ou na lista (a união
+                // libera as duplicatas na hora)
+                long total = op == OP_UNION ? n : na + nb;
+                if (!same_keys(r, expected, n) || get_size(r) + discarded.nodes != total) {
+                    printf("  Falha: caso %d, operação %d, %d threads\n", c, op, threads);
+                    ok = false;
+                }
+                treap_free(r);
+                discard_list_free(&discarded);
+                casos++;
+            }
+        }
+    }
+
+    // Formato canônico: o mesmo conjunto dá a mesma árvore por qualquer caminho
+    int na = random_sorted_keys(a, 20000, 60000, &s);
+    int nb = random_sorted_keys(b, 20000, 60000, &s);
+    int n = merge_expected(OP_UNION, a, na, b, nb, expected);
+    TreapNode *u = treap_union(treap_build_sorted(a, na), treap_build_sorted(b, nb));
+    TreapNode *direct = treap_build_sorted(expected, n);
+    bool canonical = u->key == direct->key && u->left && direct->left &&
+                     u->left->key == direct->left->key && get_size(u->left) == get_size(direct->left);
+    treap_free(u);
+    treap_free(direct);
+
+    printf("Casos conferidos contra intercalação de vetores: %d\n", casos);
+    printf("União tem a mesma forma do treap construído direto: %s\n", canonical ? "sim" : "não");
+    printf("Verificação: %s\n\n", ok && canonical ? "OK" : "FALHA");
+
+    free(a);
+    free(b);
+    free(expected);
+}
+
+// ==================== BENCHMARK ====================
+
+// "união 4T" roda em várias threads, e clock() somaria o tempo de CPU delas
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void benchmark(int n) {
+    printf("=== BENCHMARK: |A| = %d, |B| = m (tempos em ms) ===\n\n", n);
+
+    uint64_t s = 987654321;
+    int range = 4 * n;
+    int *a = (int *)malloc(n * sizeof(int));
+    int *b = (int *)malloc(n * sizeof(int));
+    int na = random_sorted_keys(a, n, range, &s);
+
+    printf("%-9s | %12s %10s %10s | %10s %10s %10s\n",
+           "m", "uma a uma", "união", "união 4T", "interseção", "liberar", "diferença");
+
+    for (int m = 1000; m <= n; m *= 10) {
+        int nb = random_sorted_keys(b, m, range, &s);
+        double t;
+
+        // Base: inserir as m chaves de B uma a uma em A
+        TreapNode *ta = treap_build_sorted(a, na);
+        t = now_seconds();
+        for (int i = 0; i < nb; i++) ta = treap_insert(ta, b[(i * 7919L) % nb]);
+        double t_one = now_seconds() - t;
+        int expected_size = get_size(ta);
+        treap_free(ta);
+
+        TreapNode *x = treap_build_sorted(a, na), *y = treap_build_sorted(b, nb);
+        t = now_seconds();
+        TreapNode *r = treap_union(x, y);
+        double t_union = now_seconds() - t;
+        bool ok = get_size(r) == expected_size;
+        treap_free(r);
+
+        x = treap_build_sorted(a, na); y = treap_build_sorted(b, nb);
+        t = now_seconds();
+        r = treap_union_parallel(x, y, 4);
+        double t_par = now_seconds() - t;
+        ok = ok && get_size(r) == expected_size;
+        treap_free(r);
+
+        // Os nós descartados são liberados fora do tempo da operação
+        DiscardList discarded;
+        discard_list_init(&discarded);
+        x = treap_build_sorted(a, na); y = treap_build_sorted(b, nb);
+        t = now_seconds();
+        r = treap_intersection(x, y, &discarded);
+        double t_inter = now_seconds() - t;
+        int inter_size = get_size(r);
+        treap_free(r);
+        t = now_seconds();
+        discard_list_free(&discarded);
+        double t_free = now_seconds() - t;
+
+        x = treap_build_sorted(a, na); y = treap_build_sorted(b, nb);
+        t = now_seconds();
+        r = treap_difference(x, y, &discarded);
+        double t_diff = now_seconds() - t;
+        ok = ok && get_size(r) == na - inter_size && expected_size == na + nb - inter_size;
+        treap_free(r);
+        discard_list_free(&discarded);
+
+        printf("%-9d | %12.1f %10.1f %10.1f | %10.1f %10.1f %10.1f %s\n", m, t_one * 1000, t_union * 1000,
+               t_par * 1000, t_inter * 1000, t_free * 1000, t_diff * 1000, ok ? "" : "(FALHA)");
+    }
+    printf("\n");
+
+    free(a);
+    free(b);
+}
+
+// ==================== FUNÇÃO PRINCIPAL ====================
+
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║          TREAP: OPERAÇÕES DE CONJUNTO EM LOTE            ║\n");
+    printf("║   União, interseção e diferença via split/join           ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    if (n < 1000) n = 1000;
+
+    testar_basico();
+    testar_aleatorio();
+    benchmark(n);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades das Operações de Conjunto:\n");
+    printf("- União/Interseção/Diferença: O(m log(n/m + 1)) esperado\n");
+    printf("- Recursões independentes: fork-join em paralelo\n");
+    printf("- Prioridade = hash(key): formato canônico\n");
+    printf("- Entradas consumidas; nós descartados liberados à parte\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,725 @@
+/**
+ * ============================================================================
+ * TREAP PERSISTENTE - CÓPIA DE CAMINHO E SNAPSHOTS O(1)
+ * ============================================================================
+ *
+ * Em treap.c, treap_split/treap_merge alteram os nós no lugar: um leitor
+ * que percorre a árvore enquanto outra thread escreve vê um estado
+ * inconsistente, e a única saída é travar a árvore inteira durante a
+ * leitura (um relatório longo bloqueia todos os escritores).
+ *
+ * Nesta versão os nós publicados são IMUTÁVEIS:
+ *
+ * CÓPIA DE CAMINHO (path copying):
+ * - Inserção e remoção copiam apenas os nós do caminho raiz -> folha
+ *   (O(log n) esperado); o resto da árvore é compartilhado entre a versão
+ *   antiga e a nova
+ *
+ *   versão 1:      8               versão 2 (insere 5):   8'
+ *                /   \                                  /   \
+ *               3     10                               3'    10  <- compartilhado
+ *              / \                                    / \
+ *             1   6                                  1   6'
+ *                                                       /
+ *                                                      5
+ *
+ * SNAPSHOT O(1):
+ * - Um snapshot é só a raiz de uma versão + uma referência a ela. O leitor
+ *   consulta essa versão pelo tempo que quiser; os escritores continuam
+ *   publicando versões novas sem esperar
+ *
+ * CONTAGEM DE REFERÊNCIAS (atômica):
+ * - refcount de um nó = número de pais + raízes que apontam para ele
+ * - Ao publicar uma versão, a raiz anterior perde a referência da árvore;
+ *   quando o último snapshot que a usa é liberado, os nós exclusivos dela
+ *   são liberados em cascata, e os compartilhados só perdem 1
+ *
+ * PUBLICAÇÃO:
+ * - Escritores são serializados por um mutex; a raiz publicada é trocada
+ *   sob um segundo mutex que só protege "ler raiz + incrementar refcount"
+ *   (sem ele, a raiz poderia ser liberada entre a leitura e o incremento)
+ *
+ * Compilação: gcc -O2 -std=c11 -pthread treap_persistente.c
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+// ==================== ESTRUTURA DO TREAP PERSISTENTE ====================
+
+typedef struct PTreapNode {
+    int key;
+    uint32_t priority;
+    int size;                       // Tamanho da subárvore (rank/k-ésimo)
+    _Atomic int refcount;
+    struct PTreapNode *left;        // Imutáveis depois de publicados
+    struct PTreapNode *right;
+} PTreapNode;
+
+typedef struct {
+    PTreapNode *root;               // Versão publicada
+    long version;
+    pthread_mutex_t publish_lock;   // Protege root/version
+    pthread_mutex_t writer_lock;    // Serializa escritores
+    uint64_t rng;                   // Prioridades (só usado sob writer_lock)
+} PersistentTreap;
+
+typedef struct {
+    PTreapNode *root;
+    long version;
+} Snapshot;
+
+static _Atomic long live_nodes = 0;     // Nós alocados e ainda não liberados
+
+// ==================== CONTAGEM DE REFERÊNCIAS ====================
+
+static inline int get_size(PTreapNode *node) {
+    return node ? node->size : 0;
+}
+
+/**
+ * Nova referência a um nó (NULL é aceito)
+ */
+static inline PTreapNode* node_ref(PTreapNode *node) {
+    if (node) {
+        atomic_fetch_add_explicit(&node->refcount, 1, memory_order_relaxed);
+    }
+    return node;
+}
+
+/**
+ * Solta uma referência; o último a soltar libera o nó e solta os filhos
+ */
+static void node_unref(PTreapNode *node) {
+    while (node != NULL) {
+        if (atomic_fetch_sub_explicit(&node->refcount, 1, memory_order_release) != 1) {
+            return;
+        }
+        atomic_thread_fence(memory_order_acquire);
+        PTreapNode *left = node->left, *right = node->right;
+        free(node);
+        atomic_fetch_sub_explicit(&live_nodes, 1, memory_order_relaxed);
+        node_unref(left);
+        node = right;               // Iterativo à direita: menos recursão
+    }
+}
+
+/**
+ * Novo nó com (key, priority); as referências a left/right são ASSUMIDAS
+ */
+static PTreapNode* make_node(int key, uint32_t priority, PTreapNode *left, PTreapNode *right) {
+    PTreapNode *node = (PTreapNode *)malloc(sizeof(PTreapNode));
+    if (node == NULL) {
+        fprintf(stderr, "Erro ao alocar nó\n");
+        exit(1);
+    }
+    node->key = key;
+    node->priority = priority;
+    node->left = left;
+    node->right = right;
+    node->size = 1 + get_size(left) + get_size(right);
+    atomic_init(&node->refcount, 1);
+    atomic_fetch_add_explicit(&live_nodes, 1, memory_order_relaxed);
+    return node;
+}
+
+/**
+ * Cópia de 'node' com novos filhos (referências assumidas)
+ */
+static inline PTreapNode* copy_with(PTreapNode *node, PTreapNode *left, PTreapNode *right) {
+    return make_node(node->key, node->priority, left, right);
+}
+
+// ==================== SPLIT E MERGE FUNCIONAIS ====================
+//
+// Convenção: os argumentos são EMPRESTADOS (não mudam de dono) e o
+// resultado é uma referência NOVA. Nenhum nó existente é alterado.
+
+/**
+ * Split funcional: left = chaves < key, right = chaves >= key
+ */
+static void pt_split(PTreapNode *node, int key, PTreapNode **left, PTreapNode **right) {
+    if (node == NULL) {
+        *left = *right = NULL;
+        return;
+    }
+    if (node->key < key) {
+        PTreapNode *a;
+        pt_split(node->right, key, &a, right);
+        *left = copy_with(node, node_ref(node->left), a);
+    } else {
+        PTreapNode *b;
+        pt_split(node->left, key, left, &b);
+        *right = copy_with(node, b, node_ref(node->right));
+    }
+}
+
+/**
+ * Merge funcional (todas as chaves de left < todas de right)
+ */
+static PTreapNode* pt_merge(PTreapNode *left, PTreapNode *right) {
+    if (left == NULL) return node_ref(right);
+    if (right == NULL) return node_ref(left);
+    if (left->priority > right->priority) {
+        return copy_with(left, node_ref(left->left), pt_merge(left->right, right));
+    }
+    return copy_with(right, pt_merge(left, right->left), node_ref(right->right));
+}
+
+static PTreapNode* pt_insert(PTreapNode *node, int key, uint32_t priority) {
+    if (node == NULL) {
+        return make_node(key, priority, NULL, NULL);
+    }
+    if (priority > node->priority) {
+        // O novo nó fica acima deste: divide a subárvore
+        PTreapNode *l, *r;
+        pt_split(node, key, &l, &r);
+        return make_node(key, priority, l, r);
+    }
+    if (key < node->key) {
+        return copy_with(node, pt_insert(node->left, key, priority), node_ref(node->right));
+    }
+    return copy_with(node, node_ref(node->left), pt_insert(node->right, key, priority));
+}
+
+static PTreapNode* pt_delete(PTreapNode *node, int key) {
+    if (node->key == key) {
+        return pt_merge(node->left, node->right);
+    }
+    if (key < node->key) {
+        return copy_with(node, pt_delete(node->left, key), node_ref(node->right));
+    }
+    return copy_with(node, node_ref(node->left), pt_delete(node->right, key));
+}
+
+// ==================== CONSULTAS (QUALQUER VERSÃO) ====================
+
+bool ptreap_contains(PTreapNode *node, int key) {
+    while (node != NULL && node->key != key) {
+        node = key < node->key ? node->left : node->right;
+    }
+    return node != NULL;
+}
+
+/**
+ * Contar elementos menores que key
+ */
+int ptreap_count_less(PTreapNode *node, int key) {
+    int count = 0;
+    while (node != NULL) {
+        if (key <= node->key) {
+            node = node->left;
+        } else {
+            count += 1 + get_size(node->left);
+            node = node->right;
+        }
+    }
+    return count;
+}
+
+/**
+ * k-ésimo menor elemento (1-indexed), -1 se não existe
+ */
+int ptreap_kth_element(PTreapNode *node, int k) {
+    while (node != NULL) {
+        int left_size = get_size(node->left);
+        if (k <= left_size) {
+            node = node->left;
+        } else if (k == left_size + 1) {
+            return node->key;
+        } else {
+            k -= left_size + 1;
+            node = node->right;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Soma das chaves em [lo, hi] (percorre só as subárvores relevantes)
+ */
+long long ptreap_range_sum(PTreapNode *node, int lo, int hi) {
+    if (node == NULL) return 0;
+    long long sum = 0;
+    if (lo < node->key) sum += ptreap_range_sum(node->left, lo, hi);
+    if (node->key >= lo && node->key <= hi) sum += node->key;
+    if (hi > node->key) sum += ptreap_range_sum(node->right, lo, hi);
+    return sum;
+}
+
+// ==================== VERSÕES E SNAPSHOTS ====================
+
+PersistentTreap* ptreap_create(uint64_t seed) {
+    PersistentTreap *t = (PersistentTreap *)malloc(sizeof(PersistentTreap));
+    t->root = NULL;
+    t->version = 0;
+    t->rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    pthread_mutex_init(&t->publish_lock, NULL);
+    pthread_mutex_init(&t->writer_lock, NULL);
+    return t;
+}
+
+static uint32_t next_priority(PersistentTreap *t) {
+    t->rng ^= t->rng << 13;
+    t->rng ^= t->rng >> 7;
+    t->rng ^= t->rng << 17;
+    return (uint32_t)(t->rng >> 32);
+}
+
+/**
+ * Troca a raiz publicada; a referência da árvore à raiz antiga é solta
+ * (os nós só são liberados se nenhum snapshot os usa)
+ */
+static void publish(PersistentTreap *t, PTreapNode *new_root) {
+    pthread_mutex_lock(&t->publish_lock);
+    PTreapNode *old = t->root;
+    t->root = new_root;
+    t->version++;
+    pthread_mutex_unlock(&t->publish_lock);
+    node_unref(old);
+}
+
+/**
+ * Inserir chave: cria a versão seguinte. Retorna false se já existia.
+ */
+bool ptreap_insert(PersistentTreap *t, int key) {
+    pthread_mutex_lock(&t->writer_lock);
+    // Só escritores trocam a raiz, e eles estão serializados: ler sem publish_lock é seguro
+    bool inserted = !ptreap_contains(t->root, key);
+    if (inserted) {
+        publish(t, pt_insert(t->root, key, next_priority(t)));
+    }
+    pthread_mutex_unlock(&t->writer_lock);
+    return inserted;
+}
+
+/**
+ * Remover chave: cria a versão seguinte. Retorna false se não existia.
+ */
+bool ptreap_delete(PersistentTreap *t, int key) {
+    pthread_mutex_lock(&t->writer_lock);
+    bool found = ptreap_contains(t->root, key);
+    if (found) {
+        publish(t, pt_delete(t->root, key));
+    }
+    pthread_mutex_unlock(&t->writer_lock);
+    return found;
+}
+
+/**
+ * Snapshot O(1): referência à versão publicada atual
+ */
+Snapshot ptreap_snapshot(PersistentTreap *t) {
+    pthread_mutex_lock(&t->publish_lock);
+    Snapshot s = { node_ref(t->root), t->version };
+    pthread_mutex_unlock(&t->publish_lock);
+    return s;
+}
+
+void ptreap_release(Snapshot *s) {
+    node_unref(s->root);
+    s->root = NULL;
+}
+
+void ptreap_destroy(PersistentTreap *t) {
+    node_unref(t->root);
+    pthread_mutex_destroy(&t->publish_lock);
+    pthread_mutex_destroy(&t->writer_lock);
+    free(t);
+}
+
+// ==================== VERIFICAÇÃO ====================
+
+bool verify_treap(PTreapNode *node, long lo, long hi) {
+    if (node == NULL) return true;
+    if (node->key < lo || node->key > hi) return false;
+    if (node->size != 1 + get_size(node->left) + get_size(node->right)) return false;
+    if (node->left && node->left->priority > node->priority) return false;
+    if (node->right && node->right->priority > node->priority) return false;
+    return verify_treap(node->left, lo, (long)node->key - 1) &&
+           verify_treap(node->right, (long)node->key + 1, hi);
+}
+
+// ==================== TESTES ====================
+
+void testar_versoes() {
+    printf("=== TESTE DE VERSÕES ===\n\n");
+
+    PersistentTreap *t = ptreap_create(1);
+    int keys[] = {50, 30, 70, 20, 40, 60, 80};
+    for (int i = 0; i < 7; i++) ptreap_insert(t, keys[i]);
+
+    Snapshot v1 = ptreap_snapshot(t);
+    long before = atomic_load(&live_nodes);
+    ptreap_insert(t, 45);
+    long copied = atomic_load(&live_nodes) - before;
+    ptreap_delete(t, 20);
+    Snapshot v3 = ptreap_snapshot(t);
+
+    printf("Versão %ld: contém 45? %s | contém 20? %s | tamanho %d\n", v1.version,
+           ptreap_contains(v1.root, 45) ? "sim" : "não", ptreap_contains(v1.root, 20) ? "sim" : "não",
+           get_size(v1.root));
+    printf("Versão %ld: contém 45? %s | contém 20? %s | tamanho %d\n", v3.version,
+           ptreap_contains(v3.root, 45) ? "sim" : "não", ptreap_contains(v3.root, 20) ? "sim" : "não",
+           get_size(v3.root));
+    printf("Nós copiados ao inserir 45: %ld (o caminho até a nova folha)\n", copied);
+
+    bool ok = !ptreap_contains(v1.root, 45) && ptreap_contains(v1.root, 20) &&
+              ptreap_contains(v3.root, 45) && !ptreap_contains(v3.root, 20) &&
+              verify_treap(v1.root, -2147483648L, 2147483647L) &&
+              verify_treap(v3.root, -2147483648L, 2147483647L);
+
+    ptreap_release(&v1);
+    ptreap_release(&v3);
+    ptreap_destroy(t);
+    ok = ok && atomic_load(&live_nodes) == 0;
+    printf("Todos os nós liberados após soltar versões: %s\n", atomic_load(&live_nodes) == 0 ? "sim" : "não");
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// Janela deslizante: a versão v contém exatamente as chaves [v' - W, v'),
+// onde v' é o número de inserções já feitas. Um snapshot inconsistente
+// (meio de uma atualização) quebraria essa invariante.
+#define WINDOW 5000
+#define WRITER_OPS 200000
+
+typedef struct {
+    PersistentTreap *t;
+    _Atomic bool *stop;
+    long snapshots;
+    long errors;
+} ReaderArgs;
+
+static void* window_writer(void *arg) {
+    ReaderArgs *a = (ReaderArgs *)arg;
+    for (int i = 0; i < WRITER_OPS; i++) {
+        ptreap_insert(a->t, i);
+        if (i >= WINDOW) ptreap_delete(a->t, i - WINDOW);
+    }
+    atomic_store(a->stop, true);
+    return NULL;
+}
+
+static void* window_reader(void *arg) {
+    ReaderArgs *a = (ReaderArgs *)arg;
+    while (!atomic_load(a->stop)) {
+        Snapshot s = ptreap_snapshot(a->t);
+        int n = get_size(s.root);
+        int first = ptreap_kth_element(s.root, 1);
+        int last = ptreap_kth_element(s.root, n);
+        // Chaves consecutivas: [first, last] com n elementos
+        bool ok = n == 0 || (last - first + 1 == n && n <= WINDOW + 1 &&
+                             ptreap_count_less(s.root, last) == n - 1 &&
+                             ptreap_range_sum(s.root, first, last) == (long long)(first + last) * n / 2);
+        if (!ok) a->errors++;
+        a->snapshots++;
+        ptreap_release(&s);
+    }
+    return NULL;
+}
+
+void testar_concorrencia() {
+    printf("=== TESTE CONCORRENTE (1 escritor, 3 leitores) ===\n\n");
+
+    PersistentTreap *t = ptreap_create(7);
+    _Atomic bool stop;
+    atomic_init(&stop, false);
+    pthread_t writer, readers[3];
+    ReaderArgs wargs = { t, &stop, 0, 0 };
+    ReaderArgs rargs[3];
+
+    pthread_create(&writer, NULL, window_writer, &wargs);
+    for (int i = 0; i < 3; i++) {
+        rargs[i] = (ReaderArgs){ t, &stop, 0, 0 };
+        pthread_create(&readers[i], NULL, window_reader, &rargs[i]);
+    }
+    pthread_join(writer, NULL);
+    long snapshots = 0, errors = 0;
+    for (int i = 0; i < 3; i++) {
+        pthread_join(readers[i], NULL);
+        snapshots += rargs[i].snapshots;
+        errors += rargs[i].errors;
+    }
+
+    Snapshot final = ptreap_snapshot(t);
+    bool ok = errors == 0 && get_size(final.root) == WINDOW &&
+              verify_treap(final.root, -2147483648L, 2147483647L);
+    printf("Versões publicadas: %ld | snapshots verificados: %ld | inconsistentes: %ld\n",
+           final.version, snapshots, errors);
+    ptreap_release(&final);
+    ptreap_destroy(t);
+    printf("Nós vivos após destruir: %ld\n", atomic_load(&live_nodes));
+    ok = ok && atomic_load(&live_nodes) == 0;
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// ==================== BENCHMARK ====================
+
+// Treap efêmero de treap.c (split/merge no lugar) atrás de um rwlock
+typedef struct TreapNode {
+    int key;
+    uint32_t priority;
+    int size;
+    struct TreapNode *left, *right;
+} TreapNode;
+
+static int e_size(TreapNode *n) { return n ? n->size : 0; }
+static void e_update(TreapNode *n) { n->size = 1 + e_size(n->left) + e_size(n->right); }
+
+static void e_split(TreapNode *node, int key, TreapNode **left, TreapNode **right) {
+    if (node == NULL) { *left = *right = NULL; return; }
+    if (node->key < key) {
+        *left = node;
+        e_split(node->right, key, &node->right, right);
+        e_update(node);
+    } else {
+        *right = node;
+        e_split(node->left, key, left, &node->left);
+        e_update(node);
+    }
+}
+
+static TreapNode* e_merge(TreapNode *left, TreapNode *right) {
+    if (left == NULL) return right;
+    if (right == NULL) return left;
+    if (left->priority > right->priority) {
+        left->right = e_merge(left->right, right);
+        e_update(left);
+        return left;
+    }
+    right->left = e_merge(left, right->left);
+    e_update(right);
+    return right;
+}
+
+static bool e_contains(TreapNode *node, int key) {
+    while (node != NULL && node->key != key) node = key < node->key ? node->left : node->right;
+    return node != NULL;
+}
+
+static long long e_range_sum(TreapNode *node, int lo, int hi) {
+    if (node == NULL) return 0;
+    long long sum = 0;
+    if (lo < node->key) sum += e_range_sum(node->left, lo, hi);
+    if (node->key >= lo && node->key <= hi) sum += node->key;
+    if (hi > node->key) sum += e_range_sum(node->right, lo, hi);
+    return sum;
+}
+
+static void e_free(TreapNode *n) {
+    if (n) { e_free(n->left); e_free(n->right); free(n); }
+}
+
+typedef struct {
+    TreapNode *root;
+    pthread_rwlock_t lock;
+    uint64_t rng;
+} LockedTreap;
+
+static void locked_insert(LockedTreap *t, int key) {
+    pthread_rwlock_wrlock(&t->lock);
+    if (!e_contains(t->root, key)) {
+        TreapNode *n = (TreapNode *)malloc(sizeof(TreapNode));
+        t->rng ^= t->rng << 13; t->rng ^= t->rng >> 7; t->rng ^= t->rng << 17;
+        n->key = key; n->priority = (uint32_t)(t->rng >> 32); n->size = 1;
+        n->left = n->right = NULL;
+        TreapNode *l, *r;
+        e_split(t->root, key, &l, &r);
+        t->root = e_merge(e_merge(l, n), r);
+    }
+    pthread_rwlock_unlock(&t->lock);
+}
+
+static void locked_delete(LockedTreap *t, int key) {
+    pthread_rwlock_wrlock(&t->lock);
+    TreapNode *l, *m, *r;
+    e_split(t->root, key, &l, &m);
+    e_split(m, key + 1, &m, &r);
+    e_free(m);
+    t->root = e_merge(l, r);
+    pthread_rwlock_unlock(&t->lock);
+}
+
+static uint64_t xorshift64(uint64_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return *s;
+}
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+#define KEY_SPACE (1 << 30)
+
+typedef struct {
+    void *tree;
+    bool persistent;
+    int *preload;
+    int preload_n;
+    int range_width;            // Consulta analítica: soma em um intervalo
+    uint64_t seed;
+    _Atomic bool *stop;
+    long ops;
+} BenchArgs;
+
+static void* bench_writer(void *arg) {
+    BenchArgs *a = (BenchArgs *)arg;
+    uint64_t s = a->seed;
+    long ops = 0;
+    int j = 0;
+    while (!atomic_load_explicit(a->stop, memory_order_relaxed)) {
+        int key = (int)(xorshift64(&s) % KEY_SPACE);
+        int old = a->preload[j++ % a->preload_n];
+        if (a->persistent) {
+            ptreap_insert((PersistentTreap *)a->tree, key);
+            ptreap_delete((PersistentTreap *)a->tree, old);
+        } else {
+            locked_insert((LockedTreap *)a->tree, key);
+            locked_delete((LockedTreap *)a->tree, old);
+        }
+        ops += 2;
+    }
+    a->ops = ops;
+    return NULL;
+}
+
+static void* bench_reader(void *arg) {
+    BenchArgs *a = (BenchArgs *)arg;
+    uint64_t s = a->seed;
+    long ops = 0;
+    volatile long long sink = 0;
+    while (!atomic_load_explicit(a->stop, memory_order_relaxed)) {
+        int lo = (int)(xorshift64(&s) % KEY_SPACE);
+        int hi = lo + a->range_width;
+        if (a->persistent) {
+            Snapshot snap = ptreap_snapshot((PersistentTreap *)a->tree);
+            sink += ptreap_range_sum(snap.root, lo, hi);
+            for (int i = 0; i < 100; i++) {
+                sink += ptreap_contains(snap.root, (int)(xorshift64(&s) % KEY_SPACE));
+            }
+            ptreap_release(&snap);
+        } else {
+            LockedTreap *t = (LockedTreap *)a->tree;
+            pthread_rwlock_rdlock(&t->lock);
+            sink += e_range_sum(t->root, lo, hi);
+            for (int i = 0; i < 100; i++) {
+                sink += e_contains(t->root, (int)(xorshift64(&s) % KEY_SPACE));
+            }
+            pthread_rwlock_unlock(&t->lock);
+        }
+        ops++;
+    }
+    a->ops = ops;
+    return NULL;
+}
+
+static void run_bench(void *tree, bool persistent, int *preload, int n, int readers,
+                      double seconds, double *writes, double *queries) {
+    pthread_t threads[9];
+    BenchArgs args[9];
+    _Atomic bool stop;
+    atomic_init(&stop, false);
+    // Intervalo com ~1% das chaves: uma consulta "analítica" longa
+    int width = (int)((long)KEY_SPACE / 100);
+
+    for (int i = 0; i <= readers; i++) {
+        args[i] = (BenchArgs){ tree, persistent, preload, n, width,
+                               0x2545F4914F6CDD1Dull * (uint64_t)(i + 1), &stop, 0 };
+        pthread_create(&threads[i], NULL, i == 0 ? bench_writer : bench_reader, &args[i]);
+    }
+    struct timespec ts = { (time_t)seconds, (long)((seconds - (long)seconds) * 1e9) };
+    double t = now_seconds();
+    nanosleep(&ts, NULL);
+    atomic_store(&stop, true);
+    for (int i = 0; i <= readers; i++) pthread_join(threads[i], NULL);
+    double elapsed = now_seconds() - t;
+
+    *writes = args[0].ops / elapsed;
+    long q = 0;
+    for (int i = 1; i <= readers; i++) q += args[i].ops;
+    *queries = q / elapsed;
+}
+
+void benchmark(int n, double seconds) {
+    printf("=== BENCHMARK: %d chaves, 1 escritor + leitores, %.1f s por medição ===\n\n", n, seconds);
+
+    int *preload = (int *)malloc(n * sizeof(int));
+    uint64_t s = 88172645463325252ull;
+    for (int i = 0; i < n; i++) preload[i] = (int)(xorshift64(&s) % KEY_SPACE);
+
+    // Custo do snapshot versus copiar a árvore
+    PersistentTreap *pt = ptreap_create(3);
+    for (int i = 0; i < n; i++) ptreap_insert(pt, preload[i]);
+    double t = now_seconds();
+    int reps = 1000000;
+    for (int i = 0; i < reps; i++) {
+        Snapshot snap = ptreap_snapshot(pt);
+        ptreap_release(&snap);
+    }
+    double snap_ns = (now_seconds() - t) * 1e9 / reps;
+    printf("Snapshot + liberação: %.0f ns (independe do tamanho; copiar %d nós seria O(n))\n\n",
+           snap_ns, n);
+
+    LockedTreap lt = { NULL, PTHREAD_RWLOCK_INITIALIZER, 11 };
+    for (int i = 0; i < n; i++) locked_insert(&lt, preload[i]);
+
+    printf("Cada consulta: soma de ~1%% das chaves + 100 buscas pontuais\n");
+    printf("%-8s | %14s %14s | %14s %14s\n", "", "rwlock global", "", "persistente", "");
+    printf("%-8s | %14s %14s | %14s %14s\n", "Leitores", "escritas/s", "consultas/s", "escritas/s", "consultas/s");
+    int reader_counts[] = { 0, 1, 2, 4, 8 };
+    for (int r = 0; r < 5; r++) {
+        double lw, lq, pw, pq;
+        run_bench(&lt, false, preload, n, reader_counts[r], seconds, &lw, &lq);
+        run_bench(pt, true, preload, n, reader_counts[r], seconds, &pw, &pq);
+        printf("%-8d | %14.0f %14.0f | %14.0f %14.0f\n", reader_counts[r], lw, lq, pw, pq);
+    }
+
+    Snapshot final = ptreap_snapshot(pt);
+    printf("\nÁrvore persistente válida após o benchmark: %s\n\n",
+           verify_treap(final.root, -2147483648L, 2147483647L) ? "OK" : "FALHA");
+    ptreap_release(&final);
+    ptreap_destroy(pt);
+    e_free(lt.root);
+    free(preload);
+}
+
+// ==================== FUNÇÃO PRINCIPAL ====================
+
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║                  TREAP PERSISTENTE                       ║\n");
+    printf("║   Cópia de caminho, snapshots O(1) e contagem de refs    ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    double seconds = (argc > 2) ? atof(argv[2]) : 1.0;
+    if (n < 1000) n = 1000;
+
+    testar_versoes();
+    testar_concorrencia();
+    benchmark(n, seconds);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades do Treap Persistente:\n");
+    printf("- Atualização: O(log n) nós novos (só o caminho é copiado)\n");
+    printf("- Snapshot: O(1), uma referência à raiz da versão\n");
+    printf("- Leitores nunca bloqueiam escritores (e vice-versa)\n");
+    printf("- Versões antigas liberadas por contagem de referências\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,652 @@
+/**
+ * ============================================================================
+ * SPLAY TREE TOP-DOWN - SEM PONTEIRO PARA O PAI E SPLAY CONDICIONAL
+ * ============================================================================
+ *
+ * O splay() de splay_tree.c é bottom-up: desce até o nó e depois sobe
+ * rotacionando, o que exige ponteiro 'parent' em cada nó e ~6 escritas de
+ * ponteiro por rotação (filho do avô, pais de três nós, dois filhos).
+ *
+ * SPLAY TOP-DOWN (Sleator & Tarjan, 1985):
+ * - Uma única descida; os nós deixados para trás são pendurados em duas
+ *   árvores auxiliares L (menores que a chave) e R (maiores)
+ * - Zig-zig vira uma rotação + um "link"; zig e zig-zag viram só links
+ * - No fim, L e R viram as subárvores do nó encontrado
+ *
+ *      descida:   L (< key)       t (atual)        R (> key)
+ *                 ... -> l        /    \           r <- ...
+ *                                A      B
+ *      fim:           t.left = L,  t.right = R
+ *
+ * - Nós sem 'parent': 24 bytes em vez de 32 (3 ponteiros/chave)
+ *
+ * SPLAY CONDICIONAL (modo cache por frequência de acesso):
+ * - Em leituras, o splay é o que gera escritas (e invalida linhas de cache
+ *   compartilhadas). Com acesso enviesado, os itens quentes já estão perto
+ *   da raiz depois de poucos splays
+ * - every_k: só faz splay a cada k-ésimo acesso
+ * - depth_threshold: só faz splay se o nó estava a mais de d níveis da raiz
+ * - Os demais acessos são buscas de BST comuns, sem nenhuma escrita
+ * - Inserção e remoção sempre usam o splay (já modificam a árvore)
+ *
+ * Pré-requisito: splay_tree.c
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+// ==================== ESTRUTURA DA SPLAY TREE ====================
+
+typedef struct SplayNode {
+    int key;
+    struct SplayNode *left;
+    struct SplayNode *right;
+} SplayNode;
+
+typedef struct {
+    int every_k;                // Splay a cada k acessos (1 = sempre)
+    int depth_threshold;        // Splay só se profundidade > d (0 = sempre)
+} SplayConfig;
+
+typedef struct {
+    SplayNode *root;
+    int size;
+    SplayConfig config;
+    unsigned long accesses;
+    // Estatísticas
+    unsigned long splays;
+    unsigned long visited;      // Nós visitados em buscas e splays
+    unsigned long writes;       // Escritas de ponteiro
+} SplayTree;
+
+// ==================== FUNÇÕES AUXILIARES ====================
+
+SplayNode* create_node(int key) {
+    SplayNode *node = (SplayNode *)malloc(sizeof(SplayNode));
+    if (node == NULL) {
+        fprintf(stderr, "Erro ao alocar nó\n");
+        exit(1);
+    }
+    node->key = key;
+    node->left = node->right = NULL;
+    return node;
+}
+
+/**
+ * Criar árvore; every_k = 1 e depth_threshold = 0 dão o splay clássico
+ */
+SplayTree* splay_create(int every_k, int depth_threshold) {
+    SplayTree *tree = (SplayTree *)calloc(1, sizeof(SplayTree));
+    tree->config.every_k = every_k < 1 ? 1 : every_k;
+    tree->config.depth_threshold = depth_threshold < 0 ? 0 : depth_threshold;
+    return tree;
+}
+
+// ==================== OPERAÇÃO SPLAY TOP-DOWN ====================
+
+/**
+ * Splay top-down: traz para a raiz o nó com 'key' ou, se não existir, o
+ * último nó do caminho (predecessor ou sucessor). Retorna a nova raiz.
+ */
+static SplayNode* splay_top_down(SplayTree *tree, SplayNode *t, int key) {
+    if (t == NULL) return NULL;
+
+    SplayNode header;               // header.right = L, header.left = R
+    header.left = header.right = NULL;
+    SplayNode *l = &header, *r = &header, *y;
+    unsigned long visited = 1, writes = 4;
+
+    for (;;) {
+        if (key < t->key) {
+            if (t->left == NULL) break;
+            if (key < t->left->key) {
+                // Zig-zig: rotação à direita
+                y = t->left;
+                t->left = y->right;
+                y->right = t;
+                t = y;
+                writes += 2;
+                visited++;
+                if (t->left == NULL) break;
+            }
+            // Link à direita: t e sua subárvore direita vão para R
+            r->left = t;
+            r = t;
+            t = t->left;
+        } else if (key > t->key) {
+            if (t->right == NULL) break;
+            if (key > t->right->key) {
+                // Zag-zag: rotação à esquerda
+                y = t->right;
+                t->right = y->left;
+                y->left = t;
+                t = y;
+                writes += 2;
+                visited++;
+                if (t->right == NULL) break;
+            }
+            // Link à esquerda: t e sua subárvore esquerda vão para L
+            l->right = t;
+            l = t;
+            t = t->right;
+        } else {
+            break;
+        }
+        writes++;
+        visited++;
+    }
+
+    // Montagem: L e R viram os filhos de t
+    l->right = t->left;
+    r->left = t->right;
+    t->left = header.right;
+    t->right = header.left;
+
+    tree->splays++;
+    tree->visited += visited;
+    tree->writes += writes;
+    return t;
+}
+
+// ==================== OPERAÇÕES PRINCIPAIS ====================
+
+/**
+ * Inserir chave (sempre faz splay). Retorna false se já existia.
+ */
+bool splay_insert(SplayTree *tree, int key) {
+    if (tree->root == NULL) {
+        tree->root = create_node(key);
+        tree->size++;
+        return true;
+    }
+
+    SplayNode *t = splay_top_down(tree, tree->root, key);
+    if (t->key == key) {
+        tree->root = t;
+        return false;
+    }
+
+    // t é predecessor ou sucessor: o novo nó vira a raiz acima dele
+    SplayNode *node = create_node(key);
+    if (key < t->key) {
+        node->left = t->left;
+        node->right = t;
+        t->left = NULL;
+    } else {
+        node->right = t->right;
+        node->left = t;
+        t->right = NULL;
+    }
+    tree->writes += 3;
+    tree->root = node;
+    tree->size++;
+    return true;
+}
+
+/**
+ * Buscar chave. Com a configuração padrão, faz splay em todo acesso; no
+ * modo condicional, a maioria dos acessos é só leitura.
+ */
+SplayNode* splay_search(SplayTree *tree, int key) {
+    SplayConfig *cfg = &tree->config;
+    tree->accesses++;
+
+    if (cfg->every_k == 1 && cfg->depth_threshold == 0) {
+        if (tree->root == NULL) return NULL;
+        tree->root = splay_top_down(tree, tree->root, key);
+        return tree->root->key == key ? tree->root : NULL;
+    }
+
+    // Busca de BST comum, medindo a profundidade
+    SplayNode *node = tree->root;
+    int depth = 0;
+    while (node != NULL && node->key != key) {
+        node = key < node->key ? node->left : node->right;
+        depth++;
+    }
+    tree->visited += depth + 1;
+
+    if (node != NULL && depth > cfg->depth_threshold && tree->accesses % cfg->every_k == 0) {
+        tree->root = splay_top_down(tree, tree->root, key);
+        return tree->root;
+    }
+    return node;
+}
+
+/**
+ * Remover chave. Retorna false se não existia.
+ */
+bool splay_delete(SplayTree *tree, int key) {
+    if (tree->root == NULL) return false;
+
+    SplayNode *t = splay_top_down(tree, tree->root, key);
+    if (t->key != key) {
+        tree->root = t;
+        return false;
+    }
+
+    if (t->left == NULL) {
+        tree->root = t->right;
+    } else {
+        // Todas as chaves da esquerda são menores: o splay traz o máximo,
+        // que fica sem filho direito
+        SplayNode *root = splay_top_down(tree, t->left, key);
+        root->right = t->right;
+        tree->root = root;
+        tree->writes++;
+    }
+    free(t);
+    tree->size--;
+    return true;
+}
+
+// ==================== UTILITÁRIOS ====================
+
+int tree_height(SplayNode *node) {
+    // Iterativo: uma splay tree pode ter altura O(n)
+    if (node == NULL) return 0;
+    int max_height = 0, top = 0, capacity = 1024;
+    SplayNode **stack = (SplayNode **)malloc(capacity * sizeof(SplayNode *));
+    int *depth = (int *)malloc(capacity * sizeof(int));
+    stack[top] = node;
+    depth[top++] = 1;
+    while (top > 0) {
+        SplayNode *n = stack[--top];
+        int d = depth[top];
+        if (d > max_height) max_height = d;
+        SplayNode *children[2] = { n->left, n->right };
+        for (int i = 0; i < 2; i++) {
+            if (children[i] == NULL) continue;
+            if (top == capacity) {
+                capacity *= 2;
+                stack = (SplayNode **)realloc(stack, capacity * sizeof(SplayNode *));
+                depth = (int *)realloc(depth, capacity * sizeof(int));
+            }
+            stack[top] = children[i];
+            depth[top++] = d + 1;
+        }
+    }
+    free(stack);
+    free(depth);
+    return max_height;
+}
+
+/**
+ * Verificar propriedade BST e contar nós (iterativo, percurso in-order)
+ */
+bool verify_bst(SplayTree *tree) {
+    int capacity = 1024, top = 0, count = 0;
+    SplayNode **stack = (SplayNode **)malloc(capacity * sizeof(SplayNode *));
+    SplayNode *node = tree->root;
+    bool has_prev = false, ok = true;
+    int prev = 0;
+    while ((node != NULL || top > 0) && ok) {
+        while (node != NULL) {
+            if (top == capacity) {
+                capacity *= 2;
+                stack = (SplayNode **)realloc(stack, capacity * sizeof(SplayNode *));
+            }
+            stack[top++] = node;
+            node = node->left;
+        }
+        node = stack[--top];
+        if (has_prev && node->key <= prev) ok = false;
+        prev = node->key;
+        has_prev = true;
+        count++;
+        node = node->right;
+    }
+    free(stack);
+    return ok && count == tree->size;
+}
+
+void splay_free(SplayTree *tree) {
+    // Achatar para a direita com rotações: libera sem recursão
+    SplayNode *node = tree->root;
+    while (node != NULL) {
+        if (node->left != NULL) {
+            SplayNode *left = node->left;
+            node->left = left->right;
+            left->right = node;
+            node = left;
+        } else {
+            SplayNode *next = node->right;
+            free(node);
+            node = next;
+        }
+    }
+    free(tree);
+}
+
+// ==================== SPLAY BOTTOM-UP (splay_tree.c) ====================
+
+// Mesmo algoritmo de splay_tree.c: ponteiro 'parent' e rotações na subida
+typedef struct BUNode {
+    int key;
+    struct BUNode *left, *right, *parent;
+} BUNode;
+
+typedef struct {
+    BUNode *root;
+    unsigned long visited;
+    unsigned long writes;
+} BUTree;
+
+static void bu_rotate(BUTree *tree, BUNode *x) {
+    BUNode *y = x->parent;
+    BUNode *g = y->parent;
+    if (g) {
+        if (y == g->left) g->left = x; else g->right = x;
+    } else {
+        tree->root = x;
+    }
+    x->parent = g;
+    y->parent = x;
+    if (x == y->left) {
+        y->left = x->right;
+        if (x->right) { x->right->parent = y; tree->writes++; }
+        x->right = y;
+    } else {
+        y->right = x->left;
+        if (x->left) { x->left->parent = y; tree->writes++; }
+        x->left = y;
+    }
+    tree->writes += 5;
+}
+
+static void bu_splay(BUTree *tree, BUNode *x) {
+    while (x->parent != NULL) {
+        BUNode *p = x->parent;
+        BUNode *g = p->parent;
+        if (g == NULL) {
+            bu_rotate(tree, x);                         // Zig
+        } else if ((x == p->left) == (p == g->left)) {
+            bu_rotate(tree, p);                         // Zig-zig
+            bu_rotate(tree, x);
+        } else {
+            bu_rotate(tree, x);                         // Zig-zag
+            bu_rotate(tree, x);
+        }
+    }
+}
+
+static void bu_insert(BUTree *tree, int key) {
+    BUNode *parent = NULL, *current = tree->root;
+    while (current != NULL) {
+        parent = current;
+        if (key == current->key) { bu_splay(tree, current); return; }
+        current = key < current->key ? current->left : current->right;
+    }
+    BUNode *node = (BUNode *)malloc(sizeof(BUNode));
+    node->key = key;
+    node->left = node->right = NULL;
+    node->parent = parent;
+    if (parent == NULL) tree->root = node;
+    else if (key < parent->key) parent->left = node;
+    else parent->right = node;
+    bu_splay(tree, node);
+}
+
+static BUNode* bu_search(BUTree *tree, int key) {
+    BUNode *current = tree->root, *last = NULL;
+    while (current != NULL) {
+        last = current;
+        tree->visited++;
+        if (key == current->key) { bu_splay(tree, current); return current; }
+        current = key < current->key ? current->left : current->right;
+    }
+    if (last) bu_splay(tree, last);
+    return NULL;
+}
+
+static void bu_free(BUTree *tree) {
+    BUNode *node = tree->root;
+    while (node != NULL) {
+        if (node->left != NULL) {
+            BUNode *left = node->left;
+            node->left = left->right;
+            left->right = node;
+            node = left;
+        } else {
+            BUNode *next = node->right;
+            free(node);
+            node = next;
+        }
+    }
+}
+
+// ==================== TESTES ====================
+
+static unsigned int rng_state = 2463534242u;
+
+static unsigned int next_random() {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+void testar_basico() {
+    printf("=== TESTE BÁSICO (TOP-DOWN) ===\n\n");
+
+    SplayTree *tree = splay_create(1, 0);
+    int valores[] = {50, 30, 70, 20, 40, 60, 80};
+    for (int i = 0; i < 7; i++) splay_insert(tree, valores[i]);
+    printf("Após inserir 50 30 70 20 40 60 80: raiz = %d\n", tree->root->key);
+    splay_search(tree, 40);
+    printf("Após buscar 40: raiz = %d\n", tree->root->key);
+    splay_delete(tree, 40);
+    printf("Após remover 40: raiz = %d (maior chave < 40)\n\n", tree->root->key);
+    bool ok = tree->root->key == 30 && verify_bst(tree) && tree->size == 6;
+    splay_free(tree);
+
+    // Aleatório em todos os modos, contra vetor de presença
+    SplayConfig modos[] = { {1, 0}, {8, 0}, {1, 6}, {4, 3} };
+    enum { RANGE = 10000, OPS = 100000 };
+    for (int m = 0; m < 4 && ok; m++) {
+        bool *present = (bool *)calloc(RANGE, sizeof(bool));
+        tree = splay_create(modos[m].every_k, modos[m].depth_threshold);
+        for (int op = 0; op < OPS && ok; op++) {
+            int key = (int)(next_random() % RANGE);
+            switch (next_random() % 3) {
+                case 0: ok = splay_insert(tree, key) == !present[key]; present[key] = true; break;
+                case 1: ok = splay_delete(tree, key) == present[key]; present[key] = false; break;
+                default: {
+                    SplayNode *n = splay_search(tree, key);
+                    ok = (n != NULL) == present[key] && (n == NULL || n->key == key);
+                }
+            }
+            if (op % 10000 == 0) ok = ok && verify_bst(tree);
+        }
+        ok = ok && verify_bst(tree);
+        printf("Modo every_k=%d, depth>%d: %d operações aleatórias %s\n",
+               modos[m].every_k, modos[m].depth_threshold, OPS, ok ? "OK" : "FALHA");
+        splay_free(tree);
+        free(present);
+    }
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+void testar_localidade() {
+    printf("=== TESTE DE LOCALIDADE TEMPORAL ===\n\n");
+
+    SplayTree *tree = splay_create(1, 0);
+    for (int i = 0; i < 100; i++) splay_insert(tree, i);
+    printf("Árvore com 100 elementos inseridos em ordem: altura %d\n", tree_height(tree->root));
+
+    for (int i = 0; i < 10; i++) {
+        splay_search(tree, 50);
+        splay_search(tree, 51);
+        splay_search(tree, 52);
+    }
+    printf("Após acessar 50, 51, 52 repetidamente: raiz = %d, altura %d\n\n",
+           tree->root->key, tree_height(tree->root));
+    splay_free(tree);
+}
+
+void testar_working_set() {
+    printf("=== WORKING SET: SPLAY SEMPRE vs CONDICIONAL ===\n\n");
+
+    SplayConfig modos[] = { {1, 0}, {16, 0}, {1, 8} };
+    const char *nomes[] = { "sempre", "a cada 16 acessos", "profundidade > 8" };
+    for (int m = 0; m < 3; m++) {
+        SplayTree *tree = splay_create(modos[m].every_k, modos[m].depth_threshold);
+        for (int i = 0; i < 1000; i++) splay_insert(tree, (i * 617) % 1000);
+        tree->splays = tree->visited = tree->writes = 0;
+
+        for (int r = 0; r < 100; r++) {
+            for (int i = 100; i <= 104; i++) splay_search(tree, i);
+        }
+        printf("  %-20s: %3lu splays, %5lu escritas, %.1f nós visitados/acesso\n",
+               nomes[m], tree->splays, tree->writes, tree->visited / 500.0);
+        splay_free(tree);
+    }
+    printf("  O working set sobe na árvore nos primeiros acessos; depois o modo\n");
+    printf("  condicional só lê.\n\n");
+}
+
+// ==================== BENCHMARK ZIPF ====================
+
+/**
+ * Sequência de acessos Zipf(s) sobre n chaves: a chave de rank i tem
+ * probabilidade proporcional a 1/i^s. Os ranks são espalhados por uma
+ * permutação para que as chaves quentes não sejam vizinhas.
+ */
+static int* zipf_sequence(int n, int q, double s, const int *perm) {
+    double *cdf = (double *)malloc(n * sizeof(double));
+    double sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += 1.0 / pow(i + 1, s);
+        cdf[i] = sum;
+    }
+    int *seq = (int *)malloc(q * sizeof(int));
+    for (int j = 0; j < q; j++) {
+        double u = (next_random() / 4294967296.0) * sum;
+        int lo = 0, hi = n - 1;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (cdf[mid] < u) lo = mid + 1; else hi = mid;
+        }
+        seq[j] = perm[lo];
+    }
+    free(cdf);
+    return seq;
+}
+
+/**
+ * Árvore balanceada estática (sem reestruturação) como referência
+ */
+static SplayNode* build_balanced(const int *keys, int lo, int hi) {
+    if (lo >= hi) return NULL;
+    int mid = lo + (hi - lo) / 2;
+    SplayNode *node = create_node(keys[mid]);
+    node->left = build_balanced(keys, lo, mid);
+    node->right = build_balanced(keys, mid + 1, hi);
+    return node;
+}
+
+void benchmark(int n, int q) {
+    printf("=== BENCHMARK ZIPF: %d chaves, %d buscas ===\n\n", n, q);
+
+    int *keys = (int *)malloc(n * sizeof(int));
+    int *perm = (int *)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) keys[i] = perm[i] = 2 * i;
+    for (int i = n - 1; i > 0; i--) {
+        int j = (int)(next_random() % (unsigned)(i + 1));
+        int tmp = perm[i]; perm[i] = perm[j]; perm[j] = tmp;
+    }
+
+    double exponents[] = { 0.8, 0.99, 1.2 };
+    for (int e = 0; e < 3; e++) {
+        int *seq = zipf_sequence(n, q, exponents[e], perm);
+        printf("Zipf s = %.2f\n", exponents[e]);
+        printf("  %-28s %9s %12s %14s\n", "Estrutura", "tempo(s)", "nós/acesso", "escritas/acesso");
+
+        // Referência: BST balanceada estática
+        SplayTree *stat = splay_create(1, 0);
+        stat->root = build_balanced(keys, 0, n);
+        stat->size = n;
+        unsigned long visited = 0;
+        clock_t start = clock();
+        for (int j = 0; j < q; j++) {
+            SplayNode *node = stat->root;
+            while (node->key != seq[j]) {
+                node = seq[j] < node->key ? node->left : node->right;
+                visited++;
+            }
+        }
+        double t = (double)(clock() - start) / CLOCKS_PER_SEC;
+        printf("  %-28s %9.2f %12.1f %14.1f\n", "BST balanceada estática", t, (double)visited / q + 1, 0.0);
+        splay_free(stat);
+
+        // Bottom-up de splay_tree.c (inserção em ordem aleatória)
+        BUTree bu = { NULL, 0, 0 };
+        for (int i = 0; i < n; i++) bu_insert(&bu, perm[i]);
+        bu.visited = bu.writes = 0;
+        start = clock();
+        for (int j = 0; j < q; j++) bu_search(&bu, seq[j]);
+        t = (double)(clock() - start) / CLOCKS_PER_SEC;
+        printf("  %-28s %9.2f %12.1f %14.1f\n", "bottom-up (splay_tree.c)", t,
+               (double)bu.visited / q, (double)bu.writes / q);
+        bu_free(&bu);
+
+        SplayConfig modos[] = { {1, 0}, {16, 0}, {1, 16}, {1, 24} };
+        const char *nomes[] = { "top-down, sempre", "top-down, a cada 16", "top-down, prof. > 16",
+                                "top-down, prof. > 24" };
+        for (int m = 0; m < 4; m++) {
+            SplayTree *tree = splay_create(modos[m].every_k, modos[m].depth_threshold);
+            for (int i = 0; i < n; i++) splay_insert(tree, perm[i]);
+            tree->splays = tree->visited = tree->writes = 0;
+            bool ok = true;
+            start = clock();
+            for (int j = 0; j < q; j++) {
+                SplayNode *node = splay_search(tree, seq[j]);
+                if (node == NULL) ok = false;
+            }
+            t = (double)(clock() - start) / CLOCKS_PER_SEC;
+            printf("  %-28s %9.2f %12.1f %14.1f %s\n", nomes[m], t, (double)tree->visited / q,
+                   (double)tree->writes / q, ok ? "" : "(FALHA)");
+            splay_free(tree);
+        }
+        printf("\n");
+        free(seq);
+    }
+
+    free(keys);
+    free(perm);
+}
+
+// ==================== FUNÇÃO PRINCIPAL ====================
+
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║                 SPLAY TREE TOP-DOWN                      ║\n");
+    printf("║   Sem ponteiro para o pai, com splay condicional         ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int q = (argc > 2) ? atoi(argv[2]) : 5000000;
+    if (n < 1000) n = 1000;
+    if (q < 1) q = 1;
+
+    testar_basico();
+    testar_localidade();
+    testar_working_set();
+    benchmark(n, q);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da Splay Top-Down:\n");
+    printf("- Uma única descida, sem ponteiro 'parent' (3 ponteiros/nó)\n");
+    printf("- O(log n) amortizado, como o splay bottom-up\n");
+    printf("- Splay condicional: leituras sem escrita na maioria dos acessos\n");
+    printf("- Itens quentes continuam perto da raiz\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,649 @@
+/**
+ * ============================================================================
+ * AVL TREE ITERATIVA - PILHA DE CAMINHO, ITERADOR E CONSTRUÇÃO EM O(n)
+ * ============================================================================
+ *
+ * avl_tree.c é recursiva e faz um malloc por nó. Para cargas grandes isso
+ * custa: uma chamada por nível em cada operação, nós espalhados pelo heap
+ * e, ao carregar dados já ordenados, n inserções com O(log n) rotações.
+ *
+ * Esta versão mantém o mesmo algoritmo de balanceamento, mas:
+ *
+ * PILHA DE CAMINHO (sem ponteiro para o pai):
+ * - A descida guarda os ENDEREÇOS dos ponteiros visitados (AVLNode **),
+ *   e a subida refaz alturas/rotações escrevendo direto neles
+ *
+ *     path[0] = &tree->root      path[1] = &raiz->left    path[2] = ...
+ *
+ * - A subida para assim que a altura de uma subárvore não muda: daí para
+ *   cima nada depende do que aconteceu embaixo
+ * - Altura AVL <= 1.44 log2(n + 2): 64 níveis cobrem qualquer n de 32 bits
+ *
+ * ITERADOR COM ESTADO:
+ * - A mesma ideia de pilha: o iterador guarda o caminho até o nó atual e
+ *   avança em O(1) amortizado, sem recursão e sem ponteiro para o pai
+ *
+ * CONSTRUÇÃO A PARTIR DE DADOS ORDENADOS:
+ * - O meio do vetor vira a raiz e cada metade uma subárvore: O(n), sem
+ *   nenhuma rotação, e a árvore resultante já é AVL (alturas diferem <= 1)
+ *
+ * POOL DE SLABS:
+ * - Nós alocados em blocos de 64K; remoções alimentam uma lista livre e
+ *   destruir a árvore libera só os blocos, sem percorrer os nós
+ *
+ * Pré-requisito: avl_tree.c
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define AVL_MAX_HEIGHT 64
+#define SLAB_NODES 65536
+
+// ==================== ESTRUTURA DA AVL TREE ====================
+
+typedef struct AVLNode {
+    int key;
+    int height;
+    struct AVLNode *left;
+    struct AVLNode *right;
+} AVLNode;
+
+typedef struct Slab {
+    struct Slab *next;
+    AVLNode nodes[SLAB_NODES];
+} Slab;
+
+typedef struct {
+    Slab *slabs;                // Lista de blocos (o mais novo primeiro)
+    int used;                   // Nós já entregues do bloco mais novo
+    AVLNode *free_list;         // Nós removidos, encadeados por 'left'
+    long slab_count;
+} NodePool;
+
+typedef struct {
+    AVLNode *root;
+    int size;
+    NodePool pool;
+} AVLTree;
+
+// ==================== POOL DE NÓS ====================
+
+static AVLNode* pool_alloc(NodePool *pool, int key) {
+    AVLNode *node;
+    if (pool->free_list != NULL) {
+        node = pool->free_list;
+        pool->free_list = node->left;
+    } else {
+        if (pool->slabs == NULL || pool->used == SLAB_NODES) {
+            Slab *slab = (Slab *)malloc(sizeof(Slab));
+            if (slab == NULL) {
+                fprintf(stderr, "Erro ao alocar slab\n");
+                exit(1);
+            }
+            slab->next = pool->slabs;
+            pool->slabs = slab;
+            pool->used = 0;
+            pool->slab_count++;
+        }
+        node = &pool->slabs->nodes[pool->used++];
+    }
+    node->key = key;
+    node->height = 1;
+    node->left = node->right = NULL;
+    return node;
+}
+
+static void pool_free(NodePool *pool, AVLNode *node) {
+    node->left = pool->free_list;
+    pool->free_list = node;
+}
+
+static void pool_destroy(NodePool *pool) {
+    while (pool->slabs != NULL) {
+        Slab *next = pool->slabs->next;
+        free(pool->slabs);
+        pool->slabs = next;
+    }
+    pool->used = 0;
+    pool->free_list = NULL;
+    pool->slab_count = 0;
+}
+
+// ==================== FUNÇÕES AUXILIARES ====================
+
+int max(int a, int b) {
+    return (a > b) ? a : b;
+}
+
+int height(AVLNode *node) {
+    return node ? node->height : 0;
+}
+
+int balance_factor(AVLNode *node) {
+    return node ? height(node->left) - height(node->right) : 0;
+}
+
+void update_height(AVLNode *node) {
+    if (node) {
+        node->height = 1 + max(height(node->left), height(node->right));
+    }
+}
+
+// ==================== ROTAÇÕES ====================
+
+AVLNode* rotate_right(AVLNode *y) {
+    AVLNode *x = y->left;
+    y->left = x->right;
+    x->right = y;
+    update_height(y);
+    update_height(x);
+    return x;
+}
+
+AVLNode* rotate_left(AVLNode *x) {
+    AVLNode *y = x->right;
+    x->right = y->left;
+    y->left = x;
+    update_height(x);
+    update_height(y);
+    return y;
+}
+
+/**
+ * Atualizar altura e aplicar a rotação necessária (LL, LR, RR, RL)
+ */
+AVLNode* rebalance(AVLNode *node) {
+    update_height(node);
+    int balance = balance_factor(node);
+
+    if (balance > 1) {
+        if (balance_factor(node->left) < 0) {
+            node->left = rotate_left(node->left);
+        }
+        return rotate_right(node);
+    }
+    if (balance < -1) {
+        if (balance_factor(node->right) > 0) {
+            node->right = rotate_right(node->right);
+        }
+        return rotate_left(node);
+    }
+    return node;
+}
+
+/**
+ * Subida pela pilha de caminho: rebalanceia de baixo para cima e para
+ * quando a altura de uma subárvore não muda
+ */
+static void retrace(AVLNode **path[], int depth) {
+    while (depth > 0) {
+        AVLNode **link = path[--depth];
+        int old_height = (*link)->height;
+        *link = rebalance(*link);
+        if ((*link)->height == old_height) {
+            break;
+        }
+    }
+}
+
+// ==================== OPERAÇÕES PRINCIPAIS ====================
+
+AVLTree* avl_create() {
+    AVLTree *tree = (AVLTree *)calloc(1, sizeof(AVLTree));
+    return tree;
+}
+
+void avl_free(AVLTree *tree) {
+    pool_destroy(&tree->pool);
+    free(tree);
+}
+
+/**
+ * Inserir chave (iterativo). Retorna false se já existia.
+ */
+bool avl_insert(AVLTree *tree, int key) {
+    AVLNode **path[AVL_MAX_HEIGHT];
+    int depth = 0;
+    AVLNode **link = &tree->root;
+
+    while (*link != NULL) {
+        AVLNode *node = *link;
+        if (key == node->key) {
+            return false;
+        }
+        path[depth++] = link;
+        link = key < node->key ? &node->left : &node->right;
+    }
+
+    *link = pool_alloc(&tree->pool, key);
+    tree->size++;
+    retrace(path, depth);
+    return true;
+}
+
+/**
+ * Remover chave (iterativo). Retorna false se não existia.
+ */
+bool avl_delete(AVLTree *tree, int key) {
+    AVLNode **path[AVL_MAX_HEIGHT];
+    int depth = 0;
+    AVLNode **link = &tree->root;
+
+    while (*link != NULL && (*link)->key != key) {
+        path[depth++] = link;
+        link = key < (*link)->key ? &(*link)->left : &(*link)->right;
+    }
+    if (*link == NULL) {
+        return false;
+    }
+
+    AVLNode *node = *link;
+    if (node->left != NULL && node->right != NULL) {
+        // Dois filhos: o sucessor in-order (mínimo da direita) ocupa o lugar
+        path[depth++] = link;
+        AVLNode **succ_link = &node->right;
+        while ((*succ_link)->left != NULL) {
+            path[depth++] = succ_link;
+            succ_link = &(*succ_link)->left;
+        }
+        AVLNode *succ = *succ_link;
+        node->key = succ->key;
+        *succ_link = succ->right;
+        pool_free(&tree->pool, succ);
+    } else {
+        *link = node->left ? node->left : node->right;
+        pool_free(&tree->pool, node);
+    }
+
+    tree->size--;
+    retrace(path, depth);
+    return true;
+}
+
+AVLNode* avl_search(AVLTree *tree, int key) {
+    AVLNode *node = tree->root;
+    while (node != NULL && node->key != key) {
+        node = key < node->key ? node->left : node->right;
+    }
+    return node;
+}
+
+// ==================== CONSTRUÇÃO A PARTIR DE VETOR ORDENADO ====================
+
+/**
+ * Subárvore com keys[lo..hi); nós alocados em ordem in-order, então a
+ * árvore fica contígua na memória
+ */
+static AVLNode* build_range(NodePool *pool, const int *keys, int lo, int hi) {
+    if (lo >= hi) return NULL;
+    int mid = lo + (hi - lo) / 2;
+    AVLNode *left = build_range(pool, keys, lo, mid);
+    AVLNode *node = pool_alloc(pool, keys[mid]);
+    node->left = left;
+    node->right = build_range(pool, keys, mid + 1, hi);
+    update_height(node);
+    return node;
+}
+
+/**
+ * Substituir o conteúdo da árvore pelas n chaves (estritamente crescentes)
+ * em O(n). Retorna false, sem alterar a árvore, se o vetor não for válido.
+ */
+bool avl_build_from_sorted(AVLTree *tree, const int *keys, int n) {
+    for (int i = 1; i < n; i++) {
+        if (keys[i - 1] >= keys[i]) {
+            return false;
+        }
+    }
+    pool_destroy(&tree->pool);
+    tree->root = build_range(&tree->pool, keys, 0, n);
+    tree->size = n;
+    return true;
+}
+
+// ==================== ITERADOR ====================
+
+typedef struct {
+    AVLNode *stack[AVL_MAX_HEIGHT];     // Ancestrais cujo nó ainda não foi visitado
+    int top;
+} AVLIterator;
+
+static void iter_push_left(AVLIterator *it, AVLNode *node) {
+    while (node != NULL) {
+        it->stack[it->top++] = node;
+        node = node->left;
+    }
+}
+
+/**
+ * Posicionar no menor elemento
+ */
+void avl_iter_begin(AVLTree *tree, AVLIterator *it) {
+    it->top = 0;
+    iter_push_left(it, tree->root);
+}
+
+/**
+ * Posicionar no primeiro elemento >= key
+ */
+void avl_iter_seek(AVLTree *tree, int key, AVLIterator *it) {
+    it->top = 0;
+    AVLNode *node = tree->root;
+    while (node != NULL) {
+        if (node->key >= key) {
+            it->stack[it->top++] = node;    // Candidato; continua à esquerda
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+}
+
+bool avl_iter_valid(AVLIterator *it) {
+    return it->top > 0;
+}
+
+int avl_iter_key(AVLIterator *it) {
+    return it->stack[it->top - 1]->key;
+}
+
+void avl_iter_next(AVLIterator *it) {
+    AVLNode *node = it->stack[--it->top];
+    iter_push_left(it, node->right);
+}
+
+// ==================== VERIFICAÇÃO ====================
+
+/**
+ * Verificar BST, alturas e balanceamento; retorna a altura ou -1
+ */
+static int check_avl(AVLNode *node, long min, long max) {
+    if (node == NULL) return 0;
+    if (node->key <= min || node->key >= max) return -1;
+    int hl = check_avl(node->left, min, node->key);
+    int hr = check_avl(node->right, node->key, max);
+    if (hl < 0 || hr < 0 || hl - hr > 1 || hr - hl > 1) return -1;
+    if (node->height != 1 + (hl > hr ? hl : hr)) return -1;
+    return node->height;
+}
+
+bool avl_verify(AVLTree *tree) {
+    return check_avl(tree->root, -2147483649L, 2147483648L) >= 0;
+}
+
+// ==================== AVL RECURSIVA (avl_tree.c) ====================
+
+// Mesmo algoritmo de avl_tree.c: recursão e um malloc por nó
+static AVLNode* rec_insert(AVLNode *node, int key) {
+    if (node == NULL) {
+        AVLNode *n = (AVLNode *)malloc(sizeof(AVLNode));
+        n->key = key;
+        n->height = 1;
+        n->left = n->right = NULL;
+        return n;
+    }
+    if (key < node->key) {
+        node->left = rec_insert(node->left, key);
+    } else if (key > node->key) {
+        node->right = rec_insert(node->right, key);
+    } else {
+        return node;
+    }
+    return rebalance(node);
+}
+
+static AVLNode* rec_delete(AVLNode *node, int key) {
+    if (node == NULL) return NULL;
+    if (key < node->key) {
+        node->left = rec_delete(node->left, key);
+    } else if (key > node->key) {
+        node->right = rec_delete(node->right, key);
+    } else {
+        if (node->left == NULL || node->right == NULL) {
+            AVLNode *child = node->left ? node->left : node->right;
+            free(node);
+            return child;
+        }
+        AVLNode *succ = node->right;
+        while (succ->left != NULL) succ = succ->left;
+        node->key = succ->key;
+        node->right = rec_delete(node->right, succ->key);
+    }
+    return rebalance(node);
+}
+
+static void rec_free(AVLNode *node) {
+    if (node) {
+        rec_free(node->left);
+        rec_free(node->right);
+        free(node);
+    }
+}
+
+// ==================== TESTES ====================
+
+static unsigned int rng_state = 2463534242u;
+
+static unsigned int next_random() {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+void testar_operacoes() {
+    printf("=== TESTE DE INSERÇÃO/REMOÇÃO ITERATIVAS ===\n\n");
+
+    AVLTree *tree = avl_create();
+    int valores[] = {10, 20, 30, 40, 50, 25};
+    for (int i = 0; i < 6; i++) avl_insert(tree, valores[i]);
+    printf("Após inserir 10 20 30 40 50 25: raiz = %d, altura = %d\n", tree->root->key, height(tree->root));
+    avl_delete(tree, 30);
+    printf("Após remover 30: raiz = %d, altura = %d\n\n", tree->root->key, height(tree->root));
+    bool ok = avl_verify(tree) && tree->size == 5 && avl_search(tree, 30) == NULL;
+    avl_free(tree);
+
+    // Aleatório: comparar com vetor de presença e com a versão recursiva
+    enum { RANGE = 20000, OPS = 200000 };
+    bool *present = (bool *)calloc(RANGE, sizeof(bool));
+    tree = avl_create();
+    AVLNode *rec_root = NULL;
+    int count = 0;
+    for (int op = 0; op < OPS && ok; op++) {
+        int key = (int)(next_random() % RANGE);
+        if (next_random() % 2 == 0) {
+            bool removed = avl_delete(tree, key);
+            ok = removed == present[key];
+            rec_root = rec_delete(rec_root, key);
+            if (removed) count--;
+            present[key] = false;
+        } else {
+            bool inserted = avl_insert(tree, key);
+            ok = inserted == !present[key];
+            rec_root = rec_insert(rec_root, key);
+            if (inserted) count++;
+            present[key] = true;
+        }
+        if (op % 10000 == 0) {
+            ok = ok && avl_verify(tree) && tree->size == count;
+        }
+    }
+    // O balanceamento é o mesmo: as duas versões chegam à mesma árvore
+    ok = ok && avl_verify(tree) && tree->root->key == rec_root->key &&
+         height(tree->root) == height(rec_root);
+    printf("%d operações aleatórias: mesma raiz e altura da versão recursiva: %s\n", OPS, ok ? "sim" : "não");
+    printf("Slabs alocados: %ld para %d nós vivos (lista livre reaproveita)\n", tree->pool.slab_count, tree->size);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+
+    free(present);
+    rec_free(rec_root);
+    avl_free(tree);
+}
+
+void testar_iterador() {
+    printf("=== TESTE DO ITERADOR ===\n\n");
+
+    AVLTree *tree = avl_create();
+    for (int i = 0; i < 20; i++) avl_insert(tree, (i * 7) % 20 * 5);
+
+    AVLIterator it;
+    printf("In-order:");
+    int prev = -1, count = 0;
+    bool ok = true;
+    for (avl_iter_begin(tree, &it); avl_iter_valid(&it); avl_iter_next(&it)) {
+        printf(" %d", avl_iter_key(&it));
+        ok = ok && avl_iter_key(&it) > prev;
+        prev = avl_iter_key(&it);
+        count++;
+    }
+    printf("\nA partir de 42:");
+    avl_iter_seek(tree, 42, &it);
+    ok = ok && count == 20 && avl_iter_valid(&it) && avl_iter_key(&it) == 45;
+    for (int i = 0; i < 4 && avl_iter_valid(&it); i++, avl_iter_next(&it)) {
+        printf(" %d", avl_iter_key(&it));
+    }
+    avl_iter_seek(tree, 96, &it);
+    ok = ok && !avl_iter_valid(&it);
+    printf("\nseek(96) além do fim: %s\n", avl_iter_valid(&it) ? "válido" : "fim");
+    avl_free(tree);
+
+    // Construção O(n) + iterador percorre exatamente o vetor
+    enum { N = 100000 };
+    int *keys = (int *)malloc(N * sizeof(int));
+    for (int i = 0; i < N; i++) keys[i] = 3 * i - 150000;
+    tree = avl_create();
+    ok = ok && avl_build_from_sorted(tree, keys, N) && avl_verify(tree);
+    int i = 0;
+    for (avl_iter_begin(tree, &it); avl_iter_valid(&it); avl_iter_next(&it), i++) {
+        if (i >= N || avl_iter_key(&it) != keys[i]) ok = false;
+    }
+    ok = ok && i == N;
+    for (int k = 0; k < 1000 && ok; k++) {
+        int probe = (int)(next_random() % (3 * N)) - 150001;
+        avl_iter_seek(tree, probe, &it);
+        int expected = probe <= keys[0] ? 0 : (probe - keys[0] + 2) / 3;
+        ok = expected < N ? (avl_iter_valid(&it) && avl_iter_key(&it) == keys[expected]) : !avl_iter_valid(&it);
+    }
+    printf("avl_build_from_sorted(%d): altura %d, válida: %s\n", N, height(tree->root),
+           avl_verify(tree) ? "sim" : "não");
+
+    // Depois da construção a árvore continua aceitando atualizações
+    for (int k = 0; k < N && ok; k += 2) ok = avl_delete(tree, keys[k]);
+    ok = ok && avl_verify(tree) && tree->size == N / 2;
+
+    int fora_de_ordem[] = {1, 3, 2};
+    ok = ok && !avl_build_from_sorted(tree, fora_de_ordem, 3) && tree->size == N / 2;
+    printf("Vetor fora de ordem rejeitado: %s\n", ok ? "sim" : "não");
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    free(keys);
+    avl_free(tree);
+}
+
+// ==================== BENCHMARK ====================
+
+void benchmark(int n) {
+    printf("=== BENCHMARK: carga a frio de %d chaves ordenadas ===\n\n", n);
+
+    int *keys = (int *)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) keys[i] = 2 * i;
+
+    clock_t start = clock();
+    AVLNode *rec_root = NULL;
+    for (int i = 0; i < n; i++) rec_root = rec_insert(rec_root, keys[i]);
+    double t_rec = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    rec_free(rec_root);
+    double t_rec_free = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    AVLTree *tree = avl_create();
+    start = clock();
+    for (int i = 0; i < n; i++) avl_insert(tree, keys[i]);
+    double t_iter = (double)(clock() - start) / CLOCKS_PER_SEC;
+    bool ok = avl_verify(tree);
+    avl_free(tree);
+
+    tree = avl_create();
+    start = clock();
+    avl_build_from_sorted(tree, keys, n);
+    double t_build = (double)(clock() - start) / CLOCKS_PER_SEC;
+    ok = ok && avl_verify(tree);
+
+    start = clock();
+    AVLIterator it;
+    long long sum = 0;
+    for (avl_iter_begin(tree, &it); avl_iter_valid(&it); avl_iter_next(&it)) sum += avl_iter_key(&it);
+    double t_scan = (double)(clock() - start) / CLOCKS_PER_SEC;
+    ok = ok && sum == (long long)n * (n - 1);
+
+    start = clock();
+    avl_free(tree);
+    double t_pool_free = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%-40s %10s\n", "Operação", "tempo (s)");
+    printf("%-40s %10.2f\n", "avl_tree.c: n inserções (malloc/nó)", t_rec);
+    printf("%-40s %10.2f\n", "iterativa: n inserções (pool)", t_iter);
+    printf("%-40s %10.2f\n", "avl_build_from_sorted", t_build);
+    printf("%-40s %10.2f\n", "percurso completo com iterador", t_scan);
+    printf("%-40s %10.2f\n", "liberar avl_tree.c (free por nó)", t_rec_free);
+    printf("%-40s %10.2f\n", "liberar pool (por slab)", t_pool_free);
+    printf("Construção %.0fx mais rápida que avl_tree.c | resultados: %s\n\n",
+           t_build > 0 ? t_rec / t_build : 0.0, ok ? "OK" : "FALHA");
+
+    // Operações aleatórias em árvore já carregada
+    int ops = n < 2000000 ? n : 2000000;
+    int *random_keys = (int *)malloc(ops * sizeof(int));
+    for (int i = 0; i < ops; i++) random_keys[i] = (int)(next_random() % (2u * (unsigned)ops));
+
+    rec_root = NULL;
+    start = clock();
+    for (int i = 0; i < ops; i++) rec_root = rec_insert(rec_root, random_keys[i]);
+    for (int i = 0; i < ops; i++) rec_root = rec_delete(rec_root, random_keys[i]);
+    double t_rec_rand = (double)(clock() - start) / CLOCKS_PER_SEC;
+    rec_free(rec_root);
+
+    tree = avl_create();
+    start = clock();
+    for (int i = 0; i < ops; i++) avl_insert(tree, random_keys[i]);
+    for (int i = 0; i < ops; i++) avl_delete(tree, random_keys[i]);
+    double t_iter_rand = (double)(clock() - start) / CLOCKS_PER_SEC;
+    ok = tree->size == 0;
+    avl_free(tree);
+
+    printf("%d inserções + %d remoções aleatórias:\n", ops, ops);
+    printf("  avl_tree.c: %.2f s | iterativa: %.2f s %s\n\n", t_rec_rand, t_iter_rand, ok ? "" : "(FALHA)");
+
+    free(random_keys);
+    free(keys);
+}
+
+// ==================== FUNÇÃO PRINCIPAL ====================
+
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║                  AVL TREE ITERATIVA                      ║\n");
+    printf("║   Pilha de caminho, iterador, construção O(n) e slabs    ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    if (n < 1000) n = 1000;
+
+    testar_operacoes();
+    testar_iterador();
+    benchmark(n);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da AVL Iterativa:\n");
+    printf("- Inserção/remoção sem recursão: pilha com <= 64 níveis\n");
+    printf("- Subida para quando a altura da subárvore não muda\n");
+    printf("- Iterador in-order e seek com O(1) amortizado por passo\n");
+    printf("- Construção a partir de vetor ordenado: O(n), sem rotações\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,783 @@
+/**
+ * ============================================================================
+ * SKIP LIST LOCK-FREE (HERLIHY / FRASER)
+ * ============================================================================
+ *
+ * skip_list.c não tem sincronização, usa rand() global em randomLevel e
+ * limita a altura em MAX_LEVEL 16. Esta versão é um mapa ordenado
+ * concorrente sem locks:
+ *
+ * PONTEIROS MARCADOS:
+ * - O bit menos significativo de next[i] marca o nó como REMOVIDO naquele
+ *   nível. Um CAS num ponteiro marcado sempre falha, então ninguém consegue
+ *   inserir atrás de um nó que está saindo
+ * - Remoção lógica: marcar next[top-1] ... next[1] e, por último, next[0].
+ *   Quem marca o nível 0 é o "dono" da remoção
+ * - Remoção física: qualquer busca (find) que encontre um nó marcado o
+ *   desencadeia do nível com um CAS no predecessor
+ *
+ * INSERÇÃO:
+ * - Liga o nó no nível 0 com CAS (ponto de linearização) e depois sobe
+ *   nível a nível, refazendo a busca quando o CAS falha
+ *
+ * RECUPERAÇÃO DE MEMÓRIA POR ÉPOCAS (EBR):
+ * - Um nó desligado ainda pode estar sendo lido por outra thread, então
+ *   deleteKey não pode dar free. Cada operação "pina" a época global;
+ *   o nó removido vai para a lista de lixo da thread com a época atual e
+ *   só é liberado quando a época global avança 2 vezes (todas as threads
+ *   que podiam vê-lo já terminaram suas operações)
+ * - A inserção e a remoção de um mesmo nó terminam em ordem qualquer; um
+ *   "aperto de mãos" atômico faz com que só a última a terminar o recicle,
+ *   garantindo que os níveis superiores já foram desligados
+ *
+ * NÍVEIS: gerador xorshift por thread (_Thread_local) e nível geométrico
+ * (p = 1/2) obtido com count-trailing-zeros, até MAX_LEVEL 32.
+ *
+ * Compilação: gcc -O2 -std=c11 -pthread skip_list_lock_free.c
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define MAX_LEVEL 32
+#define MAX_THREADS 64
+#define RETIRE_THRESHOLD 128    // Tenta avançar a época a cada N remoções
+
+// ==================== ESTRUTURAS ====================
+
+typedef struct LFNode {
+    int64_t key;                        // int64 para caber as sentinelas
+    long value;
+    int top_level;                      // Níveis 0 .. top_level-1
+    _Atomic int handshake;              // Inserção e remoção terminadas
+    struct LFNode *retired_next;        // Lista de lixo da EBR
+    _Atomic uintptr_t next[];           // Ponteiros marcados
+} LFNode;
+
+typedef struct {
+    LFNode *head;                       // Sentinela: chave -infinito
+    LFNode *tail;                       // Sentinela: chave +infinito
+    _Atomic int max_level;              // Dica: maior nível em uso
+    _Atomic long size;
+} LockFreeSkipList;
+
+// ==================== PONTEIROS MARCADOS ====================
+
+static inline bool isMarked(uintptr_t p) {
+    return (p & 1) != 0;
+}
+
+static inline LFNode* getPtr(uintptr_t p) {
+    return (LFNode *)(p & ~(uintptr_t)1);
+}
+
+// ==================== ÉPOCAS (EBR) ====================
+
+// Estado por thread: (época << 1) | pinada. Alinhado para não
+// compartilhar cache line com outras threads.
+typedef struct {
+    _Alignas(64) _Atomic uint64_t state;
+    LFNode *limbo[3];                   // Lixo por época (época % 3)
+    uint64_t limbo_epoch[3];
+    long limbo_count;
+    long retired;
+    long freed;
+} EpochRecord;
+
+static _Atomic uint64_t global_epoch = 2;
+static EpochRecord epoch_records[MAX_THREADS];
+static _Atomic bool slot_in_use[MAX_THREADS];
+static _Atomic int registered_threads = 0;      // Maior slot já usado + 1
+static pthread_key_t slot_key;
+static pthread_once_t slot_once = PTHREAD_ONCE_INIT;
+
+static _Thread_local int thread_index = -1;
+static _Thread_local uint64_t rng_state = 0;
+
+// Ao terminar, a thread devolve o slot; o lixo pendente fica para o próximo dono
+static void releaseSlot(void *rec) {
+    atomic_store(&slot_in_use[(EpochRecord *)rec - epoch_records], false);
+}
+
+static void createSlotKey() {
+    pthread_key_create(&slot_key, releaseSlot);
+}
+
+// Função para obter o registro da thread atual (ocupa um slot livre no primeiro uso)
+static EpochRecord* currentRecord() {
+    if (thread_index < 0) {
+        pthread_once(&slot_once, createSlotKey);
+        for (int i = 0; i < MAX_THREADS && thread_index < 0; i++) {
+            bool expected = false;
+            if (atomic_compare_exchange_strong(&slot_in_use[i], &expected, true)) {
+                thread_index = i;
+            }
+        }
+        if (thread_index < 0) {
+            fprintf(stderr, "Erro: mais de %d threads simultâneas\n", MAX_THREADS);
+            exit(1);
+        }
+        int high = atomic_load(&registered_threads);
+        while (high < thread_index + 1 &&
+               !atomic_compare_exchange_weak(&registered_threads, &high, thread_index + 1)) {
+        }
+        pthread_setspecific(slot_key, &epoch_records[thread_index]);
+    }
+    return &epoch_records[thread_index];
+}
+
+static void freeBucket(EpochRecord *rec, int b) {
+    LFNode *node = rec->limbo[b];
+    while (node != NULL) {
+        LFNode *next = node->retired_next;
+        free(node);
+        rec->limbo_count--;
+        rec->freed++;
+        node = next;
+    }
+    rec->limbo[b] = NULL;
+}
+
+// Função para tentar avançar a época global: só é possível se toda thread
+// pinada já observou a época atual
+static void tryAdvanceEpoch() {
+    uint64_t e = atomic_load(&global_epoch);
+    int n = atomic_load(&registered_threads);
+    atomic_thread_fence(memory_order_seq_cst);
+    for (int i = 0; i < n && i < MAX_THREADS; i++) {
+        uint64_t s = atomic_load_explicit(&epoch_records[i].state, memory_order_relaxed);
+        if ((s & 1) && (s >> 1) != e) {
+            return;
+        }
+    }
+    atomic_compare_exchange_strong(&global_epoch, &e, e + 1);
+}
+
+// Função para entrar numa seção crítica (antes de tocar qualquer nó)
+static EpochRecord* epochEnter() {
+    EpochRecord *rec = currentRecord();
+    uint64_t e = atomic_load_explicit(&global_epoch, memory_order_relaxed);
+    atomic_store_explicit(&rec->state, (e << 1) | 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    // Lixo de duas épocas atrás não é mais visível para ninguém
+    for (int b = 0; b < 3; b++) {
+        if (rec->limbo[b] != NULL && rec->limbo_epoch[b] + 2 <= e) {
+            freeBucket(rec, b);
+        }
+    }
+    return rec;
+}
+
+static void epochExit(EpochRecord *rec) {
+    uint64_t s = atomic_load_explicit(&rec->state, memory_order_relaxed);
+    atomic_store_explicit(&rec->state, s & ~(uint64_t)1, memory_order_release);
+}
+
+// Função para adiar o free de um nó já desligado de todos os níveis.
+// A etiqueta é a época GLOBAL lida depois do desligamento: uma thread que
+// ainda veja o nó está pinada nessa época ou antes e impede o avanço até +2.
+static void epochRetire(EpochRecord *rec, LFNode *node) {
+    uint64_t e = atomic_load(&global_epoch);
+    int b = (int)(e % 3);
+    if (rec->limbo[b] != NULL && rec->limbo_epoch[b] != e) {
+        freeBucket(rec, b);             // Época e - 3: seguro
+    }
+    rec->limbo_epoch[b] = e;
+    node->retired_next = rec->limbo[b];
+    rec->limbo[b] = node;
+    rec->limbo_count++;
+    rec->retired++;
+    if (rec->retired % RETIRE_THRESHOLD == 0) {
+        tryAdvanceEpoch();
+    }
+}
+
+// ==================== NÍVEIS ALEATÓRIOS ====================
+
+// Função para gerar nível aleatório: xorshift por thread, sem estado global
+static int randomLevel() {
+    if (rng_state == 0) {
+        rng_state = 0x9E3779B97F4A7C15ull * (uint64_t)(thread_index + 2) ^ (uint64_t)time(NULL);
+        if (rng_state == 0) rng_state = 1;
+    }
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    // Zeros à direita de um número aleatório: P(nível >= k) = 2^-(k-1)
+    return 1 + __builtin_ctzll(rng_state | (1ull << (MAX_LEVEL - 1)));
+}
+
+// ==================== SKIP LIST ====================
+
+// Função para criar um novo nó com 'level' níveis
+static LFNode* createNode(int64_t key, long value, int level) {
+    LFNode *node = (LFNode *)malloc(sizeof(LFNode) + level * sizeof(_Atomic uintptr_t));
+    if (node == NULL) {
+        fprintf(stderr, "Erro ao alocar nó\n");
+        exit(1);
+    }
+    node->key = key;
+    node->value = value;
+    node->top_level = level;
+    node->retired_next = NULL;
+    atomic_init(&node->handshake, 0);
+    for (int i = 0; i < level; i++) {
+        atomic_init(&node->next[i], (uintptr_t)0);
+    }
+    return node;
+}
+
+// Função para criar uma Skip List lock-free vazia
+LockFreeSkipList* createLockFreeSkipList() {
+    LockFreeSkipList *list = (LockFreeSkipList *)malloc(sizeof(LockFreeSkipList));
+    list->head = createNode(INT64_MIN, 0, MAX_LEVEL);
+    list->tail = createNode(INT64_MAX, 0, MAX_LEVEL);
+    for (int i = 0; i < MAX_LEVEL; i++) {
+        atomic_init(&list->head->next[i], (uintptr_t)list->tail);
+    }
+    atomic_init(&list->max_level, 1);
+    atomic_init(&list->size, 0);
+    return list;
+}
+
+// Função de busca com limpeza: preenche preds/succs em cada nível e
+// desliga os nós marcados encontrados pelo caminho
+static bool find(LockFreeSkipList *list, int64_t key, LFNode **preds, LFNode **succs) {
+retry:;
+    int top = atomic_load(&list->max_level);
+    LFNode *pred = list->head;
+    LFNode *curr = NULL;
+
+    for (int level = MAX_LEVEL - 1; level >= 0; level--) {
+        if (level >= top) {
+            preds[level] = list->head;
+            succs[level] = list->tail;
+            continue;
+        }
+        curr = getPtr(atomic_load(&pred->next[level]));
+        while (true) {
+            uintptr_t succ = atomic_load(&curr->next[level]);
+            while (isMarked(succ)) {
+                // curr está sendo removido: desliga deste nível
+                uintptr_t expected = (uintptr_t)curr;
+                if (!atomic_compare_exchange_strong(&pred->next[level], &expected, (uintptr_t)getPtr(succ))) {
+                    goto retry;
+                }
+                curr = getPtr(succ);
+                succ = atomic_load(&curr->next[level]);
+            }
+            if (curr->key < key) {
+                pred = curr;
+                curr = getPtr(succ);
+            } else {
+                break;
+            }
+        }
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+    return curr->key == key;
+}
+
+// Função para inserir (chave, valor); retorna false se a chave já existe
+bool lfInsert(LockFreeSkipList *list, int key, long value) {
+    LFNode *preds[MAX_LEVEL], *succs[MAX_LEVEL];
+    EpochRecord *rec = epochEnter();
+    int top = randomLevel();
+
+    int current_max = atomic_load(&list->max_level);
+    while (top > current_max && !atomic_compare_exchange_weak(&list->max_level, &current_max, top)) {
+    }
+
+    LFNode *node = NULL;
+    while (true) {
+        if (find(list, key, preds, succs)) {
+            if (node != NULL) free(node);       // Nunca foi publicado
+            epochExit(rec);
+            return false;
+        }
+        if (node == NULL) {
+            node = createNode(key, value, top);
+        }
+        for (int level = 0; level < top; level++) {
+            atomic_store_explicit(&node->next[level], (uintptr_t)succs[level], memory_order_relaxed);
+        }
+        uintptr_t expected = (uintptr_t)succs[0];
+        if (atomic_compare_exchange_strong(&preds[0]->next[0], &expected, (uintptr_t)node)) {
+            break;                                  // Linearização: chave visível
+        }
+    }
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+
+    // Liga os níveis superiores
+    for (int level = 1; level < top; level++) {
+        while (true) {
+            uintptr_t mine = atomic_load(&node->next[level]);
+            if (isMarked(mine)) goto done;          // Removido enquanto subia
+            if (getPtr(mine) != succs[level] &&
+                !atomic_compare_exchange_strong(&node->next[level], &mine, (uintptr_t)succs[level])) {
+                continue;
+            }
+            uintptr_t expected = (uintptr_t)succs[level];
+            if (atomic_compare_exchange_strong(&preds[level]->next[level], &expected, (uintptr_t)node)) {
+                break;
+            }
+            find(list, key, preds, succs);
+            if (succs[0] != node) goto done;        // Já saiu do nível 0
+        }
+    }
+
+done:
+    // Se houve remoção concorrente, garante que nenhum nível ficou ligado
+    if (isMarked(atomic_load(&node->next[0]))) {
+        find(list, key, preds, succs);
+    }
+    if (atomic_exchange(&node->handshake, 1) == 1) {
+        epochRetire(rec, node);                     // A remoção já terminou
+    }
+    epochExit(rec);
+    return true;
+}
+
+// Função para buscar uma chave (não escreve em memória compartilhada)
+bool lfSearch(LockFreeSkipList *list, int key, long *value) {
+    EpochRecord *rec = epochEnter();
+    int top = atomic_load(&list->max_level);
+    LFNode *pred = list->head;
+    LFNode *curr = NULL;
+
+    for (int level = top - 1; level >= 0; level--) {
+        curr = getPtr(atomic_load(&pred->next[level]));
+        while (true) {
+            uintptr_t succ = atomic_load(&curr->next[level]);
+            while (isMarked(succ)) {                // Pula nós removidos
+                curr = getPtr(succ);
+                succ = atomic_load(&curr->next[level]);
+            }
+            if (curr->key < key) {
+                pred = curr;
+                curr = getPtr(succ);
+            } else {
+                break;
+            }
+        }
+    }
+    bool found = curr->key == key;
+    if (found && value != NULL) {
+        *value = curr->value;
+    }
+    epochExit(rec);
+    return found;
+}
+
+// Função para deletar uma chave; retorna true se esta thread a removeu
+bool deleteKey(LockFreeSkipList *list, int key) {
+    LFNode *preds[MAX_LEVEL], *succs[MAX_LEVEL];
+    EpochRecord *rec = epochEnter();
+
+    if (!find(list, key, preds, succs)) {
+        epochExit(rec);
+        return false;
+    }
+    LFNode *node = succs[0];
+
+    // Marca os níveis superiores, de cima para baixo
+    for (int level = node->top_level - 1; level >= 1; level--) {
+        uintptr_t succ = atomic_load(&node->next[level]);
+        while (!isMarked(succ)) {
+            atomic_compare_exchange_weak(&node->next[level], &succ, succ | 1);   // Falha recarrega succ
+        }
+    }
+
+    // Nível 0: quem conseguir marcar é o dono da remoção
+    uintptr_t succ = atomic_load(&node->next[0]);
+    while (true) {
+        if (isMarked(succ)) {
+            epochExit(rec);
+            return false;                           // Outra thread removeu
+        }
+        if (atomic_compare_exchange_strong(&node->next[0], &succ, succ | 1)) {
+            break;
+        }
+    }
+    atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+
+    find(list, key, preds, succs);                  // Remoção física
+    if (atomic_exchange(&node->handshake, 1) == 1) {
+        epochRetire(rec, node);                     // A inserção já terminou
+    }
+    epochExit(rec);
+    return true;
+}
+
+// Função para liberar memória (sem outras threads ativas)
+void freeLockFreeSkipList(LockFreeSkipList *list) {
+    LFNode *node = getPtr(atomic_load(&list->head->next[0]));
+    while (node != list->tail) {
+        LFNode *next = getPtr(atomic_load(&node->next[0]));
+        free(node);
+        node = next;
+    }
+    free(list->head);
+    free(list->tail);
+    free(list);
+}
+
+// Função para liberar todo o lixo pendente (sem outras threads ativas)
+static void epochDrain(long *retired, long *freed) {
+    *retired = *freed = 0;
+    int n = atomic_load(&registered_threads);
+    for (int i = 0; i < n && i < MAX_THREADS; i++) {
+        *retired += epoch_records[i].retired;
+        *freed += epoch_records[i].freed;
+        for (int b = 0; b < 3; b++) {
+            freeBucket(&epoch_records[i], b);
+        }
+    }
+}
+
+// Função para verificar ordenação e encadeamento de todos os níveis
+bool verifyLockFree(LockFreeSkipList *list, long *count) {
+    *count = 0;
+    for (int level = MAX_LEVEL - 1; level >= 0; level--) {
+        LFNode *node = getPtr(atomic_load(&list->head->next[level]));
+        int64_t prev = INT64_MIN;
+        long n = 0;
+        while (node != list->tail) {
+            uintptr_t next = atomic_load(&node->next[level]);
+            if (isMarked(next) || node->key <= prev || node->top_level <= level) {
+                return false;
+            }
+            prev = node->key;
+            node = getPtr(next);
+            n++;
+        }
+        if (level == 0) *count = n;
+    }
+    return *count == atomic_load(&list->size);
+}
+
+// ==================== TESTES ====================
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static inline uint64_t nextRandom(uint64_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return *s;
+}
+
+#define TEST_THREADS 8
+#define TEST_OPS 200000
+#define TEST_KEYS 2000
+
+typedef struct {
+    LockFreeSkipList *list;
+    int id;
+    long inserted;
+    long deleted;
+    long errors;
+} TestArgs;
+
+// Todas as threads disputam o mesmo conjunto pequeno de chaves
+static void* contendedWorker(void *arg) {
+    TestArgs *a = (TestArgs *)arg;
+    uint64_t s = 0x2545F4914F6CDD1Dull * (uint64_t)(a->id + 1);
+    for (int i = 0; i < TEST_OPS; i++) {
+        uint64_t r = nextRandom(&s);
+        int key = (int)(r % TEST_KEYS);
+        switch ((r >> 32) % 3) {
+            case 0:
+                a->inserted += lfInsert(a->list, key, key * 7L);
+                break;
+            case 1:
+                a->deleted += deleteKey(a->list, key);
+                break;
+            default: {
+                long v;
+                if (lfSearch(a->list, key, &v) && v != key * 7L) a->errors++;
+                break;
+            }
+        }
+    }
+    return NULL;
+}
+
+void testarConcorrencia() {
+    printf("=== Teste concorrente (%d threads, %d chaves disputadas) ===\n", TEST_THREADS, TEST_KEYS);
+
+    LockFreeSkipList *list = createLockFreeSkipList();
+    pthread_t threads[TEST_THREADS];
+    TestArgs args[TEST_THREADS];
+    for (int i = 0; i < TEST_THREADS; i++) {
+        args[i] = (TestArgs){ list, i, 0, 0, 0 };
+        pthread_create(&threads[i], NULL, contendedWorker, &args[i]);
+    }
+
+    long inserted = 0, deleted = 0, errors = 0;
+    for (int i = 0; i < TEST_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        inserted += args[i].inserted;
+        deleted += args[i].deleted;
+        errors += args[i].errors;
+    }
+
+    long count;
+    bool structure = verifyLockFree(list, &count);
+    // Cada chave presente foi inserida com sucesso uma vez a mais do que removida
+    bool balance = count == inserted - deleted;
+    long present = 0;
+    for (int k = 0; k < TEST_KEYS; k++) {
+        present += lfSearch(list, k, NULL);
+    }
+
+    printf("Inserções com sucesso: %ld | remoções com sucesso: %ld\n", inserted, deleted);
+    printf("Chaves restantes: %ld (esperado %ld) | valores errados: %ld\n", count, inserted - deleted, errors);
+    printf("Verificação: %s\n\n", structure && balance && present == count && errors == 0 ? "OK" : "FALHA");
+    freeLockFreeSkipList(list);
+}
+
+// ==================== BENCHMARK ====================
+
+// Skip list de skip_list.c (sem os printf) protegida por um mutex global
+typedef struct SeqNode {
+    int key;
+    long value;
+    struct SeqNode **forward;
+} SeqNode;
+
+typedef struct {
+    int level;
+    SeqNode *header;
+    pthread_mutex_t lock;
+} LockedSkipList;
+
+static SeqNode* seqCreateNode(int key, long value, int level) {
+    SeqNode *node = (SeqNode *)malloc(sizeof(SeqNode));
+    node->key = key;
+    node->value = value;
+    node->forward = (SeqNode **)calloc(level + 1, sizeof(SeqNode *));
+    return node;
+}
+
+static LockedSkipList* lockedCreate() {
+    LockedSkipList *list = (LockedSkipList *)malloc(sizeof(LockedSkipList));
+    list->level = 0;
+    list->header = seqCreateNode(-1, 0, MAX_LEVEL);
+    pthread_mutex_init(&list->lock, NULL);
+    return list;
+}
+
+static bool lockedInsert(LockedSkipList *list, int key, long value) {
+    SeqNode *update[MAX_LEVEL + 1];
+    pthread_mutex_lock(&list->lock);
+    SeqNode *current = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (current->forward[i] != NULL && current->forward[i]->key < key) {
+            current = current->forward[i];
+        }
+        update[i] = current;
+    }
+    current = current->forward[0];
+    bool inserted = current == NULL || current->key != key;
+    if (inserted) {
+        int new_level = randomLevel() - 1;
+        for (int i = list->level + 1; i <= new_level; i++) {
+            update[i] = list->header;
+        }
+        if (new_level > list->level) list->level = new_level;
+        SeqNode *node = seqCreateNode(key, value, new_level);
+        for (int i = 0; i <= new_level; i++) {
+            node->forward[i] = update[i]->forward[i];
+            update[i]->forward[i] = node;
+        }
+    }
+    pthread_mutex_unlock(&list->lock);
+    return inserted;
+}
+
+static bool lockedSearch(LockedSkipList *list, int key) {
+    pthread_mutex_lock(&list->lock);
+    SeqNode *current = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (current->forward[i] != NULL && current->forward[i]->key < key) {
+            current = current->forward[i];
+        }
+    }
+    current = current->forward[0];
+    bool found = current != NULL && current->key == key;
+    pthread_mutex_unlock(&list->lock);
+    return found;
+}
+
+static bool lockedDelete(LockedSkipList *list, int key) {
+    SeqNode *update[MAX_LEVEL + 1];
+    pthread_mutex_lock(&list->lock);
+    SeqNode *current = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (current->forward[i] != NULL && current->forward[i]->key < key) {
+            current = current->forward[i];
+        }
+        update[i] = current;
+    }
+    current = current->forward[0];
+    bool found = current != NULL && current->key == key;
+    if (found) {
+        for (int i = 0; i <= list->level && update[i]->forward[i] == current; i++) {
+            update[i]->forward[i] = current->forward[i];
+        }
+        free(current->forward);
+        free(current);
+    }
+    pthread_mutex_unlock(&list->lock);
+    return found;
+}
+
+static void lockedFree(LockedSkipList *list) {
+    SeqNode *node = list->header;
+    while (node != NULL) {
+        SeqNode *next = node->forward[0];
+        free(node->forward);
+        free(node);
+        node = next;
+    }
+    pthread_mutex_destroy(&list->lock);
+    free(list);
+}
+
+typedef struct {
+    void *list;
+    bool lock_free;
+    int read_pct;           // Restante dividido entre inserção e remoção
+    int key_range;
+    uint64_t seed;
+    _Atomic bool *stop;
+    long ops;
+} BenchArgs;
+
+static void* benchWorker(void *arg) {
+    BenchArgs *a = (BenchArgs *)arg;
+    uint64_t s = a->seed;
+    long ops = 0;
+    while (!atomic_load_explicit(a->stop, memory_order_relaxed)) {
+        for (int i = 0; i < 64; i++) {
+            uint64_t r = nextRandom(&s);
+            int key = (int)((r >> 8) % (uint64_t)a->key_range);
+            int pct = (int)(r % 100);
+            if (a->lock_free) {
+                LockFreeSkipList *list = (LockFreeSkipList *)a->list;
+                if (pct < a->read_pct) lfSearch(list, key, NULL);
+                else if (pct & 1) lfInsert(list, key, key);
+                else deleteKey(list, key);
+            } else {
+                LockedSkipList *list = (LockedSkipList *)a->list;
+                if (pct < a->read_pct) lockedSearch(list, key);
+                else if (pct & 1) lockedInsert(list, key, key);
+                else lockedDelete(list, key);
+            }
+            ops++;
+        }
+    }
+    a->ops = ops;
+    return NULL;
+}
+
+static double runBench(void *list, bool lock_free, int read_pct, int key_range, int num_threads, double seconds) {
+    pthread_t threads[32];
+    BenchArgs args[32];
+    _Atomic bool stop;
+    atomic_init(&stop, false);
+    for (int i = 0; i < num_threads; i++) {
+        args[i] = (BenchArgs){ list, lock_free, read_pct, key_range,
+                               0x9E3779B97F4A7C15ull * (uint64_t)(i + 1), &stop, 0 };
+        pthread_create(&threads[i], NULL, benchWorker, &args[i]);
+    }
+    struct timespec ts = { (time_t)seconds, (long)((seconds - (long)seconds) * 1e9) };
+    double t = nowSeconds();
+    nanosleep(&ts, NULL);
+    atomic_store(&stop, true);
+    long ops = 0;
+    for (int i = 0; i < num_threads; i++) {
+        pthread_join(threads[i], NULL);
+        ops += args[i].ops;
+    }
+    return ops / (nowSeconds() - t);
+}
+
+void benchmark(int key_range, double seconds) {
+    printf("=== Benchmark: %d chaves (metade pré-carregada), %.1f s por medição ===\n", key_range, seconds);
+    int read_pcts[] = { 90, 50 };
+    int thread_counts[] = { 1, 2, 4, 8, 16 };
+
+    for (int w = 0; w < 2; w++) {
+        printf("\n%d%% buscas, %d%% inserções, %d%% remoções\n", read_pcts[w],
+               (100 - read_pcts[w]) / 2, (100 - read_pcts[w]) / 2);
+        printf("%-8s %20s %20s %8s\n", "Threads", "Mutex global (op/s)", "Lock-free (op/s)", "Ganho");
+
+        LockFreeSkipList *lf = createLockFreeSkipList();
+        LockedSkipList *locked = lockedCreate();
+        for (int k = 0; k < key_range; k += 2) {
+            lfInsert(lf, k, k);
+            lockedInsert(locked, k, k);
+        }
+        for (int t = 0; t < 5; t++) {
+            double locked_ops = runBench(locked, false, read_pcts[w], key_range, thread_counts[t], seconds);
+            double lf_ops = runBench(lf, true, read_pcts[w], key_range, thread_counts[t], seconds);
+            printf("%-8d %20.0f %20.0f %7.2fx\n", thread_counts[t], locked_ops, lf_ops, lf_ops / locked_ops);
+        }
+        long count;
+        printf("Estrutura válida: %s\n", verifyLockFree(lf, &count) ? "OK" : "FALHA");
+        freeLockFreeSkipList(lf);
+        lockedFree(locked);
+    }
+
+    long retired, freed;
+    epochDrain(&retired, &freed);
+    printf("\nEBR: %ld nós removidos, %ld liberados durante a execução (resto liberado no fim)\n\n",
+           retired, freed);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    int key_range = (argc > 1) ? atoi(argv[1]) : 1000000;
+    double seconds = (argc > 2) ? atof(argv[2]) : 0.3;
+    if (key_range < 100) key_range = 100;
+
+    LockFreeSkipList *list = createLockFreeSkipList();
+
+    printf("=== Inserindo elementos ===\n");
+    int values[] = {3, 6, 7, 9, 12, 19, 17, 26, 21, 25};
+    int n = sizeof(values) / sizeof(values[0]);
+    for (int i = 0; i < n; i++) {
+        lfInsert(list, values[i], values[i] * 10L);
+    }
+    long v = 0;
+    printf("Buscar 19: %s\n", lfSearch(list, 19, &v) ? "Encontrado" : "Não encontrado");
+    printf("Valor de 19: %ld\n", v);
+    printf("Deletar 19: %s\n", deleteKey(list, 19) ? "Deletado" : "Não encontrado");
+    printf("Buscar 19: %s\n\n", lfSearch(list, 19, NULL) ? "Encontrado" : "Não encontrado");
+    freeLockFreeSkipList(list);
+
+    testarConcorrencia();
+    benchmark(key_range, seconds);
+
+    return 0;
+}
@@ -0,0 +1,815 @@
+/**
+ * ============================================================================
+ * SKIP LIST DESENROLADA (UNROLLED) COM ARENA, RANK/SELECT E INTERVALOS
+ * ============================================================================
+ *
+ * Em skip_list.c cada chave é um malloc separado e os ponteiros ficam em
+ * outro malloc (forward): cada salto da busca é uma falta de cache para o
+ * nó e, em seguida, outra para o vetor forward. Esta variante muda o layout:
+ *
+ * NÓS DESENROLADOS:
+ * - Cada nó guarda até NODE_KEYS chaves ordenadas (um bloco contíguo);
+ *   10 milhões de chaves viram ~400 mil nós em vez de 10 milhões
+ * - A skip list indexa os NÓS (pela primeira chave de cada um); dentro do
+ *   nó a posição é achada com busca binária no bloco já carregado
+ * - Nó cheio é dividido ao meio; nó vazio sai da lista
+ *
+ * ENLACES INLINE:
+ * - Os níveis ficam no próprio nó (membro flexível), não em outro malloc
+ * - Cada enlace guarda a primeira chave do nó apontado, então comparar
+ *   "devo avançar?" não toca o próximo nó: só há falta de cache ao avançar
+ *
+ * ARENA:
+ * - Nós vêm de blocos grandes (bump allocation); nós liberados voltam para
+ *   uma lista livre por nível e são reaproveitados
+ *
+ * LARGURAS (SPANS) PARA RANK/SELECT:
+ * - Cada enlace guarda quantas chaves ele pula; somando as larguras na
+ *   descida obtém-se o rank em O(log n), e select(k) desce pelas larguras
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_LEVEL 32
+#define NODE_KEYS 32
+#define ARENA_CHUNK (1 << 20)
+
+// ==================== ESTRUTURAS ====================
+
+typedef struct UnrolledNode UnrolledNode;
+
+typedef struct {
+    UnrolledNode *next;
+    int next_key;           // Primeira chave de 'next' (evita tocá-lo)
+    int span;               // Chaves deste nó até 'next' (exclusive)
+} Link;
+
+struct UnrolledNode {
+    int count;
+    int level;
+    int keys[NODE_KEYS];
+    Link links[];           // 'level' enlaces, alocados junto com o nó
+};
+
+typedef struct ArenaChunk {
+    struct ArenaChunk *next;
+    size_t used;
+    char data[];
+} ArenaChunk;
+
+typedef struct {
+    ArenaChunk *chunks;
+    UnrolledNode *free_lists[MAX_LEVEL + 1];    // Nós liberados, por nível
+    size_t bytes;
+} Arena;
+
+typedef struct {
+    UnrolledNode *header;   // Sentinela sem chaves, MAX_LEVEL níveis
+    int level;              // Níveis em uso
+    long size;              // Total de chaves
+    long nodes;
+    uint64_t rng;
+    Arena arena;
+} UnrolledSkipList;
+
+// ==================== ARENA ====================
+
+static size_t nodeSize(int level) {
+    return sizeof(UnrolledNode) + (size_t)level * sizeof(Link);
+}
+
+// Função para alocar um nó da arena (reaproveita nós liberados do mesmo nível)
+static UnrolledNode* arenaAlloc(Arena *arena, int level) {
+    UnrolledNode *node = arena->free_lists[level];
+    if (node != NULL) {
+        arena->free_lists[level] = node->links[0].next;
+        return node;
+    }
+    size_t size = (nodeSize(level) + 15) & ~(size_t)15;
+    if (arena->chunks == NULL || arena->chunks->used + size > ARENA_CHUNK) {
+        ArenaChunk *chunk = (ArenaChunk *)malloc(sizeof(ArenaChunk) + ARENA_CHUNK);
+        if (chunk == NULL) {
+            fprintf(stderr, "Erro ao alocar bloco da arena\n");
+            exit(1);
+        }
+        chunk->next = arena->chunks;
+        chunk->used = 0;
+        arena->chunks = chunk;
+        arena->bytes += sizeof(ArenaChunk) + ARENA_CHUNK;
+    }
+    node = (UnrolledNode *)(arena->chunks->data + arena->chunks->used);
+    arena->chunks->used += size;
+    return node;
+}
+
+static void arenaRelease(Arena *arena, UnrolledNode *node) {
+    node->links[0].next = arena->free_lists[node->level];
+    arena->free_lists[node->level] = node;
+}
+
+static void arenaFree(Arena *arena) {
+    ArenaChunk *chunk = arena->chunks;
+    while (chunk != NULL) {
+        ArenaChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+}
+
+// ==================== SKIP LIST ====================
+
+// Função para gerar nível aleatório (p = 1/2) com xorshift
+static int randomLevel(UnrolledSkipList *list) {
+    list->rng ^= list->rng << 13;
+    list->rng ^= list->rng >> 7;
+    list->rng ^= list->rng << 17;
+    return 1 + __builtin_ctzll(list->rng | (1ull << (MAX_LEVEL - 1)));
+}
+
+static UnrolledNode* createNode(UnrolledSkipList *list, int level) {
+    UnrolledNode *node = arenaAlloc(&list->arena, level);
+    node->count = 0;
+    node->level = level;
+    for (int i = 0; i < level; i++) {
+        node->links[i].next = NULL;
+        node->links[i].next_key = 0;
+        node->links[i].span = 0;
+    }
+    list->nodes++;
+    return node;
+}
+
+// Função para criar uma Skip List desenrolada vazia
+UnrolledSkipList* createUnrolledSkipList() {
+    UnrolledSkipList *list = (UnrolledSkipList *)calloc(1, sizeof(UnrolledSkipList));
+    list->rng = 0x9E3779B97F4A7C15ull;
+    list->header = createNode(list, MAX_LEVEL);
+    list->nodes = 0;
+    list->level = 1;
+    return list;
+}
+
+/**
+ * Descida: update[i] = último nó no nível i cuja primeira chave é <= key
+ * (ou < key se 'strict'); rank[i] = número de chaves antes de update[i]
+ */
+static void descend(UnrolledSkipList *list, int key, bool strict,
+                    UnrolledNode **update, long *rank) {
+    UnrolledNode *x = list->header;
+    long pos = 0;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->links[i].next != NULL &&
+               (strict ? x->links[i].next_key < key : x->links[i].next_key <= key)) {
+            pos += x->links[i].span;
+            x = x->links[i].next;
+        }
+        update[i] = x;
+        rank[i] = pos;
+    }
+}
+
+/**
+ * Divide o nó t ao meio; update/rank descrevem os predecessores de t
+ * (em cada nível, o último nó <= t, possivelmente o próprio t)
+ */
+static void splitNode(UnrolledSkipList *list, UnrolledNode *t, UnrolledNode **update, long *rank) {
+    int level = randomLevel(list);
+    UnrolledNode *r = createNode(list, level);
+    int half = t->count / 2;
+    r->count = t->count - half;
+    memcpy(r->keys, &t->keys[half], r->count * sizeof(int));
+    t->count = half;
+
+    if (level > list->level) {
+        for (int i = list->level; i < level; i++) {
+            update[i] = list->header;
+            rank[i] = 0;
+            list->header->links[i].next = NULL;
+            list->header->links[i].span = (int)list->size;
+        }
+        list->level = level;
+    }
+
+    long rank_r = rank[0] + half;       // Chaves antes de r (update[0] == t)
+    for (int i = 0; i < level; i++) {
+        Link *prev = &update[i]->links[i];
+        r->links[i].next = prev->next;
+        r->links[i].next_key = prev->next_key;
+        r->links[i].span = prev->span - (int)(rank_r - rank[i]);
+        prev->next = r;
+        prev->next_key = r->keys[0];
+        prev->span = (int)(rank_r - rank[i]);
+    }
+    // Acima do nível de r nada muda: as mesmas chaves continuam no intervalo
+}
+
+/**
+ * Nos casos em que a chave é menor que todas, update[] aponta para o header;
+ * onde o header aponta direto para o primeiro nó, quem cobre esse nó é ele
+ */
+static UnrolledNode* targetNode(UnrolledSkipList *list, UnrolledNode **update, long *rank) {
+    if (update[0] != list->header) return update[0];
+    UnrolledNode *first = list->header->links[0].next;
+    if (first == NULL) return NULL;
+    for (int i = 0; i < list->level; i++) {
+        if (list->header->links[i].next == first) {
+            update[i] = first;
+            rank[i] = 0;
+        }
+    }
+    return first;
+}
+
+static int lowerBound(const int *keys, int n, int key) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (keys[mid] < key) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+// Função para inserir uma chave; retorna false se já existe
+bool unrolledInsert(UnrolledSkipList *list, int key) {
+    UnrolledNode *update[MAX_LEVEL];
+    long rank[MAX_LEVEL];
+
+    while (true) {
+        descend(list, key, false, update, rank);
+        UnrolledNode *t = targetNode(list, update, rank);
+
+        if (t == NULL) {
+            // Lista vazia: primeiro nó
+            int level = randomLevel(list);
+            t = createNode(list, level);
+            t->keys[0] = key;
+            t->count = 1;
+            if (level > list->level) list->level = level;
+            for (int i = 0; i < list->level; i++) {
+                Link *head = &list->header->links[i];
+                if (i < level) {
+                    head->next = t;
+                    head->next_key = key;
+                    head->span = 0;
+                    t->links[i].span = 1;
+                } else {
+                    head->next = NULL;
+                    head->span = 1;
+                }
+            }
+            list->size = 1;
+            return true;
+        }
+
+        int pos = lowerBound(t->keys, t->count, key);
+        if (pos < t->count && t->keys[pos] == key) return false;
+
+        if (t->count == NODE_KEYS) {
+            splitNode(list, t, update, rank);
+            continue;               // Refaz a descida: a chave pode ir para o novo nó
+        }
+
+        memmove(&t->keys[pos + 1], &t->keys[pos], (t->count - pos) * sizeof(int));
+        t->keys[pos] = key;
+        t->count++;
+        list->size++;
+        for (int i = 0; i < list->level; i++) {
+            update[i]->links[i].span++;
+        }
+        if (pos == 0) {
+            // Nova primeira chave: só acontece no primeiro nó (apontado pelo header)
+            for (int i = 0; i < list->level; i++) {
+                if (list->header->links[i].next == t) list->header->links[i].next_key = key;
+            }
+        }
+        return true;
+    }
+}
+
+// Função para buscar uma chave
+bool unrolledSearch(UnrolledSkipList *list, int key) {
+    UnrolledNode *x = list->header;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->links[i].next != NULL && x->links[i].next_key <= key) {
+            x = x->links[i].next;
+        }
+    }
+    if (x == list->header) return false;
+    int pos = lowerBound(x->keys, x->count, key);
+    return pos < x->count && x->keys[pos] == key;
+}
+
+// Função para deletar uma chave; nós vazios saem da lista
+bool unrolledDelete(UnrolledSkipList *list, int key) {
+    UnrolledNode *update[MAX_LEVEL];
+    long rank[MAX_LEVEL];
+    descend(list, key, true, update, rank);
+
+    // A chave está em update[0] (não é a primeira) ou é a primeira do seguinte
+    UnrolledNode *t = update[0];
+    int pos = (t == list->header) ? 0 : lowerBound(t->keys, t->count, key);
+    if (t == list->header || pos == t->count) {
+        t = update[0]->links[0].next;
+        pos = 0;
+        if (t == NULL || t->keys[0] != key) return false;
+    } else if (t->keys[pos] != key) {
+        return false;
+    }
+
+    memmove(&t->keys[pos], &t->keys[pos + 1], (t->count - pos - 1) * sizeof(int));
+    t->count--;
+    list->size--;
+
+    for (int i = 0; i < list->level; i++) {
+        // Quem cobre t no nível i: o próprio t, se update[i] aponta para ele
+        if (update[i]->links[i].next == t) {
+            t->links[i].span--;
+        } else {
+            update[i]->links[i].span--;
+        }
+    }
+
+    if (t->count == 0) {
+        // pos == 0 e t era o nó seguinte: desliga t
+        for (int i = 0; i < t->level; i++) {
+            Link *prev = &update[i]->links[i];
+            prev->span += t->links[i].span;
+            prev->next = t->links[i].next;
+            prev->next_key = t->links[i].next_key;
+        }
+        arenaRelease(&list->arena, t);
+        list->nodes--;
+        while (list->level > 1 && list->header->links[list->level - 1].next == NULL) {
+            list->level--;
+        }
+    } else if (pos == 0) {
+        for (int i = 0; i < t->level; i++) {
+            update[i]->links[i].next_key = t->keys[0];
+        }
+    }
+    return true;
+}
+
+// Função para calcular o rank: quantas chaves são menores que 'key'
+long unrolledRank(UnrolledSkipList *list, int key) {
+    UnrolledNode *update[MAX_LEVEL];
+    long rank[MAX_LEVEL];
+    descend(list, key, true, update, rank);
+    if (update[0] == list->header) return 0;
+    return rank[0] + lowerBound(update[0]->keys, update[0]->count, key);
+}
+
+// Função select: k-ésima menor chave (k a partir de 0)
+bool unrolledSelect(UnrolledSkipList *list, long k, int *key) {
+    if (k < 0 || k >= list->size) return false;
+    UnrolledNode *x = list->header;
+    long pos = 0;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->links[i].next != NULL && pos + x->links[i].span <= k) {
+            pos += x->links[i].span;
+            x = x->links[i].next;
+        }
+    }
+    *key = x->keys[k - pos];
+    return true;
+}
+
+// ==================== ITERAÇÃO POR INTERVALO ====================
+
+typedef struct {
+    UnrolledNode *node;
+    int pos;
+} UnrolledIterator;
+
+// Função para posicionar um iterador na primeira chave >= key
+UnrolledIterator unrolledSeek(UnrolledSkipList *list, int key) {
+    UnrolledNode *x = list->header;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->links[i].next != NULL && x->links[i].next_key <= key) {
+            x = x->links[i].next;
+        }
+    }
+    UnrolledIterator it = { x, (x == list->header) ? 0 : lowerBound(x->keys, x->count, key) };
+    if (it.pos == it.node->count) {
+        it.node = it.node->links[0].next;
+        it.pos = 0;
+    }
+    return it;
+}
+
+static inline bool unrolledIterValid(const UnrolledIterator *it) {
+    return it->node != NULL;
+}
+
+static inline int unrolledIterKey(const UnrolledIterator *it) {
+    return it->node->keys[it->pos];
+}
+
+static inline void unrolledIterNext(UnrolledIterator *it) {
+    if (++it->pos == it->node->count) {
+        it->node = it->node->links[0].next;
+        it->pos = 0;
+    }
+}
+
+// Função para somar as chaves em [lo, hi]
+long long unrolledRangeSum(UnrolledSkipList *list, int lo, int hi, long *count) {
+    long long sum = 0;
+    *count = 0;
+    for (UnrolledIterator it = unrolledSeek(list, lo);
+         unrolledIterValid(&it) && unrolledIterKey(&it) <= hi; unrolledIterNext(&it)) {
+        sum += unrolledIterKey(&it);
+        (*count)++;
+    }
+    return sum;
+}
+
+// Função para liberar memória
+void freeUnrolledSkipList(UnrolledSkipList *list) {
+    arenaFree(&list->arena);
+    free(list);
+}
+
+// Função para verificar ordenação, larguras e primeiras chaves dos enlaces
+bool verifyUnrolled(UnrolledSkipList *list) {
+    // Prefixo (chaves antes) de cada nó, percorrendo o nível 0
+    long total = 0;
+    int prev = 0;
+    bool first = true;
+    for (UnrolledNode *x = list->header->links[0].next; x != NULL; x = x->links[0].next) {
+        if (x->count <= 0 || x->count > NODE_KEYS) return false;
+        for (int j = 0; j < x->count; j++) {
+            if (!first && x->keys[j] <= prev) return false;
+            prev = x->keys[j];
+            first = false;
+        }
+        total += x->count;
+    }
+    if (total != list->size) return false;
+
+    for (int i = 0; i < list->level; i++) {
+        UnrolledNode *x = list->header;
+        long before = 0;
+        while (x != NULL) {
+            // Soma as chaves de x até o próximo nó do nível i
+            long span = 0;
+            UnrolledNode *y = x;
+            do {
+                span += (y == list->header) ? 0 : y->count;
+                y = y->links[0].next;
+            } while (y != NULL && y != x->links[i].next);
+            if (y != x->links[i].next || span != x->links[i].span) return false;
+            if (y != NULL && x->links[i].next_key != y->keys[0]) return false;
+            before += span;
+            x = y;
+        }
+        if (before != list->size) return false;
+    }
+    return true;
+}
+
+// ==================== BASES DE COMPARAÇÃO ====================
+
+// Skip list de skip_list.c (sem os printf)
+typedef struct SeqNode {
+    int key;
+    struct SeqNode **forward;
+} SeqNode;
+
+typedef struct {
+    int level;
+    SeqNode *header;
+} SeqSkipList;
+
+static SeqNode* seqCreateNode(int key, int level) {
+    SeqNode *node = (SeqNode *)malloc(sizeof(SeqNode));
+    node->key = key;
+    node->forward = (SeqNode **)calloc(level + 1, sizeof(SeqNode *));
+    return node;
+}
+
+static int seqRandomLevel() {
+    int level = 0;
+    while ((rand() / (double)RAND_MAX) < 0.5 && level < 16) {
+        level++;
+    }
+    return level;
+}
+
+static void seqInsert(SeqSkipList *list, int key) {
+    SeqNode *update[17];
+    SeqNode *current = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (current->forward[i] != NULL && current->forward[i]->key < key) {
+            current = current->forward[i];
+        }
+        update[i] = current;
+    }
+    current = current->forward[0];
+    if (current == NULL || current->key != key) {
+        int new_level = seqRandomLevel();
+        for (int i = list->level + 1; i <= new_level; i++) update[i] = list->header;
+        if (new_level > list->level) list->level = new_level;
+        SeqNode *node = seqCreateNode(key, new_level);
+        for (int i = 0; i <= new_level; i++) {
+            node->forward[i] = update[i]->forward[i];
+            update[i]->forward[i] = node;
+        }
+    }
+}
+
+static bool seqSearch(SeqSkipList *list, int key) {
+    SeqNode *current = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (current->forward[i] != NULL && current->forward[i]->key < key) {
+            current = current->forward[i];
+        }
+    }
+    current = current->forward[0];
+    return current != NULL && current->key == key;
+}
+
+static long long seqRangeSum(SeqSkipList *list, int lo, int hi) {
+    SeqNode *current = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (current->forward[i] != NULL && current->forward[i]->key < lo) {
+            current = current->forward[i];
+        }
+    }
+    long long sum = 0;
+    for (current = current->forward[0]; current != NULL && current->key <= hi; current = current->forward[0]) {
+        sum += current->key;
+    }
+    return sum;
+}
+
+static void seqFree(SeqSkipList *list) {
+    SeqNode *node = list->header;
+    while (node != NULL) {
+        SeqNode *next = node->forward[0];
+        free(node->forward);
+        free(node);
+        node = next;
+    }
+}
+
+// AVL compacta (mesmo algoritmo de avl_tree.c)
+typedef struct AVLNode {
+    int key, height;
+    struct AVLNode *left, *right;
+} AVLNode;
+
+static int avlHeight(AVLNode *n) { return n ? n->height : 0; }
+static void avlUpdate(AVLNode *n) {
+    int hl = avlHeight(n->left), hr = avlHeight(n->right);
+    n->height = 1 + (hl > hr ? hl : hr);
+}
+static AVLNode* avlRotateRight(AVLNode *y) {
+    AVLNode *x = y->left; y->left = x->right; x->right = y;
+    avlUpdate(y); avlUpdate(x); return x;
+}
+static AVLNode* avlRotateLeft(AVLNode *x) {
+    AVLNode *y = x->right; x->right = y->left; y->left = x;
+    avlUpdate(x); avlUpdate(y); return y;
+}
+static AVLNode* avlInsert(AVLNode *node, int key) {
+    if (node == NULL) {
+        AVLNode *n = (AVLNode *)malloc(sizeof(AVLNode));
+        n->key = key; n->height = 1; n->left = n->right = NULL;
+        return n;
+    }
+    if (key < node->key) node->left = avlInsert(node->left, key);
+    else if (key > node->key) node->right = avlInsert(node->right, key);
+    else return node;
+    avlUpdate(node);
+    int bal = avlHeight(node->left) - avlHeight(node->right);
+    if (bal > 1 && key < node->left->key) return avlRotateRight(node);
+    if (bal < -1 && key > node->right->key) return avlRotateLeft(node);
+    if (bal > 1) { node->left = avlRotateLeft(node->left); return avlRotateRight(node); }
+    if (bal < -1) { node->right = avlRotateRight(node->right); return avlRotateLeft(node); }
+    return node;
+}
+static bool avlSearch(AVLNode *node, int key) {
+    while (node != NULL && node->key != key) node = key < node->key ? node->left : node->right;
+    return node != NULL;
+}
+static long long avlRangeSum(AVLNode *node, int lo, int hi) {
+    if (node == NULL) return 0;
+    long long s = 0;
+    if (lo < node->key) s += avlRangeSum(node->left, lo, hi);
+    if (node->key >= lo && node->key <= hi) s += node->key;
+    if (hi > node->key) s += avlRangeSum(node->right, lo, hi);
+    return s;
+}
+static void avlFree(AVLNode *n) {
+    if (n) { avlFree(n->left); avlFree(n->right); free(n); }
+}
+
+// ==================== TESTES ====================
+
+static uint32_t nextRandom(uint32_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+static int compareInts(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// Compara com um vetor ordenado de referência após inserções e remoções aleatórias
+void testarContraReferencia() {
+    printf("=== Teste contra vetor ordenado de referência ===\n");
+    UnrolledSkipList *list = createUnrolledSkipList();
+    int range = 20000;
+    char *present = (char *)calloc(range, 1);
+    uint32_t s = 12345;
+    bool ok = true;
+
+    for (int i = 0; i < 200000 && ok; i++) {
+        int key = (int)(nextRandom(&s) % range);
+        if (nextRandom(&s) % 3 == 0) {
+            ok = unrolledDelete(list, key) == (present[key] == 1);
+            present[key] = 0;
+        } else {
+            ok = unrolledInsert(list, key) == (present[key] == 0);
+            present[key] = 1;
+        }
+        if (i % 20000 == 0) ok = ok && verifyUnrolled(list);
+    }
+
+    int *sorted = (int *)malloc(range * sizeof(int));
+    int n = 0;
+    for (int k = 0; k < range; k++) {
+        if (present[k]) sorted[n++] = k;
+    }
+    ok = ok && verifyUnrolled(list) && list->size == n;
+    for (int k = 0; k < range && ok; k++) {
+        ok = unrolledSearch(list, k) == (present[k] == 1);
+        // rank(k) = quantas chaves presentes são menores que k
+        int *p = (int *)bsearch(&k, sorted, n, sizeof(int), compareInts);
+        if (p != NULL) ok = ok && unrolledRank(list, k) == p - sorted;
+    }
+    for (int i = 0; i < n && ok; i++) {
+        int key;
+        ok = unrolledSelect(list, i, &key) && key == sorted[i];
+    }
+    long count;
+    long long sum = unrolledRangeSum(list, 5000, 7000, &count), expected = 0;
+    long expected_count = 0;
+    for (int k = 5000; k <= 7000; k++) {
+        if (present[k]) { expected += k; expected_count++; }
+    }
+    ok = ok && sum == expected && count == expected_count;
+
+    printf("%d chaves restantes em %ld nós (%.1f chaves/nó)\n", n, list->nodes, (double)n / list->nodes);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    free(present);
+    free(sorted);
+    freeUnrolledSkipList(list);
+}
+
+// ==================== BENCHMARK ====================
+
+static int rangeEnd(int lo, int width) {
+    return lo > 0x7fffffff - width ? 0x7fffffff : lo + width;
+}
+
+static double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+void benchmark(int n) {
+    printf("=== Benchmark com %d chaves aleatórias ===\n\n", n);
+    int lookups = 1000000;
+    int ranges = 10000;
+    int width = 100 * (int)(0x7fffffff / n);     // ~100 chaves por intervalo
+
+    int *keys = (int *)malloc(n * sizeof(int));
+    uint32_t s = 2463534242u;
+    for (int i = 0; i < n; i++) keys[i] = (int)(nextRandom(&s) & 0x7fffffff);
+
+    clock_t t;
+    double build[3], search[3], range[3];
+    long long checksum[3] = {0, 0, 0};
+
+    // Skip list desenrolada
+    t = clock();
+    UnrolledSkipList *list = createUnrolledSkipList();
+    for (int i = 0; i < n; i++) unrolledInsert(list, keys[i]);
+    build[0] = elapsed(t);
+    t = clock();
+    for (int i = 0; i < lookups; i++) checksum[0] += unrolledSearch(list, keys[(i * 7919L) % n]);
+    search[0] = elapsed(t);
+    t = clock();
+    for (int i = 0; i < ranges; i++) {
+        long c;
+        int lo = keys[(i * 104729L) % n];
+        checksum[0] += unrolledRangeSum(list, lo, rangeEnd(lo, width), &c);
+    }
+    range[0] = elapsed(t);
+    long nodes = list->nodes;
+    double mb_unrolled = list->arena.bytes / (1024.0 * 1024.0);
+
+    t = clock();
+    long long rank_check = 0;
+    for (int i = 0; i < lookups; i++) rank_check += unrolledRank(list, keys[(i * 7919L) % n]);
+    double rank_time = elapsed(t);
+    t = clock();
+    for (int i = 0; i < lookups; i++) {
+        int key;
+        unrolledSelect(list, (i * 7919L) % list->size, &key);
+        rank_check += key;
+    }
+    double select_time = elapsed(t);
+    freeUnrolledSkipList(list);
+
+    // skip_list.c
+    srand(42);
+    t = clock();
+    SeqSkipList seq = { 0, seqCreateNode(-1, 16) };
+    for (int i = 0; i < n; i++) seqInsert(&seq, keys[i]);
+    build[1] = elapsed(t);
+    t = clock();
+    for (int i = 0; i < lookups; i++) checksum[1] += seqSearch(&seq, keys[(i * 7919L) % n]);
+    search[1] = elapsed(t);
+    t = clock();
+    for (int i = 0; i < ranges; i++) {
+        int lo = keys[(i * 104729L) % n];
+        checksum[1] += seqRangeSum(&seq, lo, rangeEnd(lo, width));
+    }
+    range[1] = elapsed(t);
+    seqFree(&seq);
+
+    // AVL
+    t = clock();
+    AVLNode *avl = NULL;
+    for (int i = 0; i < n; i++) avl = avlInsert(avl, keys[i]);
+    build[2] = elapsed(t);
+    t = clock();
+    for (int i = 0; i < lookups; i++) checksum[2] += avlSearch(avl, keys[(i * 7919L) % n]);
+    search[2] = elapsed(t);
+    t = clock();
+    for (int i = 0; i < ranges; i++) {
+        int lo = keys[(i * 104729L) % n];
+        checksum[2] += avlRangeSum(avl, lo, rangeEnd(lo, width));
+    }
+    range[2] = elapsed(t);
+    avlFree(avl);
+
+    const char *names[] = { "Skip list desenrolada", "skip_list.c", "AVL Tree" };
+    printf("%-22s %12s %14s %16s\n", "Estrutura", "Construção", "1M buscas", "10k intervalos");
+    for (int i = 0; i < 3; i++) {
+        printf("%-22s %10.2f s %12.2f s %14.3f s\n", names[i], build[i], search[i], range[i]);
+    }
+    printf("\nSkip list desenrolada: %ld nós (%.1f chaves/nó), arena de %.0f MB\n",
+           nodes, (double)n / nodes, mb_unrolled);
+    printf("1M rank: %.2f s | 1M select: %.2f s (sem equivalente em skip_list.c nem na AVL)\n",
+           rank_time, select_time);
+    printf("Resultados iguais nas 3 estruturas: %s\n\n",
+           checksum[0] == checksum[1] && checksum[1] == checksum[2] ? "OK" : "FALHA");
+    (void)rank_check;
+    free(keys);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    if (n < 1000) n = 1000;
+
+    UnrolledSkipList *list = createUnrolledSkipList();
+    printf("=== Inserindo elementos ===\n");
+    int values[] = {3, 6, 7, 9, 12, 19, 17, 26, 21, 25};
+    for (int i = 0; i < 10; i++) {
+        unrolledInsert(list, values[i]);
+    }
+    printf("Buscar 19: %s\n", unrolledSearch(list, 19) ? "Encontrado" : "Não encontrado");
+    printf("Rank de 19 (chaves menores): %ld\n", unrolledRank(list, 19));
+    int key;
+    unrolledSelect(list, 4, &key);
+    printf("Select(4) (5ª menor): %d\n", key);
+    printf("Chaves em [7, 21]: ");
+    for (UnrolledIterator it = unrolledSeek(list, 7);
+         unrolledIterValid(&it) && unrolledIterKey(&it) <= 21; unrolledIterNext(&it)) {
+        printf("%d ", unrolledIterKey(&it));
+    }
+    printf("\nDeletar 19: %s\n\n", unrolledDelete(list, 19) ? "Deletado" : "Não encontrado");
+    freeUnrolledSkipList(list);
+
+    testarContraReferencia();
+    benchmark(n);
+
+    return 0;
+}
@@ -0,0 +1,643 @@
+/**
+ * ============================================================================
+ * SEGMENT TREE ITERATIVA (BOTTOM-UP) - MONOIDES GENÉRICOS E LAZY PROPAGATION
+ * ============================================================================
+ *
+ * segment_tree.c é recursiva (queryHelper/updateHelper), usa 4n posições,
+ * só faz atualização de ponto e é fixa em soma de int. Esta versão:
+ *
+ * ÁRVORE BOTTOM-UP EM POTÊNCIA DE 2:
+ * - size = menor potência de 2 >= n; folhas em tree[size .. 2*size),
+ *   nó k tem filhos 2k e 2k+1, raiz em tree[1] (2*size < 4n posições)
+ *
+ *                       [1]
+ *              [2]               [3]
+ *          [4]     [5]       [6]     [7]
+ *         a0 a1   a2 a3     a4 a5   a6 a7     <- tree[8..15]
+ *
+ * - Atualização: escreve a folha e sobe (i >>= 1) recombinando os pares
+ * - Consulta [l, r]: dois índices sobem juntos; quando l é filho direito
+ *   ou r é filho esquerdo, o nó entra no resultado. Sem recursão e sem
+ *   visitar nós fora do intervalo
+ * - O resultado da esquerda e o da direita são acumulados separadamente,
+ *   então a operação só precisa ser ASSOCIATIVA (não comutativa)
+ *
+ * MONOIDES POR MACRO:
+ * - DEFINE_SEGMENT_TREE(Nome, Tipo, OP, IDENTIDADE) gera struct e funções
+ *   especializadas (soma, mínimo, máximo, mdc); o compilador faz inline
+ *   da operação, como um template
+ *
+ * LAZY PROPAGATION ITERATIVA:
+ * - Soma e mínimo com atualizações de intervalo "somar v" e "atribuir v"
+ * - Antes de tocar um intervalo, as marcas pendentes dos ancestrais das
+ *   duas bordas são empurradas (de cima para baixo); depois, só esses
+ *   ancestrais são recalculados (de baixo para cima)
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <time.h>
+
+// ==================== MONOIDES ====================
+
+// OP pode avaliar os argumentos mais de uma vez: passe só valores sem efeito colateral
+#define OP_SUM(a, b) ((a) + (b))
+#define OP_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define OP_MAX(a, b) ((a) > (b) ? (a) : (b))
+#define OP_GCD(a, b) gcd((a), (b))
+
+// Função para calcular o mdc (identidade: 0)
+static inline int gcd(int a, int b) {
+    while (b != 0) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a < 0 ? -a : a;
+}
+
+// Função para obter a menor potência de 2 >= n
+static int nextPowerOfTwo(int n) {
+    int size = 1;
+    while (size < n) size <<= 1;
+    return size;
+}
+
+// ==================== SEGMENT TREE GENÉRICA ====================
+
+/**
+ * Gera NAME, NAME##Create, NAME##Update, NAME##Query, NAME##Get e NAME##Free
+ * para o tipo T com operação associativa OP e elemento neutro IDENTITY
+ */
+#define DEFINE_SEGMENT_TREE(NAME, T, OP, IDENTITY)                              \
+typedef struct {                                                                \
+    T *tree;                                                                    \
+    int n;                                                                      \
+    int size;                                                                   \
+} NAME;                                                                         \
+                                                                                \
+/* Função para criar a árvore a partir de um array, em O(n) */                  \
+static NAME* NAME##Create(const T *arr, int n) {                                \
+    NAME *st = (NAME *)malloc(sizeof(NAME));                                    \
+    st->n = n;                                                                  \
+    st->size = nextPowerOfTwo(n);                                               \
+    st->tree = (T *)malloc(sizeof(T) * 2 * st->size);                           \
+    for (int i = 0; i < st->size; i++) {                                        \
+        st->tree[st->size + i] = i < n ? arr[i] : (IDENTITY);                   \
+    }                                                                           \
+    for (int i = st->size - 1; i >= 1; i--) {                                   \
+        st->tree[i] = OP(st->tree[2 * i], st->tree[2 * i + 1]);                 \
+    }                                                                           \
+    return st;                                                                  \
+}                                                                               \
+                                                                                \
+/* Função para atualizar um elemento: escreve a folha e sobe */                 \
+static void NAME##Update(NAME *st, int idx, T val) {                            \
+    int i = idx + st->size;                                                     \
+    st->tree[i] = val;                                                          \
+    for (i >>= 1; i >= 1; i >>= 1) {                                            \
+        st->tree[i] = OP(st->tree[2 * i], st->tree[2 * i + 1]);                 \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+/* Função para consultar [L, R] (inclusive) sem recursão */                     \
+static T NAME##Query(NAME *st, int L, int R) {                                  \
+    T left = (IDENTITY), right = (IDENTITY);                                    \
+    for (int l = L + st->size, r = R + st->size + 1; l < r; l >>= 1, r >>= 1) { \
+        if (l & 1) { T v = st->tree[l++]; left = OP(left, v); }                 \
+        if (r & 1) { T v = st->tree[--r]; right = OP(v, right); }               \
+    }                                                                           \
+    return OP(left, right);                                                     \
+}                                                                               \
+                                                                                \
+static inline T NAME##Get(NAME *st, int idx) {                                       \
+    return st->tree[idx + st->size];                                            \
+}                                                                               \
+                                                                                \
+static void NAME##Free(NAME *st) {                                              \
+    free(st->tree);                                                             \
+    free(st);                                                                   \
+}
+
+DEFINE_SEGMENT_TREE(SumTree, long long, OP_SUM, 0)
+DEFINE_SEGMENT_TREE(IntSumTree, int, OP_SUM, 0)
+DEFINE_SEGMENT_TREE(MinTree, int, OP_MIN, INT_MAX)
+DEFINE_SEGMENT_TREE(MaxTree, int, OP_MAX, INT_MIN)
+DEFINE_SEGMENT_TREE(GcdTree, int, OP_GCD, 0)
+
+// ==================== LAZY PROPAGATION (SOMA/MÍNIMO) ====================
+
+#define NO_ASSIGN LLONG_MIN
+
+typedef struct {
+    long long sum;
+    long long min;
+} LazyValue;
+
+typedef struct {
+    long long assign;           // NO_ASSIGN se não há atribuição pendente
+    long long add;              // Soma pendente (aplicada depois da atribuição)
+} LazyTag;
+
+typedef struct {
+    LazyValue *tree;
+    LazyTag *lazy;              // Só para nós internos (1 .. size-1)
+    int n;
+    int size;
+    int log;
+} LazySegmentTree;
+
+static const LazyValue LAZY_IDENTITY = { 0, LLONG_MAX };
+
+static inline LazyValue combine(LazyValue a, LazyValue b) {
+    LazyValue r = { a.sum + b.sum, a.min < b.min ? a.min : b.min };
+    return r;
+}
+
+// Função para obter quantos elementos reais (< n) o nó k cobre
+static inline int nodeLength(LazySegmentTree *st, int k) {
+    int height = st->log - (31 - __builtin_clz((unsigned)k));
+    long start = ((long)k << height) - st->size;
+    long end = start + (1L << height);
+    if (end > st->n) end = st->n;
+    return end > start ? (int)(end - start) : 0;
+}
+
+// Função para aplicar uma marca a um nó (valor e, se interno, marca pendente)
+static inline void applyTag(LazySegmentTree *st, int k, LazyTag tag) {
+    int len = nodeLength(st, k);
+    if (len == 0) return;                       // Só preenchimento
+    LazyValue *v = &st->tree[k];
+    if (tag.assign != NO_ASSIGN) {
+        v->sum = (tag.assign + tag.add) * len;
+        v->min = tag.assign + tag.add;
+    } else {
+        v->sum += tag.add * len;
+        v->min += tag.add;
+    }
+    if (k < st->size) {
+        LazyTag *t = &st->lazy[k];
+        if (tag.assign != NO_ASSIGN) {
+            *t = tag;                           // Atribuição apaga o pendente
+        } else {
+            t->add += tag.add;
+        }
+    }
+}
+
+// Função para empurrar a marca do nó k para os filhos
+static inline void pushNode(LazySegmentTree *st, int k) {
+    LazyTag *t = &st->lazy[k];
+    if (t->assign == NO_ASSIGN && t->add == 0) return;
+    applyTag(st, 2 * k, *t);
+    applyTag(st, 2 * k + 1, *t);
+    t->assign = NO_ASSIGN;
+    t->add = 0;
+}
+
+static inline void pullNode(LazySegmentTree *st, int k) {
+    st->tree[k] = combine(st->tree[2 * k], st->tree[2 * k + 1]);
+}
+
+// Função para criar a árvore lazy a partir de um array, em O(n)
+LazySegmentTree* createLazySegmentTree(const long long *arr, int n) {
+    LazySegmentTree *st = (LazySegmentTree *)malloc(sizeof(LazySegmentTree));
+    st->n = n;
+    st->size = nextPowerOfTwo(n);
+    st->log = 0;
+    while ((1 << st->log) < st->size) st->log++;
+    st->tree = (LazyValue *)malloc(sizeof(LazyValue) * 2 * st->size);
+    st->lazy = (LazyTag *)malloc(sizeof(LazyTag) * st->size);
+    for (int i = 0; i < st->size; i++) {
+        if (i < n) {
+            st->tree[st->size + i].sum = arr[i];
+            st->tree[st->size + i].min = arr[i];
+        } else {
+            st->tree[st->size + i] = LAZY_IDENTITY;
+        }
+        st->lazy[i].assign = NO_ASSIGN;
+        st->lazy[i].add = 0;
+    }
+    for (int i = st->size - 1; i >= 1; i--) pullNode(st, i);
+    return st;
+}
+
+// Função para empurrar as marcas dos ancestrais das bordas de [l, r)
+static void pushBorders(LazySegmentTree *st, int l, int r) {
+    for (int i = st->log; i >= 1; i--) {
+        if (((l >> i) << i) != l) pushNode(st, l >> i);
+        if (((r >> i) << i) != r) pushNode(st, (r - 1) >> i);
+    }
+}
+
+// Função para aplicar uma marca em [L, R] (inclusive)
+static void applyRange(LazySegmentTree *st, int L, int R, LazyTag tag) {
+    int l = L + st->size, r = R + st->size + 1;
+    pushBorders(st, l, r);
+
+    for (int a = l, b = r; a < b; a >>= 1, b >>= 1) {
+        if (a & 1) applyTag(st, a++, tag);
+        if (b & 1) applyTag(st, --b, tag);
+    }
+
+    // Recalcular só os ancestrais das bordas, de baixo para cima
+    for (int i = 1; i <= st->log; i++) {
+        if (((l >> i) << i) != l) pullNode(st, l >> i);
+        if (((r >> i) << i) != r) pullNode(st, (r - 1) >> i);
+    }
+}
+
+// Função para somar v a todos os elementos de [L, R]
+void lazyRangeAdd(LazySegmentTree *st, int L, int R, long long v) {
+    LazyTag tag = { NO_ASSIGN, v };
+    applyRange(st, L, R, tag);
+}
+
+// Função para atribuir v a todos os elementos de [L, R]
+void lazyRangeAssign(LazySegmentTree *st, int L, int R, long long v) {
+    LazyTag tag = { v, 0 };
+    applyRange(st, L, R, tag);
+}
+
+// Função para consultar soma e mínimo de [L, R]
+LazyValue lazyQuery(LazySegmentTree *st, int L, int R) {
+    int l = L + st->size, r = R + st->size + 1;
+    pushBorders(st, l, r);
+    LazyValue left = LAZY_IDENTITY, right = LAZY_IDENTITY;
+    for (; l < r; l >>= 1, r >>= 1) {
+        if (l & 1) left = combine(left, st->tree[l++]);
+        if (r & 1) right = combine(st->tree[--r], right);
+    }
+    return combine(left, right);
+}
+
+void freeLazySegmentTree(LazySegmentTree *st) {
+    free(st->tree);
+    free(st->lazy);
+    free(st);
+}
+
+// ==================== VERSÕES RECURSIVAS (segment_tree.c) ====================
+
+// Mesmo algoritmo de segment_tree.c: recursão sobre 4n posições, soma de int
+typedef struct {
+    int *tree;
+    int n;
+} RecursiveTree;
+
+static void recBuild(RecursiveTree *st, const int *arr, int node, int start, int end) {
+    if (start == end) {
+        st->tree[node] = arr[start];
+        return;
+    }
+    int mid = (start + end) / 2;
+    recBuild(st, arr, 2 * node + 1, start, mid);
+    recBuild(st, arr, 2 * node + 2, mid + 1, end);
+    st->tree[node] = st->tree[2 * node + 1] + st->tree[2 * node + 2];
+}
+
+static int recQuery(RecursiveTree *st, int node, int start, int end, int L, int R) {
+    if (R < start || L > end) return 0;
+    if (L <= start && end <= R) return st->tree[node];
+    int mid = (start + end) / 2;
+    return recQuery(st, 2 * node + 1, start, mid, L, R) + recQuery(st, 2 * node + 2, mid + 1, end, L, R);
+}
+
+static void recUpdate(RecursiveTree *st, int node, int start, int end, int idx, int val) {
+    if (start == end) {
+        st->tree[node] = val;
+        return;
+    }
+    int mid = (start + end) / 2;
+    if (idx <= mid) recUpdate(st, 2 * node + 1, start, mid, idx, val);
+    else recUpdate(st, 2 * node + 2, mid + 1, end, idx, val);
+    st->tree[node] = st->tree[2 * node + 1] + st->tree[2 * node + 2];
+}
+
+// Lazy recursiva do README (range add + range sum)
+typedef struct {
+    long long *tree;
+    long long *lazy;
+    int n;
+} RecursiveLazyTree;
+
+static void recLazyBuild(RecursiveLazyTree *st, const long long *arr, int node, int start, int end) {
+    st->lazy[node] = 0;
+    if (start == end) {
+        st->tree[node] = arr[start];
+        return;
+    }
+    int mid = (start + end) / 2;
+    recLazyBuild(st, arr, 2 * node + 1, start, mid);
+    recLazyBuild(st, arr, 2 * node + 2, mid + 1, end);
+    st->tree[node] = st->tree[2 * node + 1] + st->tree[2 * node + 2];
+}
+
+static void recPushDown(RecursiveLazyTree *st, int node, int start, int end) {
+    if (st->lazy[node] != 0) {
+        int mid = (start + end) / 2;
+        st->tree[2 * node + 1] += st->lazy[node] * (mid - start + 1);
+        st->tree[2 * node + 2] += st->lazy[node] * (end - mid);
+        st->lazy[2 * node + 1] += st->lazy[node];
+        st->lazy[2 * node + 2] += st->lazy[node];
+        st->lazy[node] = 0;
+    }
+}
+
+static void recRangeAdd(RecursiveLazyTree *st, int node, int start, int end, int l, int r, long long val) {
+    if (r < start || end < l) return;
+    if (l <= start && end <= r) {
+        st->tree[node] += val * (end - start + 1);
+        st->lazy[node] += val;
+        return;
+    }
+    recPushDown(st, node, start, end);
+    int mid = (start + end) / 2;
+    recRangeAdd(st, 2 * node + 1, start, mid, l, r, val);
+    recRangeAdd(st, 2 * node + 2, mid + 1, end, l, r, val);
+    st->tree[node] = st->tree[2 * node + 1] + st->tree[2 * node + 2];
+}
+
+static long long recLazyQuery(RecursiveLazyTree *st, int node, int start, int end, int l, int r) {
+    if (r < start || end < l) return 0;
+    if (l <= start && end <= r) return st->tree[node];
+    recPushDown(st, node, start, end);
+    int mid = (start + end) / 2;
+    return recLazyQuery(st, 2 * node + 1, start, mid, l, r) + recLazyQuery(st, 2 * node + 2, mid + 1, end, l, r);
+}
+
+// ==================== TESTES ====================
+
+static unsigned int rngState = 2463534242u;
+
+static unsigned int nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+// Função para exibir o array
+void displayArray(int arr[], int n) {
+    printf("[");
+    for (int i = 0; i < n; i++) {
+        printf("%d", arr[i]);
+        if (i < n - 1) printf(", ");
+    }
+    printf("]\n");
+}
+
+void testarMonoides() {
+    printf("=== TESTE DOS MONOIDES ===\n\n");
+
+    int arr[] = {12, 18, 6, 30, 9, 15};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    long long arr64[6];
+    for (int i = 0; i < n; i++) arr64[i] = arr[i];
+
+    SumTree *sum = SumTreeCreate(arr64, n);
+    MinTree *mn = MinTreeCreate(arr, n);
+    MaxTree *mx = MaxTreeCreate(arr, n);
+    GcdTree *g = GcdTreeCreate(arr, n);
+
+    printf("Array: ");
+    displayArray(arr, n);
+    printf("[1, 4]: soma = %lld, mín = %d, máx = %d, mdc = %d\n",
+           SumTreeQuery(sum, 1, 4), MinTreeQuery(mn, 1, 4), MaxTreeQuery(mx, 1, 4), GcdTreeQuery(g, 1, 4));
+    bool ok = SumTreeQuery(sum, 1, 4) == 63 && MinTreeQuery(mn, 1, 4) == 6 &&
+              MaxTreeQuery(mx, 1, 4) == 30 && GcdTreeQuery(g, 1, 4) == 3;
+
+    // Aleatório contra varredura ingênua
+    enum { N = 1000, OPS = 20000 };
+    int *a = (int *)malloc(N * sizeof(int));
+    long long *a64 = (long long *)malloc(N * sizeof(long long));
+    for (int i = 0; i < N; i++) a64[i] = a[i] = (int)(nextRandom() % 1000) * 6;
+    SumTreeFree(sum); MinTreeFree(mn); MaxTreeFree(mx); GcdTreeFree(g);
+    sum = SumTreeCreate(a64, N); mn = MinTreeCreate(a, N); mx = MaxTreeCreate(a, N); g = GcdTreeCreate(a, N);
+
+    for (int op = 0; op < OPS && ok; op++) {
+        if (nextRandom() % 2 == 0) {
+            int idx = (int)(nextRandom() % N), val = (int)(nextRandom() % 1000) * 6 - 3000;
+            a[idx] = val;
+            SumTreeUpdate(sum, idx, val); MinTreeUpdate(mn, idx, val);
+            MaxTreeUpdate(mx, idx, val); GcdTreeUpdate(g, idx, val);
+        } else {
+            int l = (int)(nextRandom() % N), r = (int)(nextRandom() % N);
+            if (l > r) { int t = l; l = r; r = t; }
+            long long s = 0;
+            int lo = INT_MAX, hi = INT_MIN, d = 0;
+            for (int i = l; i <= r; i++) {
+                s += a[i];
+                if (a[i] < lo) lo = a[i];
+                if (a[i] > hi) hi = a[i];
+                d = gcd(d, a[i]);
+            }
+            ok = SumTreeQuery(sum, l, r) == s && MinTreeQuery(mn, l, r) == lo &&
+                 MaxTreeQuery(mx, l, r) == hi && GcdTreeQuery(g, l, r) == d &&
+                 MinTreeGet(mn, l) == a[l];
+        }
+    }
+    printf("%d operações aleatórias (soma, mín, máx, mdc) conferidas\n", OPS);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+
+    free(a);
+    free(a64);
+    SumTreeFree(sum); MinTreeFree(mn); MaxTreeFree(mx); GcdTreeFree(g);
+}
+
+void testarLazy() {
+    printf("=== TESTE DA LAZY PROPAGATION ===\n\n");
+
+    long long arr[] = {1, 3, 5, 7, 9, 11};
+    LazySegmentTree *st = createLazySegmentTree(arr, 6);
+    lazyRangeAdd(st, 1, 3, 10);                 // 1 13 15 17 9 11
+    LazyValue v1 = lazyQuery(st, 0, 5);
+    lazyRangeAssign(st, 2, 4, 4);               // 1 13 4 4 4 11
+    LazyValue v2 = lazyQuery(st, 1, 4);
+    lazyRangeAdd(st, 0, 2, -2);                 // -1 11 2 4 4 11
+    LazyValue v3 = lazyQuery(st, 0, 3);
+    printf("Somar 10 em [1,3]:     soma[0,5] = %lld\n", v1.sum);
+    printf("Atribuir 4 em [2,4]:   soma[1,4] = %lld, mín[1,4] = %lld\n", v2.sum, v2.min);
+    printf("Somar -2 em [0,2]:     soma[0,3] = %lld, mín[0,3] = %lld\n", v3.sum, v3.min);
+    bool ok = v1.sum == 66 && v2.sum == 25 && v2.min == 4 && v3.sum == 16 && v3.min == -1;
+    freeLazySegmentTree(st);
+
+    // Aleatório contra array ingênuo (n não potência de 2)
+    enum { N = 777, OPS = 30000 };
+    long long *a = (long long *)malloc(N * sizeof(long long));
+    for (int i = 0; i < N; i++) a[i] = (long long)(nextRandom() % 1000);
+    st = createLazySegmentTree(a, N);
+    for (int op = 0; op < OPS && ok; op++) {
+        int l = (int)(nextRandom() % N), r = (int)(nextRandom() % N);
+        if (l > r) { int t = l; l = r; r = t; }
+        long long v = (long long)(nextRandom() % 2001) - 1000;
+        switch (nextRandom() % 3) {
+            case 0:
+                lazyRangeAdd(st, l, r, v);
+                for (int i = l; i <= r; i++) a[i] += v;
+                break;
+            case 1:
+                lazyRangeAssign(st, l, r, v);
+                for (int i = l; i <= r; i++) a[i] = v;
+                break;
+            default: {
+                LazyValue got = lazyQuery(st, l, r);
+                long long s = 0, m = LLONG_MAX;
+                for (int i = l; i <= r; i++) {
+                    s += a[i];
+                    if (a[i] < m) m = a[i];
+                }
+                ok = got.sum == s && got.min == m;
+            }
+        }
+    }
+    printf("%d operações aleatórias (somar, atribuir, consultar) conferidas\n", OPS);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    free(a);
+    freeLazySegmentTree(st);
+}
+
+// ==================== BENCHMARK ====================
+
+void benchmark(int n, int ops) {
+    printf("=== BENCHMARK: %d elementos, %d operações ===\n\n", n, ops);
+
+    int *arr = (int *)malloc(n * sizeof(int));
+    long long *arr64 = (long long *)malloc(n * sizeof(long long));
+    for (int i = 0; i < n; i++) arr64[i] = arr[i] = (int)(nextRandom() % 100);
+    int *qi = (int *)malloc(ops * sizeof(int));
+    int *ql = (int *)malloc(ops * sizeof(int));
+    int *qr = (int *)malloc(ops * sizeof(int));
+    for (int i = 0; i < ops; i++) {
+        qi[i] = (int)(nextRandom() % n);
+        int l = (int)(nextRandom() % n), r = (int)(nextRandom() % n);
+        ql[i] = l < r ? l : r;
+        qr[i] = l < r ? r : l;
+    }
+    volatile long long sink = 0;
+    clock_t start;
+    bool ok = true;
+    // Cada estrutura é liberada antes da próxima rodar (memória "fria" igual
+    // para as duas); uma em cada 1024 respostas é guardada para conferência
+    long long *expected = (long long *)malloc(sizeof(long long) * (ops / 1024 + 1));
+
+    // Atualização de ponto + soma de intervalo (int, como segment_tree.c)
+    start = clock();
+    RecursiveTree rec = { (int *)malloc(sizeof(int) * 4 * (size_t)n), n };
+    recBuild(&rec, arr, 0, 0, n - 1);
+    double rb = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (int i = 0; i < ops; i++) recUpdate(&rec, 0, 0, n - 1, qi[i], i & 63);
+    double ru = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (int i = 0; i < ops; i++) {
+        int got = recQuery(&rec, 0, 0, n - 1, ql[i], qr[i]);
+        if ((i & 1023) == 0) expected[i / 1024] = got;
+        sink += got;
+    }
+    double rq = (double)(clock() - start) / CLOCKS_PER_SEC;
+    free(rec.tree);
+
+    start = clock();
+    IntSumTree *it = IntSumTreeCreate(arr, n);
+    double ib = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (int i = 0; i < ops; i++) IntSumTreeUpdate(it, qi[i], i & 63);
+    double iu = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (int i = 0; i < ops; i++) {
+        int got = IntSumTreeQuery(it, ql[i], qr[i]);
+        if ((i & 1023) == 0) ok = ok && got == expected[i / 1024];
+        sink += got;
+    }
+    double iq = (double)(clock() - start) / CLOCKS_PER_SEC;
+    IntSumTreeFree(it);
+
+    printf("Ponto + soma (int)      %12s %12s %12s %10s\n", "build (s)", "updates (s)", "queries (s)", "memória");
+    printf("  recursiva (4n)        %12.2f %12.2f %12.2f %7.0f MB\n", rb, ru, rq, 4.0 * n * sizeof(int) / 1e6);
+    printf("  iterativa (2*2^k)     %12.2f %12.2f %12.2f %7.0f MB\n\n", ib, iu, iq,
+           2.0 * nextPowerOfTwo(n) * sizeof(int) / 1e6);
+
+    // Soma em intervalo + lazy
+    start = clock();
+    RecursiveLazyTree rl = { (long long *)malloc(sizeof(long long) * 4 * (size_t)n),
+                             (long long *)malloc(sizeof(long long) * 4 * (size_t)n), n };
+    recLazyBuild(&rl, arr64, 0, 0, n - 1);
+    rb = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (int i = 0; i < ops; i++) recRangeAdd(&rl, 0, 0, n - 1, ql[i], qr[i], (i & 7) - 3);
+    ru = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (int i = 0; i < ops; i++) {
+        long long got = recLazyQuery(&rl, 0, 0, n - 1, qi[i] / 2, qi[i]);
+        if ((i & 1023) == 0) expected[i / 1024] = got;
+        sink += got;
+    }
+    rq = (double)(clock() - start) / CLOCKS_PER_SEC;
+    free(rl.tree);
+    free(rl.lazy);
+
+    start = clock();
+    LazySegmentTree *lz = createLazySegmentTree(arr64, n);
+    ib = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (int i = 0; i < ops; i++) lazyRangeAdd(lz, ql[i], qr[i], (i & 7) - 3);
+    iu = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (int i = 0; i < ops; i++) {
+        long long got = lazyQuery(lz, qi[i] / 2, qi[i]).sum;
+        if ((i & 1023) == 0) ok = ok && got == expected[i / 1024];
+        sink += got;
+    }
+    iq = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("Intervalo + soma (lazy) %12s %12s %12s %10s\n", "build (s)", "updates (s)", "queries (s)", "memória");
+    printf("  recursiva (README)    %12.2f %12.2f %12.2f %7.0f MB\n", rb, ru, rq, 8.0 * n * sizeof(long long) / 1e6);
+    printf("  iterativa (soma+mín)  %12.2f %12.2f %12.2f %7.0f MB\n", ib, iu, iq,
+           (double)nextPowerOfTwo(n) * (2 * sizeof(LazyValue) + sizeof(LazyTag)) / 1e6);
+
+    start = clock();
+    for (int i = 0; i < ops; i++) lazyRangeAssign(lz, ql[i], qr[i], i & 15);
+    double ia = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("  iterativa, atribuição %12s %12.2f\n", "", ia);
+    printf("Resultados iguais aos da versão recursiva: %s\n\n", ok ? "OK" : "FALHA");
+    freeLazySegmentTree(lz);
+    free(expected);
+    free(arr);
+    free(arr64);
+    free(qi);
+    free(ql);
+    free(qr);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║             SEGMENT TREE ITERATIVA                       ║\n");
+    printf("║   Bottom-up, monoides genéricos e lazy propagation       ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    int ops = (argc > 2) ? atoi(argv[2]) : 2000000;
+    if (n < 16) n = 16;
+    if (ops < 1) ops = 1;
+
+    testarMonoides();
+    testarLazy();
+    benchmark(n, ops);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da Segment Tree Iterativa:\n");
+    printf("- Consulta/atualização O(log n) sem recursão\n");
+    printf("- 2 * 2^ceil(log2 n) posições em vez de 4n\n");
+    printf("- Qualquer operação associativa (soma, mín, máx, mdc...)\n");
+    printf("- Lazy: somar/atribuir em intervalo em O(log n)\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
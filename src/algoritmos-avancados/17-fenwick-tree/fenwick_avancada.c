@@ -0,0 +1,513 @@
+/**
+ * ============================================================================
+ * FENWICK TREE AVANÇADA - BUILD O(n), INTERVALOS, 2D E CONSULTAS EM LOTE
+ * ============================================================================
+ *
+ * fenwick_tree.c só tem atualização de ponto e prefixSum em 1D, e é
+ * construída com n chamadas a update (O(n log n)). Esta versão adiciona:
+ *
+ * BUILD O(n):
+ * - Copia o array e empurra cada tree[i] para o "pai" i + lsb(i) uma única
+ *   vez, da esquerda para a direita
+ *
+ * RANGE UPDATE + RANGE QUERY (DUAL BIT):
+ * - Duas árvores B1 e B2 sobre o array de diferenças; somar v em [l, r]:
+ *       B1: +v em l, -v em r+1
+ *       B2: +v*(l-1) em l, -v*r em r+1
+ * - prefixo(i) = soma(B1, i) * i - soma(B2, i)
+ *
+ * FENWICK 2D:
+ * - Uma matriz contígua (rows+1) x (cols+1); cada eixo é uma BIT
+ * - Contadores tipo "mapa de calor": incrementar célula, somar retângulo
+ *   em O(log rows * log cols)
+ *
+ * CONSULTAS EM LOTE:
+ * - Uma consulta de prefixo faz ~log n leituras espalhadas pela memória.
+ *   Os endereços não dependem dos valores lidos, então o processador já
+ *   sobrepõe as leituras de consultas seguidas; intercalar percursos à mão
+ *   só acrescenta trabalho
+ * - prefixSumBatch agrupa as consultas por faixa de índice antes de
+ *   responder: consultas da mesma faixa passam pelos mesmos nós, e a maior
+ *   parte das leituras passa a vir da cache
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#define BATCH_BUCKETS 256           // Faixas de índice do lote
+#define BATCH_SORT_MIN 4096         // Lotes menores: uma consulta por vez
+
+// ==================== FENWICK TREE 1D ====================
+
+typedef struct {
+    long long *tree;                // 1-indexed
+    int n;
+} FenwickTree;
+
+// Função para criar uma Fenwick Tree zerada
+FenwickTree* createFenwickTree(int n) {
+    FenwickTree *ft = (FenwickTree *)malloc(sizeof(FenwickTree));
+    ft->n = n;
+    ft->tree = (long long *)calloc(n + 1, sizeof(long long));
+    return ft;
+}
+
+// Função para construir a partir de arr[1..n] em O(n)
+FenwickTree* buildFenwickTree(const long long *arr, int n) {
+    FenwickTree *ft = (FenwickTree *)malloc(sizeof(FenwickTree));
+    ft->n = n;
+    ft->tree = (long long *)malloc((n + 1) * sizeof(long long));
+    memcpy(ft->tree, arr, (n + 1) * sizeof(long long));
+    ft->tree[0] = 0;
+    for (int i = 1; i <= n; i++) {
+        int parent = i + (i & (-i));
+        if (parent <= n) ft->tree[parent] += ft->tree[i];
+    }
+    return ft;
+}
+
+// Função para adicionar delta ao índice i
+void update(FenwickTree *ft, int i, long long delta) {
+    for (; i <= ft->n; i += i & (-i)) {
+        ft->tree[i] += delta;
+    }
+}
+
+// Função para calcular soma de prefixo (1 a i)
+long long prefixSum(FenwickTree *ft, int i) {
+    long long result = 0;
+    for (; i > 0; i -= i & (-i)) {
+        result += ft->tree[i];
+    }
+    return result;
+}
+
+// Função para calcular soma de intervalo (L a R)
+long long rangeSum(FenwickTree *ft, int L, int R) {
+    return prefixSum(ft, R) - prefixSum(ft, L - 1);
+}
+
+/**
+ * Calcula out[k] = prefixSum(ft, idx[k]) para count consultas.
+ * Os pares (índice, k) são distribuídos em BATCH_BUCKETS faixas de índice
+ * (counting sort de uma passada) e respondidos faixa a faixa: consultas
+ * vizinhas dividem os mesmos nós, que já estão na cache
+ */
+void prefixSumBatch(FenwickTree *ft, const int *idx, long long *out, int count) {
+    if (count < BATCH_SORT_MIN) {
+        for (int k = 0; k < count; k++) out[k] = prefixSum(ft, idx[k]);
+        return;
+    }
+
+    int shift = 0;
+    while ((ft->n >> shift) >= BATCH_BUCKETS) shift++;
+    int *start = (int *)calloc(BATCH_BUCKETS + 1, sizeof(int));
+    unsigned *sorted = (unsigned *)malloc(2 * (size_t)count * sizeof(unsigned));
+    for (int k = 0; k < count; k++) start[(idx[k] >> shift) + 1]++;
+    for (int b = 0; b < BATCH_BUCKETS; b++) start[b + 1] += start[b];
+    for (int k = 0; k < count; k++) {
+        int p = start[idx[k] >> shift]++;
+        sorted[2 * p] = (unsigned)idx[k];
+        sorted[2 * p + 1] = (unsigned)k;
+    }
+
+    const long long *tree = ft->tree;
+    for (int p = 0; p < count; p++) {
+        long long result = 0;
+        for (unsigned i = sorted[2 * p]; i > 0; i &= i - 1) {     // i &= i - 1 remove o LSB
+            result += tree[i];
+        }
+        out[sorted[2 * p + 1]] = result;
+    }
+
+    free(start);
+    free(sorted);
+}
+
+void freeFenwickTree(FenwickTree *ft) {
+    free(ft->tree);
+    free(ft);
+}
+
+// ==================== RANGE UPDATE + RANGE QUERY ====================
+
+typedef struct {
+    FenwickTree *b1;                // Diferenças d[i]
+    FenwickTree *b2;                // d[i] * (i - 1)
+    int n;
+} RangeFenwick;
+
+// Função para construir a partir de arr[1..n] em O(n)
+RangeFenwick* buildRangeFenwick(const long long *arr, int n) {
+    RangeFenwick *rf = (RangeFenwick *)malloc(sizeof(RangeFenwick));
+    long long *d1 = (long long *)malloc((n + 1) * sizeof(long long));
+    long long *d2 = (long long *)malloc((n + 1) * sizeof(long long));
+    d1[0] = d2[0] = 0;
+    for (int i = 1; i <= n; i++) {
+        d1[i] = arr[i] - (i > 1 ? arr[i - 1] : 0);
+        d2[i] = d1[i] * (i - 1);
+    }
+    rf->b1 = buildFenwickTree(d1, n);
+    rf->b2 = buildFenwickTree(d2, n);
+    rf->n = n;
+    free(d1);
+    free(d2);
+    return rf;
+}
+
+// Função para somar v a todos os elementos de [L, R]
+void rangeAdd(RangeFenwick *rf, int L, int R, long long v) {
+    update(rf->b1, L, v);
+    update(rf->b2, L, v * (L - 1));
+    if (R + 1 <= rf->n) {
+        update(rf->b1, R + 1, -v);
+        update(rf->b2, R + 1, -v * R);
+    }
+}
+
+// Função para calcular soma de prefixo (1 a i)
+long long rangePrefixSum(RangeFenwick *rf, int i) {
+    return prefixSum(rf->b1, i) * i - prefixSum(rf->b2, i);
+}
+
+// Função para calcular soma de intervalo (L a R)
+long long rangeQuery(RangeFenwick *rf, int L, int R) {
+    return rangePrefixSum(rf, R) - rangePrefixSum(rf, L - 1);
+}
+
+// Função para obter o valor atual do índice i
+long long pointQuery(RangeFenwick *rf, int i) {
+    return prefixSum(rf->b1, i);
+}
+
+void freeRangeFenwick(RangeFenwick *rf) {
+    freeFenwickTree(rf->b1);
+    freeFenwickTree(rf->b2);
+    free(rf);
+}
+
+// ==================== FENWICK TREE 2D ====================
+
+typedef struct {
+    long long *tree;                // (rows+1) x (cols+1), linha a linha
+    int rows, cols;
+} Fenwick2D;
+
+#define CELL(f, x, y) ((f)->tree[(size_t)(x) * ((f)->cols + 1) + (y)])
+
+// Função para criar uma Fenwick Tree 2D zerada
+Fenwick2D* createFenwick2D(int rows, int cols) {
+    Fenwick2D *f = (Fenwick2D *)malloc(sizeof(Fenwick2D));
+    f->rows = rows;
+    f->cols = cols;
+    f->tree = (long long *)calloc((size_t)(rows + 1) * (cols + 1), sizeof(long long));
+    return f;
+}
+
+/**
+ * Constrói a partir de grid (rows x cols, 0-indexed, linha a linha) em
+ * O(rows * cols): build 1D em cada linha e depois em cada coluna
+ */
+Fenwick2D* buildFenwick2D(const long long *grid, int rows, int cols) {
+    Fenwick2D *f = createFenwick2D(rows, cols);
+    for (int x = 1; x <= rows; x++) {
+        memcpy(&CELL(f, x, 1), &grid[(size_t)(x - 1) * cols], cols * sizeof(long long));
+        for (int y = 1; y <= cols; y++) {
+            int parent = y + (y & (-y));
+            if (parent <= cols) CELL(f, x, parent) += CELL(f, x, y);
+        }
+    }
+    // Empurrar linhas inteiras para a linha "pai": varre memória em sequência
+    for (int x = 1; x <= rows; x++) {
+        int parent = x + (x & (-x));
+        if (parent > rows) continue;
+        for (int y = 1; y <= cols; y++) {
+            CELL(f, parent, y) += CELL(f, x, y);
+        }
+    }
+    return f;
+}
+
+// Função para adicionar delta à célula (x, y), 1-indexed
+void update2D(Fenwick2D *f, int x, int y, long long delta) {
+    for (int i = x; i <= f->rows; i += i & (-i)) {
+        for (int j = y; j <= f->cols; j += j & (-j)) {
+            CELL(f, i, j) += delta;
+        }
+    }
+}
+
+// Função para somar o retângulo (1,1) a (x,y)
+long long prefixSum2D(Fenwick2D *f, int x, int y) {
+    long long sum = 0;
+    for (int i = x; i > 0; i -= i & (-i)) {
+        for (int j = y; j > 0; j -= j & (-j)) {
+            sum += CELL(f, i, j);
+        }
+    }
+    return sum;
+}
+
+// Função para somar o retângulo (x1,y1) a (x2,y2), inclusive
+long long rectSum2D(Fenwick2D *f, int x1, int y1, int x2, int y2) {
+    return prefixSum2D(f, x2, y2) - prefixSum2D(f, x1 - 1, y2)
+         - prefixSum2D(f, x2, y1 - 1) + prefixSum2D(f, x1 - 1, y1 - 1);
+}
+
+void freeFenwick2D(Fenwick2D *f) {
+    free(f->tree);
+    free(f);
+}
+
+// ==================== TESTES ====================
+
+static unsigned int rngState = 2463534242u;
+
+static unsigned int nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+void testarBuildELote() {
+    printf("=== TESTE: BUILD O(n) E CONSULTAS EM LOTE ===\n\n");
+
+    enum { N = 5000 };
+    long long *arr = (long long *)malloc((N + 1) * sizeof(long long));
+    arr[0] = 0;
+    for (int i = 1; i <= N; i++) arr[i] = (long long)(nextRandom() % 1000) - 500;
+
+    FenwickTree *built = buildFenwickTree(arr, N);
+    FenwickTree *incremental = createFenwickTree(N);
+    for (int i = 1; i <= N; i++) update(incremental, i, arr[i]);
+    bool ok = memcmp(built->tree, incremental->tree, (N + 1) * sizeof(long long)) == 0;
+    printf("Build O(n) igual a n chamadas de update: %s\n", ok ? "sim" : "não");
+
+    enum { Q = 2 * BATCH_SORT_MIN + 3 };
+    int *idx = (int *)malloc(Q * sizeof(int));
+    long long *out = (long long *)malloc(Q * sizeof(long long));
+    for (int k = 0; k < Q; k++) idx[k] = (int)(nextRandom() % (N + 1));      // Inclui 0 e N
+    prefixSumBatch(built, idx, out, Q);
+    for (int k = 0; k < Q && ok; k++) {
+        long long naive = 0;
+        for (int i = 1; i <= idx[k]; i++) naive += arr[i];
+        ok = out[k] == naive && out[k] == prefixSum(built, idx[k]);
+    }
+    printf("%d consultas em lote conferidas com soma ingênua\n", Q);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+
+    freeFenwickTree(built);
+    freeFenwickTree(incremental);
+    free(arr);
+    free(idx);
+    free(out);
+}
+
+void testarRangeFenwick() {
+    printf("=== TESTE: RANGE UPDATE + RANGE QUERY ===\n\n");
+
+    long long arr[7] = {0, 1, 3, 5, 7, 9, 11};      // índice 0 não usado
+    RangeFenwick *rf = buildRangeFenwick(arr, 6);
+    printf("Array [1, 3, 5, 7, 9, 11]\n");
+    printf("Soma [2, 5]: %lld\n", rangeQuery(rf, 2, 5));        // 24
+    rangeAdd(rf, 2, 4, 10);                                     // 1 13 15 17 9 11
+    printf("Somar 10 em [2, 4] -> soma [1, 6]: %lld, arr[3] = %lld\n",
+           rangeQuery(rf, 1, 6), pointQuery(rf, 3));            // 66, 15
+    bool ok = rangeQuery(rf, 1, 6) == 66 && pointQuery(rf, 3) == 15;
+    freeRangeFenwick(rf);
+
+    enum { N = 700, OPS = 20000 };
+    long long *a = (long long *)calloc(N + 1, sizeof(long long));
+    for (int i = 1; i <= N; i++) a[i] = (long long)(nextRandom() % 100);
+    rf = buildRangeFenwick(a, N);
+    for (int op = 0; op < OPS && ok; op++) {
+        int l = 1 + (int)(nextRandom() % N), r = 1 + (int)(nextRandom() % N);
+        if (l > r) { int t = l; l = r; r = t; }
+        if (nextRandom() % 2 == 0) {
+            long long v = (long long)(nextRandom() % 201) - 100;
+            rangeAdd(rf, l, r, v);
+            for (int i = l; i <= r; i++) a[i] += v;
+        } else {
+            long long s = 0;
+            for (int i = l; i <= r; i++) s += a[i];
+            ok = rangeQuery(rf, l, r) == s && pointQuery(rf, l) == a[l];
+        }
+    }
+    printf("%d operações aleatórias conferidas\n", OPS);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    free(a);
+    freeRangeFenwick(rf);
+}
+
+void testarFenwick2D() {
+    printf("=== TESTE: FENWICK 2D (MAPA DE CALOR) ===\n\n");
+
+    enum { ROWS = 37, COLS = 53, EVENTS = 5000 };
+    long long *grid = (long long *)calloc(ROWS * COLS, sizeof(long long));
+    for (int k = 0; k < EVENTS / 2; k++) grid[nextRandom() % (ROWS * COLS)]++;
+    Fenwick2D *f = buildFenwick2D(grid, ROWS, COLS);
+
+    // Metade dos eventos chega depois, um a um
+    for (int k = 0; k < EVENTS / 2; k++) {
+        int x = (int)(nextRandom() % ROWS), y = (int)(nextRandom() % COLS);
+        grid[x * COLS + y]++;
+        update2D(f, x + 1, y + 1, 1);
+    }
+
+    bool ok = prefixSum2D(f, ROWS, COLS) == EVENTS;
+    for (int q = 0; q < 2000 && ok; q++) {
+        int x1 = 1 + (int)(nextRandom() % ROWS), x2 = 1 + (int)(nextRandom() % ROWS);
+        int y1 = 1 + (int)(nextRandom() % COLS), y2 = 1 + (int)(nextRandom() % COLS);
+        if (x1 > x2) { int t = x1; x1 = x2; x2 = t; }
+        if (y1 > y2) { int t = y1; y1 = y2; y2 = t; }
+        long long s = 0;
+        for (int x = x1; x <= x2; x++) {
+            for (int y = y1; y <= y2; y++) s += grid[(x - 1) * COLS + (y - 1)];
+        }
+        ok = rectSum2D(f, x1, y1, x2, y2) == s;
+    }
+    printf("Grade %dx%d, %d eventos (metade via build, metade via update2D)\n", ROWS, COLS, EVENTS);
+    printf("Eventos no retângulo (10,10)-(20,30): %lld\n", rectSum2D(f, 10, 10, 20, 30));
+    printf("2000 retângulos aleatórios conferidos\n");
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+
+    free(grid);
+    freeFenwick2D(f);
+}
+
+// ==================== BENCHMARK ====================
+
+static double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+void benchmark(int n, int queries) {
+    printf("=== BENCHMARK: %d elementos, %d consultas ===\n\n", n, queries);
+
+    long long *arr = (long long *)malloc((n + 1) * sizeof(long long));
+    arr[0] = 0;
+    for (int i = 1; i <= n; i++) arr[i] = (long long)(nextRandom() % 100);
+    int *idx = (int *)malloc(queries * sizeof(int));
+    for (int k = 0; k < queries; k++) idx[k] = 1 + (int)(nextRandom() % n);
+    long long *out = (long long *)malloc(queries * sizeof(long long));
+    volatile long long sink = 0;
+    clock_t start;
+
+    start = clock();
+    FenwickTree *slow = createFenwickTree(n);
+    for (int i = 1; i <= n; i++) update(slow, i, arr[i]);
+    double tUpdates = elapsed(start);
+    start = clock();
+    FenwickTree *ft = buildFenwickTree(arr, n);
+    double tBuild = elapsed(start);
+    bool ok = memcmp(slow->tree, ft->tree, (n + 1) * sizeof(long long)) == 0;
+    freeFenwickTree(slow);
+
+    printf("Construção:\n");
+    printf("  n chamadas de update  %8.3f s\n", tUpdates);
+    printf("  build O(n)            %8.3f s  (%.1fx)\n\n", tBuild, tUpdates / tBuild);
+
+    start = clock();
+    for (int k = 0; k < queries; k++) sink += prefixSum(ft, idx[k]);
+    double tSingle = elapsed(start);
+    start = clock();
+    prefixSumBatch(ft, idx, out, queries);
+    double tBatch = elapsed(start);
+    for (int k = 0; k < queries; k += 4099) ok = ok && out[k] == prefixSum(ft, idx[k]);
+
+    printf("prefixSum aleatório:\n");
+    printf("  uma por vez           %8.3f s  (%.0f ns/consulta)\n", tSingle, 1e9 * tSingle / queries);
+    printf("  em lote               %8.3f s  (%.0f ns/consulta, %.2fx)\n\n", tBatch,
+           1e9 * tBatch / queries, tSingle / tBatch);
+    freeFenwickTree(ft);
+
+    start = clock();
+    RangeFenwick *rf = buildRangeFenwick(arr, n);
+    double tRangeBuild = elapsed(start);
+    start = clock();
+    for (int k = 0; k + 1 < queries; k += 2) {
+        int l = idx[k] < idx[k + 1] ? idx[k] : idx[k + 1];
+        int r = idx[k] < idx[k + 1] ? idx[k + 1] : idx[k];
+        rangeAdd(rf, l, r, (k & 7) - 3);
+    }
+    double tRangeAdd = elapsed(start);
+    start = clock();
+    for (int k = 0; k + 1 < queries; k += 2) {
+        int l = idx[k] < idx[k + 1] ? idx[k] : idx[k + 1];
+        int r = idx[k] < idx[k + 1] ? idx[k + 1] : idx[k];
+        sink += rangeQuery(rf, l, r);
+    }
+    double tRangeQuery = elapsed(start);
+    freeRangeFenwick(rf);
+
+    printf("Dual BIT (intervalo):\n");
+    printf("  build O(n)            %8.3f s\n", tRangeBuild);
+    printf("  rangeAdd              %8.0f ns/op\n", 2e9 * tRangeAdd / queries);
+    printf("  rangeQuery            %8.0f ns/op\n\n", 2e9 * tRangeQuery / queries);
+
+    int side = 2048;
+    long long *grid = (long long *)calloc((size_t)side * side, sizeof(long long));
+    for (int k = 0; k < queries; k++) grid[(size_t)(nextRandom() % side) * side + nextRandom() % side]++;
+    start = clock();
+    Fenwick2D *f = buildFenwick2D(grid, side, side);
+    double t2dBuild = elapsed(start);
+    start = clock();
+    for (int k = 0; k < queries; k++) {
+        update2D(f, 1 + (int)(nextRandom() % side), 1 + (int)(nextRandom() % side), 1);
+    }
+    double t2dUpdate = elapsed(start);
+    start = clock();
+    for (int k = 0; k < queries; k++) {
+        int x = 1 + (int)(nextRandom() % (side - 64)), y = 1 + (int)(nextRandom() % (side - 64));
+        sink += rectSum2D(f, x, y, x + 63, y + 63);
+    }
+    double t2dQuery = elapsed(start);
+    ok = ok && prefixSum2D(f, side, side) == 2LL * queries;
+    freeFenwick2D(f);
+    free(grid);
+
+    printf("Fenwick 2D (%dx%d):\n", side, side);
+    printf("  build O(rows*cols)    %8.3f s\n", t2dBuild);
+    printf("  update2D              %8.0f ns/op\n", 1e9 * t2dUpdate / queries);
+    printf("  rectSum2D (64x64)     %8.0f ns/op\n", 1e9 * t2dQuery / queries);
+    printf("Resultados conferidos: %s\n\n", ok ? "OK" : "FALHA");
+
+    free(arr);
+    free(idx);
+    free(out);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║             FENWICK TREE AVANÇADA                        ║\n");
+    printf("║   Build O(n), dual BIT, 2D e consultas em lote           ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    int queries = (argc > 2) ? atoi(argv[2]) : 10000000;
+    if (n < 16) n = 16;
+    if (queries < 2) queries = 2;
+
+    testarBuildELote();
+    testarRangeFenwick();
+    testarFenwick2D();
+    benchmark(n, queries);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da Fenwick Tree Avançada:\n");
+    printf("- Build em O(n) a partir de um array\n");
+    printf("- Dual BIT: somar e consultar intervalos em O(log n)\n");
+    printf("- 2D: célula e retângulo em O(log R * log C)\n");
+    printf("- Lote: consultas agrupadas por faixa reaproveitam a cache\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,461 @@
+/**
+ * ============================================================================
+ * UNION-FIND CONCORRENTE (CAS) - COMPONENTES CONEXOS EM PARALELO
+ * ============================================================================
+ *
+ * union_find.c é sequencial: find reescreve parent[] e unionSets compara
+ * e altera rank[] sem nenhuma sincronização. Esta versão (no estilo de
+ * Anderson & Woll, 1991, e Jayanti & Tarjan, 2016) pode ser usada por
+ * várias threads ao mesmo tempo, sem locks:
+ *
+ * LIGAÇÃO POR ÍNDICE COM CAS:
+ * - Não há rank (seria um segundo campo a manter consistente). Cada
+ *   elemento tem uma prioridade fixa, hash(índice); a raiz de menor
+ *   prioridade passa a apontar para a de maior:
+ *
+ *       CAS(&parent[rx], rx, ry)     // só funciona se rx ainda é raiz
+ *
+ *   Se outra thread ligou rx antes, o CAS falha e a união recomeça a
+ *   partir das novas raízes. Como a prioridade só cresce ao subir na
+ *   árvore, nunca se forma um ciclo
+ * - Com prioridades aleatórias a profundidade esperada é O(log n), mesmo
+ *   que a entrada seja "ruim" (ex.: caminho 0-1-2-...-n)
+ *
+ * PATH SPLITTING:
+ * - Durante o find, cada nó passa a apontar para o avô:
+ *
+ *       parent[x] = gp;  x = p;
+ *
+ *   Uma única passada, sem pilha nem recursão. Só raízes mudam de
+ *   conjunto, e ancestrais nunca deixam de ser ancestrais: uma escrita
+ *   atômica simples basta, sem CAS (só a ligação de raízes precisa dele)
+ *
+ * COMPONENTES CONEXOS:
+ * - As arestas são divididas em blocos contíguos, um por thread; cada
+ *   thread chama concurrentUnion nas suas arestas. Depois, em paralelo,
+ *   label[v] = find(v)
+ *
+ * Compilação: gcc -O2 -std=c11 -pthread union_find_concorrente.c
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#define MAX_THREADS 64
+
+// ==================== ESTRUTURA ====================
+
+typedef struct {
+    _Atomic int *parent;
+    int n;
+} ConcurrentUnionFind;
+
+// Função para obter a prioridade fixa de um elemento (hash do índice)
+static inline uint32_t priority(int x) {
+    uint32_t h = (uint32_t)x * 0x9E3779B1u;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    return h;
+}
+
+// Função para decidir se a deve ficar acima de b (desempate pelo índice)
+static inline bool higher(int a, int b) {
+    uint32_t pa = priority(a), pb = priority(b);
+    return pa > pb || (pa == pb && a > b);
+}
+
+// Criar Union-Find concorrente
+ConcurrentUnionFind* createConcurrentUnionFind(int n) {
+    ConcurrentUnionFind *uf = (ConcurrentUnionFind *)malloc(sizeof(ConcurrentUnionFind));
+    uf->n = n;
+    uf->parent = (_Atomic int *)malloc(sizeof(_Atomic int) * n);
+    for (int i = 0; i < n; i++) {
+        atomic_init(&uf->parent[i], i);
+    }
+    return uf;
+}
+
+// Find com path splitting: cada nó visitado passa a apontar para o avô
+int concurrentFind(ConcurrentUnionFind *uf, int x) {
+    for (;;) {
+        int p = atomic_load_explicit(&uf->parent[x], memory_order_acquire);
+        int gp = atomic_load_explicit(&uf->parent[p], memory_order_acquire);
+        if (p == gp) return p;
+        // Não precisa de CAS: gp é ancestral de x e continua sendo para
+        // sempre, então sobrescrever o que outra thread escreveu em
+        // parent[x] (também um ancestral) não quebra a árvore
+        atomic_store_explicit(&uf->parent[x], gp, memory_order_relaxed);
+        x = p;
+    }
+}
+
+// Union por prioridade com CAS; retorna false se já estavam juntos
+bool concurrentUnion(ConcurrentUnionFind *uf, int x, int y) {
+    for (;;) {
+        x = concurrentFind(uf, x);
+        y = concurrentFind(uf, y);
+        if (x == y) return false;
+        if (higher(x, y)) {
+            int t = x;
+            x = y;
+            y = t;
+        }
+        // x tem a menor prioridade: liga x abaixo de y se x ainda for raiz
+        int expected = x;
+        if (atomic_compare_exchange_strong_explicit(&uf->parent[x], &expected, y,
+                                                    memory_order_acq_rel, memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+/**
+ * Verifica se x e y estão no mesmo conjunto. Com uniões acontecendo ao
+ * mesmo tempo, raízes diferentes só provam "não" se a raiz de x ainda é
+ * raiz depois da leitura; caso contrário, tenta de novo
+ */
+bool concurrentConnected(ConcurrentUnionFind *uf, int x, int y) {
+    for (;;) {
+        x = concurrentFind(uf, x);
+        y = concurrentFind(uf, y);
+        if (x == y) return true;
+        if (atomic_load_explicit(&uf->parent[x], memory_order_acquire) == x) return false;
+    }
+}
+
+// Liberar memória
+void freeConcurrentUnionFind(ConcurrentUnionFind *uf) {
+    free(uf->parent);
+    free(uf);
+}
+
+// ==================== COMPONENTES CONEXOS EM PARALELO ====================
+
+typedef struct {
+    int u, v;
+} Edge;
+
+typedef struct {
+    ConcurrentUnionFind *uf;
+    const Edge *edges;
+    long begin, end;            // Arestas [begin, end) ou vértices, conforme a fase
+    int *label;
+} ComponentTask;
+
+static void* unionTask(void *arg) {
+    ComponentTask *t = (ComponentTask *)arg;
+    for (long i = t->begin; i < t->end; i++) {
+        concurrentUnion(t->uf, t->edges[i].u, t->edges[i].v);
+    }
+    return NULL;
+}
+
+static void* labelTask(void *arg) {
+    ComponentTask *t = (ComponentTask *)arg;
+    for (long v = t->begin; v < t->end; v++) {
+        t->label[v] = concurrentFind(t->uf, (int)v);
+    }
+    return NULL;
+}
+
+// Função para rodar task em 'threads' blocos contíguos de [0, total)
+static void runParallel(void *(*task)(void *), ComponentTask *base, long total, int threads) {
+    pthread_t tid[MAX_THREADS];
+    ComponentTask tasks[MAX_THREADS];
+    for (int t = 0; t < threads; t++) {
+        tasks[t] = *base;
+        tasks[t].begin = total * t / threads;
+        tasks[t].end = total * (t + 1) / threads;
+    }
+    // A thread atual faz o bloco 0; se pthread_create falhar, roda o bloco aqui
+    bool started[MAX_THREADS] = { false };
+    for (int t = 1; t < threads; t++) {
+        started[t] = pthread_create(&tid[t], NULL, task, &tasks[t]) == 0;
+        if (!started[t]) task(&tasks[t]);
+    }
+    task(&tasks[0]);
+    for (int t = 1; t < threads; t++) {
+        if (started[t]) pthread_join(tid[t], NULL);
+    }
+}
+
+/**
+ * Calcula os componentes conexos do grafo (n vértices, m arestas) com
+ * 'threads' threads. label[v] recebe a raiz do componente de v; retorna
+ * o número de componentes
+ */
+int connectedComponents(int n, const Edge *edges, long m, int threads, int *label) {
+    if (threads < 1) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+
+    ConcurrentUnionFind *uf = createConcurrentUnionFind(n);
+    ComponentTask base = { uf, edges, 0, 0, label };
+    runParallel(unionTask, &base, m, threads);
+    runParallel(labelTask, &base, n, threads);
+    freeConcurrentUnionFind(uf);
+
+    int count = 0;
+    for (int v = 0; v < n; v++) {
+        if (label[v] == v) count++;
+    }
+    return count;
+}
+
+// ==================== VERSÃO SEQUENCIAL (union_find.c) ====================
+
+// Mesmo algoritmo de union_find.c: rank + path compression recursiva
+typedef struct {
+    int *parent;
+    int *rank;
+    int count;
+} UnionFind;
+
+static int find(UnionFind *uf, int x) {
+    if (uf->parent[x] != x) {
+        uf->parent[x] = find(uf, uf->parent[x]);
+    }
+    return uf->parent[x];
+}
+
+static bool unionSets(UnionFind *uf, int x, int y) {
+    int rx = find(uf, x), ry = find(uf, y);
+    if (rx == ry) return false;
+    if (uf->rank[rx] < uf->rank[ry]) {
+        uf->parent[rx] = ry;
+    } else if (uf->rank[rx] > uf->rank[ry]) {
+        uf->parent[ry] = rx;
+    } else {
+        uf->parent[ry] = rx;
+        uf->rank[rx]++;
+    }
+    uf->count--;
+    return true;
+}
+
+static int sequentialComponents(int n, const Edge *edges, long m, int *label) {
+    UnionFind uf = { (int *)malloc(sizeof(int) * n), (int *)calloc(n, sizeof(int)), n };
+    for (int i = 0; i < n; i++) uf.parent[i] = i;
+    for (long i = 0; i < m; i++) unionSets(&uf, edges[i].u, edges[i].v);
+    for (int v = 0; v < n; v++) label[v] = find(&uf, v);
+    int count = uf.count;
+    free(uf.parent);
+    free(uf.rank);
+    return count;
+}
+
+// ==================== TESTES ====================
+
+static uint64_t rngState = 88172645463325252ULL;
+
+static uint64_t nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return rngState;
+}
+
+// Função para gerar m arestas: 'blocks' grupos de vértices sem arestas entre si
+static void generateEdges(Edge *edges, long m, int n, int blocks) {
+    int blockSize = n / blocks;
+    for (long i = 0; i < m; i++) {
+        uint64_t r = nextRandom();
+        int block = (int)(r % blocks);
+        edges[i].u = block * blockSize + (int)((r >> 20) % blockSize);
+        edges[i].v = block * blockSize + (int)((r >> 42) % blockSize);
+    }
+}
+
+/**
+ * Verifica se duas rotulações descrevem a mesma partição: a relação
+ * rótulo A -> rótulo B precisa ser uma bijeção
+ */
+static bool samePartition(const int *a, const int *b, int n) {
+    int *aToB = (int *)malloc(sizeof(int) * n);
+    int *bToA = (int *)malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) aToB[i] = bToA[i] = -1;
+    bool ok = true;
+    for (int v = 0; v < n && ok; v++) {
+        if (aToB[a[v]] == -1 && bToA[b[v]] == -1) {
+            aToB[a[v]] = b[v];
+            bToA[b[v]] = a[v];
+        }
+        ok = aToB[a[v]] == b[v] && bToA[b[v]] == a[v];
+    }
+    free(aToB);
+    free(bToA);
+    return ok;
+}
+
+void testarBasico() {
+    printf("=== TESTE BÁSICO ===\n\n");
+
+    ConcurrentUnionFind *uf = createConcurrentUnionFind(6);
+    concurrentUnion(uf, 0, 1);
+    concurrentUnion(uf, 2, 3);
+    bool again = concurrentUnion(uf, 1, 0);
+    concurrentUnion(uf, 0, 2);
+    concurrentUnion(uf, 4, 5);
+
+    printf("Unindo 0-1, 2-3, 0-2, 4-5 (1-0 de novo retorna %s)\n", again ? "true" : "false");
+    printf("0 e 3 conectados? %s\n", concurrentConnected(uf, 0, 3) ? "Sim" : "Não");
+    printf("0 e 4 conectados? %s\n", concurrentConnected(uf, 0, 4) ? "Sim" : "Não");
+    bool ok = !again && concurrentConnected(uf, 0, 3) && concurrentConnected(uf, 1, 2) &&
+              !concurrentConnected(uf, 0, 4) && concurrentConnected(uf, 4, 5);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    freeConcurrentUnionFind(uf);
+}
+
+typedef struct {
+    ConcurrentUnionFind *uf;
+    const Edge *edges;
+    long m;
+    int stride, offset;
+    long merged;                // Uniões que retornaram true
+} StressTask;
+
+static void* stressTask(void *arg) {
+    StressTask *t = (StressTask *)arg;
+    // Threads intercaladas nas mesmas arestas: máxima disputa pelos CAS
+    for (long i = t->offset; i < t->m; i += t->stride) {
+        if (concurrentUnion(t->uf, t->edges[i].u, t->edges[i].v)) t->merged++;
+        concurrentConnected(t->uf, t->edges[i].v, t->edges[(i * 7) % t->m].u);
+    }
+    return NULL;
+}
+
+void testarConcorrencia() {
+    printf("=== TESTE CONCORRENTE ===\n\n");
+
+    enum { N = 200000, THREADS = 4 };
+    long m = 300000;
+    Edge *edges = (Edge *)malloc(sizeof(Edge) * m);
+    generateEdges(edges, m, N, 1000);
+
+    int *expected = (int *)malloc(sizeof(int) * N);
+    int *label = (int *)malloc(sizeof(int) * N);
+    int seqCount = sequentialComponents(N, edges, m, expected);
+
+    // 1) Todas as threads martelando as mesmas arestas
+    ConcurrentUnionFind *uf = createConcurrentUnionFind(N);
+    pthread_t tid[THREADS];
+    StressTask tasks[THREADS];
+    for (int t = 0; t < THREADS; t++) {
+        tasks[t] = (StressTask){ uf, edges, m, 2, t % 2, 0 };
+        pthread_create(&tid[t], NULL, stressTask, &tasks[t]);
+    }
+    long merged = 0;
+    for (int t = 0; t < THREADS; t++) {
+        pthread_join(tid[t], NULL);
+        merged += tasks[t].merged;
+    }
+    for (int v = 0; v < N; v++) label[v] = concurrentFind(uf, v);
+    bool ok = samePartition(label, expected, N) && N - merged == seqCount;
+    printf("%d threads disputando as mesmas %ld arestas\n", THREADS, m);
+    printf("Uniões bem-sucedidas: %ld (n - componentes = %d)\n", merged, N - seqCount);
+    freeConcurrentUnionFind(uf);
+
+    // 2) Componentes conexos com 1..4 threads
+    for (int threads = 1; threads <= THREADS && ok; threads++) {
+        int count = connectedComponents(N, edges, m, threads, label);
+        ok = count == seqCount && samePartition(label, expected, N);
+    }
+    printf("connectedComponents com 1..%d threads: %d componentes (sequencial: %d)\n",
+           THREADS, connectedComponents(N, edges, m, THREADS, label), seqCount);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+
+    free(edges);
+    free(expected);
+    free(label);
+}
+
+// ==================== BENCHMARK ====================
+
+// O speedup é medido em tempo de parede: com clock(), a CPU das threads se somaria
+// e nenhuma versão paralela passaria de 1x
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void benchmark(int n, long m, int maxThreads, int blocks) {
+    printf("=== BENCHMARK: %d vértices, %ld arestas, %d bloco(s) ===\n\n", n, m, blocks);
+
+    Edge *edges = (Edge *)malloc(sizeof(Edge) * m);
+    int *expected = (int *)malloc(sizeof(int) * n);
+    int *label = (int *)malloc(sizeof(int) * n);
+    if (edges == NULL || expected == NULL || label == NULL) {
+        printf("Memória insuficiente\n\n");
+        free(edges);
+        free(expected);
+        free(label);
+        return;
+    }
+    generateEdges(edges, m, n, blocks);
+
+    double start = nowSeconds();
+    int seqCount = sequentialComponents(n, edges, m, expected);
+    double tSeq = nowSeconds() - start;
+    printf("%-24s %10s %12s %10s\n", "Versão", "tempo (s)", "arestas/s", "speedup");
+    printf("%-24s %10.2f %12.3g %10s\n", "union_find.c (rank)", tSeq, m / tSeq, "1.00x");
+
+    bool ok = true;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        start = nowSeconds();
+        int count = connectedComponents(n, edges, m, threads, label);
+        double t = nowSeconds() - start;
+        ok = ok && count == seqCount;
+        char name[32];
+        snprintf(name, sizeof(name), "CAS, %d thread(s)", threads);
+        printf("%-24s %10.2f %12.3g %9.2fx\n", name, t, m / t, tSeq / t);
+    }
+    ok = ok && samePartition(label, expected, n);
+    printf("Componentes: %d, iguais aos da versão sequencial: %s\n\n", seqCount, ok ? "OK" : "FALHA");
+
+    free(edges);
+    free(expected);
+    free(label);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║             UNION-FIND CONCORRENTE                       ║\n");
+    printf("║   Ligação por CAS, path splitting, componentes paralelos ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    long m = (argc > 2) ? atol(argv[2]) : 100000000;
+    int maxThreads = (argc > 3) ? atoi(argv[3]) : 8;
+    if (n < 1000) n = 1000;
+    if (m < 1) m = 1;
+    if (maxThreads < 1) maxThreads = 1;
+    if (maxThreads > MAX_THREADS) maxThreads = MAX_THREADS;
+
+    testarBasico();
+    testarConcorrencia();
+    benchmark(n, m, maxThreads, 1);                     // Denso: um componente
+    benchmark(m < 200000000 ? (int)m : 200000000, m, maxThreads, 1);   // Esparso: grau médio 2
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades do Union-Find Concorrente:\n");
+    printf("- Sem locks: uma união é um CAS na raiz de menor prioridade\n");
+    printf("- Path splitting em uma passada, tolerante a CAS que falham\n");
+    printf("- Prioridade hash(índice): profundidade O(log n) esperada\n");
+    printf("- Componentes conexos: arestas divididas entre as threads\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,697 @@
+/**
+ * ============================================================================
+ * K-D TREE PLANA - DIMENSÃO EM TEMPO DE EXECUÇÃO, BUCKETS E K-NN
+ * ============================================================================
+ *
+ * kd_tree.c fixa K = 2 em tempo de compilação, chama qsort em todo nível
+ * de buildKDTree (O(n log² n)), aloca um Node por ponto e só oferece o
+ * vizinho mais próximo. Esta versão:
+ *
+ * ÁRVORE IMPLÍCITA EM ARRAY:
+ * - Nó k tem filhos 2k+1 e 2k+2 (como um heap); cada nó interno guarda
+ *   só o eixo e o valor de corte. O intervalo de pontos de um nó não é
+ *   armazenado: a raiz cobre [0, n) e cada nó divide o seu ao meio
+ * - As folhas são BUCKETS de até leafSize pontos, contíguos no array de
+ *   coordenadas (reordenado na construção): a varredura de uma folha
+ *   percorre memória em sequência
+ *
+ *       split/axis: [ raiz | nível 1 | nível 2 | ... ]    (2^levels - 1)
+ *       points:     [ folha 0 | folha 1 | ... | folha 2^levels - 1 ]
+ *
+ * CONSTRUÇÃO O(n log n):
+ * - Em cada nó, o eixo é o de maior amplitude e a mediana é posta no
+ *   lugar por quickselect (como std::nth_element), em O(tamanho do nó)
+ *   em média, sem ordenar
+ *
+ * CONSULTAS:
+ * - k-NN com max-heap limitado a k elementos: a raiz do heap é o pior dos
+ *   k melhores, e é o raio usado para podar. A poda usa a distância até a
+ *   célula inteira (somando todos os eixos já cortados), e não só até o
+ *   último corte: em dimensão alta isso descarta muito mais nós
+ * - Busca por raio: todos os pontos a distância <= r
+ * - Em lote: as consultas são divididas entre threads; a árvore é só de
+ *   leitura, então não há sincronização
+ *
+ * Compilação: gcc -O2 -std=c11 -pthread kd_tree_plano.c -lm
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <time.h>
+#include <pthread.h>
+
+#define DEFAULT_LEAF_SIZE 16
+#define MAX_THREADS 64
+#define PI 3.14159265358979323846
+
+// ==================== ESTRUTURA ====================
+
+typedef struct {
+    int dim;
+    int n;
+    int leafSize;
+    int levels;                 // Profundidade das folhas
+    int nodeCount;              // Nós internos: 2^levels - 1
+    double *split;              // Valor de corte de cada nó interno
+    int *axis;                  // Eixo de corte de cada nó interno
+    double *points;             // n * dim coordenadas, na ordem das folhas
+    int *ids;                   // Índice original de cada ponto
+} FlatKDTree;
+
+// Função para obter a coordenada 'axis' do ponto de índice original i
+static inline double coordOf(const double *data, int dim, int i, int axis) {
+    return data[(size_t)i * dim + axis];
+}
+
+// Função para colocar em perm[k] o elemento que estaria lá se [lo, hi) fosse ordenado
+static void nthElement(int *perm, int lo, int hi, int k, const double *data, int dim, int axis) {
+    while (hi - lo > 1) {
+        // Pivô: mediana de três, ordenando lo, mid e hi-1 no lugar. Com mid
+        // no meio "de baixo", a partição sempre termina com j < hi - 1
+        int mid = lo + (hi - lo - 1) / 2;
+        int *a = &perm[lo], *b = &perm[mid], *c = &perm[hi - 1], t;
+        if (coordOf(data, dim, *b, axis) < coordOf(data, dim, *a, axis)) { t = *a; *a = *b; *b = t; }
+        if (coordOf(data, dim, *c, axis) < coordOf(data, dim, *b, axis)) { t = *b; *b = *c; *c = t; }
+        if (coordOf(data, dim, *b, axis) < coordOf(data, dim, *a, axis)) { t = *a; *a = *b; *b = t; }
+        double pivot = coordOf(data, dim, *b, axis);
+
+        // Partição de Hoare: [lo, j] <= pivô <= [j+1, hi)
+        int i = lo - 1, j = hi;
+        for (;;) {
+            do { i++; } while (coordOf(data, dim, perm[i], axis) < pivot);
+            do { j--; } while (coordOf(data, dim, perm[j], axis) > pivot);
+            if (i >= j) break;
+            t = perm[i];
+            perm[i] = perm[j];
+            perm[j] = t;
+        }
+        if (k <= j) hi = j + 1;
+        else lo = j + 1;
+    }
+}
+
+// Função para escolher o eixo de maior amplitude em perm[lo, hi)
+static int widestAxis(const int *perm, int lo, int hi, const double *data, int dim) {
+    int best = 0;
+    double bestSpread = -1;
+    for (int a = 0; a < dim; a++) {
+        double mn = DBL_MAX, mx = -DBL_MAX;
+        for (int i = lo; i < hi; i++) {
+            double v = coordOf(data, dim, perm[i], a);
+            if (v < mn) mn = v;
+            if (v > mx) mx = v;
+        }
+        if (mx - mn > bestSpread) {
+            bestSpread = mx - mn;
+            best = a;
+        }
+    }
+    return best;
+}
+
+static void buildNode(FlatKDTree *tree, int *perm, const double *data, int node, int lo, int hi) {
+    if (node >= tree->nodeCount) return;                // Folha
+    int mid = lo + (hi - lo) / 2;
+    int axis = widestAxis(perm, lo, hi, data, tree->dim);
+    if (hi > lo) nthElement(perm, lo, hi, mid, data, tree->dim, axis);
+    tree->axis[node] = axis;
+    tree->split[node] = (mid < hi) ? coordOf(data, tree->dim, perm[mid], axis) : 0;
+    buildNode(tree, perm, data, 2 * node + 1, lo, mid);
+    buildNode(tree, perm, data, 2 * node + 2, mid, hi);
+}
+
+/**
+ * Constrói a árvore para n pontos de dimensão dim (data: n * dim, linha a
+ * linha). Os dados são copiados; leafSize <= 0 usa DEFAULT_LEAF_SIZE
+ */
+FlatKDTree* buildFlatKDTree(const double *data, int n, int dim, int leafSize) {
+    FlatKDTree *tree = (FlatKDTree *)malloc(sizeof(FlatKDTree));
+    tree->dim = dim;
+    tree->n = n;
+    tree->leafSize = leafSize > 0 ? leafSize : DEFAULT_LEAF_SIZE;
+    tree->levels = 0;
+    while (((long)n + (1L << tree->levels) - 1) >> tree->levels > tree->leafSize) {
+        tree->levels++;
+    }
+    tree->nodeCount = (1 << tree->levels) - 1;
+    tree->split = (double *)malloc(sizeof(double) * (tree->nodeCount + 1));
+    tree->axis = (int *)malloc(sizeof(int) * (tree->nodeCount + 1));
+    tree->points = (double *)malloc(sizeof(double) * ((size_t)n * dim + 1));
+    tree->ids = (int *)malloc(sizeof(int) * (n + 1));
+
+    for (int i = 0; i < n; i++) tree->ids[i] = i;
+    buildNode(tree, tree->ids, data, 0, 0, n);
+
+    // Copiar as coordenadas na ordem final: cada folha fica contígua
+    for (int i = 0; i < n; i++) {
+        memcpy(&tree->points[(size_t)i * dim], &data[(size_t)tree->ids[i] * dim], sizeof(double) * dim);
+    }
+    return tree;
+}
+
+void freeFlatKDTree(FlatKDTree *tree) {
+    free(tree->split);
+    free(tree->axis);
+    free(tree->points);
+    free(tree->ids);
+    free(tree);
+}
+
+static inline double squaredDistance(const double *a, const double *b, int dim) {
+    double sum = 0;
+    for (int i = 0; i < dim; i++) {
+        double diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+// ==================== K-NN (MAX-HEAP LIMITADO) ====================
+
+typedef struct {
+    double *dist2;              // dist2[0] é o pior dos k melhores
+    int *id;
+    int size, cap;
+} BoundedHeap;
+
+static void heapSiftDown(BoundedHeap *h, int i) {
+    for (;;) {
+        int largest = i, l = 2 * i + 1, r = 2 * i + 2;
+        if (l < h->size && h->dist2[l] > h->dist2[largest]) largest = l;
+        if (r < h->size && h->dist2[r] > h->dist2[largest]) largest = r;
+        if (largest == i) return;
+        double td = h->dist2[i]; h->dist2[i] = h->dist2[largest]; h->dist2[largest] = td;
+        int ti = h->id[i]; h->id[i] = h->id[largest]; h->id[largest] = ti;
+        i = largest;
+    }
+}
+
+// Função para oferecer um candidato ao heap (entra se for melhor que o pior)
+static inline void heapOffer(BoundedHeap *h, double d2, int id) {
+    if (h->size < h->cap) {
+        int i = h->size++;
+        while (i > 0 && h->dist2[(i - 1) / 2] < d2) {
+            h->dist2[i] = h->dist2[(i - 1) / 2];
+            h->id[i] = h->id[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        h->dist2[i] = d2;
+        h->id[i] = id;
+    } else if (d2 < h->dist2[0]) {
+        h->dist2[0] = d2;
+        h->id[0] = id;
+        heapSiftDown(h, 0);
+    }
+}
+
+static inline double heapBound(const BoundedHeap *h) {
+    return h->size < h->cap ? DBL_MAX : h->dist2[0];
+}
+
+/**
+ * Desce a árvore acumulando em cellDist2 a distância ao quadrado da
+ * consulta até a célula do nó (Arya & Mount): ao ir para o lado "de lá" de
+ * um corte, só a parcela do eixo do corte muda, de offset[axis]² para diff²
+ */
+static void knnNode(const FlatKDTree *tree, const double *query, BoundedHeap *heap,
+                    double *offset, double cellDist2, int node, int lo, int hi) {
+    if (node >= tree->nodeCount) {
+        const double *p = &tree->points[(size_t)lo * tree->dim];
+        for (int i = lo; i < hi; i++, p += tree->dim) {
+            double d2 = squaredDistance(p, query, tree->dim);
+            if (d2 < heapBound(heap)) heapOffer(heap, d2, tree->ids[i]);
+        }
+        return;
+    }
+    int mid = lo + (hi - lo) / 2;
+    int axis = tree->axis[node];
+    double diff = query[axis] - tree->split[node];
+    if (diff < 0) {
+        knnNode(tree, query, heap, offset, cellDist2, 2 * node + 1, lo, mid);
+    } else {
+        knnNode(tree, query, heap, offset, cellDist2, 2 * node + 2, mid, hi);
+    }
+
+    double old = offset[axis];
+    double farDist2 = cellDist2 - old * old + diff * diff;
+    if (farDist2 < heapBound(heap)) {
+        offset[axis] = diff;
+        if (diff < 0) {
+            knnNode(tree, query, heap, offset, farDist2, 2 * node + 2, mid, hi);
+        } else {
+            knnNode(tree, query, heap, offset, farDist2, 2 * node + 1, lo, mid);
+        }
+        offset[axis] = old;
+    }
+}
+
+/**
+ * Encontra os k pontos mais próximos de query. outIds/outDist2 (k posições)
+ * recebem índices originais e distâncias ao quadrado, em ordem crescente.
+ * Retorna quantos foram encontrados (min(k, n))
+ */
+int knnSearch(const FlatKDTree *tree, const double *query, int k, int *outIds, double *outDist2) {
+    if (k <= 0) return 0;
+    BoundedHeap heap = { outDist2, outIds, 0, k };
+    double stackOffset[32];
+    double *offset = tree->dim <= 32 ? stackOffset : (double *)malloc(sizeof(double) * tree->dim);
+    for (int a = 0; a < tree->dim; a++) offset[a] = 0;
+    knnNode(tree, query, &heap, offset, 0, 0, 0, tree->n);
+    if (offset != stackOffset) free(offset);
+
+    // Heapsort no próprio espaço de saída: o maior vai para o fim
+    int found = heap.size;
+    while (heap.size > 1) {
+        int last = heap.size - 1;
+        double td = heap.dist2[0]; heap.dist2[0] = heap.dist2[last]; heap.dist2[last] = td;
+        int ti = heap.id[0]; heap.id[0] = heap.id[last]; heap.id[last] = ti;
+        heap.size--;
+        heapSiftDown(&heap, 0);
+    }
+    return found;
+}
+
+// ==================== BUSCA POR RAIO ====================
+
+// Mesma poda por distância até a célula usada no k-NN
+static void radiusNode(const FlatKDTree *tree, const double *query, double r2, int *out, int cap,
+                       int *count, double *offset, double cellDist2, int node, int lo, int hi) {
+    if (node >= tree->nodeCount) {
+        const double *p = &tree->points[(size_t)lo * tree->dim];
+        for (int i = lo; i < hi; i++, p += tree->dim) {
+            if (squaredDistance(p, query, tree->dim) <= r2) {
+                if (*count < cap) out[*count] = tree->ids[i];
+                (*count)++;
+            }
+        }
+        return;
+    }
+    int mid = lo + (hi - lo) / 2;
+    int axis = tree->axis[node];
+    double diff = query[axis] - tree->split[node];
+    double old = offset[axis];
+    double farDist2 = cellDist2 - old * old + diff * diff;
+    if (diff < 0) {
+        radiusNode(tree, query, r2, out, cap, count, offset, cellDist2, 2 * node + 1, lo, mid);
+    } else {
+        radiusNode(tree, query, r2, out, cap, count, offset, cellDist2, 2 * node + 2, mid, hi);
+    }
+    if (farDist2 <= r2) {
+        offset[axis] = diff;
+        if (diff < 0) {
+            radiusNode(tree, query, r2, out, cap, count, offset, farDist2, 2 * node + 2, mid, hi);
+        } else {
+            radiusNode(tree, query, r2, out, cap, count, offset, farDist2, 2 * node + 1, lo, mid);
+        }
+        offset[axis] = old;
+    }
+}
+
+/**
+ * Encontra todos os pontos a distância <= radius de query. Até cap índices
+ * vão para out; retorna o total encontrado (pode ser maior que cap)
+ */
+int radiusSearch(const FlatKDTree *tree, const double *query, double radius, int *out, int cap) {
+    int count = 0;
+    double stackOffset[32];
+    double *offset = tree->dim <= 32 ? stackOffset : (double *)malloc(sizeof(double) * tree->dim);
+    for (int a = 0; a < tree->dim; a++) offset[a] = 0;
+    radiusNode(tree, query, radius * radius, out, cap, &count, offset, 0, 0, 0, tree->n);
+    if (offset != stackOffset) free(offset);
+    return count;
+}
+
+// ==================== CONSULTAS EM LOTE ====================
+
+typedef struct {
+    const FlatKDTree *tree;
+    const double *queries;
+    int k;
+    int *outIds;
+    double *outDist2;
+    int begin, end;
+} KnnTask;
+
+static void* knnTask(void *arg) {
+    KnnTask *t = (KnnTask *)arg;
+    for (int q = t->begin; q < t->end; q++) {
+        knnSearch(t->tree, &t->queries[(size_t)q * t->tree->dim], t->k,
+                  &t->outIds[(size_t)q * t->k], &t->outDist2[(size_t)q * t->k]);
+    }
+    return NULL;
+}
+
+/**
+ * k-NN para count consultas (queries: count * dim) com 'threads' threads.
+ * A consulta q escreve em outIds/outDist2[q*k .. q*k + k)
+ */
+void knnBatch(const FlatKDTree *tree, const double *queries, int count, int k,
+              int *outIds, double *outDist2, int threads) {
+    if (threads < 1) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+    pthread_t tid[MAX_THREADS];
+    KnnTask tasks[MAX_THREADS];
+    bool started[MAX_THREADS] = { false };
+    for (int t = 0; t < threads; t++) {
+        tasks[t] = (KnnTask){ tree, queries, k, outIds, outDist2,
+                              (int)((long)count * t / threads), (int)((long)count * (t + 1) / threads) };
+    }
+    // A thread atual faz o bloco 0; se pthread_create falhar, roda o bloco aqui
+    for (int t = 1; t < threads; t++) {
+        started[t] = pthread_create(&tid[t], NULL, knnTask, &tasks[t]) == 0;
+        if (!started[t]) knnTask(&tasks[t]);
+    }
+    knnTask(&tasks[0]);
+    for (int t = 1; t < threads; t++) {
+        if (started[t]) pthread_join(tid[t], NULL);
+    }
+}
+
+// ==================== VERSÃO ORIGINAL (kd_tree.c) ====================
+
+// Mesmo algoritmo de kd_tree.c: K = 2, qsort em todo nível, um nó por ponto
+#define K 2
+
+typedef struct Point {
+    double coords[K];
+} Point;
+
+typedef struct Node {
+    Point point;
+    struct Node *left;
+    struct Node *right;
+} Node;
+
+static int compareX(const void *a, const void *b) {
+    double d = ((const Point *)a)->coords[0] - ((const Point *)b)->coords[0];
+    return (d > 0) - (d < 0);
+}
+
+static int compareY(const void *a, const void *b) {
+    double d = ((const Point *)a)->coords[1] - ((const Point *)b)->coords[1];
+    return (d > 0) - (d < 0);
+}
+
+static Node* buildKDTree(Point points[], int n, int depth) {
+    if (n <= 0) return NULL;
+    qsort(points, n, sizeof(Point), depth % K == 0 ? compareX : compareY);
+    int median = n / 2;
+    Node *node = (Node *)malloc(sizeof(Node));
+    node->point = points[median];
+    node->left = buildKDTree(points, median, depth + 1);
+    node->right = buildKDTree(points + median + 1, n - median - 1, depth + 1);
+    return node;
+}
+
+static double distance(Point a, Point b) {
+    double sum = 0;
+    for (int i = 0; i < K; i++) {
+        double diff = a.coords[i] - b.coords[i];
+        sum += diff * diff;
+    }
+    return sqrt(sum);
+}
+
+static void nearestNeighborHelper(Node *node, Point target, int depth, Point *best, double *bestDist) {
+    if (node == NULL) return;
+    double d = distance(node->point, target);
+    if (d < *bestDist) {
+        *bestDist = d;
+        *best = node->point;
+    }
+    int axis = depth % K;
+    double diff = target.coords[axis] - node->point.coords[axis];
+    Node *near = (diff < 0) ? node->left : node->right;
+    Node *far = (diff < 0) ? node->right : node->left;
+    nearestNeighborHelper(near, target, depth + 1, best, bestDist);
+    if (fabs(diff) < *bestDist) nearestNeighborHelper(far, target, depth + 1, best, bestDist);
+}
+
+static void freeKDTree(Node *node) {
+    if (node == NULL) return;
+    freeKDTree(node->left);
+    freeKDTree(node->right);
+    free(node);
+}
+
+// ==================== TESTES ====================
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static double nextUniform() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (rngState >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Função para gerar pontos: uniformes ou em aglomerados (clusters)
+static void randomPoints(double *data, int n, int dim, bool clustered) {
+    for (int i = 0; i < n; i++) {
+        for (int a = 0; a < dim; a++) {
+            double v = nextUniform();
+            if (clustered) v = floor(v * 8) / 8 + nextUniform() * 0.01;
+            data[(size_t)i * dim + a] = v;
+        }
+    }
+}
+
+void testarExemplo() {
+    printf("=== TESTE: EXEMPLO DE kd_tree.c ===\n\n");
+
+    double data[] = { 2, 3, 5, 4, 9, 6, 4, 7, 8, 1, 7, 2 };
+    FlatKDTree *tree = buildFlatKDTree(data, 6, 2, 2);
+    double query[] = { 6, 5 };
+    int ids[3];
+    double d2[3];
+    int found = knnSearch(tree, query, 3, ids, d2);
+
+    printf("Pontos: (2,3) (5,4) (9,6) (4,7) (8,1) (7,2), consulta (6, 5)\n");
+    printf("3 vizinhos mais próximos:");
+    for (int i = 0; i < found; i++) {
+        printf(" (%.0f,%.0f) d=%.2f", data[2 * ids[i]], data[2 * ids[i] + 1], sqrt(d2[i]));
+    }
+    int inside[6];
+    int count = radiusSearch(tree, query, 3.0, inside, 6);
+    printf("\nPontos a distância <= 3: %d\n", count);
+
+    // (5,4) d²=2, (4,7) d²=8, (7,2) d²=10: o raio 3 (9) pega só os dois primeiros
+    bool ok = found == 3 && ids[0] == 1 && ids[1] == 3 && ids[2] == 5 &&
+              d2[0] == 2 && d2[1] == 8 && d2[2] == 10 && count == 2;
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    freeFlatKDTree(tree);
+}
+
+void testarForcaBruta() {
+    printf("=== TESTE: K-NN E RAIO CONTRA FORÇA BRUTA ===\n\n");
+
+    enum { N = 3000, Q = 200, KMAX = 16 };
+    int dims[] = { 1, 2, 3, 8 };
+    bool ok = true;
+    double *data = (double *)malloc(sizeof(double) * N * 8);
+    double *brute = (double *)malloc(sizeof(double) * N);
+    int *inside = (int *)malloc(sizeof(int) * N);
+
+    for (int di = 0; di < 4 && ok; di++) {
+        int dim = dims[di];
+        for (int clustered = 0; clustered <= 1 && ok; clustered++) {
+            randomPoints(data, N, dim, clustered);
+            // Duplicatas de propósito
+            memcpy(&data[dim * 10], &data[dim * 20], sizeof(double) * dim);
+            FlatKDTree *tree = buildFlatKDTree(data, N, dim, 1 + di * 5);
+
+            for (int q = 0; q < Q && ok; q++) {
+                double query[8];
+                for (int a = 0; a < dim; a++) query[a] = nextUniform();
+                for (int i = 0; i < N; i++) brute[i] = squaredDistance(&data[(size_t)i * dim], query, dim);
+
+                int k = 1 + q % KMAX, ids[KMAX];
+                double d2[KMAX];
+                int found = knnSearch(tree, query, k, ids, d2);
+                ok = found == k;
+                for (int i = 0; i < found && ok; i++) {
+                    // k-ésima menor distância por contagem (empates não importam)
+                    int smaller = 0;
+                    for (int j = 0; j < N; j++) smaller += brute[j] < d2[i];
+                    ok = smaller <= i && brute[ids[i]] == d2[i] && (i == 0 || d2[i - 1] <= d2[i]);
+                }
+
+                double r = 0.02 + 0.1 * nextUniform() * dim;
+                int count = radiusSearch(tree, query, r, inside, N), expected = 0;
+                for (int i = 0; i < N; i++) expected += brute[i] <= r * r;
+                ok = ok && count == expected;
+                for (int i = 0; i < count && ok; i++) ok = brute[inside[i]] <= r * r;
+            }
+            freeFlatKDTree(tree);
+        }
+    }
+    printf("Dimensões 1, 2, 3 e 8, pontos uniformes e aglomerados, k = 1..%d\n", KMAX);
+    printf("%d consultas k-NN e raio conferidas\n", 4 * 2 * Q);
+
+    // Lote com threads deve dar o mesmo que consultas isoladas
+    randomPoints(data, N, 3, false);
+    FlatKDTree *tree = buildFlatKDTree(data, N, 3, 0);
+    double *queries = (double *)malloc(sizeof(double) * Q * 3);
+    randomPoints(queries, Q, 3, false);
+    int *batchIds = (int *)malloc(sizeof(int) * Q * 4);
+    double *batchD2 = (double *)malloc(sizeof(double) * Q * 4);
+    knnBatch(tree, queries, Q, 4, batchIds, batchD2, 3);
+    for (int q = 0; q < Q && ok; q++) {
+        int ids[4];
+        double d2[4];
+        knnSearch(tree, &queries[q * 3], 4, ids, d2);
+        ok = memcmp(ids, &batchIds[q * 4], sizeof(ids)) == 0;
+    }
+    printf("knnBatch com 3 threads igual às consultas isoladas\n");
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+
+    freeFlatKDTree(tree);
+    free(queries);
+    free(batchIds);
+    free(batchD2);
+    free(data);
+    free(brute);
+    free(inside);
+}
+
+// ==================== BENCHMARK ====================
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void benchmark(int n, int queries, int maxThreads) {
+    printf("=== BENCHMARK: %d pontos, %d consultas ===\n\n", n, queries);
+
+    double *data = (double *)malloc(sizeof(double) * (size_t)n * 8);
+    double *qs = (double *)malloc(sizeof(double) * (size_t)queries * 8);
+    int *ids = (int *)malloc(sizeof(int) * (size_t)queries * 10);
+    double *d2 = (double *)malloc(sizeof(double) * (size_t)queries * 10);
+    volatile double sink = 0;
+    double start;
+
+    // 2D: contra kd_tree.c
+    randomPoints(data, n, 2, false);
+    randomPoints(qs, queries, 2, false);
+    Point *pts = (Point *)malloc(sizeof(Point) * n);
+    for (int i = 0; i < n; i++) {
+        pts[i].coords[0] = data[2 * i];
+        pts[i].coords[1] = data[2 * i + 1];
+    }
+    start = nowSeconds();
+    Node *root = buildKDTree(pts, n, 0);
+    double tOldBuild = nowSeconds() - start;
+    start = nowSeconds();
+    for (int q = 0; q < queries; q++) {
+        Point target = { { qs[2 * q], qs[2 * q + 1] } }, best = root->point;
+        double bestDist = DBL_MAX;
+        nearestNeighborHelper(root, target, 0, &best, &bestDist);
+        sink += bestDist;
+        d2[q] = bestDist * bestDist;
+    }
+    double tOldQuery = nowSeconds() - start;
+    freeKDTree(root);
+    free(pts);
+
+    start = nowSeconds();
+    FlatKDTree *tree = buildFlatKDTree(data, n, 2, 0);
+    double tBuild = nowSeconds() - start;
+    start = nowSeconds();
+    bool ok = true;
+    for (int q = 0; q < queries; q++) {
+        int id;
+        double dist2;
+        knnSearch(tree, &qs[2 * q], 1, &id, &dist2);
+        ok = ok && fabs(dist2 - d2[q]) <= 1e-12;
+    }
+    double tQuery = nowSeconds() - start;
+
+    printf("2D, vizinho mais próximo     build (s)   consulta (µs)\n");
+    printf("  kd_tree.c (qsort, nós)      %8.2f   %10.2f\n", tOldBuild, 1e6 * tOldQuery / queries);
+    printf("  plana (quickselect, bucket) %8.2f   %10.2f\n", tBuild, 1e6 * tQuery / queries);
+    printf("  mesmas distâncias: %s\n\n", ok ? "OK" : "FALHA");
+    freeFlatKDTree(tree);
+
+    // k-NN (k = 10), raio e lote em várias dimensões
+    printf("%-4s %10s %12s %12s %14s", "dim", "build (s)", "10-NN (µs)", "raio (µs)", "pontos/raio");
+    for (int t = 1; t <= maxThreads; t *= 2) printf("  lote %dT (µs)", t);
+    printf("\n");
+    int dims[] = { 2, 3, 8 };
+    for (int di = 0; di < 3; di++) {
+        int dim = dims[di];
+        randomPoints(data, n, dim, false);
+        randomPoints(qs, queries, dim, false);
+        start = nowSeconds();
+        tree = buildFlatKDTree(data, n, dim, 0);
+        tBuild = nowSeconds() - start;
+
+        start = nowSeconds();
+        for (int q = 0; q < queries; q++) knnSearch(tree, &qs[(size_t)q * dim], 10, &ids[q * 10], &d2[q * 10]);
+        double tKnn = nowSeconds() - start;
+
+        // Raio que pega ~10 pontos em média (volume da bola = 10 / n)
+        double unitBall = pow(PI, dim / 2.0) / tgamma(dim / 2.0 + 1);
+        double radius = pow(10.0 / n / unitBall, 1.0 / dim);
+        long total = 0;
+        start = nowSeconds();
+        for (int q = 0; q < queries; q++) total += radiusSearch(tree, &qs[(size_t)q * dim], radius, NULL, 0);
+        double tRadius = nowSeconds() - start;
+
+        printf("%-4d %10.2f %12.2f %12.2f %14.1f", dim, tBuild, 1e6 * tKnn / queries,
+               1e6 * tRadius / queries, (double)total / queries);
+        for (int t = 1; t <= maxThreads; t *= 2) {
+            start = nowSeconds();
+            knnBatch(tree, qs, queries, 10, ids, d2, t);
+            printf("  %12.2f", 1e6 * (nowSeconds() - start) / queries);
+        }
+        printf("\n");
+        freeFlatKDTree(tree);
+    }
+    printf("\n");
+
+    free(data);
+    free(qs);
+    free(ids);
+    free(d2);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║             K-D TREE PLANA                               ║\n");
+    printf("║   Array implícito, buckets, k-NN, raio e lote            ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int queries = (argc > 2) ? atoi(argv[2]) : 200000;
+    int maxThreads = (argc > 3) ? atoi(argv[3]) : 4;
+    if (n < 100) n = 100;
+    if (queries < 1) queries = 1;
+    if (maxThreads < 1) maxThreads = 1;
+    if (maxThreads > MAX_THREADS) maxThreads = MAX_THREADS;
+
+    testarExemplo();
+    testarForcaBruta();
+    benchmark(n, queries, maxThreads);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da K-D Tree Plana:\n");
+    printf("- Dimensão escolhida em tempo de execução\n");
+    printf("- Build O(n log n) com quickselect, sem ponteiros por nó\n");
+    printf("- Folhas em buckets contíguos: varredura sequencial\n");
+    printf("- k-NN com max-heap limitado, busca por raio, lote paralelo\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,717 @@
+/**
+ * ============================================================================
+ * B+ TREE CONCORRENTE - OPTIMISTIC LOCK COUPLING (OLC)
+ * ============================================================================
+ *
+ * insertNonFull/splitChild em b_tree.c supõem uma única thread. A forma
+ * ingênua de compartilhar a árvore é um rwlock global: leitores em paralelo,
+ * mas cada escritor para a árvore inteira. Optimistic Lock Coupling (Leis et
+ * al., 2019) troca o lock global por um "latch de versão" em cada nó:
+ *
+ * LATCH DE VERSÃO (64 bits por nó):
+ * - bit 0: travado para escrita
+ * - bits 1..63: contador de versão, incrementado a cada destravamento
+ *
+ * LEITOR (nunca escreve em memória compartilhada, nunca bloqueia):
+ * 1. Lê a versão do nó (espera se travado)
+ * 2. Lê o conteúdo do nó (busca binária, ponteiro do filho)
+ * 3. Confere se a versão não mudou; se mudou, RECOMEÇA da raiz
+ * Lock coupling: a versão do pai só é validada depois que a do filho foi
+ * lida, então um split entre as duas leituras é sempre detectado.
+ *
+ * ESCRITOR:
+ * - Desce como um leitor; só trava (CAS versão -> versão | 1) a folha
+ *   alterada e, num split, o pai e o nó dividido
+ * - Nós internos cheios são divididos já na descida, então o pai sempre
+ *   tem espaço para a nova chave separadora
+ * - Destravar soma 1: limpa o bit 0 e incrementa a versão em um único passo
+ *
+ * Como não há remoção (nem em b_tree.c), nenhum nó é liberado enquanto a
+ * árvore está em uso: um leitor atrasado pode ler um nó "velho", mas nunca
+ * memória liberada. Como no artigo original, as leituras otimistas são
+ * loads comuns; qualquer leitura inconsistente é descartada pela validação.
+ *
+ * Compilação: gcc -O2 -std=c11 -pthread b_tree_concorrente_olc.c
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define NODE_CAP 64
+
+// ==================== ESTRUTURAS ====================
+
+typedef struct OLCNode OLCNode;
+
+struct OLCNode {
+    _Atomic uint64_t version;
+    int is_leaf;
+    int count;                          // Chaves no nó
+    int32_t keys[NODE_CAP];
+    int32_t values[NODE_CAP];           // Folhas
+    OLCNode *children[NODE_CAP + 1];    // Internos: keys[i] = menor chave de children[i + 1]
+    OLCNode *next;                      // Folhas: próxima folha
+};
+
+typedef struct {
+    _Atomic(OLCNode *) root;
+    _Atomic long size;
+} OLCTree;
+
+// ==================== LATCH DE VERSÃO ====================
+
+static inline void cpu_relax(int *spins) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+    // Com menos núcleos que threads, o dono do latch pode estar fora da CPU
+    if (++(*spins) % 64 == 0) {
+        sched_yield();
+    }
+}
+
+/**
+ * Lê a versão de um nó, esperando enquanto estiver travado
+ */
+static inline uint64_t read_lock(OLCNode *node) {
+    uint64_t v = atomic_load_explicit(&node->version, memory_order_acquire);
+    int spins = 0;
+    while (v & 1) {
+        cpu_relax(&spins);
+        v = atomic_load_explicit(&node->version, memory_order_acquire);
+    }
+    return v;
+}
+
+/**
+ * Valida uma leitura otimista: true se o nó não mudou desde a versão v
+ */
+static inline bool validate(OLCNode *node, uint64_t v) {
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&node->version, memory_order_relaxed) == v;
+}
+
+/**
+ * Trava para escrita se a versão ainda é v (senão o chamador recomeça)
+ */
+static inline bool upgrade_to_write_lock(OLCNode *node, uint64_t v) {
+    return atomic_compare_exchange_strong(&node->version, &v, v + 1);
+}
+
+static inline void write_unlock(OLCNode *node) {
+    atomic_fetch_add_explicit(&node->version, 1, memory_order_release);
+}
+
+// ==================== NÓS ====================
+
+static OLCNode* create_node(int is_leaf) {
+    OLCNode *node = NULL;
+    if (posix_memalign((void **)&node, 64, sizeof(OLCNode)) != 0) {
+        fprintf(stderr, "Erro ao alocar nó\n");
+        exit(1);
+    }
+    memset(node, 0, sizeof(OLCNode));
+    atomic_init(&node->version, 0);
+    node->is_leaf = is_leaf;
+    return node;
+}
+
+static inline int node_count(const OLCNode *node) {
+    // Numa leitura otimista o valor pode estar no meio de uma alteração
+    int n = node->count;
+    return n < 0 ? 0 : (n > NODE_CAP ? NODE_CAP : n);
+}
+
+static inline int lower_bound(const int32_t *keys, int n, int32_t key) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (keys[mid] < key) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+static inline int upper_bound(const int32_t *keys, int n, int32_t key) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (keys[mid] <= key) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * Divide uma folha cheia; devolve a nova folha à direita e a separadora
+ */
+static OLCNode* split_leaf(OLCNode *leaf, int32_t *sep) {
+    OLCNode *right = create_node(1);
+    int half = leaf->count / 2;
+    right->count = leaf->count - half;
+    memcpy(right->keys, &leaf->keys[half], right->count * sizeof(int32_t));
+    memcpy(right->values, &leaf->values[half], right->count * sizeof(int32_t));
+    right->next = leaf->next;
+    leaf->next = right;
+    leaf->count = half;
+    *sep = right->keys[0];
+    return right;
+}
+
+/**
+ * Divide um nó interno cheio; a chave do meio sobe para o pai
+ */
+static OLCNode* split_inner(OLCNode *inner, int32_t *sep) {
+    OLCNode *right = create_node(0);
+    int mid = inner->count / 2;
+    right->count = inner->count - mid - 1;
+    memcpy(right->keys, &inner->keys[mid + 1], right->count * sizeof(int32_t));
+    memcpy(right->children, &inner->children[mid + 1], (right->count + 1) * sizeof(OLCNode *));
+    *sep = inner->keys[mid];
+    inner->count = mid;
+    return right;
+}
+
+static void inner_insert(OLCNode *inner, int32_t sep, OLCNode *right) {
+    int pos = upper_bound(inner->keys, inner->count, sep);
+    memmove(&inner->keys[pos + 1], &inner->keys[pos], (inner->count - pos) * sizeof(int32_t));
+    memmove(&inner->children[pos + 2], &inner->children[pos + 1], (inner->count - pos) * sizeof(OLCNode *));
+    inner->keys[pos] = sep;
+    inner->children[pos + 1] = right;
+    inner->count++;
+}
+
+/**
+ * Insere na folha (travada); devolve true se a chave é nova
+ */
+static bool leaf_insert(OLCNode *leaf, int32_t key, int32_t value) {
+    int pos = lower_bound(leaf->keys, leaf->count, key);
+    if (pos < leaf->count && leaf->keys[pos] == key) {
+        leaf->values[pos] = value;
+        return false;
+    }
+    memmove(&leaf->keys[pos + 1], &leaf->keys[pos], (leaf->count - pos) * sizeof(int32_t));
+    memmove(&leaf->values[pos + 1], &leaf->values[pos], (leaf->count - pos) * sizeof(int32_t));
+    leaf->keys[pos] = key;
+    leaf->values[pos] = value;
+    leaf->count++;
+    return true;
+}
+
+/**
+ * Nova raiz acima de 'left' (travado); publicada antes de destravar 'left',
+ * para que um leitor que veja a nova versão de 'left' veja também a raiz nova
+ */
+static void make_root(OLCTree *tree, int32_t sep, OLCNode *left, OLCNode *right) {
+    OLCNode *root = create_node(0);
+    root->count = 1;
+    root->keys[0] = sep;
+    root->children[0] = left;
+    root->children[1] = right;
+    atomic_store_explicit(&tree->root, root, memory_order_release);
+}
+
+// ==================== OPERAÇÕES ====================
+
+OLCTree* olc_create() {
+    OLCTree *tree = (OLCTree *)malloc(sizeof(OLCTree));
+    atomic_init(&tree->root, create_node(1));
+    atomic_init(&tree->size, 0);
+    return tree;
+}
+
+/**
+ * Busca: sem escrita em memória compartilhada, recomeça em conflito
+ */
+bool olc_lookup(OLCTree *tree, int32_t key, int32_t *value) {
+restart:;
+    OLCNode *node = atomic_load_explicit(&tree->root, memory_order_acquire);
+    uint64_t v = read_lock(node);
+    if (node != atomic_load_explicit(&tree->root, memory_order_acquire)) goto restart;
+
+    OLCNode *parent = NULL;
+    uint64_t parent_v = 0;
+
+    while (!node->is_leaf) {
+        if (parent != NULL && !validate(parent, parent_v)) goto restart;
+        parent = node;
+        parent_v = v;
+        node = parent->children[upper_bound(parent->keys, node_count(parent), key)];
+        if (node == NULL || !validate(parent, parent_v)) goto restart;
+        v = read_lock(node);
+    }
+
+    int n = node_count(node);
+    int pos = lower_bound(node->keys, n, key);
+    bool found = pos < n && node->keys[pos] == key;
+    int32_t result = found ? node->values[pos] : 0;
+
+    if (parent != NULL && !validate(parent, parent_v)) goto restart;
+    if (!validate(node, v)) goto restart;
+
+    if (found && value != NULL) *value = result;
+    return found;
+}
+
+/**
+ * Inserção (ou atualização): trava só a folha, ou pai + nó num split
+ */
+void olc_insert(OLCTree *tree, int32_t key, int32_t value) {
+restart:;
+    OLCNode *node = atomic_load_explicit(&tree->root, memory_order_acquire);
+    uint64_t v = read_lock(node);
+    if (node != atomic_load_explicit(&tree->root, memory_order_acquire)) goto restart;
+
+    OLCNode *parent = NULL;
+    uint64_t parent_v = 0;
+
+    while (true) {
+        if (node->count == NODE_CAP) {
+            // Nó cheio: divide agora (folha ou interno) e recomeça
+            if (parent != NULL && !upgrade_to_write_lock(parent, parent_v)) goto restart;
+            if (!upgrade_to_write_lock(node, v)) {
+                if (parent != NULL) write_unlock(parent);
+                goto restart;
+            }
+            if (parent == NULL && node != atomic_load(&tree->root)) {
+                write_unlock(node);        // Outra thread já trocou a raiz
+                goto restart;
+            }
+            int32_t sep;
+            OLCNode *right = node->is_leaf ? split_leaf(node, &sep) : split_inner(node, &sep);
+            if (parent != NULL) {
+                inner_insert(parent, sep, right);
+            } else {
+                make_root(tree, sep, node, right);
+            }
+            write_unlock(node);
+            if (parent != NULL) write_unlock(parent);
+            goto restart;
+        }
+
+        if (node->is_leaf) break;
+
+        if (parent != NULL && !validate(parent, parent_v)) goto restart;
+        parent = node;
+        parent_v = v;
+        node = parent->children[upper_bound(parent->keys, node_count(parent), key)];
+        if (node == NULL || !validate(parent, parent_v)) goto restart;
+        v = read_lock(node);
+    }
+
+    if (!upgrade_to_write_lock(node, v)) goto restart;
+    if (parent != NULL && !validate(parent, parent_v)) {
+        write_unlock(node);
+        goto restart;
+    }
+    bool inserted = leaf_insert(node, key, value);
+    write_unlock(node);
+    if (inserted) {
+        atomic_fetch_add_explicit(&tree->size, 1, memory_order_relaxed);
+    }
+}
+
+/**
+ * Desce até a folha que deve conter 'key'; devolve a folha e sua versão
+ */
+static OLCNode* find_leaf(OLCTree *tree, int32_t key, uint64_t *leaf_v) {
+restart:;
+    OLCNode *node = atomic_load_explicit(&tree->root, memory_order_acquire);
+    uint64_t v = read_lock(node);
+    if (node != atomic_load_explicit(&tree->root, memory_order_acquire)) goto restart;
+
+    OLCNode *parent = NULL;
+    uint64_t parent_v = 0;
+    while (!node->is_leaf) {
+        if (parent != NULL && !validate(parent, parent_v)) goto restart;
+        parent = node;
+        parent_v = v;
+        node = parent->children[upper_bound(parent->keys, node_count(parent), key)];
+        if (node == NULL || !validate(parent, parent_v)) goto restart;
+        v = read_lock(node);
+    }
+    if (parent != NULL && !validate(parent, parent_v)) goto restart;
+    *leaf_v = v;
+    return node;
+}
+
+/**
+ * Varredura: até 'max' pares com chave >= start, em ordem.
+ * Cada folha é lida de forma consistente; splits só movem chaves para a
+ * direita, então seguir 'next' nunca pula chaves que já existiam.
+ */
+int olc_scan(OLCTree *tree, int32_t start, int max, int32_t *out_keys, int32_t *out_values) {
+    int total = 0;
+    int32_t from = start;
+
+    while (total < max) {
+        uint64_t v;
+        OLCNode *leaf = find_leaf(tree, from, &v);
+
+        while (true) {
+            int32_t keys[NODE_CAP], values[NODE_CAP];
+            int n = node_count(leaf);
+            int pos = lower_bound(leaf->keys, n, from);
+            int k = 0;
+            for (int i = pos; i < n && total + k < max; i++, k++) {
+                keys[k] = leaf->keys[i];
+                values[k] = leaf->values[i];
+            }
+            OLCNode *next = leaf->next;
+            if (!validate(leaf, v)) break;           // Refaz a partir de 'from'
+
+            memcpy(&out_keys[total], keys, k * sizeof(int32_t));
+            memcpy(&out_values[total], values, k * sizeof(int32_t));
+            total += k;
+            if (k > 0) {
+                if (keys[k - 1] == INT32_MAX) return total;
+                from = keys[k - 1] + 1;
+            }
+            if (total == max || next == NULL) return total;
+
+            leaf = next;
+            v = read_lock(leaf);
+        }
+    }
+    return total;
+}
+
+static void destroy_rec(OLCNode *node) {
+    if (!node->is_leaf) {
+        for (int i = 0; i <= node->count; i++) {
+            destroy_rec(node->children[i]);
+        }
+    }
+    free(node);
+}
+
+void olc_destroy(OLCTree *tree) {
+    destroy_rec(atomic_load(&tree->root));
+    free(tree);
+}
+
+// ==================== VERIFICAÇÃO ====================
+
+static bool verify_rec(OLCNode *node, long lo, long hi, int depth, int *leaf_depth, long *count) {
+    if (node->version & 1) return false;
+    for (int i = 0; i < node->count; i++) {
+        if (node->keys[i] < lo || node->keys[i] >= hi) return false;
+        if (i > 0 && node->keys[i - 1] >= node->keys[i]) return false;
+    }
+    if (node->is_leaf) {
+        if (*leaf_depth < 0) *leaf_depth = depth;
+        *count += node->count;
+        return *leaf_depth == depth;
+    }
+    for (int i = 0; i <= node->count; i++) {
+        long clo = (i == 0) ? lo : node->keys[i - 1];
+        long chi = (i == node->count) ? hi : node->keys[i];
+        if (!verify_rec(node->children[i], clo, chi, depth + 1, leaf_depth, count)) return false;
+    }
+    return true;
+}
+
+/**
+ * Verifica ordenação, profundidade uniforme, contagem e a lista de folhas
+ */
+bool olc_verify(OLCTree *tree) {
+    OLCNode *root = atomic_load(&tree->root);
+    int leaf_depth = -1;
+    long count = 0;
+    if (!verify_rec(root, -2147483648L, 2147483648L, 0, &leaf_depth, &count)) return false;
+
+    OLCNode *leaf = root;
+    while (!leaf->is_leaf) leaf = leaf->children[0];
+    long chained = 0;
+    long prev = -2147483649L;
+    for (; leaf != NULL; leaf = leaf->next) {
+        for (int i = 0; i < leaf->count; i++) {
+            if (leaf->keys[i] <= prev) return false;
+            prev = leaf->keys[i];
+        }
+        chained += leaf->count;
+    }
+    return count == chained && count == atomic_load(&tree->size);
+}
+
+// ==================== UTILITÁRIOS ====================
+
+static inline uint64_t xorshift64(uint64_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return *s;
+}
+
+// Embaralha i em uma chave positiva de 31 bits (bijeção)
+static inline int32_t key_of(uint32_t i) {
+    uint32_t x = i * 2654435761u;
+    x ^= x >> 15;
+    x *= 2246822519u;
+    x ^= x >> 13;
+    return (int32_t)(x & 0x7fffffff);
+}
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// ==================== TESTE CONCORRENTE ====================
+
+#define TEST_PRELOAD 100000
+#define TEST_WRITERS 4
+#define TEST_READERS 4
+#define TEST_PER_WRITER 50000
+
+typedef struct {
+    OLCTree *tree;
+    int id;
+    _Atomic bool *stop;
+    long errors;
+} TestArgs;
+
+// Escritores inserem chaves ímpares disjuntas (id, id + W, id + 2W, ...)
+static void* test_writer(void *arg) {
+    TestArgs *a = (TestArgs *)arg;
+    for (int i = 0; i < TEST_PER_WRITER; i++) {
+        int32_t key = 2 * (a->id + i * TEST_WRITERS) + 1;
+        olc_insert(a->tree, key, key * 3);
+    }
+    return NULL;
+}
+
+// Leitores exigem que as chaves pares pré-carregadas NUNCA sumam durante os splits
+static void* test_reader(void *arg) {
+    TestArgs *a = (TestArgs *)arg;
+    uint64_t s = 0x9E3779B97F4A7C15ull + (uint64_t)a->id;
+    int32_t keys[100], values[100];
+    while (!atomic_load(a->stop)) {
+        int32_t key = 2 * (int32_t)(xorshift64(&s) % TEST_PRELOAD);
+        int32_t v;
+        if (!olc_lookup(a->tree, key, &v) || v != key * 3) a->errors++;
+
+        int n = olc_scan(a->tree, key, 100, keys, values);
+        for (int i = 0; i < n; i++) {
+            if ((i > 0 && keys[i] <= keys[i - 1]) || values[i] != keys[i] * 3) a->errors++;
+        }
+        // Entre duas chaves pares consecutivas não pode faltar nenhuma
+        for (int i = 1; i < n; i++) {
+            if (keys[i] < 2 * TEST_PRELOAD && keys[i] - keys[i - 1] > 2) a->errors++;
+        }
+    }
+    return NULL;
+}
+
+void testar_concorrencia() {
+    printf("=== TESTE CONCORRENTE ===\n\n");
+
+    OLCTree *tree = olc_create();
+    for (int i = 0; i < TEST_PRELOAD; i++) {
+        olc_insert(tree, 2 * i, 2 * i * 3);
+    }
+
+    pthread_t threads[TEST_WRITERS + TEST_READERS];
+    TestArgs args[TEST_WRITERS + TEST_READERS];
+    _Atomic bool stop;
+    atomic_init(&stop, false);
+
+    for (int i = 0; i < TEST_WRITERS + TEST_READERS; i++) {
+        args[i] = (TestArgs){ tree, i, &stop, 0 };
+    }
+    for (int i = 0; i < TEST_READERS; i++) {
+        pthread_create(&threads[TEST_WRITERS + i], NULL, test_reader, &args[TEST_WRITERS + i]);
+    }
+    for (int i = 0; i < TEST_WRITERS; i++) {
+        pthread_create(&threads[i], NULL, test_writer, &args[i]);
+    }
+    for (int i = 0; i < TEST_WRITERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    atomic_store(&stop, true);
+
+    long errors = 0;
+    for (int i = 0; i < TEST_READERS; i++) {
+        pthread_join(threads[TEST_WRITERS + i], NULL);
+        errors += args[TEST_WRITERS + i].errors;
+    }
+
+    long missing = 0;
+    for (int i = 0; i < TEST_WRITERS * TEST_PER_WRITER; i++) {
+        int32_t v;
+        if (!olc_lookup(tree, 2 * i + 1, &v) || v != (2 * i + 1) * 3) missing++;
+    }
+
+    long expected = TEST_PRELOAD + (long)TEST_WRITERS * TEST_PER_WRITER;
+    bool ok = errors == 0 && missing == 0 && olc_verify(tree) && atomic_load(&tree->size) == expected;
+    printf("%d escritores inseriram %d chaves enquanto %d leitores buscavam e varriam\n",
+           TEST_WRITERS, TEST_WRITERS * TEST_PER_WRITER, TEST_READERS);
+    printf("Leituras inconsistentes: %ld | chaves ausentes: %ld | tamanho: %ld\n",
+           errors, missing, (long)atomic_load(&tree->size));
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    olc_destroy(tree);
+}
+
+// ==================== BENCHMARK (ESTILO YCSB) ====================
+
+typedef enum { WORKLOAD_READ_HEAVY, WORKLOAD_WRITE_HEAVY, WORKLOAD_SCAN } Workload;
+
+static const char *workload_names[] = {
+    "Leitura intensa (95% busca, 5% atualização)",
+    "Escrita intensa (50% busca, 50% inserção)",
+    "Varredura (95% scan de 100, 5% inserção)",
+};
+
+typedef struct {
+    OLCTree *tree;
+    pthread_rwlock_t *global_lock;      // NULL = OLC; senão, lock global
+    Workload workload;
+    uint32_t preload;
+    uint64_t seed;
+    _Atomic bool *stop;
+    long ops;
+} BenchArgs;
+
+static void* bench_worker(void *arg) {
+    BenchArgs *a = (BenchArgs *)arg;
+    uint64_t s = a->seed;
+    int32_t keys[100], values[100];
+    long ops = 0;
+
+    while (!atomic_load_explicit(a->stop, memory_order_relaxed)) {
+        for (int batch = 0; batch < 64; batch++) {
+            uint64_t r = xorshift64(&s);
+            int pct = (int)(r % 100);
+            int32_t existing = key_of((uint32_t)((r >> 8) % a->preload));
+            bool write;
+            int32_t key;
+
+            switch (a->workload) {
+                case WORKLOAD_READ_HEAVY:
+                    write = pct < 5;
+                    key = existing;                          // Atualização
+                    break;
+                case WORKLOAD_WRITE_HEAVY:
+                    write = pct < 50;
+                    key = write ? (int32_t)(xorshift64(&s) & 0x7fffffff) : existing;
+                    break;
+                default:
+                    write = pct < 5;
+                    key = write ? (int32_t)(xorshift64(&s) & 0x7fffffff) : existing;
+                    break;
+            }
+
+            if (a->global_lock != NULL) {
+                if (write) pthread_rwlock_wrlock(a->global_lock);
+                else pthread_rwlock_rdlock(a->global_lock);
+            }
+            if (write) {
+                olc_insert(a->tree, key, (int32_t)r);
+            } else if (a->workload == WORKLOAD_SCAN) {
+                olc_scan(a->tree, key, 100, keys, values);
+            } else {
+                olc_lookup(a->tree, key, NULL);
+            }
+            if (a->global_lock != NULL) {
+                pthread_rwlock_unlock(a->global_lock);
+            }
+            ops++;
+        }
+    }
+    a->ops = ops;
+    return NULL;
+}
+
+static double run_bench(OLCTree *tree, pthread_rwlock_t *lock, Workload w, uint32_t preload,
+                        int num_threads, double seconds) {
+    pthread_t threads[32];
+    BenchArgs args[32];
+    _Atomic bool stop;
+    atomic_init(&stop, false);
+
+    for (int i = 0; i < num_threads; i++) {
+        args[i] = (BenchArgs){ tree, lock, w, preload, 0x2545F4914F6CDD1Dull * (i + 1), &stop, 0 };
+        pthread_create(&threads[i], NULL, bench_worker, &args[i]);
+    }
+    struct timespec ts = { (time_t)seconds, (long)((seconds - (long)seconds) * 1e9) };
+    double t = now_seconds();
+    nanosleep(&ts, NULL);
+    atomic_store(&stop, true);
+
+    long ops = 0;
+    for (int i = 0; i < num_threads; i++) {
+        pthread_join(threads[i], NULL);
+        ops += args[i].ops;
+    }
+    return ops / (now_seconds() - t);
+}
+
+void benchmark(uint32_t preload, double seconds) {
+    printf("=== BENCHMARK (estilo YCSB, %u chaves pré-carregadas, %.1f s por medição) ===\n\n",
+           preload, seconds);
+    int thread_counts[] = { 1, 2, 4, 8, 16, 32 };
+
+    for (int w = 0; w < 3; w++) {
+        printf("%s\n", workload_names[w]);
+        printf("%-8s %18s %18s %8s\n", "Threads", "Lock global (op/s)", "OLC (op/s)", "Ganho");
+
+        OLCTree *global_tree = olc_create();
+        OLCTree *olc_tree = olc_create();
+        for (uint32_t i = 0; i < preload; i++) {
+            olc_insert(global_tree, key_of(i), (int32_t)i);
+            olc_insert(olc_tree, key_of(i), (int32_t)i);
+        }
+        pthread_rwlock_t lock;
+        pthread_rwlock_init(&lock, NULL);
+
+        for (int t = 0; t < 6; t++) {
+            double global_ops = run_bench(global_tree, &lock, (Workload)w, preload, thread_counts[t], seconds);
+            double olc_ops = run_bench(olc_tree, NULL, (Workload)w, preload, thread_counts[t], seconds);
+            printf("%-8d %18.0f %18.0f %7.2fx\n", thread_counts[t], global_ops, olc_ops, olc_ops / global_ops);
+        }
+        printf("Estrutura válida após o benchmark: %s\n\n",
+               olc_verify(olc_tree) && olc_verify(global_tree) ? "OK" : "FALHA");
+
+        pthread_rwlock_destroy(&lock);
+        olc_destroy(global_tree);
+        olc_destroy(olc_tree);
+    }
+}
+
+// ==================== FUNÇÃO PRINCIPAL ====================
+
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║          B+ TREE CONCORRENTE - LOCK COUPLING OTIMISTA    ║\n");
+    printf("║     Latches de versão por nó, leitores sem bloqueio      ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    uint32_t preload = (argc > 1) ? (uint32_t)atoi(argv[1]) : 1000000;
+    double seconds = (argc > 2) ? atof(argv[2]) : 0.3;
+    if (preload < 1000) preload = 1000;
+
+    testar_concorrencia();
+    benchmark(preload, seconds);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades do Optimistic Lock Coupling:\n");
+    printf("- Leitores não escrevem em memória compartilhada (sem\n");
+    printf("  contenção de cache line na raiz)\n");
+    printf("- Escritores travam só a folha, ou pai + nó num split\n");
+    printf("- Conflito detectado pela versão -> recomeça da raiz\n");
+    printf("- Splits de internos na descida: o pai sempre tem espaço\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
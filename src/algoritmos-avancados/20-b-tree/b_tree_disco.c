@@ -0,0 +1,1138 @@
+/**
+ * ============================================================================
+ * B-TREE EM DISCO - PÁGINAS, BUFFER POOL (CLOCK) E WRITE-AHEAD LOG
+ * ============================================================================
+ *
+ * b_tree.c mantém os nós na memória: tudo se perde quando o processo
+ * termina, e o índice não pode ser maior que a RAM. Este arquivo implementa
+ * um índice ordenado embutido (chave -> valor) que sobrevive ao processo:
+ *
+ * ARQUIVO DE DADOS (páginas de 4 KB):
+ * - Página 0: cabeçalho (raiz, número de páginas, altura, número de chaves)
+ * - Demais páginas: nós de uma B+ Tree (folhas com pares chave/valor,
+ *   nós internos com chaves separadoras e números de página dos filhos)
+ *
+ * BUFFER POOL:
+ * - Quadros (frames) de 4 KB na memória, em número fixo enquanto a altura
+ *   da árvore couber nele; uma árvore mais alta aumenta o pool
+ * - Tabela hash página -> quadro; páginas em uso ficam "pinadas"
+ * - Substituição CLOCK: um ponteiro circular dá uma "segunda chance" às
+ *   páginas com bit de referência ligado (aproximação barata do LRU)
+ *
+ * WRITE-AHEAD LOG (WAL) COM IMAGENS DE PÁGINA:
+ * - As operações são agrupadas em LOTES. No commit do lote, a imagem
+ *   completa de cada página alterada é gravada no WAL, seguida de um
+ *   registro COMMIT, e um ÚNICO fsync torna o lote durável (group commit:
+ *   o custo do fsync é dividido entre todas as operações do lote)
+ * - Páginas alteradas NÃO são gravadas no arquivo de dados no commit
+ *   (política no-force); só na substituição ou no checkpoint
+ * - Regra do WAL: uma página só vai para o arquivo de dados depois que sua
+ *   imagem está durável no WAL. Por isso, se o lote aberto estiver perto de
+ *   ocupar o pool, ele é confirmado ANTES da próxima operação (sempre na
+ *   fronteira entre operações, nunca no meio de um split)
+ * - Checkpoint: grava todas as páginas sujas, fsync no arquivo de dados e
+ *   trunca o WAL
+ * - Recuperação: ao abrir, as imagens dos lotes com COMMIT válido (CRC32)
+ *   são copiadas para o arquivo de dados; um final de log incompleto
+ *   (queda no meio da escrita) é descartado. Reaplicar imagens é
+ *   idempotente, então uma queda durante a recuperação também é segura
+ *
+ * Remoção: a chave é retirada da folha sem fusão de nós (folhas podem
+ * ficar vazias, como em muitos bancos de dados reais).
+ *
+ * Pré-requisito: B+ Tree (bplus_tree.c)
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+// ==================== FORMATO DAS PÁGINAS ====================
+
+#define DB_PAGE_SIZE 4096
+#define DB_MAGIC 0x44425442u          // "BTBD"
+#define HEADER_PAGE 0
+
+#define LEAF_CAP ((DB_PAGE_SIZE - 16) / 8)          // 510 pares
+#define INNER_CAP ((DB_PAGE_SIZE - 16 - 4) / 8)     // 509 chaves, 510 filhos
+
+typedef struct {
+    uint32_t magic;
+    uint32_t page_size;
+    uint32_t root;
+    uint32_t num_pages;
+    uint32_t height;
+    uint32_t reserved;
+    uint64_t num_keys;
+} HeaderPage;
+
+typedef struct {
+    uint32_t is_leaf;
+    uint32_t n;
+    uint32_t next;          // Próxima folha (0 = nenhuma)
+    uint32_t reserved;
+    int32_t keys[LEAF_CAP];
+    int32_t values[LEAF_CAP];
+} LeafPage;
+
+// keys[i] é a menor chave da subárvore children[i + 1]
+typedef struct {
+    uint32_t is_leaf;
+    uint32_t n;
+    uint32_t unused;
+    uint32_t reserved;
+    int32_t keys[INNER_CAP];
+    uint32_t children[INNER_CAP + 1];
+} InnerPage;
+
+// ==================== FORMATO DO WAL ====================
+
+#define WAL_PAGE 1
+#define WAL_COMMIT 2
+#define WAL_CHECKPOINT_BYTES (64L * 1024 * 1024)   // Checkpoint automático
+
+typedef struct {
+    uint32_t type;
+    uint32_t page_id;
+    uint64_t batch;
+    uint32_t crc;           // CRC32 do cabeçalho (com crc = 0) + imagem
+    uint32_t reserved;
+} WalRecord;
+
+static uint32_t crc_table[256];
+
+static void crc32_init() {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        crc_table[i] = c;
+    }
+}
+
+static uint32_t crc32_update(uint32_t crc, const void *data, size_t n) {
+    const unsigned char *p = (const unsigned char *)data;
+    crc = ~crc;
+    for (size_t i = 0; i < n; i++) {
+        crc = crc_table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static uint32_t wal_record_crc(WalRecord rec, const char *page) {
+    rec.crc = 0;
+    uint32_t crc = crc32_update(0, &rec, sizeof(rec));
+    if (page != NULL) {
+        crc = crc32_update(crc, page, DB_PAGE_SIZE);
+    }
+    return crc;
+}
+
+// ==================== ESTRUTURAS DO BANCO ====================
+
+typedef struct {
+    uint32_t page_id;
+    int pin;                // Operações usando a página agora
+    bool ref;               // Bit de referência do CLOCK
+    bool dirty;             // Difere do arquivo de dados
+    bool in_batch;          // Alterada no lote ainda não confirmado
+    int next;               // Encadeamento na tabela hash
+    char *data;
+} Frame;
+
+typedef struct {
+    long page_reads;
+    long page_writes;
+    long pool_hits;
+    long pool_misses;
+    long commits;
+    long forced_commits;    // Lotes confirmados por pressão no pool
+    long victim_commits;    // ... pelo CLOCK, sem quadro livre (nunca deveria ocorrer)
+    long pool_grows;        // Aumentos do pool por causa da altura
+    long fsyncs;
+    long checkpoints;
+    long long wal_bytes;
+} DBStats;
+
+typedef struct {
+    int data_fd;
+    int wal_fd;
+    char *data_path;
+    char *wal_path;
+
+    Frame *frames;
+    char *frame_memory;
+    int num_frames;
+    int *buckets;           // Tabela hash: página -> primeiro quadro
+    int num_buckets;
+    int clock_hand;
+
+    HeaderPage *header;     // Página 0, sempre pinada no pool
+    int header_frame;
+
+    uint64_t batch;         // Número do lote aberto
+    int batch_pages;        // Quadros com in_batch
+    int batch_ops;
+    int commit_every;       // Confirma automaticamente a cada N operações
+    long long wal_size;
+
+    DBStats stats;
+} DiskBTree;
+
+// ==================== E/S DE PÁGINAS ====================
+
+static void fatal(const char *msg) {
+    fprintf(stderr, "Erro fatal: %s\n", msg);
+    exit(1);
+}
+
+static void read_page(DiskBTree *db, uint32_t page_id, char *buf) {
+    ssize_t n = pread(db->data_fd, buf, DB_PAGE_SIZE, (off_t)page_id * DB_PAGE_SIZE);
+    if (n < 0) fatal("leitura do arquivo de dados");
+    if (n < DB_PAGE_SIZE) {
+        // Página alocada mas ainda não gravada (só existia no pool/WAL)
+        memset(buf + n, 0, DB_PAGE_SIZE - n);
+    }
+    db->stats.page_reads++;
+}
+
+static void write_page(DiskBTree *db, uint32_t page_id, const char *buf) {
+    if (pwrite(db->data_fd, buf, DB_PAGE_SIZE, (off_t)page_id * DB_PAGE_SIZE) != DB_PAGE_SIZE) {
+        fatal("escrita no arquivo de dados");
+    }
+    db->stats.page_writes++;
+}
+
+static void write_all(int fd, const void *buf, size_t n) {
+    const char *p = (const char *)buf;
+    while (n > 0) {
+        ssize_t w = write(fd, p, n);
+        if (w <= 0) fatal("escrita no WAL");
+        p += w;
+        n -= (size_t)w;
+    }
+}
+
+// ==================== BUFFER POOL ====================
+
+static int bucket_of(DiskBTree *db, uint32_t page_id) {
+    return (int)((page_id * 2654435761u) % (uint32_t)db->num_buckets);
+}
+
+static int pool_lookup(DiskBTree *db, uint32_t page_id) {
+    for (int f = db->buckets[bucket_of(db, page_id)]; f != -1; f = db->frames[f].next) {
+        if (db->frames[f].page_id == page_id) return f;
+    }
+    return -1;
+}
+
+static void pool_remove(DiskBTree *db, int frame) {
+    int *link = &db->buckets[bucket_of(db, db->frames[frame].page_id)];
+    while (*link != frame) {
+        link = &db->frames[*link].next;
+    }
+    *link = db->frames[frame].next;
+}
+
+static void pool_add(DiskBTree *db, int frame, uint32_t page_id) {
+    int b = bucket_of(db, page_id);
+    db->frames[frame].page_id = page_id;
+    db->frames[frame].next = db->buckets[b];
+    db->buckets[b] = frame;
+}
+
+void bt_commit(DiskBTree *db);
+
+/**
+ * Escolhe um quadro livre com o algoritmo CLOCK; grava a vítima se suja
+ */
+static int pool_victim(DiskBTree *db) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        for (int steps = 0; steps < 2 * db->num_frames; steps++) {
+            int f = db->clock_hand;
+            db->clock_hand = (db->clock_hand + 1) % db->num_frames;
+            Frame *fr = &db->frames[f];
+
+            if (fr->page_id == UINT32_MAX) return f;        // Quadro nunca usado
+            if (fr->pin > 0 || fr->in_batch) continue;       // Regra do WAL
+            if (fr->ref) {
+                fr->ref = false;                             // Segunda chance
+                continue;
+            }
+            if (fr->dirty) {
+                write_page(db, fr->page_id, fr->data);       // Imagem já durável no WAL
+                fr->dirty = false;
+            }
+            pool_remove(db, f);
+            fr->page_id = UINT32_MAX;
+            return f;
+        }
+        // Só restam páginas do lote aberto: confirma o lote e tenta de novo.
+        // Nunca ocorre no meio de uma operação (ver bt_begin_op).
+        db->stats.victim_commits++;
+        bt_commit(db);
+    }
+    fatal("buffer pool pequeno demais (todas as páginas pinadas)");
+    return -1;
+}
+
+/**
+ * Aumenta o pool para num_frames quadros. Só é chamada entre operações,
+ * quando apenas o cabeçalho está pinado: as páginas são copiadas e a
+ * tabela hash é refeita
+ */
+static void pool_grow(DiskBTree *db, int num_frames) {
+    Frame *frames = (Frame *)realloc(db->frames, num_frames * sizeof(Frame));
+    void *mem = NULL;
+    int *buckets = (int *)malloc((num_frames * 2 + 1) * sizeof(int));
+    if (frames == NULL || buckets == NULL ||
+        posix_memalign(&mem, DB_PAGE_SIZE, (size_t)num_frames * DB_PAGE_SIZE) != 0) {
+        fatal("memória do pool");
+    }
+    memcpy(mem, db->frame_memory, (size_t)db->num_frames * DB_PAGE_SIZE);
+    free(db->frame_memory);
+    free(db->buckets);
+
+    db->frames = frames;
+    db->frame_memory = (char *)mem;
+    db->buckets = buckets;
+    db->num_buckets = num_frames * 2 + 1;
+    for (int i = 0; i < db->num_buckets; i++) db->buckets[i] = -1;
+    for (int f = 0; f < num_frames; f++) {
+        if (f >= db->num_frames) {
+            memset(&db->frames[f], 0, sizeof(Frame));
+            db->frames[f].page_id = UINT32_MAX;
+            db->frames[f].next = -1;
+        }
+        db->frames[f].data = db->frame_memory + (size_t)f * DB_PAGE_SIZE;
+        if (db->frames[f].page_id != UINT32_MAX) pool_add(db, f, db->frames[f].page_id);
+    }
+    db->num_frames = num_frames;
+    db->header = (HeaderPage *)db->frames[db->header_frame].data;
+    db->stats.pool_grows++;
+}
+
+/**
+ * Obtém (e pina) uma página; lê do disco se não estiver no pool
+ */
+static char* pool_fetch(DiskBTree *db, uint32_t page_id, int *frame_out) {
+    int f = pool_lookup(db, page_id);
+    if (f >= 0) {
+        db->stats.pool_hits++;
+    } else {
+        db->stats.pool_misses++;
+        f = pool_victim(db);
+        read_page(db, page_id, db->frames[f].data);
+        pool_add(db, f, page_id);
+        db->frames[f].dirty = false;
+        db->frames[f].in_batch = false;
+    }
+    db->frames[f].pin++;
+    db->frames[f].ref = true;
+    *frame_out = f;
+    return db->frames[f].data;
+}
+
+static void pool_unpin(DiskBTree *db, int frame) {
+    db->frames[frame].pin--;
+}
+
+/**
+ * Marca a página como alterada no lote atual
+ */
+static void pool_mark_dirty(DiskBTree *db, int frame) {
+    Frame *fr = &db->frames[frame];
+    fr->dirty = true;
+    if (!fr->in_batch) {
+        fr->in_batch = true;
+        db->batch_pages++;
+    }
+}
+
+/**
+ * Aloca uma nova página no fim do arquivo (pinada e zerada)
+ */
+static char* pool_new_page(DiskBTree *db, uint32_t *page_id, int *frame_out) {
+    *page_id = db->header->num_pages++;
+    pool_mark_dirty(db, db->header_frame);
+
+    int f = pool_victim(db);
+    memset(db->frames[f].data, 0, DB_PAGE_SIZE);
+    pool_add(db, f, *page_id);
+    db->frames[f].dirty = false;
+    db->frames[f].in_batch = false;
+    db->frames[f].pin = 1;
+    db->frames[f].ref = true;
+    pool_mark_dirty(db, f);
+    *frame_out = f;
+    return db->frames[f].data;
+}
+
+// ==================== WAL: COMMIT, CHECKPOINT E RECUPERAÇÃO ====================
+
+/**
+ * Confirma o lote aberto: imagens das páginas + COMMIT + um fsync
+ */
+void bt_commit(DiskBTree *db) {
+    if (db->batch_pages == 0) {
+        db->batch_ops = 0;
+        return;
+    }
+
+    size_t record_size = sizeof(WalRecord) + DB_PAGE_SIZE;
+    size_t buf_size = (size_t)(db->batch_pages + 1) * record_size;
+    char *buf = (char *)malloc(buf_size);
+    if (buf == NULL) fatal("memória para o WAL");
+    size_t used = 0;
+
+    for (int f = 0; f < db->num_frames; f++) {
+        Frame *fr = &db->frames[f];
+        if (!fr->in_batch) continue;
+        WalRecord rec = { WAL_PAGE, fr->page_id, db->batch, 0, 0 };
+        rec.crc = wal_record_crc(rec, fr->data);
+        memcpy(buf + used, &rec, sizeof(rec));
+        memcpy(buf + used + sizeof(rec), fr->data, DB_PAGE_SIZE);
+        used += record_size;
+        fr->in_batch = false;     // Continua suja: vai ao arquivo de dados depois
+    }
+    WalRecord commit = { WAL_COMMIT, 0, db->batch, 0, 0 };
+    commit.crc = wal_record_crc(commit, NULL);
+    memcpy(buf + used, &commit, sizeof(commit));
+    used += sizeof(commit);
+
+    write_all(db->wal_fd, buf, used);
+    if (fdatasync(db->wal_fd) != 0) fatal("fsync do WAL");
+    free(buf);
+
+    db->wal_size += (long long)used;
+    db->stats.wal_bytes += (long long)used;
+    db->stats.fsyncs++;
+    db->stats.commits++;
+    db->batch++;
+    db->batch_pages = 0;
+    db->batch_ops = 0;
+}
+
+/**
+ * Checkpoint: confirma o lote, grava todas as páginas sujas e trunca o WAL
+ */
+void bt_checkpoint(DiskBTree *db) {
+    bt_commit(db);
+    for (int f = 0; f < db->num_frames; f++) {
+        Frame *fr = &db->frames[f];
+        if (fr->page_id != UINT32_MAX && fr->dirty) {
+            write_page(db, fr->page_id, fr->data);
+            fr->dirty = false;
+        }
+    }
+    if (fsync(db->data_fd) != 0) fatal("fsync do arquivo de dados");
+    // Só depois que os dados estão duráveis o WAL pode ser descartado
+    if (ftruncate(db->wal_fd, 0) != 0 || fsync(db->wal_fd) != 0) fatal("truncar WAL");
+    db->wal_size = 0;
+    db->stats.fsyncs += 2;
+    db->stats.checkpoints++;
+}
+
+/**
+ * Recuperação: aplica ao arquivo de dados as imagens dos lotes confirmados.
+ * Retorna o número de lotes recuperados.
+ */
+static long wal_recover(DiskBTree *db) {
+    struct stat st;
+    if (fstat(db->wal_fd, &st) != 0 || st.st_size == 0) return 0;
+
+    char *page = (char *)malloc(DB_PAGE_SIZE);
+    WalRecord rec;
+
+    // Passo 1: encontra o fim do último COMMIT válido
+    off_t pos = 0, valid_end = 0;
+    long batches = 0;
+    while (pread(db->wal_fd, &rec, sizeof(rec), pos) == (ssize_t)sizeof(rec)) {
+        if (rec.type == WAL_PAGE) {
+            if (pread(db->wal_fd, page, DB_PAGE_SIZE, pos + (off_t)sizeof(rec)) != DB_PAGE_SIZE ||
+                wal_record_crc(rec, page) != rec.crc) {
+                break;      // Registro incompleto ou corrompido: fim do log
+            }
+            pos += (off_t)(sizeof(rec) + DB_PAGE_SIZE);
+        } else if (rec.type == WAL_COMMIT && wal_record_crc(rec, NULL) == rec.crc) {
+            pos += (off_t)sizeof(rec);
+            valid_end = pos;
+            batches++;
+        } else {
+            break;
+        }
+    }
+
+    // Passo 2: reaplica as imagens até o último COMMIT, em ordem
+    pos = 0;
+    while (pos < valid_end) {
+        if (pread(db->wal_fd, &rec, sizeof(rec), pos) != (ssize_t)sizeof(rec)) fatal("releitura do WAL");
+        pos += (off_t)sizeof(rec);
+        if (rec.type == WAL_PAGE) {
+            if (pread(db->wal_fd, page, DB_PAGE_SIZE, pos) != DB_PAGE_SIZE) fatal("releitura do WAL");
+            write_page(db, rec.page_id, page);
+            pos += DB_PAGE_SIZE;
+        }
+    }
+    free(page);
+
+    if (fsync(db->data_fd) != 0) fatal("fsync do arquivo de dados");
+    if (ftruncate(db->wal_fd, 0) != 0 || fsync(db->wal_fd) != 0) fatal("truncar WAL");
+    return batches;
+}
+
+// ==================== ABERTURA E FECHAMENTO ====================
+
+/**
+ * Abre (ou cria) o índice em 'path'; o WAL fica em 'path-wal'.
+ * num_frames: tamanho do buffer pool em páginas de 4 KB (mínimo 16; cresce
+ *             se a árvore ficar alta demais para ele, ver bt_begin_op)
+ * commit_every: operações por lote (group commit); 1 = fsync por operação
+ */
+DiskBTree* bt_open(const char *path, int num_frames, int commit_every, long *recovered) {
+    if (num_frames < 16) num_frames = 16;
+    crc32_init();
+
+    DiskBTree *db = (DiskBTree *)calloc(1, sizeof(DiskBTree));
+    db->data_path = strdup(path);
+    size_t wal_len = strlen(path) + 5;
+    db->wal_path = (char *)malloc(wal_len);
+    if (db->data_path == NULL || db->wal_path == NULL) fatal("memória");
+    snprintf(db->wal_path, wal_len, "%s-wal", path);
+    db->commit_every = commit_every > 0 ? commit_every : 1;
+
+    db->data_fd = open(path, O_RDWR | O_CREAT, 0644);
+    db->wal_fd = open(db->wal_path, O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (db->data_fd < 0 || db->wal_fd < 0) fatal("abrir arquivos do banco");
+
+    long batches = wal_recover(db);
+    if (recovered) *recovered = batches;
+
+    // Buffer pool
+    db->num_frames = num_frames;
+    db->frames = (Frame *)calloc(num_frames, sizeof(Frame));
+    void *mem = NULL;
+    if (posix_memalign(&mem, DB_PAGE_SIZE, (size_t)num_frames * DB_PAGE_SIZE) != 0) fatal("memória do pool");
+    db->frame_memory = (char *)mem;
+    db->num_buckets = num_frames * 2 + 1;
+    db->buckets = (int *)malloc(db->num_buckets * sizeof(int));
+    for (int i = 0; i < db->num_buckets; i++) db->buckets[i] = -1;
+    for (int f = 0; f < num_frames; f++) {
+        db->frames[f].page_id = UINT32_MAX;
+        db->frames[f].data = db->frame_memory + (size_t)f * DB_PAGE_SIZE;
+        db->frames[f].next = -1;
+    }
+
+    struct stat st;
+    fstat(db->data_fd, &st);
+    if (st.st_size == 0) {
+        // Banco novo: cabeçalho + folha raiz vazia
+        char *page = (char *)calloc(1, DB_PAGE_SIZE);
+        HeaderPage *h = (HeaderPage *)page;
+        h->magic = DB_MAGIC;
+        h->page_size = DB_PAGE_SIZE;
+        h->root = 1;
+        h->num_pages = 2;
+        h->height = 1;
+        write_page(db, HEADER_PAGE, page);
+        memset(page, 0, DB_PAGE_SIZE);
+        ((LeafPage *)page)->is_leaf = 1;
+        write_page(db, 1, page);
+        free(page);
+        if (fsync(db->data_fd) != 0) fatal("fsync do arquivo de dados");
+    }
+
+    db->header = (HeaderPage *)pool_fetch(db, HEADER_PAGE, &db->header_frame);
+    if (db->header->magic != DB_MAGIC || db->header->page_size != DB_PAGE_SIZE) {
+        fatal("arquivo não é um índice válido");
+    }
+    memset(&db->stats, 0, sizeof(db->stats));
+    return db;
+}
+
+void bt_close(DiskBTree *db) {
+    bt_checkpoint(db);
+    close(db->data_fd);
+    close(db->wal_fd);
+    free(db->frames);
+    free(db->frame_memory);
+    free(db->buckets);
+    free(db->data_path);
+    free(db->wal_path);
+    free(db);
+}
+
+// ==================== OPERAÇÕES ====================
+
+static inline int lower_bound(const int32_t *keys, int n, int32_t key) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (keys[mid] < key) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+static inline int upper_bound(const int32_t *keys, int n, int32_t key) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (keys[mid] <= key) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * Início de uma operação de escrita: se o lote aberto deixaria o pool sem
+ * quadros substituíveis durante a operação, ele é confirmado agora. Se nem
+ * o pool vazio comporta a operação, o pool dobra antes dela: um commit
+ * forçado no meio de um split gravaria no WAL uma operação pela metade
+ */
+static void bt_begin_op(DiskBTree *db) {
+    // Uma inserção pina no máximo height + 1 páginas e suja até 2 * (height + 1) + 1
+    int reserve = 3 * ((int)db->header->height + 2) + 2;
+    if (reserve >= db->num_frames) {
+        int frames = db->num_frames;
+        while (reserve >= frames) frames *= 2;
+        pool_grow(db, frames);
+    }
+    if (db->batch_pages > 0 && db->batch_pages + reserve >= db->num_frames) {
+        db->stats.forced_commits++;
+        bt_commit(db);
+    }
+}
+
+static void bt_end_op(DiskBTree *db) {
+    if (++db->batch_ops >= db->commit_every) {
+        bt_commit(db);
+        if (db->wal_size >= WAL_CHECKPOINT_BYTES) {
+            bt_checkpoint(db);
+        }
+    }
+}
+
+/**
+ * Buscar chave; se encontrada, copia o valor para *value
+ */
+bool bt_search(DiskBTree *db, int32_t key, int32_t *value) {
+    int f;
+    char *page = pool_fetch(db, db->header->root, &f);
+    while (!((LeafPage *)page)->is_leaf) {
+        InnerPage *inner = (InnerPage *)page;
+        uint32_t child = inner->children[upper_bound(inner->keys, (int)inner->n, key)];
+        pool_unpin(db, f);
+        page = pool_fetch(db, child, &f);
+    }
+    LeafPage *leaf = (LeafPage *)page;
+    int i = lower_bound(leaf->keys, (int)leaf->n, key);
+    bool found = i < (int)leaf->n && leaf->keys[i] == key;
+    if (found && value) *value = leaf->values[i];
+    pool_unpin(db, f);
+    return found;
+}
+
+/**
+ * Inserção recursiva; se a página dividir, devolve o número da nova página
+ * à direita (0 = sem divisão) e a chave separadora em *sep
+ */
+static uint32_t insert_rec(DiskBTree *db, uint32_t page_id, int32_t key, int32_t value,
+                           int32_t *sep, bool *inserted) {
+    int f;
+    char *page = pool_fetch(db, page_id, &f);
+
+    if (((LeafPage *)page)->is_leaf) {
+        LeafPage *leaf = (LeafPage *)page;
+        int i = lower_bound(leaf->keys, (int)leaf->n, key);
+        pool_mark_dirty(db, f);
+        if (i < (int)leaf->n && leaf->keys[i] == key) {
+            leaf->values[i] = value;
+            *inserted = false;
+            pool_unpin(db, f);
+            return 0;
+        }
+        *inserted = true;
+
+        if (leaf->n < LEAF_CAP) {
+            memmove(&leaf->keys[i + 1], &leaf->keys[i], (leaf->n - i) * sizeof(int32_t));
+            memmove(&leaf->values[i + 1], &leaf->values[i], (leaf->n - i) * sizeof(int32_t));
+            leaf->keys[i] = key;
+            leaf->values[i] = value;
+            leaf->n++;
+            pool_unpin(db, f);
+            return 0;
+        }
+
+        uint32_t right_id;
+        int rf;
+        LeafPage *right = (LeafPage *)pool_new_page(db, &right_id, &rf);
+        int half = (LEAF_CAP + 1) / 2;
+        right->is_leaf = 1;
+        right->n = LEAF_CAP - half;
+        memcpy(right->keys, &leaf->keys[half], right->n * sizeof(int32_t));
+        memcpy(right->values, &leaf->values[half], right->n * sizeof(int32_t));
+        leaf->n = half;
+        right->next = leaf->next;
+        leaf->next = right_id;
+
+        LeafPage *target = (i <= half) ? leaf : right;
+        int pos = (i <= half) ? i : i - half;
+        memmove(&target->keys[pos + 1], &target->keys[pos], (target->n - pos) * sizeof(int32_t));
+        memmove(&target->values[pos + 1], &target->values[pos], (target->n - pos) * sizeof(int32_t));
+        target->keys[pos] = key;
+        target->values[pos] = value;
+        target->n++;
+
+        *sep = right->keys[0];
+        pool_unpin(db, rf);
+        pool_unpin(db, f);
+        return right_id;
+    }
+
+    InnerPage *inner = (InnerPage *)page;
+    int c = upper_bound(inner->keys, (int)inner->n, key);
+    int32_t child_sep;
+    uint32_t new_child = insert_rec(db, inner->children[c], key, value, &child_sep, inserted);
+    if (new_child == 0) {
+        pool_unpin(db, f);
+        return 0;
+    }
+
+    pool_mark_dirty(db, f);
+    if (inner->n < INNER_CAP) {
+        memmove(&inner->keys[c + 1], &inner->keys[c], (inner->n - c) * sizeof(int32_t));
+        memmove(&inner->children[c + 2], &inner->children[c + 1], (inner->n - c) * sizeof(uint32_t));
+        inner->keys[c] = child_sep;
+        inner->children[c + 1] = new_child;
+        inner->n++;
+        pool_unpin(db, f);
+        return 0;
+    }
+
+    // Nó interno cheio: sequência com INNER_CAP + 1 chaves, a do meio sobe
+    int32_t keys[INNER_CAP + 1];
+    uint32_t children[INNER_CAP + 2];
+    memcpy(keys, inner->keys, c * sizeof(int32_t));
+    keys[c] = child_sep;
+    memcpy(&keys[c + 1], &inner->keys[c], (INNER_CAP - c) * sizeof(int32_t));
+    memcpy(children, inner->children, (c + 1) * sizeof(uint32_t));
+    children[c + 1] = new_child;
+    memcpy(&children[c + 2], &inner->children[c + 1], (INNER_CAP - c) * sizeof(uint32_t));
+
+    int mid = (INNER_CAP + 1) / 2;
+    uint32_t right_id;
+    int rf;
+    InnerPage *right = (InnerPage *)pool_new_page(db, &right_id, &rf);
+    inner->n = mid;
+    memcpy(inner->keys, keys, mid * sizeof(int32_t));
+    memcpy(inner->children, children, (mid + 1) * sizeof(uint32_t));
+    right->is_leaf = 0;
+    right->n = INNER_CAP - mid;
+    memcpy(right->keys, &keys[mid + 1], right->n * sizeof(int32_t));
+    memcpy(right->children, &children[mid + 1], (right->n + 1) * sizeof(uint32_t));
+
+    *sep = keys[mid];
+    pool_unpin(db, rf);
+    pool_unpin(db, f);
+    return right_id;
+}
+
+/**
+ * Inserir (ou atualizar) o par (chave, valor)
+ */
+void bt_insert(DiskBTree *db, int32_t key, int32_t value) {
+    bt_begin_op(db);
+
+    int32_t sep;
+    bool inserted;
+    uint32_t right = insert_rec(db, db->header->root, key, value, &sep, &inserted);
+    if (inserted) {
+        db->header->num_keys++;
+        pool_mark_dirty(db, db->header_frame);
+    }
+    if (right != 0) {
+        uint32_t root_id;
+        int rf;
+        InnerPage *root = (InnerPage *)pool_new_page(db, &root_id, &rf);
+        root->is_leaf = 0;
+        root->n = 1;
+        root->keys[0] = sep;
+        root->children[0] = db->header->root;
+        root->children[1] = right;
+        pool_unpin(db, rf);
+        db->header->root = root_id;
+        db->header->height++;
+        pool_mark_dirty(db, db->header_frame);
+    }
+
+    bt_end_op(db);
+}
+
+/**
+ * Remover chave (sem fusão de páginas). Retorna true se existia.
+ */
+bool bt_delete(DiskBTree *db, int32_t key) {
+    bt_begin_op(db);
+
+    int f;
+    char *page = pool_fetch(db, db->header->root, &f);
+    while (!((LeafPage *)page)->is_leaf) {
+        InnerPage *inner = (InnerPage *)page;
+        uint32_t child = inner->children[upper_bound(inner->keys, (int)inner->n, key)];
+        pool_unpin(db, f);
+        page = pool_fetch(db, child, &f);
+    }
+    LeafPage *leaf = (LeafPage *)page;
+    int i = lower_bound(leaf->keys, (int)leaf->n, key);
+    bool found = i < (int)leaf->n && leaf->keys[i] == key;
+    if (found) {
+        memmove(&leaf->keys[i], &leaf->keys[i + 1], (leaf->n - i - 1) * sizeof(int32_t));
+        memmove(&leaf->values[i], &leaf->values[i + 1], (leaf->n - i - 1) * sizeof(int32_t));
+        leaf->n--;
+        pool_mark_dirty(db, f);
+        db->header->num_keys--;
+        pool_mark_dirty(db, db->header_frame);
+    }
+    pool_unpin(db, f);
+
+    bt_end_op(db);
+    return found;
+}
+
+// ==================== VERIFICAÇÃO ====================
+
+static bool verify_rec(DiskBTree *db, uint32_t page_id, long lo, long hi, uint32_t depth, long *count) {
+    int f;
+    char *page = pool_fetch(db, page_id, &f);
+    bool ok = true;
+
+    if (((LeafPage *)page)->is_leaf) {
+        LeafPage *leaf = (LeafPage *)page;
+        ok = depth == db->header->height && leaf->n <= LEAF_CAP;
+        for (uint32_t i = 0; ok && i < leaf->n; i++) {
+            ok = leaf->keys[i] >= lo && leaf->keys[i] < hi && (i == 0 || leaf->keys[i - 1] < leaf->keys[i]);
+        }
+        *count += leaf->n;
+        pool_unpin(db, f);
+        return ok;
+    }
+
+    // Copia o nó: as chamadas recursivas podem substituir páginas do pool
+    InnerPage inner;
+    memcpy(&inner, page, sizeof(inner));
+    pool_unpin(db, f);
+    if (inner.n < 1 || inner.n > INNER_CAP) return false;
+    for (uint32_t i = 0; ok && i <= inner.n; i++) {
+        long clo = (i == 0) ? lo : inner.keys[i - 1];
+        long chi = (i == inner.n) ? hi : inner.keys[i];
+        ok = clo <= chi && verify_rec(db, inner.children[i], clo, chi, depth + 1, count);
+    }
+    return ok;
+}
+
+bool bt_verify(DiskBTree *db) {
+    long count = 0;
+    return verify_rec(db, db->header->root, -2147483648L, 2147483648L, 1, &count) &&
+           (uint64_t)count == db->header->num_keys;
+}
+
+// ==================== TESTES ====================
+
+static void remove_db(const char *path) {
+    char wal[512];
+    snprintf(wal, sizeof(wal), "%s-wal", path);
+    unlink(path);
+    unlink(wal);
+}
+
+static uint32_t next_rand(uint32_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+void testar_persistencia(const char *path) {
+    printf("=== TESTE DE PERSISTÊNCIA ===\n\n");
+    remove_db(path);
+
+    DiskBTree *db = bt_open(path, 64, 1000, NULL);   // Pool de 256 KB: força substituições
+    int n = 50000;
+    for (int i = 0; i < n; i++) {
+        int32_t key = (int32_t)((i * 7919L) % n);    // Permutação de 0..n-1
+        bt_insert(db, key, key * 2);
+    }
+    for (int i = 0; i < n; i += 3) {
+        bt_delete(db, i);
+    }
+    bool ok = bt_verify(db);
+    printf("Inseridas %d chaves e removidas %d (pool de 64 páginas)\n", n, (n + 2) / 3);
+    printf("Páginas: %u | altura: %u | lidas: %ld | gravadas: %ld | commits forçados: %ld\n",
+           db->header->num_pages, db->header->height, db->stats.page_reads,
+           db->stats.page_writes, db->stats.forced_commits);
+    bt_close(db);
+
+    db = bt_open(path, 64, 1000, NULL);
+    for (int i = 0; i < n && ok; i++) {
+        int32_t v;
+        bool found = bt_search(db, i, &v);
+        ok = (i % 3 == 0) ? !found : (found && v == i * 2);
+    }
+    ok = ok && bt_verify(db) && db->header->num_keys == (uint64_t)(n - (n + 2) / 3);
+    printf("Reaberto: %llu chaves encontradas\n", (unsigned long long)db->header->num_keys);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    bt_close(db);
+    remove_db(path);
+}
+
+void testar_pool_minimo(const char *path) {
+    printf("=== TESTE DE POOL MÍNIMO (16 páginas) ===\n\n");
+    remove_db(path);
+
+    // Na altura 3 a reserva de uma inserção (17 quadros) já passa do pool
+    DiskBTree *db = bt_open(path, 16, 1000, NULL);
+    int n = 0;
+    while (db->header->height < 3 || n % 1000 != 0) {
+        bt_insert(db, n, -n);                        // Crescente: folhas meio cheias
+        n++;
+    }
+    int reserve = 3 * ((int)db->header->height + 2) + 2;
+    bool ok = bt_verify(db) && db->num_frames > reserve &&
+              db->stats.pool_grows > 0 && db->stats.victim_commits == 0;
+    printf("Inseridas %d chaves | altura: %u | pool: %d páginas (%ld aumento(s))\n",
+           n, db->header->height, db->num_frames, db->stats.pool_grows);
+    printf("Commits sem quadro livre (no meio de uma operação): %ld\n", db->stats.victim_commits);
+    bt_close(db);
+
+    db = bt_open(path, 16, 1000, NULL);
+    for (int i = 0; i < n && ok; i++) {
+        int32_t v;
+        ok = bt_search(db, i, &v) && v == -i;
+    }
+    printf("Reaberto: %llu chaves encontradas\n", (unsigned long long)db->header->num_keys);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    bt_close(db);
+    remove_db(path);
+}
+
+/**
+ * Chave inserida pela i-ésima operação do teste de queda (permutação
+ * de 0..total-1, para que as inserções espalhem-se por muitas folhas)
+ */
+static int32_t crash_key(int i, int total) {
+    return (int32_t)((i * 7919L) % total);
+}
+
+/**
+ * Processo filho: executa operações e "cai" com _exit, sem checkpoint
+ */
+static void child_workload(const char *path, int frames, int commit_every, int committed_ops,
+                           int extra_ops) {
+    int total = committed_ops + extra_ops;
+    DiskBTree *db = bt_open(path, frames, commit_every, NULL);
+    for (int i = 0; i < committed_ops; i++) {
+        bt_insert(db, crash_key(i, total), crash_key(i, total) * 10);
+    }
+    bt_delete(db, crash_key(0, total));
+    bt_commit(db);                       // Tudo até aqui é durável
+    for (int i = committed_ops; i < total; i++) {
+        bt_insert(db, crash_key(i, total), crash_key(i, total) * 10);
+    }
+    bt_delete(db, crash_key(1, total));  // Nunca confirmada
+    _exit(0);                            // Queda: sem bt_close, pool perdido
+}
+
+/**
+ * Verifica que as inserções presentes formam um prefixo da sequência de
+ * operações (lotes aplicados inteiros e em ordem) e devolve seu tamanho
+ */
+static int check_prefix(DiskBTree *db, int total, bool *ok) {
+    int present = 0;
+    bool gap = false;
+    for (int i = 1; i < total; i++) {
+        int32_t v;
+        bool found = bt_search(db, crash_key(i, total), &v);
+        if (found && (gap || v != crash_key(i, total) * 10)) *ok = false;
+        if (!found) gap = true; else present++;
+    }
+    return present;
+}
+
+void testar_queda(const char *path) {
+    printf("=== TESTE DE QUEDA (fork + _exit) ===\n\n");
+
+    struct {
+        const char *desc;
+        int frames, commit_every, committed, extra;
+        bool tear_wal;
+    } cases[] = {
+        { "pool grande, lote aberto perdido", 4096, 1000000, 20000, 3000, false },
+        { "pool pequeno (commits forçados)", 32, 1000000, 20000, 3000, false },
+        { "commit a cada 100 ops + WAL rasgado", 4096, 100, 20000, 3000, true },
+    };
+
+    bool all_ok = true;
+    for (int c = 0; c < 3; c++) {
+        int total = cases[c].committed + cases[c].extra;
+        remove_db(path);
+        pid_t pid = fork();
+        if (pid == 0) {
+            child_workload(path, cases[c].frames, cases[c].commit_every, cases[c].committed, cases[c].extra);
+        }
+        int status;
+        waitpid(pid, &status, 0);
+
+        if (cases[c].tear_wal) {
+            // Simula uma queda no meio da escrita do WAL: corta o final
+            char wal[512];
+            snprintf(wal, sizeof(wal), "%s-wal", path);
+            struct stat st;
+            stat(wal, &st);
+            if (truncate(wal, st.st_size - st.st_size / 5 - 123) != 0) all_ok = false;
+        }
+
+        long recovered;
+        DiskBTree *db = bt_open(path, 256, 1000, &recovered);
+        bool ok = bt_verify(db);
+        int present = check_prefix(db, total, &ok);
+
+        if (!cases[c].tear_wal) {
+            // Tudo até o commit explícito sobreviveu, inclusive a remoção
+            ok = ok && !bt_search(db, crash_key(0, total), NULL) && present >= cases[c].committed - 1;
+        }
+        if (cases[c].frames == 4096 && cases[c].commit_every == 1000000) {
+            ok = ok && present == cases[c].committed - 1;     // Lote aberto inteiro perdido
+        }
+
+        printf("%s:\n", cases[c].desc);
+        printf("  lotes recuperados do WAL: %ld%s\n", recovered,
+               cases[c].tear_wal ? " (WAL cortado)" : "");
+        printf("  inserções presentes: %d de %d (confirmadas explicitamente: %d)\n",
+               present, total - 1, cases[c].committed - 1);
+        printf("  Verificação: %s\n", ok ? "OK" : "FALHA");
+        all_ok = all_ok && ok;
+        bt_close(db);
+    }
+    printf("\nVerificação geral: %s\n\n", all_ok ? "OK" : "FALHA");
+    remove_db(path);
+}
+
+// ==================== BENCHMARK ====================
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void benchmark(const char *path, int n) {
+    printf("=== BENCHMARK ===\n\n");
+
+    printf("Vazão de inserções aleatórias (pool de 1024 páginas = 4 MB):\n");
+    printf("%-16s %10s %12s %8s %10s\n", "Ops por commit", "Operações", "Ops/s", "fsyncs", "WAL (MB)");
+    int batches[] = { 1, 10, 100, 1000, 10000 };
+    for (int b = 0; b < 5; b++) {
+        remove_db(path);
+        // fsync por operação é lento: menos operações nos lotes pequenos
+        int ops = (batches[b] == 1) ? n / 500 : (batches[b] == 10 ? n / 50 : n / 5);
+        DiskBTree *db = bt_open(path, 1024, batches[b], NULL);
+        uint32_t state = 2463534242u;
+        double t = now_seconds();
+        for (int i = 0; i < ops; i++) {
+            bt_insert(db, (int32_t)(next_rand(&state) & 0x7fffffff), i);
+        }
+        bt_commit(db);
+        double elapsed = now_seconds() - t;
+        printf("%-16d %10d %12.0f %8ld %10.1f\n", batches[b], ops, ops / elapsed,
+               db->stats.fsyncs, db->stats.wal_bytes / (1024.0 * 1024.0));
+        bt_close(db);
+    }
+
+    // Índice maior que o pool: n chaves, pool de 256 páginas (1 MB)
+    remove_db(path);
+    DiskBTree *db = bt_open(path, 256, 10000, NULL);
+    uint32_t state = 88172645u;
+    for (int i = 0; i < n; i++) {
+        bt_insert(db, (int32_t)(next_rand(&state) & 0x7fffffff), i);
+    }
+    uint32_t pages = db->header->num_pages;
+    bt_close(db);
+
+    // Frio: descarta o cache do sistema operacional para o arquivo
+    int fd = open(path, O_RDONLY);
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+
+    int lookups = 20000;
+    db = bt_open(path, 4096, 10000, NULL);         // Pool de 16 MB, vazio
+    state = 88172645u;
+    long hits = 0;
+    double t = now_seconds();
+    for (int i = 0; i < lookups; i++) {
+        uint32_t k = next_rand(&state);
+        for (int s = 0; s < n / lookups - 1; s++) next_rand(&state);   // 1 a cada n/lookups chaves inseridas
+        hits += bt_search(db, (int32_t)(k & 0x7fffffff), NULL);
+    }
+    double cold = now_seconds() - t;
+    long cold_reads = db->stats.page_reads;
+
+    state = 88172645u;
+    t = now_seconds();
+    for (int i = 0; i < lookups; i++) {
+        uint32_t k = next_rand(&state);
+        for (int s = 0; s < n / lookups - 1; s++) next_rand(&state);
+        hits += bt_search(db, (int32_t)(k & 0x7fffffff), NULL);
+    }
+    double warm = now_seconds() - t;
+
+    printf("\nÍndice com %d chaves (%u páginas = %.1f MB):\n", n, pages, pages * 4.0 / 1024);
+    printf("  Busca fria (pool vazio, cache do SO descartado): %7.2f µs/busca (%ld páginas lidas)\n",
+           cold * 1e6 / lookups, cold_reads);
+    printf("  Busca quente (páginas no pool):                  %7.2f µs/busca\n", warm * 1e6 / lookups);
+    printf("  Chaves encontradas: %ld de %d\n\n", hits, 2 * lookups);
+    bt_close(db);
+    remove_db(path);
+}
+
+// ==================== FUNÇÃO PRINCIPAL ====================
+
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║                    B-TREE EM DISCO                       ║\n");
+    printf("║   Páginas de 4 KB, buffer pool CLOCK e write-ahead log   ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    if (n < 20000) n = 20000;
+    const char *path = (argc > 2) ? argv[2] : "/tmp/b_tree_disco.db";
+
+    testar_persistencia(path);
+    testar_pool_minimo(path);
+    testar_queda(path);
+    benchmark(path, n);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da B-Tree em disco:\n");
+    printf("- Busca: O(log_B n) páginas; páginas no pool não custam E/S\n");
+    printf("- Commit: imagens das páginas alteradas + um fsync por lote\n");
+    printf("- Group commit divide o custo do fsync entre as operações\n");
+    printf("- Recuperação: reaplica lotes com COMMIT válido (idempotente)\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,898 @@
+/**
+ * ============================================================================
+ * B+ TREE - NÓS DO TAMANHO DE UMA PÁGINA, FOLHAS ENCADEADAS E BULK LOADING
+ * ============================================================================
+ *
+ * A B+ Tree guarda os pares (chave, valor) apenas nas folhas; os nós
+ * internos contêm só chaves separadoras. As folhas formam uma lista
+ * encadeada, então uma consulta por intervalo desce uma vez até a primeira
+ * chave e depois percorre as folhas em sequência.
+ *
+ * Diferenças em relação a b_tree.c (T = 3, 5 chaves por nó):
+ * - Cada nó ocupa exatamente 4 KB (uma página), alinhado em 4 KB:
+ *   510 pares por folha, 339 chaves por nó interno
+ * - Com esse fan-out, 10 milhões de chaves cabem em 3 níveis
+ * - Busca dentro do nó por pesquisa binária SEM DESVIOS (branchless):
+ *   o laço não depende do resultado das comparações, evitando erros de
+ *   previsão de desvio
+ * - Bulk loading: a partir de dados ordenados, as folhas são preenchidas
+ *   em sequência e os níveis internos construídos de baixo para cima,
+ *   em O(n), sem nenhum split
+ *
+ * Por que nós grandes ajudam mesmo na memória RAM:
+ * - Uma AVL com 1 milhão de chaves tem altura ~20: cerca de 20 faltas
+ *   de cache por busca, cada nó em um lugar diferente da memória
+ * - Na B+ Tree são 3 nós; dentro de cada um a busca binária toca
+ *   ~9 linhas de cache contíguas, e as folhas de um intervalo são lidas
+ *   sequencialmente (pré-busca do hardware)
+ *
+ * Pré-requisito: B-Tree (b_tree.c)
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+// ==================== ESTRUTURA DA B+ TREE ====================
+
+#define BPLUS_PAGE_SIZE 4096
+
+// Cabeçalho comum: n (4 bytes) + is_leaf (4 bytes) + ponteiro (8 bytes)
+#define BPLUS_HEADER_SIZE 16
+#define LEAF_CAP ((int)((BPLUS_PAGE_SIZE - BPLUS_HEADER_SIZE) / (2 * sizeof(int))))
+#define INNER_CAP ((int)((BPLUS_PAGE_SIZE - BPLUS_HEADER_SIZE - sizeof(void *)) / \
+                         (sizeof(int) + sizeof(void *))))
+
+typedef struct BPlusNode {
+    int n;          // Número de chaves
+    int is_leaf;
+} BPlusNode;
+
+typedef struct BPlusLeaf {
+    int n;
+    int is_leaf;
+    struct BPlusLeaf *next;     // Próxima folha (ordem crescente)
+    int keys[LEAF_CAP];
+    int values[LEAF_CAP];
+} BPlusLeaf;
+
+// keys[i] é a menor chave da subárvore children[i + 1]
+typedef struct BPlusInner {
+    int n;
+    int is_leaf;
+    void *padding;              // Mantém keys alinhado como nas folhas
+    int keys[INNER_CAP];
+    BPlusNode *children[INNER_CAP + 1];
+} BPlusInner;
+
+typedef struct {
+    BPlusNode *root;
+    BPlusLeaf *first_leaf;
+    int height;                 // 1 = raiz é folha
+    long size;
+    long num_nodes;
+} BPlusTree;
+
+// Iterador sobre as folhas encadeadas
+typedef struct {
+    BPlusLeaf *leaf;
+    int pos;
+} BPlusIterator;
+
+// ==================== ALOCAÇÃO ====================
+
+/**
+ * Aloca um nó de 4 KB alinhado à página
+ */
+static void* alloc_page(BPlusTree *tree) {
+    void *page = NULL;
+    if (posix_memalign(&page, BPLUS_PAGE_SIZE, BPLUS_PAGE_SIZE) != 0) {
+        fprintf(stderr, "Erro: memória insuficiente\n");
+        exit(1);
+    }
+    tree->num_nodes++;
+    return page;
+}
+
+BPlusLeaf* create_leaf(BPlusTree *tree) {
+    BPlusLeaf *leaf = (BPlusLeaf *)alloc_page(tree);
+    leaf->n = 0;
+    leaf->is_leaf = 1;
+    leaf->next = NULL;
+    return leaf;
+}
+
+BPlusInner* create_inner(BPlusTree *tree) {
+    BPlusInner *inner = (BPlusInner *)alloc_page(tree);
+    inner->n = 0;
+    inner->is_leaf = 0;
+    inner->padding = NULL;
+    return inner;
+}
+
+BPlusTree* bplus_create() {
+    BPlusTree *tree = (BPlusTree *)malloc(sizeof(BPlusTree));
+    tree->num_nodes = 0;
+    tree->size = 0;
+    tree->height = 1;
+    tree->first_leaf = create_leaf(tree);
+    tree->root = (BPlusNode *)tree->first_leaf;
+    return tree;
+}
+
+void free_node(BPlusNode *node) {
+    if (!node->is_leaf) {
+        BPlusInner *inner = (BPlusInner *)node;
+        for (int i = 0; i <= inner->n; i++) {
+            free_node(inner->children[i]);
+        }
+    }
+    free(node);
+}
+
+void bplus_free(BPlusTree *tree) {
+    free_node(tree->root);
+    free(tree);
+}
+
+// ==================== BUSCA DENTRO DO NÓ ====================
+
+/**
+ * Primeira posição i com keys[i] >= key (pesquisa binária sem desvios)
+ */
+static inline int lower_bound(const int *keys, int n, int key) {
+    if (n == 0) return 0;
+    const int *base = keys;
+    while (n > 1) {
+        int half = n / 2;
+        base = (base[half] < key) ? base + half : base;  // vira cmov
+        n -= half;
+    }
+    return (int)(base - keys) + (*base < key);
+}
+
+/**
+ * Primeira posição i com keys[i] > key = filho a seguir no nó interno
+ */
+static inline int upper_bound(const int *keys, int n, int key) {
+    if (n == 0) return 0;
+    const int *base = keys;
+    while (n > 1) {
+        int half = n / 2;
+        base = (base[half] <= key) ? base + half : base;
+        n -= half;
+    }
+    return (int)(base - keys) + (*base <= key);
+}
+
+// ==================== BUSCA ====================
+
+/**
+ * Desce até a folha que pode conter a chave
+ */
+static BPlusLeaf* find_leaf(BPlusTree *tree, int key) {
+    BPlusNode *node = tree->root;
+    while (!node->is_leaf) {
+        BPlusInner *inner = (BPlusInner *)node;
+        node = inner->children[upper_bound(inner->keys, inner->n, key)];
+    }
+    return (BPlusLeaf *)node;
+}
+
+/**
+ * Buscar chave; se encontrada, copia o valor para *value
+ */
+bool bplus_search(BPlusTree *tree, int key, int *value) {
+    BPlusLeaf *leaf = find_leaf(tree, key);
+    int i = lower_bound(leaf->keys, leaf->n, key);
+    if (i < leaf->n && leaf->keys[i] == key) {
+        if (value) *value = leaf->values[i];
+        return true;
+    }
+    return false;
+}
+
+// ==================== INSERÇÃO ====================
+
+/**
+ * Insere recursivamente; se o nó dividir, devolve o novo irmão direito
+ * e a chave separadora em *sep_key
+ */
+static BPlusNode* insert_rec(BPlusTree *tree, BPlusNode *node, int key, int value,
+                             int *sep_key, bool *inserted) {
+    if (node->is_leaf) {
+        BPlusLeaf *leaf = (BPlusLeaf *)node;
+        int i = lower_bound(leaf->keys, leaf->n, key);
+        if (i < leaf->n && leaf->keys[i] == key) {
+            leaf->values[i] = value;   // Chave existente: atualiza o valor
+            *inserted = false;
+            return NULL;
+        }
+        *inserted = true;
+
+        if (leaf->n < LEAF_CAP) {
+            memmove(&leaf->keys[i + 1], &leaf->keys[i], (leaf->n - i) * sizeof(int));
+            memmove(&leaf->values[i + 1], &leaf->values[i], (leaf->n - i) * sizeof(int));
+            leaf->keys[i] = key;
+            leaf->values[i] = value;
+            leaf->n++;
+            return NULL;
+        }
+
+        // Folha cheia: metade superior vai para a nova folha
+        BPlusLeaf *right = create_leaf(tree);
+        int half = (LEAF_CAP + 1) / 2;
+        right->n = LEAF_CAP - half;
+        memcpy(right->keys, &leaf->keys[half], right->n * sizeof(int));
+        memcpy(right->values, &leaf->values[half], right->n * sizeof(int));
+        leaf->n = half;
+        right->next = leaf->next;
+        leaf->next = right;
+
+        BPlusLeaf *target = (i <= half) ? leaf : right;
+        int pos = (i <= half) ? i : i - half;
+        memmove(&target->keys[pos + 1], &target->keys[pos], (target->n - pos) * sizeof(int));
+        memmove(&target->values[pos + 1], &target->values[pos], (target->n - pos) * sizeof(int));
+        target->keys[pos] = key;
+        target->values[pos] = value;
+        target->n++;
+
+        *sep_key = right->keys[0];
+        return (BPlusNode *)right;
+    }
+
+    BPlusInner *inner = (BPlusInner *)node;
+    int c = upper_bound(inner->keys, inner->n, key);
+    int child_sep;
+    BPlusNode *new_child = insert_rec(tree, inner->children[c], key, value, &child_sep, inserted);
+    if (new_child == NULL) {
+        return NULL;
+    }
+
+    if (inner->n < INNER_CAP) {
+        memmove(&inner->keys[c + 1], &inner->keys[c], (inner->n - c) * sizeof(int));
+        memmove(&inner->children[c + 2], &inner->children[c + 1], (inner->n - c) * sizeof(BPlusNode *));
+        inner->keys[c] = child_sep;
+        inner->children[c + 1] = new_child;
+        inner->n++;
+        return NULL;
+    }
+
+    // Nó interno cheio: monta a sequência com INNER_CAP + 1 chaves e divide
+    int keys[INNER_CAP + 1];
+    BPlusNode *children[INNER_CAP + 2];
+    memcpy(keys, inner->keys, c * sizeof(int));
+    keys[c] = child_sep;
+    memcpy(&keys[c + 1], &inner->keys[c], (INNER_CAP - c) * sizeof(int));
+    memcpy(children, inner->children, (c + 1) * sizeof(BPlusNode *));
+    children[c + 1] = new_child;
+    memcpy(&children[c + 2], &inner->children[c + 1], (INNER_CAP - c) * sizeof(BPlusNode *));
+
+    int mid = (INNER_CAP + 1) / 2;   // keys[mid] sobe para o pai
+    BPlusInner *right = create_inner(tree);
+    inner->n = mid;
+    memcpy(inner->keys, keys, mid * sizeof(int));
+    memcpy(inner->children, children, (mid + 1) * sizeof(BPlusNode *));
+    right->n = INNER_CAP - mid;
+    memcpy(right->keys, &keys[mid + 1], right->n * sizeof(int));
+    memcpy(right->children, &children[mid + 1], (right->n + 1) * sizeof(BPlusNode *));
+
+    *sep_key = keys[mid];
+    return (BPlusNode *)right;
+}
+
+/**
+ * Inserir (ou atualizar) o par (chave, valor)
+ */
+void bplus_insert(BPlusTree *tree, int key, int value) {
+    int sep;
+    bool inserted;
+    BPlusNode *right = insert_rec(tree, tree->root, key, value, &sep, &inserted);
+    if (inserted) {
+        tree->size++;
+    }
+    if (right != NULL) {
+        BPlusInner *root = create_inner(tree);
+        root->n = 1;
+        root->keys[0] = sep;
+        root->children[0] = tree->root;
+        root->children[1] = right;
+        tree->root = (BPlusNode *)root;
+        tree->height++;
+    }
+}
+
+// ==================== BULK LOADING ====================
+
+/**
+ * Constrói a árvore a partir de chaves ESTRITAMENTE crescentes, em O(n).
+ * fill (0 < fill <= 1) é a ocupação desejada dos nós: 1.0 para dados só de
+ * leitura; ~0.7 deixa espaço para inserções futuras sem splits imediatos.
+ * Os itens são distribuídos por igual, então nenhum nó fica quase vazio.
+ */
+BPlusTree* bplus_bulk_load(const int *keys, const int *values, long n, double fill) {
+    BPlusTree *tree = (BPlusTree *)malloc(sizeof(BPlusTree));
+    tree->num_nodes = 0;
+    tree->size = n;
+    tree->height = 1;
+
+    if (n == 0) {
+        tree->first_leaf = create_leaf(tree);
+        tree->root = (BPlusNode *)tree->first_leaf;
+        return tree;
+    }
+    if (fill <= 0 || fill > 1) fill = 1.0;
+
+    // Nível das folhas
+    int per_leaf = (int)(LEAF_CAP * fill);
+    if (per_leaf < 1) per_leaf = 1;
+    long num_leaves = (n + per_leaf - 1) / per_leaf;
+
+    BPlusNode **level = (BPlusNode **)malloc(num_leaves * sizeof(BPlusNode *));
+    int *level_min = (int *)malloc(num_leaves * sizeof(int));  // Menor chave de cada nó
+    BPlusLeaf *prev = NULL;
+    long pos = 0;
+    for (long i = 0; i < num_leaves; i++) {
+        BPlusLeaf *leaf = create_leaf(tree);
+        long count = n / num_leaves + (i < n % num_leaves ? 1 : 0);
+        memcpy(leaf->keys, &keys[pos], count * sizeof(int));
+        memcpy(leaf->values, &values[pos], count * sizeof(int));
+        leaf->n = (int)count;
+        pos += count;
+        if (prev) prev->next = leaf; else tree->first_leaf = leaf;
+        prev = leaf;
+        level[i] = (BPlusNode *)leaf;
+        level_min[i] = leaf->keys[0];
+    }
+
+    // Níveis internos, de baixo para cima
+    long count_level = num_leaves;
+    int per_inner = (int)((INNER_CAP + 1) * fill);  // filhos por nó
+    if (per_inner < 2) per_inner = 2;
+    while (count_level > 1) {
+        long num_parents = (count_level + per_inner - 1) / per_inner;
+        long next = 0;
+        for (long p = 0; p < num_parents; p++) {
+            BPlusInner *inner = create_inner(tree);
+            long children = count_level / num_parents + (p < count_level % num_parents ? 1 : 0);
+            for (long c = 0; c < children; c++) {
+                inner->children[c] = level[next + c];
+                if (c > 0) inner->keys[c - 1] = level_min[next + c];
+            }
+            inner->n = (int)children - 1;
+            int min_key = level_min[next];
+            next += children;
+            level[p] = (BPlusNode *)inner;   // Reaproveita o vetor do nível
+            level_min[p] = min_key;
+        }
+        count_level = num_parents;
+        tree->height++;
+    }
+
+    tree->root = level[0];
+    free(level);
+    free(level_min);
+    return tree;
+}
+
+// ==================== CONSULTAS POR INTERVALO ====================
+
+/**
+ * Posiciona o iterador na primeira chave >= key
+ */
+BPlusIterator bplus_seek(BPlusTree *tree, int key) {
+    BPlusIterator it;
+    it.leaf = find_leaf(tree, key);
+    it.pos = lower_bound(it.leaf->keys, it.leaf->n, key);
+    if (it.pos == it.leaf->n) {      // Todas as chaves da folha são menores
+        it.leaf = it.leaf->next;
+        it.pos = 0;
+    }
+    return it;
+}
+
+bool bplus_iter_valid(const BPlusIterator *it) {
+    return it->leaf != NULL;
+}
+
+void bplus_iter_next(BPlusIterator *it) {
+    if (++it->pos == it->leaf->n) {
+        it->leaf = it->leaf->next;
+        it->pos = 0;
+    }
+}
+
+/**
+ * Soma os valores das chaves em [lo, hi]; *count recebe quantas são
+ */
+long long bplus_range_sum(BPlusTree *tree, int lo, int hi, long *count) {
+    long long sum = 0;
+    long found = 0;
+    if (lo > hi) {                              // Intervalo invertido: vazio
+        if (count) *count = 0;
+        return 0;
+    }
+    BPlusIterator it = bplus_seek(tree, lo);
+    while (it.leaf != NULL) {
+        BPlusLeaf *leaf = it.leaf;
+        int end = leaf->n;
+        if (leaf->keys[leaf->n - 1] > hi) {
+            end = lower_bound(leaf->keys, leaf->n, hi + 1);  // Última folha do intervalo
+        }
+        for (int i = it.pos; i < end; i++) {   // Laço sequencial dentro da folha
+            sum += leaf->values[i];
+        }
+        found += end - it.pos;
+        if (end < leaf->n) break;
+        it.leaf = leaf->next;
+        it.pos = 0;
+    }
+    if (count) *count = found;
+    return sum;
+}
+
+// ==================== VERIFICAÇÃO ====================
+
+/**
+ * Verifica ordenação, limites das subárvores, ocupação e profundidade
+ * uniforme das folhas
+ */
+static bool verify_node(BPlusNode *node, long lo, long hi, int depth, int height, bool is_root) {
+    if (node->is_leaf) {
+        BPlusLeaf *leaf = (BPlusLeaf *)node;
+        if (depth != height) return false;
+        if (!is_root && leaf->n == 0) return false;
+        for (int i = 0; i < leaf->n; i++) {
+            if (leaf->keys[i] < lo || leaf->keys[i] >= hi) return false;
+            if (i > 0 && leaf->keys[i - 1] >= leaf->keys[i]) return false;
+        }
+        return true;
+    }
+
+    BPlusInner *inner = (BPlusInner *)node;
+    if (inner->n < 1 || inner->n > INNER_CAP) return false;
+    for (int i = 0; i <= inner->n; i++) {
+        long clo = (i == 0) ? lo : inner->keys[i - 1];
+        long chi = (i == inner->n) ? hi : inner->keys[i];
+        if (clo > chi) return false;
+        if (!verify_node(inner->children[i], clo, chi, depth + 1, height, false)) return false;
+    }
+    return true;
+}
+
+bool bplus_verify(BPlusTree *tree) {
+    if (!verify_node(tree->root, -2147483648L, 2147483648L, 1, tree->height, true)) {
+        return false;
+    }
+    // A lista de folhas deve conter exatamente size chaves, em ordem
+    long total = 0;
+    long last = -2147483649L;
+    for (BPlusLeaf *leaf = tree->first_leaf; leaf != NULL; leaf = leaf->next) {
+        for (int i = 0; i < leaf->n; i++) {
+            if (leaf->keys[i] <= last) return false;
+            last = leaf->keys[i];
+        }
+        total += leaf->n;
+    }
+    return total == tree->size;
+}
+
+// ==================== ESTRUTURAS PARA COMPARAÇÃO ====================
+
+// AVL compacta (mesmo algoritmo de avl_tree.c)
+typedef struct AVLNode {
+    int key, value, height;
+    struct AVLNode *left, *right;
+} AVLNode;
+
+static int avl_h(AVLNode *n) { return n ? n->height : 0; }
+static void avl_upd(AVLNode *n) {
+    int hl = avl_h(n->left), hr = avl_h(n->right);
+    n->height = 1 + (hl > hr ? hl : hr);
+}
+static AVLNode* avl_rot_right(AVLNode *y) {
+    AVLNode *x = y->left; y->left = x->right; x->right = y;
+    avl_upd(y); avl_upd(x); return x;
+}
+static AVLNode* avl_rot_left(AVLNode *x) {
+    AVLNode *y = x->right; x->right = y->left; y->left = x;
+    avl_upd(x); avl_upd(y); return y;
+}
+static AVLNode* avl_insert(AVLNode *node, int key, int value) {
+    if (node == NULL) {
+        AVLNode *n = (AVLNode *)malloc(sizeof(AVLNode));
+        n->key = key; n->value = value; n->height = 1; n->left = n->right = NULL;
+        return n;
+    }
+    if (key < node->key) node->left = avl_insert(node->left, key, value);
+    else if (key > node->key) node->right = avl_insert(node->right, key, value);
+    else { node->value = value; return node; }
+    avl_upd(node);
+    int bal = avl_h(node->left) - avl_h(node->right);
+    if (bal > 1 && key < node->left->key) return avl_rot_right(node);
+    if (bal < -1 && key > node->right->key) return avl_rot_left(node);
+    if (bal > 1) { node->left = avl_rot_left(node->left); return avl_rot_right(node); }
+    if (bal < -1) { node->right = avl_rot_right(node->right); return avl_rot_left(node); }
+    return node;
+}
+static bool avl_search(AVLNode *node, int key, int *value) {
+    while (node) {
+        if (key == node->key) { *value = node->value; return true; }
+        node = key < node->key ? node->left : node->right;
+    }
+    return false;
+}
+static long long avl_range_sum(AVLNode *node, int lo, int hi, long *count) {
+    if (node == NULL) return 0;
+    long long s = 0;
+    if (lo < node->key) s += avl_range_sum(node->left, lo, hi, count);
+    if (lo <= node->key && node->key <= hi) { s += node->value; (*count)++; }
+    if (hi > node->key) s += avl_range_sum(node->right, lo, hi, count);
+    return s;
+}
+static void avl_free(AVLNode *n) {
+    if (n) { avl_free(n->left); avl_free(n->right); free(n); }
+}
+
+// Skip list compacta (mesmo algoritmo de skip_list.c, sem impressão)
+#define SL_MAX_LEVEL 24
+typedef struct SLNode {
+    int key, value;
+    struct SLNode **forward;
+} SLNode;
+typedef struct {
+    int level;
+    SLNode *header;
+} SkipList;
+
+static SLNode* sl_node(int key, int value, int level) {
+    SLNode *n = (SLNode *)malloc(sizeof(SLNode));
+    n->key = key; n->value = value;
+    n->forward = (SLNode **)calloc(level + 1, sizeof(SLNode *));
+    return n;
+}
+static SkipList* sl_create() {
+    SkipList *l = (SkipList *)malloc(sizeof(SkipList));
+    l->level = 0;
+    l->header = sl_node(0, 0, SL_MAX_LEVEL);
+    return l;
+}
+static void sl_insert(SkipList *l, int key, int value) {
+    SLNode *update[SL_MAX_LEVEL + 1];
+    SLNode *cur = l->header;
+    for (int i = l->level; i >= 0; i--) {
+        while (cur->forward[i] && cur->forward[i]->key < key) cur = cur->forward[i];
+        update[i] = cur;
+    }
+    cur = cur->forward[0];
+    if (cur && cur->key == key) { cur->value = value; return; }
+    int lvl = 0;
+    while ((rand() & 1) && lvl < SL_MAX_LEVEL) lvl++;
+    if (lvl > l->level) {
+        for (int i = l->level + 1; i <= lvl; i++) update[i] = l->header;
+        l->level = lvl;
+    }
+    SLNode *n = sl_node(key, value, lvl);
+    for (int i = 0; i <= lvl; i++) {
+        n->forward[i] = update[i]->forward[i];
+        update[i]->forward[i] = n;
+    }
+}
+static SLNode* sl_lower_bound(SkipList *l, int key) {
+    SLNode *cur = l->header;
+    for (int i = l->level; i >= 0; i--) {
+        while (cur->forward[i] && cur->forward[i]->key < key) cur = cur->forward[i];
+    }
+    return cur->forward[0];
+}
+static bool sl_search(SkipList *l, int key, int *value) {
+    SLNode *n = sl_lower_bound(l, key);
+    if (n && n->key == key) { *value = n->value; return true; }
+    return false;
+}
+static long long sl_range_sum(SkipList *l, int lo, int hi, long *count) {
+    long long s = 0;
+    for (SLNode *n = sl_lower_bound(l, lo); n && n->key <= hi; n = n->forward[0]) {
+        s += n->value;
+        (*count)++;
+    }
+    return s;
+}
+static void sl_free(SkipList *l) {
+    SLNode *n = l->header;
+    while (n) {
+        SLNode *next = n->forward[0];
+        free(n->forward);
+        free(n);
+        n = next;
+    }
+    free(l);
+}
+
+// ==================== TESTES ====================
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+void testar_layout() {
+    printf("=== LAYOUT DOS NÓS ===\n\n");
+    printf("Tamanho da folha:       %zu bytes (%d pares chave/valor)\n", sizeof(BPlusLeaf), LEAF_CAP);
+    printf("Tamanho do nó interno:  %zu bytes (%d chaves, %d filhos)\n",
+           sizeof(BPlusInner), INNER_CAP, INNER_CAP + 1);
+    printf("Verificação: %s\n\n",
+           (sizeof(BPlusLeaf) <= BPLUS_PAGE_SIZE && sizeof(BPlusInner) <= BPLUS_PAGE_SIZE) ? "OK" : "FALHA");
+}
+
+void testar_insercao() {
+    printf("=== TESTE DE INSERÇÃO E BUSCA ===\n\n");
+
+    srand(42);
+    BPlusTree *tree = bplus_create();
+    int n = 200000;
+    int *keys = (int *)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        keys[i] = rand() % 1000000;
+        bplus_insert(tree, keys[i], keys[i] * 2);
+    }
+
+    bool ok = bplus_verify(tree);
+    for (int i = 0; i < n && ok; i++) {
+        int v;
+        ok = bplus_search(tree, keys[i], &v) && v == keys[i] * 2;
+    }
+    int v;
+    ok = ok && !bplus_search(tree, -5, &v) && !bplus_search(tree, 1000001, &v);
+
+    printf("Inseridas %d chaves aleatórias (%ld distintas)\n", n, tree->size);
+    printf("Altura: %d | nós: %ld | memória: %.1f MB\n", tree->height, tree->num_nodes,
+           tree->num_nodes * BPLUS_PAGE_SIZE / (1024.0 * 1024.0));
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+
+    free(keys);
+    bplus_free(tree);
+}
+
+void testar_intervalos() {
+    printf("=== TESTE DE CONSULTAS POR INTERVALO ===\n\n");
+
+    srand(7);
+    BPlusTree *tree = bplus_create();
+    int n = 50000;
+    int *sorted = (int *)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        sorted[i] = rand() % 200000;
+        bplus_insert(tree, sorted[i], sorted[i] % 1000);
+    }
+    qsort(sorted, n, sizeof(int), compare_int);
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        if (m == 0 || sorted[m - 1] != sorted[i]) sorted[m++] = sorted[i];
+    }
+
+    bool ok = true;
+    for (int q = 0; q < 2000 && ok; q++) {
+        int lo = rand() % 210000 - 5000;
+        int hi = lo + rand() % 3000;
+        long long expected = 0;
+        long expected_count = 0;
+        for (int i = 0; i < m; i++) {
+            if (sorted[i] >= lo && sorted[i] <= hi) {
+                expected += sorted[i] % 1000;
+                expected_count++;
+            }
+        }
+        long count;
+        ok = bplus_range_sum(tree, lo, hi, &count) == expected && count == expected_count;
+    }
+
+    // Intervalos invertidos são vazios, inclusive entre chaves presentes
+    for (int q = 0; q < 200 && ok; q++) {
+        int hi = sorted[rand() % m];
+        int lo = hi + 1 + rand() % 3000;
+        long count = -1;
+        ok = bplus_range_sum(tree, lo, hi, &count) == 0 && count == 0;
+    }
+
+    // Iterador: percorre tudo em ordem
+    long visited = 0;
+    for (BPlusIterator it = bplus_seek(tree, -1); bplus_iter_valid(&it) && ok; bplus_iter_next(&it)) {
+        ok = it.leaf->keys[it.pos] == sorted[visited++];
+    }
+    ok = ok && visited == m;
+
+    printf("2000 intervalos aleatórios comparados com vetor ordenado, 200 invertidos vazios\n");
+    printf("Iterador visitou %ld chaves em ordem\n", visited);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+
+    free(sorted);
+    bplus_free(tree);
+}
+
+void testar_bulk_load() {
+    printf("=== TESTE DE BULK LOADING ===\n\n");
+
+    long n = 1000000;
+    int *keys = (int *)malloc(n * sizeof(int));
+    int *values = (int *)malloc(n * sizeof(int));
+    for (long i = 0; i < n; i++) {
+        keys[i] = (int)(i * 3);
+        values[i] = (int)i;
+    }
+
+    double fills[] = { 1.0, 0.7 };
+    bool ok = true;
+    for (int f = 0; f < 2; f++) {
+        BPlusTree *tree = bplus_bulk_load(keys, values, n, fills[f]);
+        bool valid = bplus_verify(tree);
+        int v;
+        valid = valid && bplus_search(tree, 2999997, &v) && v == 999999 && !bplus_search(tree, 4, &v);
+
+        // Inserções depois do bulk load continuam funcionando
+        for (int i = 0; i < 10000; i++) {
+            bplus_insert(tree, i * 300 + 1, -1);
+        }
+        valid = valid && bplus_verify(tree) && tree->size == n + 10000;
+
+        printf("fill = %.1f: altura %d, %ld nós (%.1f MB) -> %s\n", fills[f], tree->height,
+               tree->num_nodes, tree->num_nodes * BPLUS_PAGE_SIZE / (1024.0 * 1024.0),
+               valid ? "OK" : "FALHA");
+        ok = ok && valid;
+        bplus_free(tree);
+    }
+
+    BPlusTree *empty = bplus_bulk_load(keys, values, 0, 1.0);
+    ok = ok && bplus_verify(empty);
+    bplus_free(empty);
+
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+    free(keys);
+    free(values);
+}
+
+// ==================== BENCHMARK ====================
+
+static double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+void benchmark(int n) {
+    printf("=== BENCHMARK: %d CHAVES ===\n\n", n);
+
+    int *keys = (int *)malloc(n * sizeof(int));
+    srand(123);
+    for (int i = 0; i < n; i++) {
+        keys[i] = (int)(((unsigned)rand() << 8) ^ (unsigned)rand()) & 0x7fffffff;
+    }
+    int queries = n;
+    int *lookups = (int *)malloc(queries * sizeof(int));
+    for (int i = 0; i < queries; i++) {
+        lookups[i] = (i % 2) ? keys[rand() % n] : (int)(((unsigned)rand() << 8) ^ (unsigned)rand()) & 0x7fffffff;
+    }
+    int num_ranges = 20000;
+    int *range_lo = (int *)malloc(num_ranges * sizeof(int));
+    // Intervalos com ~100 chaves em média
+    long span = (long)(0x7fffffffL / n) * 100;
+    for (int i = 0; i < num_ranges; i++) {
+        range_lo[i] = keys[rand() % n];
+    }
+
+    // Construção
+    clock_t t = clock();
+    BPlusTree *bp = bplus_create();
+    for (int i = 0; i < n; i++) bplus_insert(bp, keys[i], i);
+    double t_bp_build = elapsed(t);
+
+    int *sorted = (int *)malloc(n * sizeof(int));
+    memcpy(sorted, keys, n * sizeof(int));
+    t = clock();
+    qsort(sorted, n, sizeof(int), compare_int);
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        if (m == 0 || sorted[m - 1] != sorted[i]) sorted[m++] = sorted[i];
+    }
+    BPlusTree *bulk = bplus_bulk_load(sorted, sorted, m, 1.0);
+    double t_bulk_build = elapsed(t);
+
+    t = clock();
+    AVLNode *avl = NULL;
+    for (int i = 0; i < n; i++) avl = avl_insert(avl, keys[i], i);
+    double t_avl_build = elapsed(t);
+
+    t = clock();
+    SkipList *sl = sl_create();
+    for (int i = 0; i < n; i++) sl_insert(sl, keys[i], i);
+    double t_sl_build = elapsed(t);
+
+    // Buscas pontuais
+    long hits[3] = { 0, 0, 0 };
+    int v;
+    t = clock();
+    for (int i = 0; i < queries; i++) hits[0] += bplus_search(bp, lookups[i], &v);
+    double t_bp_search = elapsed(t);
+    t = clock();
+    for (int i = 0; i < queries; i++) hits[1] += avl_search(avl, lookups[i], &v);
+    double t_avl_search = elapsed(t);
+    t = clock();
+    for (int i = 0; i < queries; i++) hits[2] += sl_search(sl, lookups[i], &v);
+    double t_sl_search = elapsed(t);
+
+    // Consultas por intervalo
+    long long sums[3] = { 0, 0, 0 };
+    long counts[3] = { 0, 0, 0 };
+    t = clock();
+    for (int i = 0; i < num_ranges; i++) {
+        long c;
+        sums[0] += bplus_range_sum(bp, range_lo[i], (int)(range_lo[i] + span > 0x7fffffffL ? 0x7fffffff : range_lo[i] + span), &c);
+        counts[0] += c;
+    }
+    double t_bp_range = elapsed(t);
+    t = clock();
+    for (int i = 0; i < num_ranges; i++) {
+        sums[1] += avl_range_sum(avl, range_lo[i], (int)(range_lo[i] + span > 0x7fffffffL ? 0x7fffffff : range_lo[i] + span), &counts[1]);
+    }
+    double t_avl_range = elapsed(t);
+    t = clock();
+    for (int i = 0; i < num_ranges; i++) {
+        sums[2] += sl_range_sum(sl, range_lo[i], (int)(range_lo[i] + span > 0x7fffffffL ? 0x7fffffff : range_lo[i] + span), &counts[2]);
+    }
+    double t_sl_range = elapsed(t);
+
+    printf("%-22s %12s %14s %14s\n", "Estrutura", "Construção", "Busca pontual", "Intervalos");
+    printf("%-22s %11.3fs %13.3fs %13.3fs\n", "B+ Tree (inserções)", t_bp_build, t_bp_search, t_bp_range);
+    printf("%-22s %11.3fs %14s %14s\n", "B+ Tree (qsort + bulk)", t_bulk_build, "-", "-");
+    printf("%-22s %11.3fs %13.3fs %13.3fs\n", "AVL Tree", t_avl_build, t_avl_search, t_avl_range);
+    printf("%-22s %11.3fs %13.3fs %13.3fs\n", "Skip List", t_sl_build, t_sl_search, t_sl_range);
+    printf("\n%d buscas pontuais (metade presentes), %d intervalos (~%ld chaves cada)\n",
+           queries, num_ranges, counts[0] / num_ranges);
+    printf("Altura: B+ Tree %d | AVL %d\n", bp->height, avl_h(avl));
+    printf("Resultados idênticos: %s\n\n",
+           (hits[0] == hits[1] && hits[1] == hits[2] && counts[0] == counts[1] && counts[1] == counts[2] &&
+            bplus_verify(bulk) && bulk->size == bp->size) ? "OK" : "FALHA");
+    (void)sums;
+
+    bplus_free(bp);
+    bplus_free(bulk);
+    avl_free(avl);
+    sl_free(sl);
+    free(keys);
+    free(sorted);
+    free(lookups);
+    free(range_lo);
+}
+
+// ==================== FUNÇÃO PRINCIPAL ====================
+
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║                       B+ TREE                            ║\n");
+    printf("║   Nós de 4 KB, folhas encadeadas e bulk loading          ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    testar_layout();
+    testar_insercao();
+    testar_intervalos();
+    testar_bulk_load();
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    if (n < 1000) n = 1000;
+    benchmark(n);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da B+ Tree:\n");
+    printf("- Busca/Inserção: O(log n), com altura log_B(n) para B ~ 340-510\n");
+    printf("- Intervalo [lo, hi]: O(log n + k), folhas lidas em sequência\n");
+    printf("- Bulk loading: O(n) a partir de dados ordenados\n");
+    printf("- Nós de uma página: poucas faltas de cache por busca\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,521 @@
+/**
+ * ============================================================================
+ * GEOHASH - CODIFICAÇÃO POR INTERCALAÇÃO DE BITS (BMI2 PDEP/PEXT)
+ * ============================================================================
+ *
+ * Geohash (Niemeyer, 2008) transforma (latitude, longitude) em uma string
+ * base32 em que cada caractere subdivide a célula anterior. A versão do
+ * material de aula (docs/algoritmos-avancados/01-geohash) faz uma
+ * bissecção por bit, com um desvio e uma divisão de intervalo em cada um
+ * dos 60 bits. Aqui:
+ *
+ * QUANTIZAÇÃO + INTERCALAÇÃO (CURVA Z / MORTON):
+ * - Longitude e latitude viram inteiros de 32 bits:
+ *       lonq = (lon + 180) / 360 * 2^32,   latq = (lat + 90) / 180 * 2^32
+ *   Cada bit de lonq é um passo da bissecção, exceto no desempate: um
+ *   ponto exatamente na fronteira (ou a um arredondamento dela) vai para
+ *   a célula de cima, como em geohash.org, e a bissecção do material, que
+ *   testa 'longitude > mid', o manda para a de baixo. (0, 0) dá 's' aqui
+ *   e '7' no material
+ * - O código de 64 bits intercala os dois, começando pela longitude:
+ *
+ *       bit:   63   62   61   60  ...   1    0
+ *             lon31 lat31 lon30 lat30 ... lon0 lat0
+ *
+ * - A string são os 5*precision bits mais altos, 5 bits por caractere
+ *
+ * PDEP/PEXT (BMI2):
+ * - _pdep_u64(lonq, 0xAAAA...) espalha os bits de lonq nas posições
+ *   ímpares em uma instrução; _pext_u64 faz o inverso
+ * - Sem BMI2, a intercalação usa 5 passos de shift + máscara
+ * - A escolha é feita em tempo de execução (__builtin_cpu_supports), então
+ *   o mesmo binário roda em qualquer x86-64 ou em outra arquitetura.
+ *   Em AMD anteriores ao Zen 3, pdep/pext são microcodificadas e lentas:
+ *   geohash_use_bmi2(false) força o caminho portátil
+ *
+ * VIZINHOS:
+ * - A célula vira um par de inteiros (coluna, linha); os 8 vizinhos são
+ *   (coluna ± 1, linha ± 1), com a longitude dando a volta em ±180 e sem
+ *   vizinhos além dos polos. Nada de tabelas de bordas por caractere
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define GEOHASH_HAS_BMI2_PATH 1
+#endif
+
+#define GEOHASH_MAX_PRECISION 12        // 60 bits
+
+static const char BASE32[] = "0123456789bcdefghjkmnpqrstuvwxyz";
+
+typedef struct {
+    double lat_min, lat_max;
+    double lon_min, lon_max;
+} GeoBox;
+
+// ==================== INTERCALAÇÃO PORTÁTIL ====================
+
+// Função para espalhar os 32 bits de x nas posições pares de 64 bits
+static inline uint64_t spread_bits(uint32_t v) {
+    uint64_t x = v;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8))  & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4))  & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2))  & 0x3333333333333333ULL;
+    x = (x | (x << 1))  & 0x5555555555555555ULL;
+    return x;
+}
+
+// Função inversa: junta os bits das posições pares
+static inline uint32_t compact_bits(uint64_t x) {
+    x &= 0x5555555555555555ULL;
+    x = (x | (x >> 1))  & 0x3333333333333333ULL;
+    x = (x | (x >> 2))  & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x >> 4))  & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >> 8))  & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+    return (uint32_t)x;
+}
+
+static uint64_t interleave_portable(uint32_t latq, uint32_t lonq) {
+    return (spread_bits(lonq) << 1) | spread_bits(latq);
+}
+
+static void deinterleave_portable(uint64_t code, uint32_t *latq, uint32_t *lonq) {
+    *lonq = compact_bits(code >> 1);
+    *latq = compact_bits(code);
+}
+
+// ==================== INTERCALAÇÃO BMI2 ====================
+
+#ifdef GEOHASH_HAS_BMI2_PATH
+__attribute__((target("bmi2")))
+static uint64_t interleave_bmi2(uint32_t latq, uint32_t lonq) {
+    return _pdep_u64(lonq, 0xAAAAAAAAAAAAAAAAULL) | _pdep_u64(latq, 0x5555555555555555ULL);
+}
+
+__attribute__((target("bmi2")))
+static void deinterleave_bmi2(uint64_t code, uint32_t *latq, uint32_t *lonq) {
+    *lonq = (uint32_t)_pext_u64(code, 0xAAAAAAAAAAAAAAAAULL);
+    *latq = (uint32_t)_pext_u64(code, 0x5555555555555555ULL);
+}
+#endif
+
+// Implementação escolhida em tempo de execução
+static uint64_t (*interleave)(uint32_t, uint32_t) = interleave_portable;
+static void (*deinterleave)(uint64_t, uint32_t *, uint32_t *) = deinterleave_portable;
+
+/**
+ * Liga ou desliga o caminho BMI2. Retorna true se BMI2 ficou ativo
+ * (só acontece se a CPU suportar)
+ */
+bool geohash_use_bmi2(bool enable) {
+#ifdef GEOHASH_HAS_BMI2_PATH
+    if (enable && __builtin_cpu_supports("bmi2")) {
+        interleave = interleave_bmi2;
+        deinterleave = deinterleave_bmi2;
+        return true;
+    }
+#endif
+    (void)enable;
+    interleave = interleave_portable;
+    deinterleave = deinterleave_portable;
+    return false;
+}
+
+// ==================== CODIFICAÇÃO ====================
+
+// Função para quantizar v de [lo, hi] em 32 bits (hi cai na última célula)
+static inline uint32_t quantize(double v, double lo, double hi) {
+    double t = (v - lo) / (hi - lo);
+    if (t <= 0) return 0;
+    if (t >= 1) return UINT32_MAX;
+    return (uint32_t)(t * 4294967296.0);
+}
+
+// Função para calcular o código de 64 bits (precisão máxima) de um ponto
+uint64_t geohash_encode_bits(double latitude, double longitude) {
+    return interleave(quantize(latitude, -90.0, 90.0), quantize(longitude, -180.0, 180.0));
+}
+
+// Função para escrever os 5*precision bits mais altos de code em base32
+static void bits_to_string(uint64_t code, int precision, char *out) {
+    for (int i = 0; i < precision; i++) {
+        out[i] = BASE32[(code >> (59 - 5 * i)) & 31];
+    }
+    out[precision] = '\0';
+}
+
+/**
+ * Codifica (latitude, longitude) em geohash de 'precision' caracteres
+ * (1 a 12). out precisa de precision + 1 posições
+ */
+void geohash_encode(double latitude, double longitude, int precision, char *out) {
+    if (precision < 1) precision = 1;
+    if (precision > GEOHASH_MAX_PRECISION) precision = GEOHASH_MAX_PRECISION;
+    bits_to_string(geohash_encode_bits(latitude, longitude), precision, out);
+}
+
+// ==================== DECODIFICAÇÃO ====================
+
+// Função para ler um geohash: bits alinhados à esquerda; -1 se inválido
+static int string_to_bits(const char *hash, uint64_t *code) {
+    static signed char value[256];
+    static bool ready = false;
+    if (!ready) {
+        memset(value, -1, sizeof(value));
+        for (int i = 0; i < 32; i++) value[(unsigned char)BASE32[i]] = (signed char)i;
+        ready = true;
+    }
+
+    int len = (int)strlen(hash);
+    if (len < 1 || len > GEOHASH_MAX_PRECISION) return -1;
+    uint64_t bits = 0;
+    for (int i = 0; i < len; i++) {
+        int v = value[(unsigned char)hash[i]];
+        if (v < 0) return -1;
+        bits |= (uint64_t)v << (59 - 5 * i);
+    }
+    *code = bits;
+    return len;
+}
+
+// Função para obter quantos bits de longitude e de latitude há em 'len' caracteres
+static inline void axis_bits(int len, int *lon_bits, int *lat_bits) {
+    *lon_bits = (5 * len + 1) / 2;
+    *lat_bits = (5 * len) / 2;
+}
+
+/**
+ * Decodifica o geohash na sua célula (retângulo). Retorna false se a
+ * string for inválida
+ */
+bool geohash_decode_box(const char *hash, GeoBox *box) {
+    uint64_t code;
+    int len = string_to_bits(hash, &code);
+    if (len < 0) return false;
+
+    uint32_t latq, lonq;
+    deinterleave(code, &latq, &lonq);
+    int lon_bits, lat_bits;
+    axis_bits(len, &lon_bits, &lat_bits);
+
+    double lon_cell = 360.0 / (double)(1ULL << lon_bits);
+    double lat_cell = 180.0 / (double)(1ULL << lat_bits);
+    box->lon_min = -180.0 + (double)(lonq >> (32 - lon_bits)) * lon_cell;
+    box->lat_min = -90.0 + (double)(latq >> (32 - lat_bits)) * lat_cell;
+    box->lon_max = box->lon_min + lon_cell;
+    box->lat_max = box->lat_min + lat_cell;
+    return true;
+}
+
+// Função para decodificar no centro da célula (mesma assinatura do material de aula)
+bool geohash_decode(const char *hash, double *latitude, double *longitude) {
+    GeoBox box;
+    if (!geohash_decode_box(hash, &box)) return false;
+    *latitude = (box.lat_min + box.lat_max) / 2;
+    *longitude = (box.lon_min + box.lon_max) / 2;
+    return true;
+}
+
+// ==================== VIZINHOS ====================
+
+typedef enum {
+    GEO_NORTH, GEO_NORTHEAST, GEO_EAST, GEO_SOUTHEAST,
+    GEO_SOUTH, GEO_SOUTHWEST, GEO_WEST, GEO_NORTHWEST
+} GeoDirection;
+
+static const int DIR_DLAT[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+static const int DIR_DLON[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+
+/**
+ * Calcula o vizinho de hash na direção dir (mesma precisão). Retorna false
+ * se não existe (além de um polo) ou se hash é inválido
+ */
+bool geohash_neighbor(const char *hash, GeoDirection dir, char *out) {
+    uint64_t code;
+    int len = string_to_bits(hash, &code);
+    if (len < 0) return false;
+
+    uint32_t latq, lonq;
+    deinterleave(code, &latq, &lonq);
+    int lon_bits, lat_bits;
+    axis_bits(len, &lon_bits, &lat_bits);
+
+    uint64_t lon_cells = 1ULL << lon_bits, lat_cells = 1ULL << lat_bits;
+    int64_t row = (int64_t)(latq >> (32 - lat_bits)) + DIR_DLAT[dir];
+    int64_t col = (int64_t)(lonq >> (32 - lon_bits)) + DIR_DLON[dir];
+    if (row < 0 || row >= (int64_t)lat_cells) return false;
+    col = (col + (int64_t)lon_cells) % (int64_t)lon_cells;     // Volta em ±180
+
+    uint64_t ncode = interleave((uint32_t)((uint64_t)row << (32 - lat_bits)),
+                                (uint32_t)((uint64_t)col << (32 - lon_bits)));
+    bits_to_string(ncode, len, out);
+    return true;
+}
+
+/**
+ * Enumera os vizinhos de hash na ordem N, NE, E, SE, S, SW, W, NW.
+ * out[i] recebe cada um; retorna quantos existem (8, ou 5 junto a um polo)
+ */
+int geohash_neighbors(const char *hash, char out[8][GEOHASH_MAX_PRECISION + 1]) {
+    int count = 0;
+    for (int d = 0; d < 8; d++) {
+        if (geohash_neighbor(hash, (GeoDirection)d, out[count])) count++;
+    }
+    return count;
+}
+
+// ==================== VERSÃO DO MATERIAL DE AULA ====================
+
+// Mesmo algoritmo de docs/algoritmos-avancados/01-geohash: bissecção por bit
+static void encode_geohash(double latitude, double longitude, int precision, char *geohash) {
+    double lat_interval[2] = { -90.0, 90.0 };
+    double lon_interval[2] = { -180.0, 180.0 };
+    int is_even = 1, bit = 0, ch = 0, geohash_index = 0;
+    while (geohash_index < precision) {
+        double mid;
+        if (is_even) {
+            mid = (lon_interval[0] + lon_interval[1]) / 2;
+            if (longitude > mid) {
+                ch |= (1 << (4 - bit));
+                lon_interval[0] = mid;
+            } else {
+                lon_interval[1] = mid;
+            }
+        } else {
+            mid = (lat_interval[0] + lat_interval[1]) / 2;
+            if (latitude > mid) {
+                ch |= (1 << (4 - bit));
+                lat_interval[0] = mid;
+            } else {
+                lat_interval[1] = mid;
+            }
+        }
+        is_even = !is_even;
+        if (++bit == 5) {
+            geohash[geohash_index++] = BASE32[ch];
+            bit = 0;
+            ch = 0;
+        }
+    }
+    geohash[geohash_index] = '\0';
+}
+
+// ==================== TESTES ====================
+
+static uint64_t rng_state = 88172645463325252ULL;
+
+static double next_uniform(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (rng_state >> 11) * (1.0 / 9007199254740992.0);
+}
+
+void testar_codificacao(void) {
+    printf("=== TESTE: CODIFICAÇÃO E DECODIFICAÇÃO ===\n\n");
+
+    char hash[GEOHASH_MAX_PRECISION + 1];
+    geohash_encode(42.6, -5.6, 5, hash);
+    printf("(42.6, -5.6), 5 caracteres:          %s\n", hash);
+    bool ok = strcmp(hash, "ezs42") == 0;
+    geohash_encode(57.64911, 10.40744, 11, hash);
+    printf("(57.64911, 10.40744), 11 caracteres: %s\n", hash);
+    ok = ok && strcmp(hash, "u4pruydqqvj") == 0;
+
+    double lat = 0, lon = 0;
+    geohash_decode("ezs42", &lat, &lon);
+    GeoBox box;
+    geohash_decode_box("ezs42", &box);
+    printf("ezs42 -> centro (%.4f, %.4f), célula %.4f x %.4f graus\n",
+           lat, lon, box.lat_max - box.lat_min, box.lon_max - box.lon_min);
+    ok = ok && fabs(lat - 42.605) < 0.001 && fabs(lon - (-5.603)) < 0.001;
+    ok = ok && !geohash_decode("ezs4a", &lat, &lon);          // 'a' não existe em base32
+
+    // Contra a bissecção do material, nos dois caminhos (portátil e BMI2)
+    bool has_bmi2 = geohash_use_bmi2(true);
+    for (int impl = 0; impl < 2 && ok; impl++) {
+        geohash_use_bmi2(impl == 1);
+        for (int i = 0; i < 200000 && ok; i++) {
+            double la = next_uniform() * 180 - 90, lo = next_uniform() * 360 - 180;
+            int p = 1 + i % GEOHASH_MAX_PRECISION;
+            char expected[GEOHASH_MAX_PRECISION + 1];
+            encode_geohash(la, lo, p, expected);
+            geohash_encode(la, lo, p, hash);
+            ok = strcmp(hash, expected) == 0 && geohash_decode_box(hash, &box) &&
+                 box.lat_min <= la && la <= box.lat_max && box.lon_min <= lo && lo <= box.lon_max;
+        }
+    }
+    geohash_use_bmi2(true);
+    printf("200k pontos por caminho iguais à bissecção do material (BMI2 %s)\n",
+           has_bmi2 ? "disponível" : "indisponível: só o portátil");
+
+    // Fronteiras: o ponto cai na célula que começa nele (o material escolhe a anterior)
+    char docs[2];
+    geohash_encode(0.0, 0.0, 1, hash);
+    encode_geohash(0.0, 0.0, 1, docs);
+    printf("(0, 0), 1 caractere: %s (material: %s)\n", hash, docs);
+    ok = ok && strcmp(hash, "s") == 0 && strcmp(docs, "7") == 0;
+    for (int i = 0; i < 20000 && ok; i++) {
+        int p = 1 + i % GEOHASH_MAX_PRECISION;
+        int lon_bits = (5 * p + 1) / 2, lat_bits = (5 * p) / 2;
+        double lon_cells = (double)(1ULL << lon_bits), lat_cells = (double)(1ULL << lat_bits);
+        double lo = -180.0 + floor(next_uniform() * lon_cells) * (360.0 / lon_cells);
+        double la = -90.0 + floor(next_uniform() * lat_cells) * (180.0 / lat_cells);
+        geohash_encode(la, lo, p, hash);
+        ok = geohash_decode_box(hash, &box) && box.lon_min == lo && box.lat_min == la;
+    }
+    printf("20k pontos sobre fronteiras: cada um no canto inferior da sua célula\n");
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// Função para verificar se b é a célula vizinha de a na direção d
+static bool is_adjacent(const GeoBox *a, const GeoBox *b, int d) {
+    const double eps = 1e-9;
+    double w = a->lon_max - a->lon_min, h = a->lat_max - a->lat_min;
+    double dlon = b->lon_min - a->lon_min;
+    if (dlon > 180) dlon -= 360;                        // Volta em ±180
+    if (dlon < -180) dlon += 360;
+    return fabs(dlon - DIR_DLON[d] * w) < eps && fabs((b->lat_min - a->lat_min) - DIR_DLAT[d] * h) < eps &&
+           fabs((b->lon_max - b->lon_min) - w) < eps && fabs((b->lat_max - b->lat_min) - h) < eps;
+}
+
+void testar_vizinhos(void) {
+    printf("=== TESTE: VIZINHOS ===\n\n");
+
+    static const char *names[8] = { "N", "NE", "E", "SE", "S", "SW", "W", "NW" };
+    char out[8][GEOHASH_MAX_PRECISION + 1];
+    int count = geohash_neighbors("ezs42", out);
+    printf("Vizinhos de ezs42:");
+    for (int i = 0; i < count; i++) printf(" %s=%s", names[i], out[i]);
+    printf("\n");
+    bool ok = count == 8;
+
+    // Junto ao polo norte e na linha de ±180
+    char polar[GEOHASH_MAX_PRECISION + 1], east[GEOHASH_MAX_PRECISION + 1];
+    geohash_encode(89.99, 179.99, 4, polar);
+    int polar_count = geohash_neighbors(polar, out);
+    geohash_neighbor(polar, GEO_EAST, east);
+    GeoBox b;
+    geohash_decode_box(east, &b);
+    printf("%s (perto de 90N, 180E): %d vizinhos; a leste fica %s (lon %.1f..%.1f)\n",
+           polar, polar_count, east, b.lon_min, b.lon_max);
+    ok = ok && polar_count == 5 && b.lon_min == -180.0;
+
+    for (int i = 0; i < 20000 && ok; i++) {
+        char hash[GEOHASH_MAX_PRECISION + 1];
+        geohash_encode(next_uniform() * 180 - 90, next_uniform() * 360 - 180, 1 + i % 12, hash);
+        GeoBox a;
+        geohash_decode_box(hash, &a);
+        for (int d = 0; d < 8 && ok; d++) {
+            char n[GEOHASH_MAX_PRECISION + 1], back[GEOHASH_MAX_PRECISION + 1];
+            if (!geohash_neighbor(hash, (GeoDirection)d, n)) {
+                ok = a.lat_max >= 90 || a.lat_min <= -90;       // Só falta vizinho no polo
+                continue;
+            }
+            GeoBox nb;
+            geohash_decode_box(n, &nb);
+            // Voltar pela direção oposta dá a célula original
+            ok = is_adjacent(&a, &nb, d) && geohash_neighbor(n, (GeoDirection)((d + 4) % 8), back) &&
+                 strcmp(back, hash) == 0;
+        }
+    }
+    printf("20k células: vizinhos adjacentes, do mesmo tamanho e reversíveis\n");
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// ==================== BENCHMARK ====================
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void benchmark(int n) {
+    printf("=== BENCHMARK: %d pontos, 12 caracteres ===\n\n", n);
+
+    double *lat = (double *)malloc(sizeof(double) * n);
+    double *lon = (double *)malloc(sizeof(double) * n);
+    char (*hashes)[GEOHASH_MAX_PRECISION + 1] = malloc(sizeof(*hashes) * (size_t)n);
+    for (int i = 0; i < n; i++) {
+        lat[i] = next_uniform() * 180 - 90;
+        lon[i] = next_uniform() * 360 - 180;
+    }
+    volatile uint64_t sink = 0;
+    double start;
+
+    start = now_seconds();
+    for (int i = 0; i < n; i++) encode_geohash(lat[i], lon[i], 12, hashes[i]);
+    double t_docs = now_seconds() - start;
+
+    printf("%-28s %12s %12s %12s\n", "Implementação", "string (ns)", "bits (ns)", "decode (ns)");
+    printf("%-28s %12.1f %12s %12s\n", "bissecção (material)", 1e9 * t_docs / n, "-", "-");
+
+    bool has_bmi2 = geohash_use_bmi2(true);
+    for (int impl = 0; impl < (has_bmi2 ? 2 : 1); impl++) {
+        geohash_use_bmi2(impl == 1);
+        start = now_seconds();
+        for (int i = 0; i < n; i++) geohash_encode(lat[i], lon[i], 12, hashes[i]);
+        double t_str = now_seconds() - start;
+        start = now_seconds();
+        for (int i = 0; i < n; i++) sink += geohash_encode_bits(lat[i], lon[i]);
+        double t_bits = now_seconds() - start;
+        start = now_seconds();
+        for (int i = 0; i < n; i++) {
+            double la = 0, lo = 0;
+            geohash_decode(hashes[i], &la, &lo);
+            sink += (uint64_t)la;
+        }
+        double t_dec = now_seconds() - start;
+        printf("%-28s %12.1f %12.1f %12.1f\n", impl == 1 ? "intercalação BMI2 (pdep)" : "intercalação portátil",
+               1e9 * t_str / n, 1e9 * t_bits / n, 1e9 * t_dec / n);
+    }
+    geohash_use_bmi2(true);
+    printf("\n");
+
+    free(lat);
+    free(lon);
+    free(hashes);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║             GEOHASH                                      ║\n");
+    printf("║   Intercalação de bits (BMI2 pdep/pext) e vizinhos       ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    if (n < 1) n = 1;
+
+    printf("Caminho BMI2: %s\n\n", geohash_use_bmi2(true) ? "ativo" : "indisponível (portátil)");
+
+    testar_codificacao();
+    testar_vizinhos();
+    benchmark(n);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades do Geohash:\n");
+    printf("- Código = intercalação (curva Z) de lon e lat quantizadas\n");
+    printf("- Prefixo comum => mesma célula (mas células vizinhas podem\n");
+    printf("  ter prefixos diferentes: por isso os 8 vizinhos)\n");
+    printf("- BMI2 com escolha em tempo de execução e caminho portátil\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,784 @@
+/**
+ * ============================================================================
+ * QUADTREE DE REGIÃO - CARGA EM LOTE, BUSCA POR RETÂNGULO E CÉLULAS VIZINHAS
+ * ============================================================================
+ *
+ * A quadtree de região divide um retângulo fixo em 4 quadrantes iguais,
+ * recursivamente, até cada folha ter no máximo 'leafSize' pontos. Ao
+ * contrário da k-d tree, os cortes não dependem dos dados: a célula de um
+ * ponto em cada nível é conhecida de antemão, o que permite:
+ *
+ * COORDENADAS QUANTIZADAS:
+ * - x e y viram inteiros de 16 bits dentro da região; um nó no nível L
+ *   cobre um quadrado de 2^(16-L) x 2^(16-L) inteiros
+ * - O quadrante de um ponto no nível L é o bit (15-L) de x e de y, sem
+ *   comparar doubles: inserção e poda usam só inteiros
+ * - A poda da busca converte o retângulo para inteiros; como a quantização
+ *   é monótona, nenhum ponto dentro do retângulo é descartado
+ *
+ * CARGA EM LOTE (BULK INSERT):
+ * - Ordena os pontos pelo código de Morton (intercalação dos bits de y e x)
+ *   com radix sort: os pontos de cada nó ficam contíguos e os 4 filhos são
+ *   4 fatias consecutivas, achadas por busca binária
+ * - As folhas apontam para um único bloco com os pontos ordenados. Uma
+ *   folha só ganha vetor próprio se receber inserção depois
+ *
+ * BUSCA POR RETÂNGULO:
+ * - Nó disjunto: podado. Nó inteiramente dentro: todos os pontos entram
+ *   sem teste. Só as folhas da borda testam ponto a ponto
+ *
+ * CÉLULAS VIZINHAS:
+ * - Para a folha que contém (x, y), lista as folhas que tocam sua célula
+ *   (aresta ou canto), independente do nível de cada uma
+ *
+ * Compilação: gcc -O2 -std=c11 quadtree.c -o quadtree -lm
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define QT_BITS 16                      // Profundidade máxima
+#define QT_CELLS (1u << QT_BITS)
+#define DEFAULT_LEAF_SIZE 16
+
+typedef struct {
+    double x_min, y_min, x_max, y_max;
+} Box;
+
+typedef struct {
+    double x, y;
+    int id;
+} QuadPoint;
+
+typedef struct {
+    int children;                       // Índice do 1º de 4 filhos; -1 se folha
+    uint32_t x0, y0;                    // Canto da célula (quantizado)
+    int level;
+    QuadPoint *items;                   // Folha: seus pontos
+    int count;
+    int capacity;                       // 0: items aponta para o bloco da carga em lote
+} QuadNode;
+
+typedef struct {
+    Box bounds;
+    double scale_x, scale_y;            // QT_CELLS / largura, QT_CELLS / altura
+    int leafSize;
+    QuadNode *nodes;                    // Filhos de um nó são 4 posições seguidas
+    int nodeCount, nodeCapacity;
+    QuadPoint *slab;                    // Pontos da carga em lote, em ordem de Morton
+    int size;
+} QuadTree;
+
+// Folha devolvida pela enumeração de vizinhos
+typedef struct {
+    Box box;
+    const QuadPoint *items;
+    int count;
+} QuadLeaf;
+
+// ==================== AUXILIARES ====================
+
+static inline uint32_t quantize(double v, double lo, double scale) {
+    double t = (v - lo) * scale;
+    if (t <= 0) return 0;
+    if (t >= QT_CELLS) return QT_CELLS - 1;
+    return (uint32_t)t;
+}
+
+static inline uint32_t quantize_x(const QuadTree *qt, double x) {
+    return quantize(x, qt->bounds.x_min, qt->scale_x);
+}
+
+static inline uint32_t quantize_y(const QuadTree *qt, double y) {
+    return quantize(y, qt->bounds.y_min, qt->scale_y);
+}
+
+static inline bool box_contains(const Box *b, double x, double y) {
+    return x >= b->x_min && x <= b->x_max && y >= b->y_min && y <= b->y_max;
+}
+
+static inline uint32_t cell_size(int level) {
+    return QT_CELLS >> level;
+}
+
+// Função para obter o quadrante (bit 0 = leste, bit 1 = norte) no nível level
+static inline int quadrant(uint32_t qx, uint32_t qy, int level) {
+    int shift = QT_BITS - 1 - level;
+    return (int)(((qx >> shift) & 1) | (((qy >> shift) & 1) << 1));
+}
+
+// Função para espalhar 16 bits nas posições pares de 32
+static inline uint32_t spread16(uint32_t x) {
+    x = (x | (x << 8)) & 0x00FF00FFu;
+    x = (x | (x << 4)) & 0x0F0F0F0Fu;
+    x = (x | (x << 2)) & 0x33333333u;
+    x = (x | (x << 1)) & 0x55555555u;
+    return x;
+}
+
+// Código de Morton: os 2 bits do nível L são exatamente quadrant(L)
+static inline uint32_t morton(uint32_t qx, uint32_t qy) {
+    return (spread16(qy) << 1) | spread16(qx);
+}
+
+// Função para converter a célula de um nó em retângulo no espaço original
+static Box node_box(const QuadTree *qt, const QuadNode *node) {
+    uint32_t size = cell_size(node->level);
+    Box b;
+    b.x_min = qt->bounds.x_min + node->x0 / qt->scale_x;
+    b.y_min = qt->bounds.y_min + node->y0 / qt->scale_y;
+    b.x_max = qt->bounds.x_min + (node->x0 + size) / qt->scale_x;
+    b.y_max = qt->bounds.y_min + (node->y0 + size) / qt->scale_y;
+    return b;
+}
+
+// ==================== CRIAÇÃO ====================
+
+// Função para reservar 4 filhos consecutivos de parent; retorna o índice do 1º
+static int alloc_children(QuadTree *qt, int parent) {
+    if (qt->nodeCount + 4 > qt->nodeCapacity) {
+        qt->nodeCapacity *= 2;
+        qt->nodes = (QuadNode *)realloc(qt->nodes, sizeof(QuadNode) * qt->nodeCapacity);
+    }
+    QuadNode *p = &qt->nodes[parent];
+    uint32_t half = cell_size(p->level + 1);
+    int first = qt->nodeCount;
+    for (int q = 0; q < 4; q++) {
+        QuadNode *c = &qt->nodes[first + q];
+        c->children = -1;
+        c->x0 = p->x0 + ((q & 1) ? half : 0);
+        c->y0 = p->y0 + ((q & 2) ? half : 0);
+        c->level = p->level + 1;
+        c->items = NULL;
+        c->count = 0;
+        c->capacity = 0;
+    }
+    qt->nodeCount += 4;
+    p->children = first;
+    return first;
+}
+
+// Função para criar uma quadtree vazia sobre a região bounds
+QuadTree* quadtree_create(Box bounds, int leafSize) {
+    QuadTree *qt = (QuadTree *)malloc(sizeof(QuadTree));
+    qt->bounds = bounds;
+    qt->scale_x = QT_CELLS / (bounds.x_max - bounds.x_min);
+    qt->scale_y = QT_CELLS / (bounds.y_max - bounds.y_min);
+    qt->leafSize = leafSize > 0 ? leafSize : DEFAULT_LEAF_SIZE;
+    qt->nodeCapacity = 64;
+    qt->nodes = (QuadNode *)malloc(sizeof(QuadNode) * qt->nodeCapacity);
+    qt->nodes[0] = (QuadNode){ .children = -1, .x0 = 0, .y0 = 0, .level = 0,
+                               .items = NULL, .count = 0, .capacity = 0 };
+    qt->nodeCount = 1;
+    qt->slab = NULL;
+    qt->size = 0;
+    return qt;
+}
+
+// Função para liberar a quadtree
+void quadtree_free(QuadTree *qt) {
+    for (int i = 0; i < qt->nodeCount; i++) {
+        if (qt->nodes[i].capacity > 0) free(qt->nodes[i].items);
+    }
+    free(qt->nodes);
+    free(qt->slab);
+    free(qt);
+}
+
+// ==================== INSERÇÃO ====================
+
+// Função para acrescentar p a uma folha (copia do bloco da carga em lote se preciso)
+static void leaf_append(QuadNode *leaf, QuadPoint p) {
+    if (leaf->count == leaf->capacity || leaf->capacity == 0) {
+        int capacity = leaf->count < 2 ? 4 : 2 * leaf->count;
+        QuadPoint *items = (QuadPoint *)malloc(sizeof(QuadPoint) * capacity);
+        if (leaf->count > 0) memcpy(items, leaf->items, sizeof(QuadPoint) * leaf->count);
+        if (leaf->capacity > 0) free(leaf->items);
+        leaf->items = items;
+        leaf->capacity = capacity;
+    }
+    leaf->items[leaf->count++] = p;
+}
+
+// Função para dividir uma folha cheia, repetindo nos filhos que continuarem cheios
+static void split_leaf(QuadTree *qt, int idx) {
+    int first = alloc_children(qt, idx);
+    QuadNode *leaf = &qt->nodes[idx];
+    for (int i = 0; i < leaf->count; i++) {
+        QuadPoint p = leaf->items[i];
+        int q = quadrant(quantize_x(qt, p.x), quantize_y(qt, p.y), leaf->level);
+        leaf_append(&qt->nodes[first + q], p);
+    }
+    if (leaf->capacity > 0) free(leaf->items);
+    leaf->items = NULL;
+    leaf->count = 0;
+    leaf->capacity = 0;
+
+    for (int q = 0; q < 4; q++) {
+        QuadNode *c = &qt->nodes[first + q];
+        if (c->count > qt->leafSize && c->level < QT_BITS) split_leaf(qt, first + q);
+    }
+}
+
+/**
+ * Insere um ponto. Retorna false se estiver fora da região da árvore
+ */
+bool quadtree_insert(QuadTree *qt, double x, double y, int id) {
+    if (!box_contains(&qt->bounds, x, y)) return false;
+    uint32_t qx = quantize_x(qt, x), qy = quantize_y(qt, y);
+
+    int idx = 0;
+    while (qt->nodes[idx].children >= 0) {
+        idx = qt->nodes[idx].children + quadrant(qx, qy, qt->nodes[idx].level);
+    }
+    QuadNode *leaf = &qt->nodes[idx];
+    leaf_append(leaf, (QuadPoint){ x, y, id });
+    qt->size++;
+    if (leaf->count > qt->leafSize && leaf->level < QT_BITS) split_leaf(qt, idx);
+    return true;
+}
+
+// ==================== CARGA EM LOTE ====================
+
+// Função para ordenar (chave, ponto) por chave: radix sort LSD de 4 passadas de 8 bits
+static void radix_sort(uint32_t *keys, QuadPoint *pts, int n) {
+    uint32_t *tmpKeys = (uint32_t *)malloc(sizeof(uint32_t) * n);
+    QuadPoint *tmpPts = (QuadPoint *)malloc(sizeof(QuadPoint) * n);
+    for (int shift = 0; shift < 32; shift += 8) {
+        int count[257] = {0};
+        for (int i = 0; i < n; i++) count[((keys[i] >> shift) & 0xFF) + 1]++;
+        for (int b = 0; b < 256; b++) count[b + 1] += count[b];
+        for (int i = 0; i < n; i++) {
+            int pos = count[(keys[i] >> shift) & 0xFF]++;
+            tmpKeys[pos] = keys[i];
+            tmpPts[pos] = pts[i];
+        }
+        memcpy(keys, tmpKeys, sizeof(uint32_t) * n);
+        memcpy(pts, tmpPts, sizeof(QuadPoint) * n);
+    }
+    free(tmpKeys);
+    free(tmpPts);
+}
+
+// Função para achar o 1º índice em [lo, hi) cujo quadrante no nível level é > q
+static int quadrant_end(const uint32_t *keys, int lo, int hi, int level, int q) {
+    int shift = 2 * (QT_BITS - 1 - level);
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if ((int)((keys[mid] >> shift) & 3) <= q) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Função para montar o nó idx sobre slab[lo..hi), já em ordem de Morton
+static void build_node(QuadTree *qt, int idx, const uint32_t *keys, int lo, int hi) {
+    QuadNode *node = &qt->nodes[idx];
+    if (hi - lo <= qt->leafSize || node->level == QT_BITS) {
+        node->items = qt->slab + lo;
+        node->count = hi - lo;
+        node->capacity = 0;
+        return;
+    }
+    int level = node->level;
+    int first = alloc_children(qt, idx);        // Pode realocar qt->nodes
+    int start = lo;
+    for (int q = 0; q < 4; q++) {
+        int end = (q == 3) ? hi : quadrant_end(keys, start, hi, level, q);
+        build_node(qt, first + q, keys, start, end);
+        start = end;
+    }
+}
+
+/**
+ * Insere n pontos de uma vez. Numa árvore vazia, monta a árvore direto dos
+ * pontos ordenados por Morton; senão, insere um a um nessa ordem (que
+ * visita as folhas em sequência). Pontos fora da região são ignorados.
+ * Retorna quantos foram inseridos
+ */
+int quadtree_bulk_insert(QuadTree *qt, const QuadPoint *points, int n) {
+    QuadPoint *pts = (QuadPoint *)malloc(sizeof(QuadPoint) * (n > 0 ? n : 1));
+    uint32_t *keys = (uint32_t *)malloc(sizeof(uint32_t) * (n > 0 ? n : 1));
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        if (!box_contains(&qt->bounds, points[i].x, points[i].y)) continue;
+        pts[m] = points[i];
+        keys[m] = morton(quantize_x(qt, points[i].x), quantize_y(qt, points[i].y));
+        m++;
+    }
+    radix_sort(keys, pts, m);
+
+    if (qt->size == 0 && qt->nodeCount == 1 && qt->slab == NULL) {
+        qt->slab = pts;
+        build_node(qt, 0, keys, 0, m);
+        qt->size = m;
+    } else {
+        for (int i = 0; i < m; i++) quadtree_insert(qt, pts[i].x, pts[i].y, pts[i].id);
+        free(pts);
+    }
+    free(keys);
+    return m;
+}
+
+// ==================== BUSCA POR RETÂNGULO ====================
+
+typedef struct {
+    const QuadTree *qt;
+    const Box *box;
+    uint32_t qx0, qx1, qy0, qy1;        // Retângulo quantizado (inclusivo)
+    int *out;
+    int cap;
+    int found;
+} BoxQuery;
+
+static inline void emit(BoxQuery *q, int id) {
+    if (q->found < q->cap) q->out[q->found] = id;
+    q->found++;
+}
+
+// Função para reportar todos os pontos de uma subárvore, sem testes
+static void report_all(BoxQuery *q, int idx) {
+    const QuadNode *node = &q->qt->nodes[idx];
+    if (node->children < 0) {
+        for (int i = 0; i < node->count; i++) emit(q, node->items[i].id);
+        return;
+    }
+    for (int c = 0; c < 4; c++) report_all(q, node->children + c);
+}
+
+static void query_node(BoxQuery *q, int idx) {
+    const QuadNode *node = &q->qt->nodes[idx];
+    uint32_t x1 = node->x0 + cell_size(node->level) - 1;
+    uint32_t y1 = node->y0 + cell_size(node->level) - 1;
+    if (node->x0 > q->qx1 || x1 < q->qx0 || node->y0 > q->qy1 || y1 < q->qy0) return;
+
+    // Estritamente dentro em inteiros => todo ponto do nó está dentro do retângulo
+    if (node->x0 > q->qx0 && x1 < q->qx1 && node->y0 > q->qy0 && y1 < q->qy1) {
+        report_all(q, idx);
+        return;
+    }
+    if (node->children < 0) {
+        for (int i = 0; i < node->count; i++) {
+            const QuadPoint *p = &node->items[i];
+            if (box_contains(q->box, p->x, p->y)) emit(q, p->id);
+        }
+        return;
+    }
+    for (int c = 0; c < 4; c++) query_node(q, node->children + c);
+}
+
+/**
+ * Busca os pontos dentro de box (bordas inclusas). Escreve até cap ids em
+ * out e retorna o total encontrado (pode ser maior que cap)
+ */
+int quadtree_query_box(const QuadTree *qt, Box box, int *out, int cap) {
+    if (box.x_min > qt->bounds.x_max || box.x_max < qt->bounds.x_min ||
+        box.y_min > qt->bounds.y_max || box.y_max < qt->bounds.y_min ||
+        box.x_min > box.x_max || box.y_min > box.y_max) {
+        return 0;
+    }
+    BoxQuery q = { qt, &box,
+                   quantize_x(qt, box.x_min), quantize_x(qt, box.x_max),
+                   quantize_y(qt, box.y_min), quantize_y(qt, box.y_max),
+                   out, cap, 0 };
+    query_node(&q, 0);
+    return q.found;
+}
+
+// ==================== CÉLULAS VIZINHAS ====================
+
+// Função para achar a folha que contém (x, y); -1 se fora da região
+int quadtree_find_leaf(const QuadTree *qt, double x, double y) {
+    if (!box_contains(&qt->bounds, x, y)) return -1;
+    uint32_t qx = quantize_x(qt, x), qy = quantize_y(qt, y);
+    int idx = 0;
+    while (qt->nodes[idx].children >= 0) {
+        idx = qt->nodes[idx].children + quadrant(qx, qy, qt->nodes[idx].level);
+    }
+    return idx;
+}
+
+static void collect_touching(const QuadTree *qt, int idx, int self,
+                             uint32_t rx0, uint32_t rx1, uint32_t ry0, uint32_t ry1,
+                             QuadLeaf *out, int cap, int *found) {
+    const QuadNode *node = &qt->nodes[idx];
+    uint32_t x1 = node->x0 + cell_size(node->level) - 1;
+    uint32_t y1 = node->y0 + cell_size(node->level) - 1;
+    if (node->x0 > rx1 || x1 < rx0 || node->y0 > ry1 || y1 < ry0) return;
+    if (node->children < 0) {
+        if (idx == self) return;
+        if (*found < cap) {
+            out[*found] = (QuadLeaf){ node_box(qt, node), node->items, node->count };
+        }
+        (*found)++;
+        return;
+    }
+    for (int c = 0; c < 4; c++) {
+        collect_touching(qt, node->children + c, self, rx0, rx1, ry0, ry1, out, cap, found);
+    }
+}
+
+/**
+ * Enumera as folhas que tocam (aresta ou canto) a folha que contém (x, y).
+ * A própria folha vai em *self se self != NULL. Escreve até cap folhas em
+ * out e retorna o total (-1 se o ponto está fora da região)
+ */
+int quadtree_neighbor_leaves(const QuadTree *qt, double x, double y,
+                             QuadLeaf *self, QuadLeaf *out, int cap) {
+    int leaf = quadtree_find_leaf(qt, x, y);
+    if (leaf < 0) return -1;
+    const QuadNode *node = &qt->nodes[leaf];
+    if (self) *self = (QuadLeaf){ node_box(qt, node), node->items, node->count };
+
+    // Célula da folha expandida em 1 unidade quantizada para cada lado
+    uint32_t size = cell_size(node->level);
+    uint32_t rx0 = node->x0 > 0 ? node->x0 - 1 : 0;
+    uint32_t ry0 = node->y0 > 0 ? node->y0 - 1 : 0;
+    uint32_t rx1 = node->x0 + size < QT_CELLS ? node->x0 + size : QT_CELLS - 1;
+    uint32_t ry1 = node->y0 + size < QT_CELLS ? node->y0 + size : QT_CELLS - 1;
+    int found = 0;
+    collect_touching(qt, 0, leaf, rx0, rx1, ry0, ry1, out, cap, &found);
+    return found;
+}
+
+// ==================== K-D TREE DE REFERÊNCIA ====================
+
+// Mesmo algoritmo de 19-kd-tree/kd_tree.c (nó por ponto, qsort a cada
+// nível), com id no ponto e busca por retângulo
+typedef struct KDNode {
+    QuadPoint point;
+    struct KDNode *left, *right;
+} KDNode;
+
+static int compareX(const void *a, const void *b) {
+    double d = ((const QuadPoint *)a)->x - ((const QuadPoint *)b)->x;
+    return (d > 0) - (d < 0);
+}
+
+static int compareY(const void *a, const void *b) {
+    double d = ((const QuadPoint *)a)->y - ((const QuadPoint *)b)->y;
+    return (d > 0) - (d < 0);
+}
+
+static KDNode* buildKDTree(QuadPoint points[], int n, int depth) {
+    if (n <= 0) return NULL;
+    qsort(points, n, sizeof(QuadPoint), depth % 2 == 0 ? compareX : compareY);
+    int median = n / 2;
+    KDNode *node = (KDNode *)malloc(sizeof(KDNode));
+    node->point = points[median];
+    node->left = buildKDTree(points, median, depth + 1);
+    node->right = buildKDTree(points + median + 1, n - median - 1, depth + 1);
+    return node;
+}
+
+static void kdRangeSearch(const KDNode *node, const Box *box, int depth, int *out, int cap, int *found) {
+    if (!node) return;
+    const QuadPoint *p = &node->point;
+    if (box_contains(box, p->x, p->y)) {
+        if (*found < cap) out[*found] = p->id;
+        (*found)++;
+    }
+    double v = depth % 2 == 0 ? p->x : p->y;
+    double lo = depth % 2 == 0 ? box->x_min : box->y_min;
+    double hi = depth % 2 == 0 ? box->x_max : box->y_max;
+    if (lo <= v) kdRangeSearch(node->left, box, depth + 1, out, cap, found);
+    if (hi >= v) kdRangeSearch(node->right, box, depth + 1, out, cap, found);
+}
+
+static void freeKDTree(KDNode *node) {
+    if (!node) return;
+    freeKDTree(node->left);
+    freeKDTree(node->right);
+    free(node);
+}
+
+// ==================== TESTES ====================
+
+static uint64_t rng_state = 88172645463325252ULL;
+
+static double next_uniform(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (rng_state >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Função para gerar pontos: uniformes no quadrado unitário ou em aglomerados
+static void generate_points(QuadPoint *pts, int n, bool clustered) {
+    double cx = 0.5, cy = 0.5;
+    for (int i = 0; i < n; i++) {
+        if (!clustered) {
+            pts[i] = (QuadPoint){ next_uniform(), next_uniform(), i };
+            continue;
+        }
+        if (i % 1000 == 0) {
+            cx = 0.05 + 0.9 * next_uniform();
+            cy = 0.05 + 0.9 * next_uniform();
+        }
+        // Soma de 4 uniformes ~ normal estreita em torno do centro
+        double dx = (next_uniform() + next_uniform() + next_uniform() + next_uniform() - 2) * 0.01;
+        double dy = (next_uniform() + next_uniform() + next_uniform() + next_uniform() - 2) * 0.01;
+        pts[i] = (QuadPoint){ cx + dx, cy + dy, i };
+    }
+}
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// Função para comparar a busca da árvore com força bruta em 'queries' retângulos
+static bool check_queries(const QuadTree *qt, const QuadPoint *pts, int n, int queries) {
+    int *got = (int *)malloc(sizeof(int) * n);
+    int *expected = (int *)malloc(sizeof(int) * n);
+    bool ok = true;
+    for (int t = 0; t < queries && ok; t++) {
+        double w = next_uniform() * 0.3, h = next_uniform() * 0.3;
+        double x = next_uniform() * 1.2 - 0.1, y = next_uniform() * 1.2 - 0.1;
+        Box box = { x, y, x + w, y + h };
+        if (t % 10 == 0) box = (Box){ pts[t].x, pts[t].y, pts[t].x, pts[t].y };    // Degenerado
+        int m = 0;
+        for (int i = 0; i < n; i++) {
+            if (box_contains(&box, pts[i].x, pts[i].y)) expected[m++] = pts[i].id;
+        }
+        int found = quadtree_query_box(qt, box, got, n);
+        qsort(got, found < n ? found : n, sizeof(int), compare_int);
+        qsort(expected, m, sizeof(int), compare_int);
+        ok = found == m && memcmp(got, expected, sizeof(int) * m) == 0;
+    }
+    free(got);
+    free(expected);
+    return ok;
+}
+
+void testar_exemplo(void) {
+    printf("=== TESTE: EXEMPLO PEQUENO ===\n\n");
+
+    QuadTree *qt = quadtree_create((Box){ -10, -10, 10, 10 }, 2);
+    double coords[][2] = { {1, 1}, {-2, -3}, {3, 4}, {8, -1}, {2, 2}, {1.5, 1.5}, {-9, 9} };
+    for (int i = 0; i < 7; i++) quadtree_insert(qt, coords[i][0], coords[i][1], i);
+    bool ok = !quadtree_insert(qt, 11, 0, 99);             // Fora da região
+
+    int out[8];
+    int found = quadtree_query_box(qt, (Box){ 0, 0, 3, 3 }, out, 8);
+    qsort(out, found, sizeof(int), compare_int);
+    printf("Pontos em [0,3]x[0,3]:");
+    for (int i = 0; i < found; i++) printf(" %d(%.1f, %.1f)", out[i], coords[out[i]][0], coords[out[i]][1]);
+    printf("\n");
+    ok = ok && found == 3 && out[0] == 0 && out[1] == 4 && out[2] == 5;
+
+    QuadLeaf self, near[16];
+    int count = quadtree_neighbor_leaves(qt, 1, 1, &self, near, 16);
+    printf("Folha de (1, 1): [%.2f, %.2f] x [%.2f, %.2f], %d pontos; %d folhas vizinhas\n",
+           self.box.x_min, self.box.x_max, self.box.y_min, self.box.y_max, self.count, count);
+    printf("%d nós, %d pontos\n", qt->nodeCount, qt->size);
+    quadtree_free(qt);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+void testar_busca(void) {
+    printf("=== TESTE: BUSCA POR RETÂNGULO X FORÇA BRUTA ===\n\n");
+
+    const int n = 20000;
+    QuadPoint *pts = (QuadPoint *)malloc(sizeof(QuadPoint) * n);
+    bool ok = true;
+    for (int clustered = 0; clustered < 2; clustered++) {
+        generate_points(pts, n, clustered);
+        for (int i = 0; i + 1 < n; i += 97) {                       // Duplicatas
+            pts[i + 1].x = pts[i].x;
+            pts[i + 1].y = pts[i].y;
+        }
+
+        QuadTree *bulk = quadtree_create((Box){ 0, 0, 1, 1 }, 8);
+        quadtree_bulk_insert(bulk, pts, n / 2);
+        for (int i = n / 2; i < n; i++) quadtree_insert(bulk, pts[i].x, pts[i].y, pts[i].id);
+
+        QuadTree *dynamic = quadtree_create((Box){ 0, 0, 1, 1 }, 8);
+        for (int i = 0; i < n; i++) quadtree_insert(dynamic, pts[i].x, pts[i].y, pts[i].id);
+
+        bool okBulk = bulk->size == n && check_queries(bulk, pts, n, 300);
+        bool okDyn = dynamic->size == n && check_queries(dynamic, pts, n, 300);
+        printf("%-11s lote+inserção: %s (%d nós)   só inserção: %s (%d nós)\n",
+               clustered ? "aglomerado" : "uniforme", okBulk ? "ok" : "ERRO", bulk->nodeCount,
+               okDyn ? "ok" : "ERRO", dynamic->nodeCount);
+        ok = ok && okBulk && okDyn;
+        quadtree_free(bulk);
+        quadtree_free(dynamic);
+    }
+    free(pts);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// Função para coletar todas as folhas (força bruta para o teste de vizinhos)
+static void all_leaves(const QuadTree *qt, int idx, int *out, int *count) {
+    if (qt->nodes[idx].children < 0) {
+        out[(*count)++] = idx;
+        return;
+    }
+    for (int c = 0; c < 4; c++) all_leaves(qt, qt->nodes[idx].children + c, out, count);
+}
+
+void testar_vizinhos(void) {
+    printf("=== TESTE: CÉLULAS VIZINHAS ===\n\n");
+
+    const int n = 5000;
+    QuadPoint *pts = (QuadPoint *)malloc(sizeof(QuadPoint) * n);
+    generate_points(pts, n, true);
+    QuadTree *qt = quadtree_create((Box){ 0, 0, 1, 1 }, 4);
+    quadtree_bulk_insert(qt, pts, n);
+
+    int *leaves = (int *)malloc(sizeof(int) * qt->nodeCount);
+    int leafCount = 0;
+    all_leaves(qt, 0, leaves, &leafCount);
+    QuadLeaf *near = (QuadLeaf *)malloc(sizeof(QuadLeaf) * leafCount);
+
+    bool ok = true;
+    long long total = 0;
+    for (int t = 0; t < 500 && ok; t++) {
+        double x = next_uniform(), y = next_uniform();
+        QuadLeaf self;
+        int count = quadtree_neighbor_leaves(qt, x, y, &self, near, leafCount);
+        total += count;
+        ok = box_contains(&self.box, x, y);
+
+        // Força bruta: folhas cujo retângulo fechado encosta no da folha de (x, y)
+        int expected = 0;
+        for (int i = 0; i < leafCount; i++) {
+            Box b = node_box(qt, &qt->nodes[leaves[i]]);
+            bool touch = b.x_min <= self.box.x_max && b.x_max >= self.box.x_min &&
+                         b.y_min <= self.box.y_max && b.y_max >= self.box.y_min;
+            bool same = b.x_min == self.box.x_min && b.y_min == self.box.y_min &&
+                        b.x_max == self.box.x_max && b.y_max == self.box.y_max;
+            if (touch && !same) expected++;
+        }
+        ok = ok && count == expected;
+    }
+    printf("%d folhas; 500 pontos: %.1f vizinhas por folha, iguais à força bruta\n",
+           leafCount, total / 500.0);
+
+    free(near);
+    free(leaves);
+    quadtree_free(qt);
+    free(pts);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// ==================== BENCHMARK ====================
+
+void benchmark(int n, int queries, bool clustered) {
+    printf("=== BENCHMARK: %d pontos %s, %d buscas por tamanho ===\n\n",
+           n, clustered ? "aglomerados" : "uniformes", queries);
+
+    QuadPoint *pts = (QuadPoint *)malloc(sizeof(QuadPoint) * n);
+    QuadPoint *work = (QuadPoint *)malloc(sizeof(QuadPoint) * n);
+    generate_points(pts, n, clustered);
+
+    // Quadrados centrados em pontos: ~10 e ~1000 pontos em média se uniformes
+    const int sizes = 2;
+    const double expectedHits[2] = { 10, 1000 };
+    Box *boxes = (Box *)malloc(sizeof(Box) * queries * sizes);
+    for (int s = 0; s < sizes; s++) {
+        double a = sqrt(expectedHits[s] / n);
+        for (int t = 0; t < queries; t++) {
+            const QuadPoint *c = &pts[(int)(next_uniform() * n)];
+            boxes[s * queries + t] = (Box){ c->x - a / 2, c->y - a / 2, c->x + a / 2, c->y + a / 2 };
+        }
+    }
+
+    int *out = (int *)malloc(sizeof(int) * n);
+    long long sums[3][2] = {{0}};
+    double buildTime[3], queryTime[3][2];
+    clock_t start;
+
+    // k-d tree de referência
+    memcpy(work, pts, sizeof(QuadPoint) * n);
+    start = clock();
+    KDNode *kd = buildKDTree(work, n, 0);
+    buildTime[0] = (double)(clock() - start) / CLOCKS_PER_SEC;
+    for (int s = 0; s < sizes; s++) {
+        start = clock();
+        for (int t = 0; t < queries; t++) {
+            int found = 0;
+            kdRangeSearch(kd, &boxes[s * queries + t], 0, out, n, &found);
+            sums[0][s] += found;
+        }
+        queryTime[0][s] = (double)(clock() - start) / CLOCKS_PER_SEC;
+    }
+    freeKDTree(kd);
+
+    // Quadtree: carga em lote (1) e inserção um a um (2)
+    for (int v = 1; v <= 2; v++) {
+        start = clock();
+        QuadTree *qt = quadtree_create((Box){ 0, 0, 1, 1 }, DEFAULT_LEAF_SIZE);
+        if (v == 1) {
+            quadtree_bulk_insert(qt, pts, n);
+        } else {
+            for (int i = 0; i < n; i++) quadtree_insert(qt, pts[i].x, pts[i].y, pts[i].id);
+        }
+        buildTime[v] = (double)(clock() - start) / CLOCKS_PER_SEC;
+        for (int s = 0; s < sizes; s++) {
+            start = clock();
+            for (int t = 0; t < queries; t++) {
+                sums[v][s] += quadtree_query_box(qt, boxes[s * queries + t], out, n);
+            }
+            queryTime[v][s] = (double)(clock() - start) / CLOCKS_PER_SEC;
+        }
+        quadtree_free(qt);
+    }
+
+    static const char *names[3] = { "k-d tree (kd_tree.c)", "quadtree, carga em lote", "quadtree, inserção" };
+    printf("%-26s %10s %16s %16s\n", "Estrutura", "build (s)", "pequena (µs)", "grande (µs)");
+    for (int v = 0; v < 3; v++) {
+        printf("%-26s %10.3f %16.2f %16.2f\n", names[v], buildTime[v],
+               1e6 * queryTime[v][0] / queries, 1e6 * queryTime[v][1] / queries);
+    }
+    printf("Média de pontos por busca: %.1f e %.1f (resultados %s)\n\n",
+           (double)sums[0][0] / queries, (double)sums[0][1] / queries,
+           sums[0][0] == sums[1][0] && sums[0][0] == sums[2][0] &&
+           sums[0][1] == sums[1][1] && sums[0][1] == sums[2][1] ? "iguais" : "DIFERENTES");
+
+    free(out);
+    free(boxes);
+    free(work);
+    free(pts);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║             QUADTREE DE REGIÃO                           ║\n");
+    printf("║   Carga em lote, busca por retângulo e células vizinhas  ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int queries = (argc > 2) ? atoi(argv[2]) : 100000;
+    if (n < 1000) n = 1000;
+    if (queries < 1) queries = 1;
+
+    testar_exemplo();
+    testar_busca();
+    testar_vizinhos();
+    benchmark(n, queries, false);
+    benchmark(n, queries, true);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da Quadtree de região:\n");
+    printf("- Cortes fixos (metade da célula): quadrante = 1 bit de x e de y\n");
+    printf("- Carga em lote: ordenação de Morton, filhos = fatias contíguas\n");
+    printf("- Busca: poda em inteiros, nós inteiros dentro sem teste\n");
+    printf("- Profundidade máxima %d; a k-d tree se adapta melhor a dados\n", QT_BITS);
+    printf("  muito concentrados, a quadtree insere sem rebalancear\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
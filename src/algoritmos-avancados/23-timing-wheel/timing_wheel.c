@@ -0,0 +1,657 @@
+/**
+ * ============================================================================
+ * HIERARCHICAL TIMING WHEEL - TEMPORIZADORES COM ADD/CANCEL O(1)
+ * ============================================================================
+ *
+ * Varghese & Lauck (1987): em vez de manter os temporizadores ordenados
+ * (heap: O(log n) por inserção), o tempo é dividido em ticks e cada
+ * temporizador vai para o balde (slot) do seu tick de expiração. Para
+ * cobrir prazos longos com poucos slots, há vários níveis: o nível l tem
+ * 2^b slots de 2^(b*l) ticks cada.
+ *
+ * NÍVEL E SLOT (b = slot_bits):
+ * - O nível é o grupo de b bits mais alto em que o prazo e o tick atual
+ *   diferem; o slot é o valor desse grupo no prazo:
+ *
+ *       nível = (bit mais alto de (prazo XOR agora)) / b
+ *       slot  = (prazo >> (b * nível)) & (2^b - 1)
+ *
+ * - Prazos além do último nível ficam no último nível e são reavaliados
+ *   a cada volta dele
+ *
+ * CASCATA:
+ * - Quando os b*l bits baixos do tick atual zeram, o slot corrente do
+ *   nível l é redistribuído para os níveis de baixo. Cada temporizador
+ *   desce no máximo (níveis - 1) vezes: O(1) amortizado
+ *
+ * CANCELAMENTO O(1):
+ * - Cada slot é um vetor de índices de nós, e o nó guarda sua posição
+ *   nele: cancelar é trocar com o último do vetor. Percorrer um slot
+ *   (cascata, disparo) é sequencial e permite prefetch dos nós, o que uma
+ *   lista encadeada não permite
+ * - O TimerId leva uma geração: cancelar um temporizador já disparado ou
+ *   cancelado é detectado
+ *
+ * DISPARO EM LOTE:
+ * - Os temporizadores que vencem num tick são entregues a uma callback em
+ *   lotes de até TIMER_BATCH, e não um a um
+ *
+ * Compilação: gcc -O2 -std=c11 timing_wheel.c -o timing_wheel
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define TIMER_BATCH 256
+#define MAX_LEVELS 8
+
+// (geração << 32) | índice do nó; 0 nunca é um id válido
+typedef uint64_t TimerId;
+
+// Temporizador vencido, entregue à callback
+typedef struct {
+    TimerId id;
+    void *arg;
+    uint64_t deadline;                  // Tick de expiração
+} TimerExpired;
+
+typedef struct TimingWheel TimingWheel;
+
+typedef void (*TimerBatchCallback)(TimingWheel *tw, const TimerExpired *batch, int count, void *context);
+
+typedef struct {
+    uint64_t deadline;
+    void *arg;
+    int slot;                           // Slot global (nível * slots + s); -1 = livre
+    int pos;                            // Posição no vetor do slot; livre: próximo livre
+    uint32_t generation;
+} TimerNode;
+
+// Vetor de índices de nós; a ordem dentro do slot não importa
+typedef struct {
+    int *items;
+    int count, capacity;
+} TimerSlot;
+
+struct TimingWheel {
+    uint64_t tick_ns;                   // Resolução
+    uint64_t start_ns;
+    uint64_t now;                       // Último tick processado
+    int levels;
+    int slot_bits;
+    int slots;                          // 2^slot_bits por nível
+    TimerSlot *wheel;                   // levels * slots
+    TimerSlot spare;                    // Troca com o slot sendo esvaziado
+    TimerNode *nodes;
+    int node_count, node_capacity;
+    int free_list;
+    int size;                           // Temporizadores ativos
+    TimerExpired *expired;              // Vencidos do tick, antes das callbacks
+    int expired_capacity;
+};
+
+// ==================== CRIAÇÃO ====================
+
+/**
+ * Cria uma roda com resolução tick_ns, 'levels' níveis de 2^slot_bits
+ * slots. Alcance sem reavaliação: 2^(levels * slot_bits) ticks
+ */
+TimingWheel* timing_wheel_create(uint64_t tick_ns, int levels, int slot_bits, uint64_t start_ns) {
+    if (levels < 1) levels = 1;
+    if (levels > MAX_LEVELS) levels = MAX_LEVELS;
+    if (slot_bits < 1) slot_bits = 1;
+    if (slot_bits > 16) slot_bits = 16;
+    if (slot_bits * levels > 62) slot_bits = 62 / levels;
+
+    TimingWheel *tw = (TimingWheel *)malloc(sizeof(TimingWheel));
+    tw->tick_ns = tick_ns > 0 ? tick_ns : 1;
+    tw->start_ns = start_ns;
+    tw->now = 0;
+    tw->levels = levels;
+    tw->slot_bits = slot_bits;
+    tw->slots = 1 << slot_bits;
+    tw->wheel = (TimerSlot *)calloc((size_t)levels * tw->slots, sizeof(TimerSlot));
+    tw->spare = (TimerSlot){ NULL, 0, 0 };
+    tw->node_capacity = 1024;
+    tw->nodes = (TimerNode *)malloc(sizeof(TimerNode) * tw->node_capacity);
+    tw->node_count = 0;
+    tw->free_list = -1;
+    tw->size = 0;
+    tw->expired_capacity = TIMER_BATCH;
+    tw->expired = (TimerExpired *)malloc(sizeof(TimerExpired) * tw->expired_capacity);
+    return tw;
+}
+
+void timing_wheel_free(TimingWheel *tw) {
+    for (int i = 0; i < tw->levels * tw->slots; i++) free(tw->wheel[i].items);
+    free(tw->wheel);
+    free(tw->spare.items);
+    free(tw->nodes);
+    free(tw->expired);
+    free(tw);
+}
+
+// ==================== VETORES DOS SLOTS ====================
+
+static inline void slot_push(TimingWheel *tw, int idx, int slot) {
+    TimerSlot *s = &tw->wheel[slot];
+    if (s->count == s->capacity) {
+        s->capacity = s->capacity ? s->capacity * 2 : 16;
+        s->items = (int *)realloc(s->items, sizeof(int) * s->capacity);
+    }
+    tw->nodes[idx].slot = slot;
+    tw->nodes[idx].pos = s->count;
+    s->items[s->count++] = idx;
+}
+
+// Função para remover em O(1): o último do vetor ocupa o lugar do removido
+static inline void slot_remove(TimingWheel *tw, int idx) {
+    TimerNode *t = &tw->nodes[idx];
+    TimerSlot *s = &tw->wheel[t->slot];
+    int last = s->items[--s->count];
+    s->items[t->pos] = last;
+    tw->nodes[last].pos = t->pos;
+}
+
+// Função para esvaziar um slot: ele recebe o vetor reserva (vazio) e o
+// conteúdo antigo é devolvido para ser percorrido
+static inline TimerSlot slot_take(TimingWheel *tw, int slot) {
+    TimerSlot taken = tw->wheel[slot];
+    tw->wheel[slot] = tw->spare;
+    return taken;
+}
+
+static inline void slot_recycle(TimingWheel *tw, TimerSlot taken) {
+    taken.count = 0;
+    tw->spare = taken;
+}
+
+// Função para colocar um nó no slot do seu prazo, relativo a tw->now
+static inline void wheel_place(TimingWheel *tw, int idx) {
+    uint64_t deadline = tw->nodes[idx].deadline;
+    uint64_t diff = deadline ^ tw->now;
+    int level = diff ? (63 - __builtin_clzll(diff)) / tw->slot_bits : 0;
+    if (level >= tw->levels) level = tw->levels - 1;
+    int s = (int)((deadline >> (tw->slot_bits * level)) & (uint64_t)(tw->slots - 1));
+    slot_push(tw, idx, level * tw->slots + s);
+}
+
+static inline TimerId make_id(const TimingWheel *tw, int idx) {
+    return ((uint64_t)tw->nodes[idx].generation << 32) | (uint32_t)idx;
+}
+
+// ==================== ADICIONAR E CANCELAR ====================
+
+/**
+ * Agenda um temporizador para daqui a delay_ns (arredondado para cima
+ * em ticks, no mínimo 1: nunca dispara antes do prazo). O(1)
+ */
+TimerId timer_add(TimingWheel *tw, uint64_t delay_ns, void *arg) {
+    int idx;
+    if (tw->free_list >= 0) {
+        idx = tw->free_list;
+        tw->free_list = tw->nodes[idx].pos;
+    } else {
+        if (tw->node_count == tw->node_capacity) {
+            tw->node_capacity *= 2;
+            tw->nodes = (TimerNode *)realloc(tw->nodes, sizeof(TimerNode) * tw->node_capacity);
+        }
+        idx = tw->node_count++;
+        tw->nodes[idx].generation = 1;
+    }
+    uint64_t ticks = (delay_ns + tw->tick_ns - 1) / tw->tick_ns;
+    TimerNode *t = &tw->nodes[idx];
+    t->deadline = tw->now + (ticks > 0 ? ticks : 1);
+    t->arg = arg;
+    wheel_place(tw, idx);
+    tw->size++;
+    return make_id(tw, idx);
+}
+
+// Função para devolver um nó à lista livre (a geração invalida o id antigo)
+static inline void node_release(TimingWheel *tw, int idx) {
+    TimerNode *t = &tw->nodes[idx];
+    t->slot = -1;
+    t->generation++;
+    if (t->generation == 0) t->generation = 1;
+    t->pos = tw->free_list;
+    tw->free_list = idx;
+    tw->size--;
+}
+
+/**
+ * Cancela um temporizador em O(1). Retorna false se ele já disparou,
+ * já foi cancelado ou o id é inválido
+ */
+bool timer_cancel(TimingWheel *tw, TimerId id) {
+    uint32_t idx = (uint32_t)id;
+    if (idx >= (uint32_t)tw->node_count) return false;
+    TimerNode *t = &tw->nodes[idx];
+    if (t->slot < 0 || t->generation != (uint32_t)(id >> 32)) return false;
+    slot_remove(tw, (int)idx);
+    node_release(tw, (int)idx);
+    return true;
+}
+
+// ==================== AVANÇO DO TEMPO ====================
+
+// Distância do prefetch ao percorrer um slot: os nós estão espalhados
+#define PREFETCH_AHEAD 8
+
+// Função para redistribuir o slot corrente do nível level (cascata)
+static void cascade(TimingWheel *tw, int level) {
+    int slot = level * tw->slots + (int)((tw->now >> (tw->slot_bits * level)) & (uint64_t)(tw->slots - 1));
+    if (tw->wheel[slot].count == 0) return;
+    TimerSlot taken = slot_take(tw, slot);
+    for (int i = 0; i < taken.count; i++) {
+        if (i + PREFETCH_AHEAD < taken.count) {
+            __builtin_prefetch(&tw->nodes[taken.items[i + PREFETCH_AHEAD]], 1);
+        }
+        wheel_place(tw, taken.items[i]);
+    }
+    slot_recycle(tw, taken);
+}
+
+/**
+ * Função para disparar o slot corrente do nível 0. Todos os vencidos do
+ * tick são liberados antes da primeira callback (cancelar um deles dentro
+ * dela retorna false) e entregues em lotes de até TIMER_BATCH
+ */
+static void fire_current(TimingWheel *tw, TimerBatchCallback callback, void *context) {
+    int slot = (int)(tw->now & (uint64_t)(tw->slots - 1));
+    if (tw->wheel[slot].count == 0) return;
+    TimerSlot taken = slot_take(tw, slot);
+
+    if (taken.count > tw->expired_capacity) {
+        while (tw->expired_capacity < taken.count) tw->expired_capacity *= 2;
+        tw->expired = (TimerExpired *)realloc(tw->expired, sizeof(TimerExpired) * tw->expired_capacity);
+    }
+    int count = 0;
+    for (int i = 0; i < taken.count; i++) {
+        if (i + PREFETCH_AHEAD < taken.count) {
+            __builtin_prefetch(&tw->nodes[taken.items[i + PREFETCH_AHEAD]], 1);
+        }
+        int idx = taken.items[i];
+        TimerNode *t = &tw->nodes[idx];
+        if (t->deadline > tw->now) {
+            wheel_place(tw, idx);               // Só com 1 nível: prazo além de uma volta
+            continue;
+        }
+        tw->expired[count].id = make_id(tw, idx);
+        tw->expired[count].arg = t->arg;
+        tw->expired[count].deadline = t->deadline;
+        count++;
+        node_release(tw, idx);
+    }
+    slot_recycle(tw, taken);
+
+    for (int i = 0; i < count; i += TIMER_BATCH) {
+        callback(tw, tw->expired + i, count - i < TIMER_BATCH ? count - i : TIMER_BATCH, context);
+    }
+}
+
+/**
+ * Avança a roda até o instante now_ns, disparando tudo o que venceu.
+ * A callback pode agendar e cancelar temporizadores, mas não deve chamar
+ * timing_wheel_advance. Retorna quantos ticks foram processados
+ */
+uint64_t timing_wheel_advance(TimingWheel *tw, uint64_t now_ns, TimerBatchCallback callback, void *context) {
+    if (now_ns < tw->start_ns) return 0;
+    uint64_t target = (now_ns - tw->start_ns) / tw->tick_ns;
+    uint64_t processed = 0;
+    uint64_t low_mask = (uint64_t)(tw->slots - 1);
+
+    while (tw->now < target) {
+        if (tw->size == 0) {                    // Nada agendado: pula direto
+            processed += target - tw->now;
+            tw->now = target;
+            break;
+        }
+        tw->now++;
+        processed++;
+
+        // Cascata nos níveis cujos bits de baixo zeraram, do mais alto ao 1
+        if (tw->levels > 1 && (tw->now & low_mask) == 0) {
+            int top = 1;
+            while (top + 1 < tw->levels &&
+                   (tw->now & ((1ULL << (tw->slot_bits * (top + 1))) - 1)) == 0) {
+                top++;
+            }
+            for (int level = top; level >= 1; level--) cascade(tw, level);
+        }
+        fire_current(tw, callback, context);
+    }
+    return processed;
+}
+
+// ==================== HEAP BINÁRIO DE REFERÊNCIA ====================
+
+// Mesmo algoritmo de 09-heap/heap_binario.c (heapify_up/heapify_down com
+// trocas), com par (prazo, id) e capacidade dobrando. Cancelar só marca o
+// id; a entrada sai do heap quando chega ao topo (cancelamento preguiçoso)
+typedef struct {
+    uint64_t deadline;
+    int id;
+} HeapTimer;
+
+typedef struct {
+    HeapTimer *data;
+    int size;
+    int capacity;
+} MinHeap;
+
+static void heap_swap(HeapTimer *a, HeapTimer *b) {
+    HeapTimer temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static void heapify_up(MinHeap *heap, int i) {
+    while (i != 0 && heap->data[(i - 1) / 2].deadline > heap->data[i].deadline) {
+        heap_swap(&heap->data[i], &heap->data[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+}
+
+static void heapify_down(MinHeap *heap, int i) {
+    int smallest = i;
+    int left = 2 * i + 1;
+    int right = 2 * i + 2;
+    if (left < heap->size && heap->data[left].deadline < heap->data[smallest].deadline) smallest = left;
+    if (right < heap->size && heap->data[right].deadline < heap->data[smallest].deadline) smallest = right;
+    if (smallest != i) {
+        heap_swap(&heap->data[i], &heap->data[smallest]);
+        heapify_down(heap, smallest);
+    }
+}
+
+static void heap_insert(MinHeap *heap, HeapTimer t) {
+    if (heap->size == heap->capacity) {
+        heap->capacity *= 2;
+        heap->data = (HeapTimer *)realloc(heap->data, sizeof(HeapTimer) * heap->capacity);
+    }
+    heap->data[heap->size] = t;
+    heapify_up(heap, heap->size);
+    heap->size++;
+}
+
+static HeapTimer heap_extract_min(MinHeap *heap) {
+    HeapTimer root = heap->data[0];
+    heap->data[0] = heap->data[heap->size - 1];
+    heap->size--;
+    heapify_down(heap, 0);
+    return root;
+}
+
+// ==================== TESTES ====================
+
+static uint64_t rng_state = 88172645463325252ULL;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+typedef struct {
+    uint64_t *fired_at;                 // Tick em que cada temporizador disparou
+    int fired;
+    int batches;
+    int rearm;                          // Temporizadores ainda a reagendar na callback
+    TimerId *ids;
+    int next_id;
+} TestState;
+
+static void record_batch(TimingWheel *tw, const TimerExpired *batch, int count, void *context) {
+    TestState *st = (TestState *)context;
+    st->batches++;
+    for (int i = 0; i < count; i++) {
+        int k = (int)(intptr_t)batch[i].arg;
+        st->fired_at[k] = tw->now;
+        st->fired++;
+        // Reagendar de dentro da callback
+        if (st->rearm > 0) {
+            st->rearm--;
+            int j = st->next_id++;
+            st->ids[j] = timer_add(tw, (1 + next_random() % 300) * tw->tick_ns, (void *)(intptr_t)j);
+        }
+    }
+}
+
+// Função para conferir disparos contra os prazos esperados
+static bool run_random_test(int levels, int slot_bits, int n, uint64_t max_delay) {
+    const uint64_t tick = 1000;
+    TimingWheel *tw = timing_wheel_create(tick, levels, slot_bits, 0);
+    int total = n + n / 4;
+    TestState st = { (uint64_t *)malloc(sizeof(uint64_t) * total), 0, 0, n / 4,
+                     (TimerId *)malloc(sizeof(TimerId) * total), n };
+    uint64_t *deadline = (uint64_t *)malloc(sizeof(uint64_t) * total);
+    bool *cancelled = (bool *)calloc(total, sizeof(bool));
+    for (int i = 0; i < total; i++) st.fired_at[i] = UINT64_MAX;
+
+    for (int i = 0; i < n; i++) {
+        uint64_t delay = (1 + next_random() % max_delay) * tick - next_random() % tick;
+        st.ids[i] = timer_add(tw, delay, (void *)(intptr_t)i);
+        deadline[i] = (delay + tick - 1) / tick;
+    }
+    bool ok = tw->size == n;
+    // Cancela ~60%, com alguns cancelamentos repetidos (devem falhar)
+    for (int i = 0; i < n; i++) {
+        if (next_random() % 10 < 6) {
+            ok = ok && timer_cancel(tw, st.ids[i]);
+            ok = ok && !timer_cancel(tw, st.ids[i]);
+            cancelled[i] = true;
+        }
+    }
+
+    // Avança em passos irregulares até tudo disparar
+    uint64_t now_ns = 0;
+    while (tw->size > 0) {
+        now_ns += (1 + next_random() % 50) * tick + next_random() % tick;
+        timing_wheel_advance(tw, now_ns, record_batch, &st);
+    }
+
+    for (int i = 0; i < n && ok; i++) {
+        ok = cancelled[i] ? st.fired_at[i] == UINT64_MAX : st.fired_at[i] == deadline[i];
+    }
+    for (int j = n; j < st.next_id && ok; j++) ok = st.fired_at[j] != UINT64_MAX;
+    ok = ok && !timer_cancel(tw, st.ids[0]) && !timer_cancel(tw, 0);
+
+    printf("%d níveis x %3d slots, prazos até %5llu ticks: %d disparos em %d lotes, %s\n",
+           levels, 1 << slot_bits, (unsigned long long)max_delay, st.fired, st.batches,
+           ok ? "todos no tick exato" : "ERRO");
+    free(st.fired_at);
+    free(st.ids);
+    free(deadline);
+    free(cancelled);
+    timing_wheel_free(tw);
+    return ok;
+}
+
+void testar_roda(void) {
+    printf("=== TESTE: DISPAROS NO TICK EXATO ===\n\n");
+
+    bool ok = true;
+    ok = run_random_test(4, 8, 20000, 60000) && ok;    // Configuração padrão
+    ok = run_random_test(2, 4, 20000, 2000) && ok;     // Alcance 256 < prazos: reavaliação no topo
+    ok = run_random_test(1, 6, 5000, 500) && ok;       // Um nível só (roda simples)
+    ok = run_random_test(3, 2, 5000, 300) && ok;       // Slots mínimos: muita cascata
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// ==================== BENCHMARK ====================
+
+// Estado da simulação: conexões com timeout que é reiniciado (cancelar +
+// agendar de novo) a cada atividade
+typedef struct {
+    uint64_t *handle;                   // TimerId da roda ou id no heap
+    bool *fired;
+    long long fired_count;
+    uint64_t checksum;
+} Simulation;
+
+static void sim_batch(TimingWheel *tw, const TimerExpired *batch, int count, void *context) {
+    Simulation *sim = (Simulation *)context;
+    for (int i = 0; i < count; i++) {
+        int conn = (int)(intptr_t)batch[i].arg;
+        sim->fired[conn] = true;
+        sim->fired_count++;
+        sim->checksum += (uint64_t)conn * 2654435761u + tw->now;
+    }
+}
+
+typedef struct {
+    double add, run;
+    long long fired, cancels;
+    uint64_t checksum;
+} SimResult;
+
+#define SIM_TICKS 60000                 // 60 s com ticks de 1 ms
+#define TICK_NS 1000000ULL
+
+/**
+ * n temporizadores com prazo de 1..60000 ms; em cada um dos 60000 ticks,
+ * 'resets' conexões aleatórias reiniciam o timeout (cancel + add)
+ */
+static SimResult simulate_wheel(int n, int resets, uint64_t seed) {
+    SimResult r = { 0, 0, 0, 0, 0 };
+    Simulation sim = { (uint64_t *)malloc(sizeof(uint64_t) * n), (bool *)calloc(n, sizeof(bool)), 0, 0 };
+    rng_state = seed;
+
+    clock_t start = clock();
+    TimingWheel *tw = timing_wheel_create(TICK_NS, 4, 8, 0);
+    for (int i = 0; i < n; i++) {
+        sim.handle[i] = timer_add(tw, (1 + next_random() % SIM_TICKS) * TICK_NS, (void *)(intptr_t)i);
+    }
+    r.add = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (uint64_t t = 1; t <= SIM_TICKS; t++) {
+        timing_wheel_advance(tw, t * TICK_NS, sim_batch, &sim);
+        for (int k = 0; k < resets; k++) {
+            int conn = (int)(next_random() % (uint64_t)n);
+            if (sim.fired[conn]) continue;
+            timer_cancel(tw, sim.handle[conn]);
+            r.cancels++;
+            sim.handle[conn] = timer_add(tw, (1 + next_random() % SIM_TICKS) * TICK_NS, (void *)(intptr_t)conn);
+        }
+    }
+    timing_wheel_advance(tw, 2 * SIM_TICKS * TICK_NS + TICK_NS, sim_batch, &sim);
+    r.run = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    r.fired = sim.fired_count;
+    r.checksum = sim.checksum;
+    timing_wheel_free(tw);
+    free(sim.handle);
+    free(sim.fired);
+    return r;
+}
+
+// Mesma simulação com o heap binário e cancelamento preguiçoso
+static SimResult simulate_heap(int n, int resets, uint64_t seed) {
+    SimResult r = { 0, 0, 0, 0, 0 };
+    Simulation sim = { (uint64_t *)malloc(sizeof(uint64_t) * n), (bool *)calloc(n, sizeof(bool)), 0, 0 };
+    int id_capacity = n + n / 2;
+    int *owner = (int *)malloc(sizeof(int) * id_capacity);     // id -> conexão
+    bool *cancelled = (bool *)calloc(id_capacity, sizeof(bool));
+    int next_id = 0;
+    rng_state = seed;
+
+    clock_t start = clock();
+    MinHeap heap = { (HeapTimer *)malloc(sizeof(HeapTimer) * 1024), 0, 1024 };
+    for (int i = 0; i < n; i++) {
+        owner[next_id] = i;
+        sim.handle[i] = (uint64_t)next_id;
+        heap_insert(&heap, (HeapTimer){ 1 + next_random() % SIM_TICKS, next_id++ });
+    }
+    r.add = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (uint64_t t = 1; t <= 2 * SIM_TICKS + 1; t++) {
+        while (heap.size > 0 && heap.data[0].deadline <= t) {
+            HeapTimer top = heap_extract_min(&heap);
+            if (cancelled[top.id]) continue;
+            int conn = owner[top.id];
+            sim.fired[conn] = true;
+            sim.fired_count++;
+            sim.checksum += (uint64_t)conn * 2654435761u + t;
+        }
+        if (t > SIM_TICKS) continue;
+        for (int k = 0; k < resets; k++) {
+            int conn = (int)(next_random() % (uint64_t)n);
+            if (sim.fired[conn]) continue;
+            cancelled[sim.handle[conn]] = true;
+            r.cancels++;
+            if (next_id == id_capacity) {
+                id_capacity *= 2;
+                owner = (int *)realloc(owner, sizeof(int) * id_capacity);
+                cancelled = (bool *)realloc(cancelled, sizeof(bool) * id_capacity);
+                memset(cancelled + next_id, 0, id_capacity - next_id);
+            }
+            owner[next_id] = conn;
+            sim.handle[conn] = (uint64_t)next_id;
+            heap_insert(&heap, (HeapTimer){ t + 1 + next_random() % SIM_TICKS, next_id++ });
+        }
+    }
+    r.run = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    r.fired = sim.fired_count;
+    r.checksum = sim.checksum;
+    free(heap.data);
+    free(owner);
+    free(cancelled);
+    free(sim.handle);
+    free(sim.fired);
+    return r;
+}
+
+void benchmark(int n, int resets) {
+    printf("=== BENCHMARK: %d temporizadores, %d reinícios por tick, %d ticks ===\n\n",
+           n, resets, SIM_TICKS);
+
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    SimResult heap = simulate_heap(n, resets, seed);
+    SimResult wheel = simulate_wheel(n, resets, seed);
+
+    printf("%-30s %12s %14s %12s %12s\n", "Estrutura", "agendar (s)", "simulação (s)", "cancelados", "disparados");
+    printf("%-30s %12.3f %14.3f %12lld %12lld\n", "heap binário (heap_binario.c)",
+           heap.add, heap.run, heap.cancels, heap.fired);
+    printf("%-30s %12.3f %14.3f %12lld %12lld\n", "timing wheel (4 x 256)",
+           wheel.add, wheel.run, wheel.cancels, wheel.fired);
+    printf("Mesmos disparos nos mesmos ticks: %s\n\n",
+           heap.fired == wheel.fired && heap.checksum == wheel.checksum ? "sim" : "NÃO");
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║             HIERARCHICAL TIMING WHEEL                    ║\n");
+    printf("║   Add/cancel O(1), cascata e disparo em lote             ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    int resets = (argc > 2) ? atoi(argv[2]) : 150;
+    if (n < 1000) n = 1000;
+    if (resets < 0) resets = 0;
+
+    testar_roda();
+    benchmark(n, resets);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da Timing Wheel hierárquica:\n");
+    printf("- Nível = grupo de bits mais alto em que prazo e agora diferem\n");
+    printf("- Add e cancel O(1); cascata O(1) amortizada por temporizador\n");
+    printf("- Resolução fixa (tick): prazos arredondados para cima\n");
+    printf("- Heap: O(log n) por operação e memória presa por cancelados\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
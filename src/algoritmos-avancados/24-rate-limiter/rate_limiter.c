@@ -0,0 +1,813 @@
+/**
+ * ============================================================================
+ * RATE LIMITER - TOKEN BUCKET E LEAKY BUCKET SEM LOCKS, TABELA POR CHAVE
+ * ============================================================================
+ *
+ * A versão do material (docs/algoritmos-avancados/05-token-bucket) guarda
+ * (tokens, timestamp) sob um Lock e lê o relógio a cada chamada. Aqui o
+ * estado inteiro de um balde é UM instante de 64 bits, atualizado com CAS
+ * (GCRA, Generic Cell Rate Algorithm, do ATM Forum):
+ *
+ * TOKEN BUCKET (taxa r, capacidade b, intervalo I = 1/r):
+ * - tat = instante em que o balde estará cheio de novo (theoretical
+ *   arrival time). Consumir n tokens em 'agora':
+ *
+ *       novo = max(tat, agora) + n·I
+ *       aceita se novo - agora <= b·I       (senão, tat não muda)
+ *
+ * - tat <= agora significa balde cheio; tat = agora + k·I significa que
+ *   faltam k tokens. O reabastecimento é implícito (preguiçoso): nenhuma
+ *   thread precisa "pingar" tokens
+ *
+ * LEAKY BUCKET (como fila, taxa de saída r, fila de c posições):
+ * - next = instante em que a fila esvazia. Uma requisição sai em
+ *   max(next, agora), e next avança I: a saída é espaçada exatamente de I,
+ *   sem rajadas. Aceita se novo next - agora <= c·I; o retorno é quanto
+ *   esperar
+ * - É a mesma conta do token bucket: o token bucket deixa a rajada passar
+ *   já, o leaky bucket a atrasa
+ *
+ * RELÓGIO GROSSO:
+ * - Uma thread grava CLOCK_MONOTONIC num atômico a cada ~1 ms; ler a hora
+ *   é uma leitura de memória, sem chamada ao sistema por decisão
+ *
+ * TABELA POR CHAVE:
+ * - Shards com lock próprio, cada um uma tabela de endereçamento aberto
+ *   (chave, tat). Uma chave ociosa tem tat <= agora, isto é, balde cheio,
+ *   o mesmo estado de uma chave nova: removê-la não muda nenhuma decisão
+ *
+ * Compilação: gcc -O2 -std=c11 -pthread rate_limiter.c -o rate_limiter
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#define RATE_REJECTED (-1)
+#define MAX_THREADS 64
+#define NS_PER_SEC 1000000000ULL
+
+// ==================== PASSO DO GCRA ====================
+
+// Função para converter taxa (por segundo) e capacidade em intervalo e limite (ns)
+static void rate_params(double rate, uint32_t capacity, uint64_t *interval_ns, uint64_t *limit_ns) {
+    if (rate < 1e-3) rate = 1e-3;
+    if (capacity < 1) capacity = 1;
+    double interval = (double)NS_PER_SEC / rate;
+    if (interval < 1.0) interval = 1.0;
+    double limit = interval * capacity;
+    if (limit > (double)(1ULL << 62)) limit = (double)(1ULL << 62);
+    *interval_ns = (uint64_t)(interval + 0.5);
+    *limit_ns = (uint64_t)limit;
+}
+
+/**
+ * Um passo do GCRA: a partir de tat, tenta agendar 'cost_ns' de trabalho.
+ * Retorna false se passaria do limite; senão, *start recebe o instante
+ * de início (>= now) e *next o novo tat
+ */
+static inline bool gcra_step(uint64_t tat, uint64_t now, uint64_t cost_ns, uint64_t limit_ns,
+                             uint64_t *start, uint64_t *next) {
+    uint64_t s = tat > now ? tat : now;
+    if (s + cost_ns - now > limit_ns) return false;
+    *start = s;
+    *next = s + cost_ns;
+    return true;
+}
+
+// ==================== TOKEN BUCKET ====================
+
+typedef struct {
+    _Atomic uint64_t tat;               // Instante em que o balde estará cheio
+    uint64_t interval_ns;               // Um token a cada interval_ns
+    uint64_t limit_ns;                  // capacidade · intervalo
+    uint32_t capacity;
+} TokenBucket;
+
+void token_bucket_init(TokenBucket *tb, double rate, uint32_t capacity) {
+    rate_params(rate, capacity, &tb->interval_ns, &tb->limit_ns);
+    tb->capacity = capacity > 0 ? capacity : 1;
+    atomic_init(&tb->tat, 0);           // Começa cheio
+}
+
+/**
+ * Tenta consumir 'tokens' no instante now_ns. Sem locks: um CAS, repetido
+ * só se outra thread mudou o balde no meio. O estado não depende de
+ * nenhuma outra memória, então ordem relaxada basta
+ */
+bool token_bucket_try_acquire(TokenBucket *tb, uint32_t tokens, uint64_t now_ns) {
+    if (tokens > tb->capacity) return false;
+    uint64_t cost = (uint64_t)tokens * tb->interval_ns;
+    uint64_t tat = atomic_load_explicit(&tb->tat, memory_order_relaxed);
+    uint64_t start, next;
+    do {
+        if (!gcra_step(tat, now_ns, cost, tb->limit_ns, &start, &next)) return false;
+    } while (!atomic_compare_exchange_weak_explicit(&tb->tat, &tat, next,
+                                                    memory_order_relaxed, memory_order_relaxed));
+    return true;
+}
+
+// Tokens disponíveis em now_ns (para consulta; pode mudar logo em seguida)
+double token_bucket_tokens(TokenBucket *tb, uint64_t now_ns) {
+    uint64_t tat = atomic_load_explicit(&tb->tat, memory_order_relaxed);
+    uint64_t missing = tat > now_ns ? tat - now_ns : 0;
+    return (double)(tb->limit_ns - (missing < tb->limit_ns ? missing : tb->limit_ns)) / tb->interval_ns;
+}
+
+// ==================== LEAKY BUCKET ====================
+
+typedef struct {
+    _Atomic uint64_t next;              // Instante em que a fila esvazia
+    uint64_t interval_ns;               // Uma saída a cada interval_ns
+    uint64_t limit_ns;                  // posições da fila · intervalo
+} LeakyBucket;
+
+void leaky_bucket_init(LeakyBucket *lb, double rate, uint32_t queue_capacity) {
+    rate_params(rate, queue_capacity, &lb->interval_ns, &lb->limit_ns);
+    atomic_init(&lb->next, 0);
+}
+
+/**
+ * Coloca uma requisição na fila em now_ns. Retorna quantos ns ela deve
+ * esperar para sair (0 = sai já) ou RATE_REJECTED se a fila está cheia
+ */
+int64_t leaky_bucket_enqueue(LeakyBucket *lb, uint64_t now_ns) {
+    uint64_t tat = atomic_load_explicit(&lb->next, memory_order_relaxed);
+    uint64_t start, next;
+    do {
+        if (!gcra_step(tat, now_ns, lb->interval_ns, lb->limit_ns, &start, &next)) return RATE_REJECTED;
+    } while (!atomic_compare_exchange_weak_explicit(&lb->next, &tat, next,
+                                                    memory_order_relaxed, memory_order_relaxed));
+    return (int64_t)(start - now_ns);
+}
+
+// ==================== RELÓGIO GROSSO ====================
+
+typedef struct {
+    _Atomic uint64_t now_ns;
+    atomic_bool running;
+    uint64_t resolution_ns;
+    pthread_t thread;
+} CoarseClock;
+
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NS_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+static void* coarse_clock_run(void *arg) {
+    CoarseClock *clk = (CoarseClock *)arg;
+    struct timespec pause = { (time_t)(clk->resolution_ns / NS_PER_SEC), (long)(clk->resolution_ns % NS_PER_SEC) };
+    while (atomic_load_explicit(&clk->running, memory_order_relaxed)) {
+        nanosleep(&pause, NULL);
+        atomic_store_explicit(&clk->now_ns, monotonic_ns(), memory_order_relaxed);
+    }
+    return NULL;
+}
+
+/**
+ * Inicia o relógio: uma thread atualiza a hora a cada resolution_ns.
+ * Se a thread não puder ser criada, retorna NULL
+ */
+CoarseClock* coarse_clock_start(uint64_t resolution_ns) {
+    CoarseClock *clk = (CoarseClock *)malloc(sizeof(CoarseClock));
+    clk->resolution_ns = resolution_ns > 0 ? resolution_ns : 1000000;
+    atomic_init(&clk->now_ns, monotonic_ns());
+    atomic_init(&clk->running, true);
+    if (pthread_create(&clk->thread, NULL, coarse_clock_run, clk) != 0) {
+        free(clk);
+        return NULL;
+    }
+    return clk;
+}
+
+// Hora atual com a resolução do relógio: uma leitura atômica
+static inline uint64_t coarse_clock_now(CoarseClock *clk) {
+    return atomic_load_explicit(&clk->now_ns, memory_order_relaxed);
+}
+
+void coarse_clock_stop(CoarseClock *clk) {
+    atomic_store(&clk->running, false);
+    pthread_join(clk->thread, NULL);
+    free(clk);
+}
+
+// ==================== TABELA POR CHAVE ====================
+
+typedef enum { RATE_TOKEN_BUCKET, RATE_LEAKY_BUCKET } RateAlgorithm;
+
+// tat = 0 marca posição vazia: uma entrada só é criada ao aceitar uma
+// requisição, e aí tat >= custo > 0
+typedef struct {
+    uint64_t key;
+    uint64_t tat;
+} RateEntry;
+
+// Cada shard ocupa suas próprias linhas de cache (sem falso compartilhamento)
+typedef struct {
+    _Alignas(64) pthread_mutex_t lock;
+    RateEntry *entries;
+    uint32_t capacity;                  // Potência de 2
+    uint32_t count;
+    uint64_t evicted;
+} RateShard;
+
+typedef struct {
+    RateAlgorithm algorithm;
+    uint64_t interval_ns;
+    uint64_t limit_ns;
+    uint32_t capacity;
+    uint64_t idle_ns;                   // Ociosa há mais que isso: pode sair
+    int shard_bits;
+    RateShard *shards;
+} RateTable;
+
+#define SHARD_MIN_CAPACITY 16
+
+static inline uint64_t hash_key(uint64_t key) {
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+    return key;
+}
+
+/**
+ * Cria a tabela: cada chave tem seu balde (token ou leaky) com a mesma
+ * taxa e capacidade. 'shards' é arredondado para potência de 2
+ */
+RateTable* rate_table_create(RateAlgorithm algorithm, double rate, uint32_t capacity,
+                             uint64_t idle_ns, int shards) {
+    RateTable *t = (RateTable *)malloc(sizeof(RateTable));
+    t->algorithm = algorithm;
+    rate_params(rate, capacity, &t->interval_ns, &t->limit_ns);
+    t->capacity = capacity > 0 ? capacity : 1;
+    t->idle_ns = idle_ns;
+    t->shard_bits = 0;
+    while ((1 << t->shard_bits) < shards && t->shard_bits < 16) t->shard_bits++;
+    int n = 1 << t->shard_bits;
+    t->shards = (RateShard *)aligned_alloc(64, sizeof(RateShard) * n);
+    for (int i = 0; i < n; i++) {
+        RateShard *s = &t->shards[i];
+        pthread_mutex_init(&s->lock, NULL);
+        s->capacity = SHARD_MIN_CAPACITY;
+        s->entries = (RateEntry *)calloc(s->capacity, sizeof(RateEntry));
+        s->count = 0;
+        s->evicted = 0;
+    }
+    return t;
+}
+
+void rate_table_free(RateTable *t) {
+    for (int i = 0; i < (1 << t->shard_bits); i++) {
+        pthread_mutex_destroy(&t->shards[i].lock);
+        free(t->shards[i].entries);
+    }
+    free(t->shards);
+    free(t);
+}
+
+static inline bool entry_idle(const RateTable *t, const RateEntry *e, uint64_t now) {
+    return e->tat + t->idle_ns <= now;
+}
+
+/**
+ * Função para reconstruir um shard sem as chaves ociosas, com capacidade
+ * para que as restantes ocupem no máximo metade (pode encolher)
+ */
+static void shard_rebuild(const RateTable *t, RateShard *s, uint64_t now) {
+    uint32_t live = 0;
+    for (uint32_t i = 0; i < s->capacity; i++) {
+        if (s->entries[i].tat != 0 && !entry_idle(t, &s->entries[i], now)) live++;
+    }
+    uint32_t capacity = SHARD_MIN_CAPACITY;
+    while (capacity < 2 * (live + 1)) capacity *= 2;
+
+    RateEntry *entries = (RateEntry *)calloc(capacity, sizeof(RateEntry));
+    for (uint32_t i = 0; i < s->capacity; i++) {
+        RateEntry *e = &s->entries[i];
+        if (e->tat == 0 || entry_idle(t, e, now)) continue;
+        uint32_t j = (uint32_t)hash_key(e->key) & (capacity - 1);
+        while (entries[j].tat != 0) j = (j + 1) & (capacity - 1);
+        entries[j] = *e;
+    }
+    s->evicted += s->count - live;
+    free(s->entries);
+    s->entries = entries;
+    s->capacity = capacity;
+    s->count = live;
+}
+
+/**
+ * Decide uma requisição de 'cost' unidades para 'key' em now_ns. Retorna
+ * RATE_REJECTED, ou a espera em ns (sempre 0 no token bucket). Uma chave
+ * nova começa com o balde cheio e só entra na tabela se for aceita
+ */
+int64_t rate_table_acquire(RateTable *t, uint64_t key, uint32_t cost, uint64_t now_ns) {
+    if (cost == 0) return 0;
+    if (cost > t->capacity) return RATE_REJECTED;
+    uint64_t h = hash_key(key);
+    RateShard *s = &t->shards[t->shard_bits ? h >> (64 - t->shard_bits) : 0];
+    uint64_t cost_ns = (uint64_t)cost * t->interval_ns;
+    uint64_t start, next;
+    int64_t result = RATE_REJECTED;
+
+    pthread_mutex_lock(&s->lock);
+    uint32_t mask = s->capacity - 1;
+    uint32_t i = (uint32_t)h & mask;
+    while (s->entries[i].tat != 0 && s->entries[i].key != key) i = (i + 1) & mask;
+
+    if (s->entries[i].tat != 0) {
+        RateEntry *e = &s->entries[i];
+        if (gcra_step(e->tat, now_ns, cost_ns, t->limit_ns, &start, &next)) {
+            e->tat = next;
+            result = (int64_t)(start - now_ns);
+        }
+    } else if (gcra_step(0, now_ns, cost_ns, t->limit_ns, &start, &next)) {
+        // Chave nova: antes de passar de 3/4, remove ociosas e/ou cresce
+        if (4 * (s->count + 1) > 3 * s->capacity) {
+            shard_rebuild(t, s, now_ns);
+            mask = s->capacity - 1;
+            i = (uint32_t)h & mask;
+            while (s->entries[i].tat != 0) i = (i + 1) & mask;
+        }
+        s->entries[i].key = key;
+        s->entries[i].tat = next;
+        s->count++;
+        result = (int64_t)(start - now_ns);
+    }
+    pthread_mutex_unlock(&s->lock);
+
+    if (t->algorithm == RATE_TOKEN_BUCKET && result > 0) result = 0;
+    return result;
+}
+
+/**
+ * Remove as chaves ociosas de todos os shards (um shard travado por vez).
+ * Retorna quantas foram removidas
+ */
+size_t rate_table_evict_idle(RateTable *t, uint64_t now_ns) {
+    size_t removed = 0;
+    for (int i = 0; i < (1 << t->shard_bits); i++) {
+        RateShard *s = &t->shards[i];
+        pthread_mutex_lock(&s->lock);
+        uint32_t before = s->count;
+        shard_rebuild(t, s, now_ns);
+        removed += before - s->count;
+        pthread_mutex_unlock(&s->lock);
+    }
+    return removed;
+}
+
+size_t rate_table_size(RateTable *t) {
+    size_t total = 0;
+    for (int i = 0; i < (1 << t->shard_bits); i++) {
+        pthread_mutex_lock(&t->shards[i].lock);
+        total += t->shards[i].count;
+        pthread_mutex_unlock(&t->shards[i].lock);
+    }
+    return total;
+}
+
+// ==================== TOKEN BUCKET DO MATERIAL ====================
+
+// Mesmo algoritmo de docs/algoritmos-avancados/05-token-bucket (classe
+// TokenBucket em Python): tokens em ponto flutuante, timestamp, Lock e
+// relógio lido a cada chamada
+typedef struct {
+    double rate;
+    double capacity;
+    double tokens;
+    double timestamp;
+    pthread_mutex_t lock;
+} ReferenceBucket;
+
+static double reference_now(void) {
+    return monotonic_ns() / 1e9;
+}
+
+static void reference_init(ReferenceBucket *b, double rate, double capacity, double now) {
+    b->rate = rate;
+    b->capacity = capacity;
+    b->tokens = capacity;
+    b->timestamp = now;
+    pthread_mutex_init(&b->lock, NULL);
+}
+
+static void reference_add_tokens(ReferenceBucket *b, double now) {
+    double elapsed = now - b->timestamp;
+    if (elapsed > 0) {
+        double added = elapsed * b->rate;
+        b->tokens = b->tokens + added < b->capacity ? b->tokens + added : b->capacity;
+        b->timestamp = now;
+    }
+}
+
+static bool reference_consume(ReferenceBucket *b, double tokens, double now) {
+    pthread_mutex_lock(&b->lock);
+    reference_add_tokens(b, now);
+    bool ok = b->tokens >= tokens;
+    if (ok) b->tokens -= tokens;
+    pthread_mutex_unlock(&b->lock);
+    return ok;
+}
+
+// ==================== TESTES ====================
+
+static uint64_t rng_state = 88172645463325252ULL;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+void testar_token_bucket(void) {
+    printf("=== TESTE: TOKEN BUCKET (r = 1000/s, b = 50) ===\n\n");
+
+    TokenBucket tb;
+    token_bucket_init(&tb, 1000.0, 50);
+    const uint64_t ms = 1000000;
+    int burst = 0;
+    while (token_bucket_try_acquire(&tb, 1, 5 * ms)) burst++;
+    int after_10ms = 0;
+    while (token_bucket_try_acquire(&tb, 1, 15 * ms)) after_10ms++;
+    printf("Rajada inicial: %d, 10 ms depois: %d, grande demais (51): %s\n",
+           burst, after_10ms, token_bucket_try_acquire(&tb, 51, 1000 * ms) ? "aceito" : "recusado");
+    bool ok = burst == 50 && after_10ms == 10;
+
+    // Chegadas aleatórias: contra o algoritmo do material e contra o limite
+    // A(t1, t2) <= r·(t2 - t1) + b, em janelas que terminam em cada aceite
+    token_bucket_init(&tb, 1000.0, 50);
+    ReferenceBucket ref;
+    reference_init(&ref, 1000.0, 50.0, 0.0);
+    enum { N = 200000, MAX_TOKENS = 4 };
+    uint64_t *accepted = (uint64_t *)malloc(sizeof(uint64_t) * N * MAX_TOKENS);  // Um instante por ficha
+    int count = 0, ref_count = 0, mismatches = 0;
+    uint64_t now = 0;
+    for (int i = 0; i < N; i++) {
+        now += next_random() % 3000 * 1000;                 // 0 a 3 ms, em µs inteiros
+        uint32_t tokens = 1 + (uint32_t)(next_random() % MAX_TOKENS);
+        bool a = token_bucket_try_acquire(&tb, tokens, now);
+        bool r = reference_consume(&ref, tokens, now / 1e9);
+        ref_count += r;
+        mismatches += a != r;
+        if (a) {
+            for (uint32_t k = 0; k < tokens; k++) accepted[count++] = now;
+        }
+    }
+    int window_ok = 1;
+    for (int j = 0; j < count; j++) {
+        // Os 'b + r·Δt + 1' aceites anteriores não cabem em Δt
+        int back = j - 50 - 1;
+        if (back >= 0) {
+            double dt = (accepted[j] - accepted[back]) / 1e9;
+            if (50 + 1 > 1000.0 * dt + 50 + 1e-9) window_ok = 0;
+        }
+    }
+    printf("200k chegadas: %d decisões diferentes do material, limite r·Δt + b: %s\n",
+           mismatches, window_ok ? "respeitado" : "VIOLADO");
+    ok = ok && mismatches <= N / 1000 && window_ok;
+    pthread_mutex_destroy(&ref.lock);
+    free(accepted);
+    (void)ref_count;
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+void testar_leaky_bucket(void) {
+    printf("=== TESTE: LEAKY BUCKET (r = 100/s, fila de 10) ===\n\n");
+
+    LeakyBucket lb;
+    leaky_bucket_init(&lb, 100.0, 10);
+    const uint64_t ms = 1000000;
+    bool ok = true;
+    printf("20 requisições no mesmo instante, espera (ms):");
+    for (int i = 0; i < 20; i++) {
+        int64_t wait = leaky_bucket_enqueue(&lb, 1000 * ms);
+        if (wait == RATE_REJECTED) printf(" X");
+        else printf(" %lld", (long long)(wait / (int64_t)ms));
+        ok = ok && (i < 10 ? wait == (int64_t)(i * 10 * ms) : wait == RATE_REJECTED);
+    }
+    printf("\n");
+    // 25 ms depois, 2 saíram e há 2 posições (e a próxima sai em 5 ms)
+    int64_t w1 = leaky_bucket_enqueue(&lb, 1025 * ms);
+    int64_t w2 = leaky_bucket_enqueue(&lb, 1025 * ms);
+    int64_t w3 = leaky_bucket_enqueue(&lb, 1025 * ms);
+    printf("25 ms depois: espera %lld ms, %lld ms, terceira %s\n",
+           (long long)(w1 / (int64_t)ms), (long long)(w2 / (int64_t)ms), w3 == RATE_REJECTED ? "recusada" : "aceita");
+    ok = ok && w1 == (int64_t)(75 * ms) && w2 == (int64_t)(85 * ms) && w3 == RATE_REJECTED;
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+typedef struct {
+    TokenBucket *tb;
+    RateTable *table;
+    int attempts;
+    int keys;
+    long accepted;
+} ContendTask;
+
+static void* contend_bucket(void *arg) {
+    ContendTask *c = (ContendTask *)arg;
+    for (int i = 0; i < c->attempts; i++) c->accepted += token_bucket_try_acquire(c->tb, 1, 1000);
+    return NULL;
+}
+
+static void* contend_table(void *arg) {
+    ContendTask *c = (ContendTask *)arg;
+    for (int i = 0; i < c->attempts; i++) {
+        c->accepted += rate_table_acquire(c->table, (uint64_t)(i % c->keys), 1, 1000) == 0;
+    }
+    return NULL;
+}
+
+void testar_concorrencia(void) {
+    printf("=== TESTE: 4 THREADS NO MESMO INSTANTE ===\n\n");
+
+    // Sem o tempo andar, o total aceito tem que ser exatamente a capacidade
+    TokenBucket tb;
+    token_bucket_init(&tb, 1.0, 100000);
+    RateTable *table = rate_table_create(RATE_TOKEN_BUCKET, 1.0, 10, NS_PER_SEC, 4);
+    pthread_t tid[4];
+    ContendTask tasks[4], table_tasks[4];
+    for (int t = 0; t < 4; t++) {
+        tasks[t] = (ContendTask){ &tb, NULL, 50000, 0, 0 };
+        table_tasks[t] = (ContendTask){ NULL, table, 50000, 1000, 0 };
+        pthread_create(&tid[t], NULL, contend_bucket, &tasks[t]);
+    }
+    for (int t = 0; t < 4; t++) pthread_join(tid[t], NULL);
+    for (int t = 0; t < 4; t++) pthread_create(&tid[t], NULL, contend_table, &table_tasks[t]);
+    for (int t = 0; t < 4; t++) pthread_join(tid[t], NULL);
+
+    long total = 0, table_total = 0;
+    for (int t = 0; t < 4; t++) {
+        total += tasks[t].accepted;
+        table_total += table_tasks[t].accepted;
+    }
+    printf("Um balde, 200k tentativas, capacidade 100000: %ld aceitas\n", total);
+    printf("Tabela, 1000 chaves x 200 tentativas, capacidade 10: %ld aceitas (esperado 10000)\n", table_total);
+    bool ok = total == 100000 && table_total == 10000 && rate_table_size(table) == 1000;
+    rate_table_free(table);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+void testar_tabela(void) {
+    printf("=== TESTE: TABELA POR CHAVE E REMOÇÃO DE OCIOSAS ===\n\n");
+
+    const uint64_t ms = 1000000;
+    RateTable *table = rate_table_create(RATE_TOKEN_BUCKET, 10.0, 5, 100 * ms, 8);
+    // 100k chaves, cada uma com 1 a 8 requisições no instante 1 s
+    bool ok = true;
+    for (uint64_t k = 0; k < 100000; k++) {
+        int requests = 1 + (int)(k % 8);
+        for (int r = 0; r < requests; r++) {
+            bool accepted = rate_table_acquire(table, k * 7919, 1, 1000 * ms) == 0;
+            ok = ok && accepted == (r < 5);
+        }
+    }
+    size_t size = rate_table_size(table);
+    // I = 100 ms: com k tokens gastos, o balde enche em 1000 + 100·k ms e a
+    // chave fica ociosa 100 ms depois. Em 1250 ms, só as de 1 token
+    size_t early = rate_table_evict_idle(table, 1250 * ms);
+    // 2 s depois: todos
+    size_t late = rate_table_evict_idle(table, 3000 * ms);
+    printf("Chaves: %zu, ociosas em 250 ms: %zu, em 2 s: %zu, restantes: %zu\n",
+           size, early, late, rate_table_size(table));
+    ok = ok && size == 100000 && early == 12500 && early + late == 100000 && rate_table_size(table) == 0;
+
+    // Depois de removida, a chave se comporta como nova (balde cheio)
+    int accepted = 0;
+    while (rate_table_acquire(table, 7919, 1, 3000 * ms) == 0) accepted++;
+    printf("Chave removida volta com o balde cheio: %d tokens\n", accepted);
+    ok = ok && accepted == 5;
+    rate_table_free(table);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// ==================== BENCHMARK ====================
+
+typedef enum { CLOCK_PER_CALL, CLOCK_COARSE } ClockMode;
+
+typedef struct {
+    RateTable *table;
+    ReferenceBucket *single_ref;
+    TokenBucket *single;
+    CoarseClock *clk;
+    ClockMode mode;
+    long ops;
+    uint64_t keys;
+    uint64_t seed;
+    long accepted;
+} BenchTask;
+
+static inline uint64_t bench_now(const BenchTask *b) {
+    return b->mode == CLOCK_COARSE ? coarse_clock_now(b->clk) : monotonic_ns();
+}
+
+static void* bench_single_reference(void *arg) {
+    BenchTask *b = (BenchTask *)arg;
+    for (long i = 0; i < b->ops; i++) b->accepted += reference_consume(b->single_ref, 1.0, reference_now());
+    return NULL;
+}
+
+static void* bench_single(void *arg) {
+    BenchTask *b = (BenchTask *)arg;
+    for (long i = 0; i < b->ops; i++) b->accepted += token_bucket_try_acquire(b->single, 1, bench_now(b));
+    return NULL;
+}
+
+static void* bench_table(void *arg) {
+    BenchTask *b = (BenchTask *)arg;
+    uint64_t x = b->seed;
+    for (long i = 0; i < b->ops; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        b->accepted += rate_table_acquire(b->table, x % b->keys, 1, bench_now(b)) == 0;
+    }
+    return NULL;
+}
+
+// Mesmo balde do material por chave, numa tabela com um único lock
+typedef struct {
+    uint64_t key;
+    bool used;
+    ReferenceBucket bucket;
+} ReferenceEntry;
+
+typedef struct {
+    ReferenceEntry *entries;
+    uint64_t mask;
+    pthread_mutex_t lock;
+} ReferenceTable;
+
+static ReferenceTable *bench_ref_table;
+
+static void* bench_reference_table(void *arg) {
+    BenchTask *b = (BenchTask *)arg;
+    ReferenceTable *rt = bench_ref_table;
+    uint64_t x = b->seed;
+    for (long i = 0; i < b->ops; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        uint64_t key = x % b->keys;
+        double now = reference_now();
+        pthread_mutex_lock(&rt->lock);
+        uint64_t j = hash_key(key) & rt->mask;
+        while (rt->entries[j].used && rt->entries[j].key != key) j = (j + 1) & rt->mask;
+        ReferenceEntry *e = &rt->entries[j];
+        if (!e->used) {
+            e->used = true;
+            e->key = key;
+            e->bucket.rate = 100.0;
+            e->bucket.capacity = 20.0;
+            e->bucket.tokens = 20.0;
+            e->bucket.timestamp = now;
+        }
+        reference_add_tokens(&e->bucket, now);
+        bool ok = e->bucket.tokens >= 1.0;
+        if (ok) e->bucket.tokens -= 1.0;
+        pthread_mutex_unlock(&rt->lock);
+        b->accepted += ok;
+    }
+    return NULL;
+}
+
+static double now_seconds(void) {
+    return monotonic_ns() / 1e9;
+}
+
+// Função para rodar 'threads' cópias de task e devolver decisões/s
+static double run_threads(void *(*task)(void *), BenchTask base, int threads, long total_ops, long *accepted) {
+    pthread_t tid[MAX_THREADS];
+    BenchTask tasks[MAX_THREADS];
+    double start = now_seconds();
+    for (int t = 0; t < threads; t++) {
+        tasks[t] = base;
+        tasks[t].ops = total_ops / threads;
+        tasks[t].seed = base.seed + 0x9E3779B97F4A7C15ULL * (t + 1);
+        pthread_create(&tid[t], NULL, task, &tasks[t]);
+    }
+    *accepted = 0;
+    for (int t = 0; t < threads; t++) {
+        pthread_join(tid[t], NULL);
+        *accepted += tasks[t].accepted;
+    }
+    return total_ops / (now_seconds() - start);
+}
+
+void benchmark(long ops, uint64_t keys, int max_threads) {
+    printf("=== BENCHMARK: %ld decisões ===\n\n", ops);
+
+    CoarseClock *clk = coarse_clock_start(1000000);
+    if (clk == NULL) {
+        printf("Não foi possível iniciar o relógio\n\n");
+        return;
+    }
+    long accepted;
+
+    printf("Um balde (r = 1M/s, b = 1000):\n");
+    printf("%-42s %14s %10s\n", "Versão", "decisões/s", "aceitas");
+    ReferenceBucket ref;
+    reference_init(&ref, 1e6, 1000.0, reference_now());
+    BenchTask base = { NULL, &ref, NULL, clk, CLOCK_PER_CALL, 0, keys, 12345, 0 };
+    double rate = run_threads(bench_single_reference, base, 1, ops, &accepted);
+    printf("%-42s %14.3g %9.1f%%\n", "material: lock + double + clock_gettime", rate, 100.0 * accepted / ops);
+    pthread_mutex_destroy(&ref.lock);
+
+    TokenBucket tb;
+    token_bucket_init(&tb, 1e6, 1000);
+    base.single = &tb;
+    rate = run_threads(bench_single, base, 1, ops, &accepted);
+    printf("%-42s %14.3g %9.1f%%\n", "GCRA + clock_gettime", rate, 100.0 * accepted / ops);
+    token_bucket_init(&tb, 1e6, 1000);
+    base.mode = CLOCK_COARSE;
+    rate = run_threads(bench_single, base, 1, ops, &accepted);
+    printf("%-42s %14.3g %9.1f%%\n\n", "GCRA + relógio grosso", rate, 100.0 * accepted / ops);
+
+    printf("Tabela com %llu chaves aleatórias (r = 100/s, b = 20 por chave):\n", (unsigned long long)keys);
+    printf("%-42s %14s %10s\n", "Versão", "decisões/s", "aceitas");
+
+    uint64_t ref_capacity = 1;
+    while (ref_capacity < 2 * keys) ref_capacity *= 2;
+    base.mode = CLOCK_PER_CALL;
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        ReferenceTable rt;
+        rt.entries = (ReferenceEntry *)calloc(ref_capacity, sizeof(ReferenceEntry));
+        rt.mask = ref_capacity - 1;
+        pthread_mutex_init(&rt.lock, NULL);
+        bench_ref_table = &rt;
+        rate = run_threads(bench_reference_table, base, threads, ops, &accepted);
+        char name[64];
+        snprintf(name, sizeof(name), "material, lock global, %d thread(s)", threads);
+        printf("%-42s %14.3g %9.1f%%\n", name, rate, 100.0 * accepted / ops);
+        pthread_mutex_destroy(&rt.lock);
+        free(rt.entries);
+    }
+
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        RateTable *table = rate_table_create(RATE_TOKEN_BUCKET, 100.0, 20, NS_PER_SEC, 256);
+        base.table = table;
+        base.mode = CLOCK_COARSE;
+        rate = run_threads(bench_table, base, threads, ops, &accepted);
+        char name[64];
+        snprintf(name, sizeof(name), "rate_table, 256 shards, %d thread(s)", threads);
+        printf("%-42s %14.3g %9.1f%%\n", name, rate, 100.0 * accepted / ops);
+        if (threads * 2 > max_threads) {
+            size_t size = rate_table_size(table);
+            double start = now_seconds();
+            size_t removed = rate_table_evict_idle(table, coarse_clock_now(clk) + 2 * NS_PER_SEC);
+            printf("Chaves na tabela: %zu; remoção de ociosas (2 s depois): %zu em %.1f ms\n",
+                   size, removed, (now_seconds() - start) * 1000);
+        }
+        rate_table_free(table);
+    }
+    printf("\n");
+    coarse_clock_stop(clk);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║             RATE LIMITER                                 ║\n");
+    printf("║   Token/leaky bucket por CAS, tabela por chave           ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    long ops = (argc > 1) ? atol(argv[1]) : 20000000;
+    long keys = (argc > 2) ? atol(argv[2]) : 1000000;
+    int max_threads = (argc > 3) ? atoi(argv[3]) : 4;
+    if (ops < 1000) ops = 1000;
+    if (keys < 1) keys = 1;
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > MAX_THREADS) max_threads = MAX_THREADS;
+
+    testar_token_bucket();
+    testar_leaky_bucket();
+    testar_concorrencia();
+    testar_tabela();
+    benchmark(ops, (uint64_t)keys, max_threads);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades do Rate Limiter:\n");
+    printf("- Estado de um balde: um instante de 64 bits (GCRA), um CAS\n");
+    printf("- Reabastecimento implícito: nenhuma thread pinga tokens\n");
+    printf("- Token bucket aceita rajadas; leaky bucket as espaça\n");
+    printf("- Chave ociosa = balde cheio: removê-la não muda decisões\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,972 @@
+/**
+ * ============================================================================
+ * MERKLE TREE - VERIFICAÇÃO INCREMENTAL E DIFERENÇA ENTRE RÉPLICAS
+ * ============================================================================
+ *
+ * Um arquivo é dividido em blocos de tamanho fixo; cada folha é o hash de
+ * um bloco e cada nó interno, o hash dos dois filhos. Duas réplicas com a
+ * mesma raiz são iguais; se as raízes diferem, basta descer pelos nós
+ * diferentes para achar os blocos alterados, trocando O(d log n) hashes
+ * em vez do arquivo (ou da lista inteira de n hashes).
+ *
+ * FORMATO (RFC 6962, Certificate Transparency):
+ * - folha = SHA-256(0x00 || bloco), nó = SHA-256(0x01 || esq || dir)
+ *   Os prefixos impedem que um nó interno se passe por folha
+ * - Nível a nível, pares de nós viram um pai; um nó sem par SOBE sem ser
+ *   hasheado de novo (o material duplica o último, o que faz [a, b, c] e
+ *   [a, b, c, c] terem a mesma raiz). O resultado é a árvore da RFC:
+ *   a subárvore esquerda é sempre completa (potência de 2)
+ * - O nó j do nível k cobre os blocos [j·2^k, (j+1)·2^k), cortado em n:
+ *   árvores de arquivos com tamanhos diferentes ainda se comparam nó a nó
+ *
+ * CONSTRUÇÃO:
+ * - merkle_builder_*: recebe o arquivo em pedaços de qualquer tamanho e
+ *   hasheia os blocos em lotes, com várias threads (cada folha é
+ *   independente). A memória é O(n) hashes, não O(arquivo)
+ * - Atualizar um bloco refaz a folha e o caminho até a raiz: O(log n)
+ *
+ * SHA-256:
+ * - Implementação própria (FIPS 180-4), sem OpenSSL; em CPUs com SHA-NI
+ *   (sha256rnds2/msg1/msg2), a compressão usa as instruções, escolhidas em
+ *   tempo de execução. sha256_use_shani(false) força o caminho portátil
+ *
+ * Compilação: gcc -O2 -std=c11 -pthread merkle_tree.c -o merkle_tree
+ *
+ * Autor: Estrutura de Dados em C
+ * ============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define SHA256_HAS_SHANI_PATH 1
+#endif
+
+#define MAX_THREADS 64
+#define MAX_LEVELS 64
+
+// ==================== SHA-256 PORTÁTIL ====================
+
+static const uint32_t K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t rotr32(uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+static inline uint32_t load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Função para comprimir 'blocks' blocos de 64 bytes no estado
+static void sha256_blocks_portable(uint32_t state[8], const uint8_t *data, size_t blocks) {
+    uint32_t w[64];
+    while (blocks--) {
+        for (int t = 0; t < 16; t++) w[t] = load_be32(data + 4 * t);
+        for (int t = 16; t < 64; t++) {
+            uint32_t s0 = rotr32(w[t - 15], 7) ^ rotr32(w[t - 15], 18) ^ (w[t - 15] >> 3);
+            uint32_t s1 = rotr32(w[t - 2], 17) ^ rotr32(w[t - 2], 19) ^ (w[t - 2] >> 10);
+            w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (int t = 0; t < 64; t++) {
+            uint32_t S1 = rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25);
+            uint32_t ch = (e & f) ^ (~e & g);
+            uint32_t t1 = h + S1 + ch + K256[t] + w[t];
+            uint32_t S0 = rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22);
+            uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+            uint32_t t2 = S0 + maj;
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+        data += 64;
+    }
+}
+
+// ==================== SHA-256 COM SHA-NI ====================
+
+#ifdef SHA256_HAS_SHANI_PATH
+/**
+ * Cada sha256rnds2 faz 2 rodadas com o estado dividido em ABEF e CDGH;
+ * sha256msg1/msg2 expandem a mensagem 4 palavras por vez:
+ *   W[t..t+3] = msg2(msg1(W[t-16..], W[t-12..]) + W[t-7..t-4], W[t-4..])
+ */
+__attribute__((target("sha,sse4.1")))
+static void sha256_blocks_shani(uint32_t state[8], const uint8_t *data, size_t blocks) {
+    const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+    __m128i state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);                  // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B);            // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);    // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);         // CDGH
+
+    while (blocks--) {
+        __m128i abef = state0, cdgh = state1;
+        __m128i w[4];
+#pragma GCC unroll 16
+        for (int g = 0; g < 16; g++) {
+            if (g < 4) {
+                w[g] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * g)), byte_swap);
+            } else {
+                __m128i t = _mm_sha256msg1_epu32(w[g & 3], w[(g + 1) & 3]);
+                t = _mm_add_epi32(t, _mm_alignr_epi8(w[(g + 3) & 3], w[(g + 2) & 3], 4));
+                w[g & 3] = _mm_sha256msg2_epu32(t, w[(g + 3) & 3]);
+            }
+            __m128i msg = _mm_add_epi32(w[g & 3], _mm_loadu_si128((const __m128i *)&K256[4 * g]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        }
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+        data += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);               // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);            // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);         // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);            // HGFE
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+#endif
+
+// Implementação escolhida em tempo de execução
+static void (*sha256_blocks)(uint32_t[8], const uint8_t *, size_t) = sha256_blocks_portable;
+
+/**
+ * Liga ou desliga o caminho SHA-NI. Retorna true se ele ficou ativo
+ * (só acontece se a CPU suportar)
+ */
+bool sha256_use_shani(bool enable) {
+#ifdef SHA256_HAS_SHANI_PATH
+    __builtin_cpu_init();
+    if (enable && __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1")) {
+        sha256_blocks = sha256_blocks_shani;
+        return true;
+    }
+#endif
+    (void)enable;
+    sha256_blocks = sha256_blocks_portable;
+    return false;
+}
+
+// ==================== SHA-256: INTERFACE ====================
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t length;                    // Bytes processados
+    uint8_t buffer[64];
+    size_t buffered;
+} Sha256;
+
+void sha256_init(Sha256 *ctx) {
+    static const uint32_t iv[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    memcpy(ctx->state, iv, sizeof(iv));
+    ctx->length = 0;
+    ctx->buffered = 0;
+}
+
+void sha256_update(Sha256 *ctx, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    if (len == 0) return;
+    ctx->length += len;
+    if (ctx->buffered > 0) {
+        size_t take = 64 - ctx->buffered < len ? 64 - ctx->buffered : len;
+        memcpy(ctx->buffer + ctx->buffered, p, take);
+        ctx->buffered += take;
+        p += take;
+        len -= take;
+        if (ctx->buffered < 64) return;
+        sha256_blocks(ctx->state, ctx->buffer, 1);
+        ctx->buffered = 0;
+    }
+    // Blocos inteiros direto da entrada, sem cópia
+    if (len >= 64) {
+        sha256_blocks(ctx->state, p, len / 64);
+        p += len & ~(size_t)63;
+        len &= 63;
+    }
+    memcpy(ctx->buffer, p, len);
+    ctx->buffered = len;
+}
+
+void sha256_final(Sha256 *ctx, uint8_t out[32]) {
+    uint64_t bits = ctx->length * 8;
+    ctx->buffer[ctx->buffered++] = 0x80;
+    if (ctx->buffered > 56) {
+        memset(ctx->buffer + ctx->buffered, 0, 64 - ctx->buffered);
+        sha256_blocks(ctx->state, ctx->buffer, 1);
+        ctx->buffered = 0;
+    }
+    memset(ctx->buffer + ctx->buffered, 0, 56 - ctx->buffered);
+    for (int i = 0; i < 8; i++) ctx->buffer[56 + i] = (uint8_t)(bits >> (56 - 8 * i));
+    sha256_blocks(ctx->state, ctx->buffer, 1);
+    for (int i = 0; i < 8; i++) {
+        out[4 * i] = (uint8_t)(ctx->state[i] >> 24);
+        out[4 * i + 1] = (uint8_t)(ctx->state[i] >> 16);
+        out[4 * i + 2] = (uint8_t)(ctx->state[i] >> 8);
+        out[4 * i + 3] = (uint8_t)ctx->state[i];
+    }
+}
+
+void sha256(const void *data, size_t len, uint8_t out[32]) {
+    Sha256 ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, data, len);
+    sha256_final(&ctx, out);
+}
+
+// ==================== ÁRVORE ====================
+
+typedef struct {
+    uint8_t bytes[32];
+} Hash256;
+
+typedef struct {
+    size_t block_size;
+    uint64_t leaves;                    // n = número de blocos (>= 1)
+    uint64_t length;                    // Tamanho dos dados em bytes
+    int height;                         // Níveis; level[height - 1][0] é a raiz
+    uint64_t count[MAX_LEVELS];         // Nós por nível
+    Hash256 *level[MAX_LEVELS];         // level[0] = folhas
+} MerkleTree;
+
+// Faixa [start, start + count) de blocos diferentes
+typedef struct {
+    uint64_t start;
+    uint64_t count;
+} MerkleRange;
+
+static void hash_leaf(const uint8_t *block, size_t len, Hash256 *out) {
+    static const uint8_t prefix = 0x00;
+    Sha256 ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, &prefix, 1);
+    sha256_update(&ctx, block, len);
+    sha256_final(&ctx, out->bytes);
+}
+
+static void hash_node(const Hash256 *left, const Hash256 *right, Hash256 *out) {
+    uint8_t buf[65];
+    buf[0] = 0x01;
+    memcpy(buf + 1, left->bytes, 32);
+    memcpy(buf + 33, right->bytes, 32);
+    sha256(buf, sizeof(buf), out->bytes);
+}
+
+// ==================== EXECUÇÃO EM PARALELO ====================
+
+typedef struct {
+    void (*work)(void *ctx, uint64_t begin, uint64_t end);
+    void *ctx;
+    uint64_t begin, end;
+} ParallelTask;
+
+static void* parallel_entry(void *arg) {
+    ParallelTask *t = (ParallelTask *)arg;
+    t->work(t->ctx, t->begin, t->end);
+    return NULL;
+}
+
+// Função para rodar work em 'threads' blocos contíguos de [0, total)
+static void run_parallel(void (*work)(void *, uint64_t, uint64_t), void *ctx, uint64_t total, int threads) {
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+    if (threads < 1 || total < (uint64_t)threads * 16) threads = 1;
+    pthread_t tid[MAX_THREADS];
+    ParallelTask tasks[MAX_THREADS];
+    bool started[MAX_THREADS] = { false };
+    for (int t = 0; t < threads; t++) {
+        tasks[t] = (ParallelTask){ work, ctx, total * t / threads, total * (t + 1) / threads };
+    }
+    // A thread atual faz o bloco 0; se pthread_create falhar, roda o bloco aqui
+    for (int t = 1; t < threads; t++) {
+        started[t] = pthread_create(&tid[t], NULL, parallel_entry, &tasks[t]) == 0;
+        if (!started[t]) parallel_entry(&tasks[t]);
+    }
+    parallel_entry(&tasks[0]);
+    for (int t = 1; t < threads; t++) {
+        if (started[t]) pthread_join(tid[t], NULL);
+    }
+}
+
+typedef struct {
+    const uint8_t *data;                // Primeiro bloco do lote
+    uint64_t data_length;               // Bytes disponíveis a partir de data
+    size_t block_size;
+    Hash256 *out;
+} LeafWork;
+
+static void leaf_range(void *arg, uint64_t begin, uint64_t end) {
+    LeafWork *w = (LeafWork *)arg;
+    for (uint64_t i = begin; i < end; i++) {
+        uint64_t offset = i * w->block_size;
+        uint64_t len = w->data_length - offset < w->block_size ? w->data_length - offset : w->block_size;
+        hash_leaf(w->data + offset, (size_t)len, &w->out[i]);
+    }
+}
+
+typedef struct {
+    const Hash256 *children;
+    uint64_t child_count;
+    Hash256 *parents;
+} LevelWork;
+
+static void level_range(void *arg, uint64_t begin, uint64_t end) {
+    LevelWork *w = (LevelWork *)arg;
+    for (uint64_t j = begin; j < end; j++) {
+        if (2 * j + 1 < w->child_count) hash_node(&w->children[2 * j], &w->children[2 * j + 1], &w->parents[j]);
+        else w->parents[j] = w->children[2 * j];        // Sem par: sobe igual
+    }
+}
+
+// Função para montar os níveis acima das folhas (já em level[0])
+static void build_levels(MerkleTree *t, int threads) {
+    int k = 0;
+    while (t->count[k] > 1) {
+        uint64_t parents = (t->count[k] + 1) / 2;
+        t->level[k + 1] = (Hash256 *)malloc(sizeof(Hash256) * parents);
+        t->count[k + 1] = parents;
+        LevelWork w = { t->level[k], t->count[k], t->level[k + 1] };
+        run_parallel(level_range, &w, parents, threads);
+        k++;
+    }
+    t->height = k + 1;
+}
+
+static MerkleTree* tree_alloc(size_t block_size, uint64_t length) {
+    MerkleTree *t = (MerkleTree *)calloc(1, sizeof(MerkleTree));
+    t->block_size = block_size;
+    t->length = length;
+    t->leaves = length == 0 ? 1 : (length + block_size - 1) / block_size;
+    t->count[0] = t->leaves;
+    t->level[0] = (Hash256 *)malloc(sizeof(Hash256) * t->leaves);
+    return t;
+}
+
+/**
+ * Constrói a árvore de um buffer em memória, hasheando as folhas com
+ * 'threads' threads. Dados vazios viram um único bloco vazio
+ */
+MerkleTree* merkle_tree_build(const uint8_t *data, uint64_t length, size_t block_size, int threads) {
+    if (block_size == 0) block_size = 4096;
+    MerkleTree *t = tree_alloc(block_size, length);
+    LeafWork w = { data, length, block_size, t->level[0] };
+    run_parallel(leaf_range, &w, t->leaves, threads);
+    build_levels(t, threads);
+    return t;
+}
+
+void merkle_tree_free(MerkleTree *t) {
+    for (int k = 0; k < t->height; k++) free(t->level[k]);
+    free(t);
+}
+
+const uint8_t* merkle_tree_root(const MerkleTree *t) {
+    return t->level[t->height - 1][0].bytes;
+}
+
+/**
+ * Substitui o conteúdo do bloco 'index' (len <= block_size; só o último
+ * bloco pode ser menor) e refaz o caminho até a raiz: O(log n)
+ */
+bool merkle_tree_update(MerkleTree *t, uint64_t index, const uint8_t *block, size_t len) {
+    if (index >= t->leaves || len > t->block_size) return false;
+    if (index + 1 < t->leaves && len != t->block_size) return false;
+    if (index + 1 == t->leaves) t->length = index * t->block_size + len;
+    hash_leaf(block, len, &t->level[0][index]);
+    uint64_t j = index;
+    for (int k = 0; k + 1 < t->height; k++) {
+        j /= 2;
+        const Hash256 *children = t->level[k];
+        if (2 * j + 1 < t->count[k]) hash_node(&children[2 * j], &children[2 * j + 1], &t->level[k + 1][j]);
+        else t->level[k + 1][j] = children[2 * j];
+    }
+    return true;
+}
+
+// ==================== CONSTRUÇÃO EM FLUXO ====================
+
+typedef struct {
+    size_t block_size;
+    int threads;
+    size_t batch_blocks;                // Blocos hasheados de uma vez
+    uint8_t *pending;                   // Lote em formação
+    size_t pending_bytes;
+    Hash256 *leaves;
+    uint64_t leaf_count, leaf_capacity;
+    uint64_t length;
+} MerkleBuilder;
+
+/**
+ * Cria um construtor em fluxo: os dados chegam em pedaços de qualquer
+ * tamanho, e cada lote de blocos é hasheado em paralelo
+ */
+MerkleBuilder* merkle_builder_create(size_t block_size, int threads) {
+    MerkleBuilder *b = (MerkleBuilder *)malloc(sizeof(MerkleBuilder));
+    b->block_size = block_size > 0 ? block_size : 4096;
+    b->threads = threads > 0 ? threads : 1;
+    b->batch_blocks = (4u << 20) / b->block_size;       // ~4 MiB por lote
+    if (b->batch_blocks < 64 * (size_t)b->threads) b->batch_blocks = 64 * (size_t)b->threads;
+    b->pending = (uint8_t *)malloc(b->batch_blocks * b->block_size);
+    b->pending_bytes = 0;
+    b->leaf_capacity = 1024;
+    b->leaves = (Hash256 *)malloc(sizeof(Hash256) * b->leaf_capacity);
+    b->leaf_count = 0;
+    b->length = 0;
+    return b;
+}
+
+// Função para hashear 'bytes' bytes (blocos inteiros, exceto no fim) como folhas
+static void builder_hash(MerkleBuilder *b, const uint8_t *data, uint64_t bytes) {
+    uint64_t blocks = (bytes + b->block_size - 1) / b->block_size;
+    if (b->leaf_count + blocks > b->leaf_capacity) {
+        while (b->leaf_count + blocks > b->leaf_capacity) b->leaf_capacity *= 2;
+        b->leaves = (Hash256 *)realloc(b->leaves, sizeof(Hash256) * b->leaf_capacity);
+    }
+    LeafWork w = { data, bytes, b->block_size, b->leaves + b->leaf_count };
+    run_parallel(leaf_range, &w, blocks, b->threads);
+    b->leaf_count += blocks;
+}
+
+void merkle_builder_update(MerkleBuilder *b, const uint8_t *data, size_t len) {
+    size_t batch_bytes = b->batch_blocks * b->block_size;
+    b->length += len;
+    while (len > 0) {
+        // Lote inteiro disponível na entrada: hasheia direto, sem copiar
+        if (b->pending_bytes == 0 && len >= batch_bytes) {
+            builder_hash(b, data, batch_bytes);
+            data += batch_bytes;
+            len -= batch_bytes;
+            continue;
+        }
+        size_t take = batch_bytes - b->pending_bytes < len ? batch_bytes - b->pending_bytes : len;
+        memcpy(b->pending + b->pending_bytes, data, take);
+        b->pending_bytes += take;
+        data += take;
+        len -= take;
+        if (b->pending_bytes == batch_bytes) {
+            builder_hash(b, b->pending, batch_bytes);
+            b->pending_bytes = 0;
+        }
+    }
+}
+
+// Termina a construção (o último bloco pode ser parcial) e libera o construtor
+MerkleTree* merkle_builder_finish(MerkleBuilder *b) {
+    if (b->pending_bytes > 0 || b->leaf_count == 0) builder_hash(b, b->pending, b->pending_bytes);
+    if (b->leaf_count == 0) {                           // Fluxo vazio: um bloco vazio
+        hash_leaf(NULL, 0, &b->leaves[0]);
+        b->leaf_count = 1;
+    }
+    MerkleTree *t = (MerkleTree *)calloc(1, sizeof(MerkleTree));
+    t->block_size = b->block_size;
+    t->length = b->length;
+    t->leaves = b->leaf_count;
+    t->count[0] = b->leaf_count;
+    t->level[0] = (Hash256 *)realloc(b->leaves, sizeof(Hash256) * b->leaf_count);
+    build_levels(t, b->threads);
+    free(b->pending);
+    free(b);
+    return t;
+}
+
+// ==================== DIFERENÇA ENTRE ÁRVORES ====================
+
+typedef struct {
+    const MerkleTree *a, *b;
+    uint64_t total;                     // max(n_a, n_b)
+    MerkleRange *out;
+    size_t cap, ranges;
+    uint64_t compared;                  // Nós comparados (hashes trocados)
+} DiffState;
+
+static const Hash256* tree_node(const MerkleTree *t, int k, uint64_t j) {
+    return k < t->height && j < t->count[k] ? &t->level[k][j] : NULL;
+}
+
+// Função para registrar [start, end), emendando com a faixa anterior
+static void diff_emit(DiffState *st, uint64_t start, uint64_t end) {
+    if (st->ranges > 0 && st->ranges <= st->cap) {
+        MerkleRange *last = &st->out[st->ranges - 1];
+        if (last->start + last->count == start) {
+            last->count += end - start;
+            return;
+        }
+    }
+    if (st->ranges < st->cap) st->out[st->ranges] = (MerkleRange){ start, end - start };
+    st->ranges++;
+}
+
+static void diff_node(DiffState *st, int k, uint64_t j) {
+    uint64_t start = j << k;
+    if (start >= st->total) return;
+    uint64_t end = (j + 1) << k;
+    if (end > st->total) end = st->total;
+
+    // Uma das árvores não tem blocos nesta faixa: tudo difere, sem descer
+    if (start >= st->a->leaves || start >= st->b->leaves) {
+        diff_emit(st, start, end);
+        return;
+    }
+    const Hash256 *ha = tree_node(st->a, k, j);
+    const Hash256 *hb = tree_node(st->b, k, j);
+    if (ha != NULL && hb != NULL) {
+        st->compared++;
+        if (memcmp(ha->bytes, hb->bytes, 32) == 0) return;
+        if (k == 0) {
+            diff_emit(st, start, end);
+            return;
+        }
+    }
+    diff_node(st, k - 1, 2 * j);
+    diff_node(st, k - 1, 2 * j + 1);
+}
+
+/**
+ * Compara duas árvores (mesmo tamanho de bloco) e escreve em out as faixas
+ * de blocos diferentes, em ordem e já emendadas. Retorna o número de
+ * faixas (só as primeiras 'cap' são escritas); *compared recebe quantos
+ * nós foram comparados, isto é, quantos hashes uma réplica teria que
+ * mandar para a outra
+ */
+size_t merkle_tree_diff(const MerkleTree *a, const MerkleTree *b, MerkleRange *out, size_t cap, uint64_t *compared) {
+    DiffState st = { a, b, a->leaves > b->leaves ? a->leaves : b->leaves, out, cap, 0, 0 };
+    if (a->block_size != b->block_size) {
+        diff_emit(&st, 0, st.total);
+    } else {
+        int top = a->height > b->height ? a->height : b->height;
+        diff_node(&st, top - 1, 0);
+    }
+    if (compared != NULL) *compared = st.compared;
+    return st.ranges;
+}
+
+// ==================== ÁRVORE DO MATERIAL ====================
+
+// Mesmo algoritmo de docs/algoritmos-avancados/10-merke-three (versão em
+// C): hashes como strings hex, concatenação com malloc, último nó
+// duplicado, recursão por nível. O SHA-256 é o deste arquivo, no lugar do
+// OpenSSL
+#define HASH_LENGTH 65
+
+static void sha256_hex(const uint8_t *data, size_t len, char output[HASH_LENGTH]) {
+    uint8_t hash[32];
+    sha256(data, len, hash);
+    for (int i = 0; i < 32; i++) sprintf(output + (i * 2), "%02x", hash[i]);
+    output[64] = '\0';
+}
+
+static char* concat_hash(const char *a, const char *b) {
+    char *concat = (char *)malloc(strlen(a) + strlen(b) + 1);
+    strcpy(concat, a);
+    strcat(concat, b);
+    return concat;
+}
+
+static char* build_merkle_tree(char **hashes, int n) {
+    if (n == 1) {
+        char *copy = (char *)malloc(HASH_LENGTH);
+        strcpy(copy, hashes[0]);
+        return copy;
+    }
+    int next_level = (n + 1) / 2;
+    char **parent_hashes = (char **)malloc(next_level * sizeof(char *));
+    for (int i = 0; i < n; i += 2) {
+        char *left = hashes[i];
+        char *right = (i + 1 < n) ? hashes[i + 1] : hashes[i];     // Duplicar último se necessário
+        char *combined = concat_hash(left, right);
+        parent_hashes[i / 2] = (char *)malloc(HASH_LENGTH);
+        sha256_hex((const uint8_t *)combined, strlen(combined), parent_hashes[i / 2]);
+        free(combined);
+    }
+    char *result = build_merkle_tree(parent_hashes, next_level);
+    for (int i = 0; i < next_level; i++) free(parent_hashes[i]);
+    free(parent_hashes);
+    return result;
+}
+
+// ==================== TESTES ====================
+
+static uint64_t rng_state = 88172645463325252ULL;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void fill_random(uint8_t *data, uint64_t len) {
+    uint64_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t r = next_random();
+        memcpy(data + i, &r, 8);
+    }
+    for (; i < len; i++) data[i] = (uint8_t)next_random();
+}
+
+static void to_hex(const uint8_t *hash, char out[65]) {
+    for (int i = 0; i < 32; i++) sprintf(out + 2 * i, "%02x", hash[i]);
+    out[64] = '\0';
+}
+
+void testar_sha256(void) {
+    printf("=== TESTE: SHA-256 (vetores do NIST) ===\n\n");
+
+    static const char *inputs[] = {
+        "", "abc", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"
+    };
+    static const char *expected[] = {
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+        "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+    };
+    static const char *million_a = "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0";
+    uint8_t *a = (uint8_t *)malloc(1000000);
+    memset(a, 'a', 1000000);
+
+    bool ok = true;
+    bool has_shani = sha256_use_shani(true);
+    for (int impl = 0; impl < (has_shani ? 2 : 1); impl++) {
+        sha256_use_shani(impl == 1);
+        uint8_t hash[32];
+        char hex[65];
+        for (int i = 0; i < 3; i++) {
+            sha256(inputs[i], strlen(inputs[i]), hash);
+            to_hex(hash, hex);
+            ok = ok && strcmp(hex, expected[i]) == 0;
+        }
+        // Um milhão de 'a' em pedaços irregulares (testa o buffer interno)
+        Sha256 ctx;
+        sha256_init(&ctx);
+        for (size_t done = 0; done < 1000000;) {
+            size_t step = 1 + next_random() % 300;
+            if (step > 1000000 - done) step = 1000000 - done;
+            sha256_update(&ctx, a + done, step);
+            done += step;
+        }
+        sha256_final(&ctx, hash);
+        to_hex(hash, hex);
+        ok = ok && strcmp(hex, million_a) == 0;
+        printf("%-10s \"abc\" e 1M de 'a': %s\n", impl == 1 ? "SHA-NI" : "portátil",
+               ok ? "iguais aos vetores" : "DIFERENTES");
+    }
+    if (!has_shani) printf("SHA-NI indisponível: só o caminho portátil\n");
+    sha256_use_shani(true);
+    free(a);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// Raiz pela definição recursiva da RFC 6962: k = maior potência de 2 < n
+static void reference_root(const Hash256 *leaves, uint64_t n, Hash256 *out) {
+    if (n == 1) {
+        *out = leaves[0];
+        return;
+    }
+    uint64_t k = 1;
+    while (2 * k < n) k *= 2;
+    Hash256 left, right;
+    reference_root(leaves, k, &left);
+    reference_root(leaves + k, n - k, &right);
+    hash_node(&left, &right, out);
+}
+
+void testar_construcao(void) {
+    printf("=== TESTE: CONSTRUÇÃO EM BLOCO, EM FLUXO E RFC 6962 ===\n\n");
+
+    const size_t bs = 256;
+    const uint64_t lengths[] = { 0, 1, bs - 1, bs, bs + 1, 3 * bs, 5 * bs + 7, 1000 * bs, 4097 * bs + 3, 10000 * bs };
+    uint8_t *data = (uint8_t *)malloc(10000 * bs);
+    fill_random(data, 10000 * bs);
+    bool ok = true;
+
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        uint64_t len = lengths[i];
+        MerkleTree *whole = merkle_tree_build(data, len, bs, 1);
+        MerkleTree *parallel = merkle_tree_build(data, len, bs, 4);
+
+        // Em fluxo, com pedaços de tamanho aleatório
+        MerkleBuilder *b = merkle_builder_create(bs, 3);
+        for (uint64_t done = 0; done < len;) {
+            uint64_t step = 1 + next_random() % (3 * bs + 1000);
+            if (step > len - done) step = len - done;
+            merkle_builder_update(b, data + done, (size_t)step);
+            done += step;
+        }
+        MerkleTree *streamed = merkle_builder_finish(b);
+
+        Hash256 ref;
+        reference_root(whole->level[0], whole->leaves, &ref);
+        ok = ok && memcmp(merkle_tree_root(whole), ref.bytes, 32) == 0
+                && memcmp(merkle_tree_root(parallel), ref.bytes, 32) == 0
+                && memcmp(merkle_tree_root(streamed), ref.bytes, 32) == 0
+                && streamed->leaves == whole->leaves && streamed->length == len;
+        merkle_tree_free(whole);
+        merkle_tree_free(parallel);
+        merkle_tree_free(streamed);
+    }
+    printf("%zu tamanhos (0 a 10000 blocos): 1 thread, 4 threads e em fluxo\n",
+           sizeof(lengths) / sizeof(lengths[0]));
+    printf("Raízes iguais entre si e à definição recursiva da RFC 6962: %s\n", ok ? "sim" : "NÃO");
+
+    // O material duplica o último nó: [a, b, c] e [a, b, c, c] colidem
+    uint8_t blocks[4][4] = { "aaa", "bbb", "ccc", "ccc" };
+    char *hex[4];
+    for (int i = 0; i < 4; i++) {
+        hex[i] = (char *)malloc(HASH_LENGTH);
+        sha256_hex(blocks[i], 3, hex[i]);
+    }
+    char *root3 = build_merkle_tree(hex, 3);
+    char *root4 = build_merkle_tree(hex, 4);
+    MerkleTree *t3 = merkle_tree_build(&blocks[0][0], 3 * 4, 4, 1);
+    MerkleTree *t4 = merkle_tree_build(&blocks[0][0], 4 * 4, 4, 1);
+    bool material_collides = strcmp(root3, root4) == 0;
+    bool rfc_distinct = memcmp(merkle_tree_root(t3), merkle_tree_root(t4), 32) != 0;
+    printf("3 e 4 blocos (último repetido): material %s, RFC 6962 %s\n",
+           material_collides ? "dá a mesma raiz" : "distingue", rfc_distinct ? "distingue" : "dá a mesma raiz");
+    ok = ok && rfc_distinct;
+    for (int i = 0; i < 4; i++) free(hex[i]);
+    free(root3);
+    free(root4);
+    merkle_tree_free(t3);
+    merkle_tree_free(t4);
+    free(data);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+void testar_atualizacao_e_diff(void) {
+    printf("=== TESTE: ATUALIZAÇÃO O(log n) E DIFERENÇA ===\n\n");
+
+    const size_t bs = 128;
+    const uint64_t n = 3000;
+    uint8_t *a = (uint8_t *)malloc(n * bs);
+    uint8_t *b = (uint8_t *)malloc((n + 500) * bs);
+    fill_random(a, n * bs);
+    bool ok = true;
+    int rounds = 0;
+
+    for (int round = 0; round < 40; round++) {
+        // Réplica b: tamanho n - 500 a n + 500, alguns blocos trocados
+        uint64_t nb = n - 500 + next_random() % 1001;
+        memcpy(b, a, (nb < n ? nb : n) * bs);
+        if (nb > n) fill_random(b + n * bs, (nb - n) * bs);
+        MerkleTree *ta = merkle_tree_build(a, n * bs, bs, 2);
+        MerkleTree *tb = merkle_tree_build(b, nb * bs, bs, 2);
+        // As trocas entram por update; a reconstrução serve de referência
+        int changes = (int)(next_random() % 50);
+        for (int c = 0; c < changes; c++) {
+            uint64_t i = next_random() % nb;
+            fill_random(b + i * bs, bs);
+            ok = ok && merkle_tree_update(tb, i, b + i * bs, bs);
+        }
+        MerkleTree *rebuilt = merkle_tree_build(b, nb * bs, bs, 1);
+        ok = ok && memcmp(merkle_tree_root(tb), merkle_tree_root(rebuilt), 32) == 0;
+
+        // Diferença contra a comparação bloco a bloco
+        MerkleRange ranges[256];
+        uint64_t compared;
+        size_t count = merkle_tree_diff(ta, tb, ranges, 256, &compared);
+        bool *differs = (bool *)calloc(n + 500, sizeof(bool));
+        for (size_t r = 0; r < count && r < 256; r++) {
+            for (uint64_t i = ranges[r].start; i < ranges[r].start + ranges[r].count; i++) differs[i] = true;
+        }
+        uint64_t total = nb > n ? nb : n;
+        for (uint64_t i = 0; i < total; i++) {
+            bool expect = i >= n || i >= nb || memcmp(a + i * bs, b + i * bs, bs) != 0;
+            ok = ok && differs[i] == expect;
+        }
+        ok = ok && count <= 256;
+        rounds++;
+        free(differs);
+        merkle_tree_free(ta);
+        merkle_tree_free(tb);
+        merkle_tree_free(rebuilt);
+    }
+    printf("%d rodadas: réplicas de 2500 a 3500 blocos, até 50 blocos trocados\n", rounds);
+    printf("Atualização igual à reconstrução e faixas iguais à comparação bloco a bloco: %s\n",
+           ok ? "sim" : "NÃO");
+    free(a);
+    free(b);
+    printf("Verificação: %s\n\n", ok ? "OK" : "FALHA");
+}
+
+// ==================== BENCHMARK ====================
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void benchmark(uint64_t megabytes, size_t block_size, int max_threads) {
+    uint64_t length = megabytes << 20;
+    uint64_t n = (length + block_size - 1) / block_size;
+    printf("=== BENCHMARK: %llu MiB, blocos de %zu bytes (%llu folhas) ===\n\n",
+           (unsigned long long)megabytes, block_size, (unsigned long long)n);
+
+    uint8_t *data = (uint8_t *)malloc(length);
+    if (data == NULL) {
+        printf("Memória insuficiente\n\n");
+        return;
+    }
+    fill_random(data, length);
+    bool has_shani = sha256_use_shani(true);
+
+    printf("%-42s %10s %10s\n", "Construção", "tempo (s)", "MiB/s");
+    // Material: hex + malloc por nó
+    sha256_use_shani(has_shani);
+    double start = now_seconds();
+    char **hex = (char **)malloc(sizeof(char *) * n);
+    for (uint64_t i = 0; i < n; i++) {
+        hex[i] = (char *)malloc(HASH_LENGTH);
+        uint64_t len = length - i * block_size < block_size ? length - i * block_size : block_size;
+        sha256_hex(data + i * block_size, (size_t)len, hex[i]);
+    }
+    char *root = build_merkle_tree(hex, (int)n);
+    double t = now_seconds() - start;
+    printf("%-42s %10.3f %10.0f\n", "material (hex, malloc por nó)", t, megabytes / t);
+    for (uint64_t i = 0; i < n; i++) free(hex[i]);
+    free(hex);
+    free(root);
+
+    uint8_t reference[32];
+    bool same = true;
+    for (int impl = 0; impl < (has_shani ? 2 : 1); impl++) {
+        sha256_use_shani(impl == 1);
+        for (int threads = 1; threads <= max_threads; threads *= 2) {
+            if (impl == 0 && threads > 1) break;
+            start = now_seconds();
+            MerkleTree *tree = merkle_tree_build(data, length, block_size, threads);
+            t = now_seconds() - start;
+            if (impl == 0) memcpy(reference, merkle_tree_root(tree), 32);
+            same = same && memcmp(reference, merkle_tree_root(tree), 32) == 0;
+            char name[64];
+            snprintf(name, sizeof(name), "merkle_tree_build, %s, %d thread(s)", impl == 1 ? "SHA-NI" : "portátil", threads);
+            printf("%-42s %10.3f %10.0f\n", name, t, megabytes / t);
+            merkle_tree_free(tree);
+        }
+    }
+    // Em fluxo, pedaços de 64 KiB
+    start = now_seconds();
+    MerkleBuilder *b = merkle_builder_create(block_size, max_threads);
+    for (uint64_t done = 0; done < length; done += 65536) {
+        merkle_builder_update(b, data + done, (size_t)(length - done < 65536 ? length - done : 65536));
+    }
+    MerkleTree *tree = merkle_builder_finish(b);
+    t = now_seconds() - start;
+    same = same && memcmp(reference, merkle_tree_root(tree), 32) == 0;
+    char name[64];
+    snprintf(name, sizeof(name), "em fluxo (64 KiB), %d thread(s)", max_threads);
+    printf("%-42s %10.3f %10.0f\n", name, t, megabytes / t);
+    printf("Mesma raiz em todas as versões: %s\n\n", same ? "sim" : "NÃO");
+
+    // Atualizações e diferença sorteiam entre os n - 1 blocos completos
+    if (n < 2) {
+        printf("Um só bloco: sem atualizações nem diferença para medir\n\n");
+        merkle_tree_free(tree);
+        free(data);
+        sha256_use_shani(true);
+        return;
+    }
+
+    // Atualizações
+    const int updates = 100000;
+    uint8_t *block = (uint8_t *)malloc(block_size);
+    start = now_seconds();
+    for (int u = 0; u < updates; u++) {
+        uint64_t i = next_random() % (n - 1);
+        fill_random(block, 16);
+        memcpy(data + i * block_size, block, 16);
+        merkle_tree_update(tree, i, data + i * block_size, block_size);
+    }
+    t = now_seconds() - start;
+    MerkleTree *rebuilt = merkle_tree_build(data, length, block_size, 1);
+    printf("Atualização de um bloco: %.2f µs (altura %d), igual à reconstrução: %s\n\n",
+           t / updates * 1e6, tree->height,
+           memcmp(merkle_tree_root(tree), merkle_tree_root(rebuilt), 32) == 0 ? "sim" : "NÃO");
+    merkle_tree_free(rebuilt);
+
+    // Diferença: réplica com d blocos trocados
+    printf("%-14s %8s %12s %14s %16s\n", "Blocos trocados", "faixas", "tempo (µs)", "hashes trocados", "lista de folhas");
+    const int changed[] = { 1, 10, 100, 1000, 10000 };
+    MerkleRange *ranges = (MerkleRange *)malloc(sizeof(MerkleRange) * 20000);
+    for (size_t c = 0; c < sizeof(changed) / sizeof(changed[0]); c++) {
+        if ((uint64_t)changed[c] > n) break;
+        MerkleTree *replica = merkle_tree_build(data, length, block_size, max_threads);
+        for (int k = 0; k < changed[c]; k++) {
+            uint64_t i = next_random() % (n - 1);
+            memcpy(block, data + i * block_size, block_size);
+            block[0] ^= 0xFF;
+            merkle_tree_update(replica, i, block, block_size);
+        }
+        uint64_t compared;
+        start = now_seconds();
+        size_t count = merkle_tree_diff(tree, replica, ranges, 20000, &compared);
+        t = now_seconds() - start;
+        printf("%-14d %8zu %12.1f %14llu %16llu\n", changed[c], count, t * 1e6,
+               (unsigned long long)compared, (unsigned long long)n);
+        merkle_tree_free(replica);
+    }
+    printf("\n");
+    free(ranges);
+    free(block);
+    merkle_tree_free(tree);
+    free(data);
+    sha256_use_shani(true);
+}
+
+// Exemplo de uso
+int main(int argc, char *argv[]) {
+    printf("╔══════════════════════════════════════════════════════════╗\n");
+    printf("║             MERKLE TREE                                  ║\n");
+    printf("║   Construção em fluxo, atualização O(log n), diferença   ║\n");
+    printf("╚══════════════════════════════════════════════════════════╝\n\n");
+
+    long megabytes = (argc > 1) ? atol(argv[1]) : 256;
+    long block_size = (argc > 2) ? atol(argv[2]) : 4096;
+    int max_threads = (argc > 3) ? atoi(argv[3]) : 4;
+    if (megabytes < 1) megabytes = 1;
+    if (block_size < 64) block_size = 64;
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > MAX_THREADS) max_threads = MAX_THREADS;
+
+    sha256_use_shani(true);
+    testar_sha256();
+    testar_construcao();
+    testar_atualizacao_e_diff();
+    benchmark((uint64_t)megabytes, (size_t)block_size, max_threads);
+
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("Propriedades da Merkle Tree:\n");
+    printf("- Raiz igual <=> dados iguais (salvo colisão de SHA-256)\n");
+    printf("- Atualizar um bloco refaz só o caminho até a raiz: O(log n)\n");
+    printf("- Diferença: desce só pelos nós diferentes, O(d log n)\n");
+    printf("- Folhas independentes: hash em paralelo por lotes\n");
+    printf("═══════════════════════════════════════════════════════════\n");
+
+    return 0;
+}